@@ -126,7 +126,7 @@ TEST (active_transactions, adjusted_multiplier_priority)
 	{
 		futurehead::lock_guard<std::mutex> active_guard (node1.active.mutex);
 		node1.active.update_adjusted_multiplier ();
-		ASSERT_EQ (node1.active.roots.get<1> ().begin ()->election->status.winner->hash (), send1->hash ());
+		ASSERT_EQ (node1.active.roots.top (1).front ()->election->status.winner->hash (), send1->hash ());
 		ASSERT_LT (node1.active.roots.find (send2->qualified_root ())->adjusted_multiplier, node1.active.roots.find (send1->qualified_root ())->adjusted_multiplier);
 		ASSERT_LT (node1.active.roots.find (open1->qualified_root ())->adjusted_multiplier, node1.active.roots.find (send1->qualified_root ())->adjusted_multiplier);
 		ASSERT_LT (node1.active.roots.find (open2->qualified_root ())->adjusted_multiplier, node1.active.roots.find (send2->qualified_root ())->adjusted_multiplier);
@@ -175,14 +175,14 @@ TEST (active_transactions, adjusted_multiplier_priority)
 	futurehead::lock_guard<std::mutex> lock (node1.active.mutex);
 	node1.active.update_adjusted_multiplier ();
 	double last_adjusted (0.0);
-	for (auto i (node1.active.roots.get<1> ().begin ()), n (node1.active.roots.get<1> ().end ()); i != n; ++i)
+	for (auto info : node1.active.roots.top ())
 	{
 		//first root has nothing to compare
 		if (last_adjusted != 0.0)
 		{
-			ASSERT_LE (i->adjusted_multiplier, last_adjusted);
+			ASSERT_LE (info->adjusted_multiplier, last_adjusted);
 		}
-		last_adjusted = i->adjusted_multiplier;
+		last_adjusted = info->adjusted_multiplier;
 	}
 	ASSERT_LT (node1.active.roots.find (send4->qualified_root ())->adjusted_multiplier, node1.active.roots.find (send3->qualified_root ())->adjusted_multiplier);
 	ASSERT_LT (node1.active.roots.find (send6->qualified_root ())->adjusted_multiplier, node1.active.roots.find (send5->qualified_root ())->adjusted_multiplier);
@@ -303,14 +303,12 @@ TEST (active_transactions, prioritize_chains)
 	{
 		futurehead::lock_guard<std::mutex> active_guard (node1.active.mutex);
 		node1.active.update_adjusted_multiplier ();
-		auto it (node1.active.roots.get<1> ().begin ());
-		while (!node1.active.roots.empty () && it != node1.active.roots.get<1> ().end ())
+		for (auto const & info : node1.active.roots)
 		{
-			if (it->multiplier == multiplier1 || it->multiplier == multiplier2)
+			if (info.multiplier == multiplier1 || info.multiplier == multiplier2)
 			{
 				seen++;
 			}
-			it++;
 		}
 	}
 	ASSERT_LT (seen, 2);
@@ -1269,3 +1267,59 @@ TEST (active_transactions, activate_account_chain)
 	ASSERT_TIMELY (3s, node.block_confirmed (send3->hash ()));
 	ASSERT_TIMELY (3s, node.active.active (receive->qualified_root ()));
 }
+
+TEST (prioritized_roots, ordering)
+{
+	futurehead::prioritized_roots roots;
+	auto root = [](uint64_t root_a) {
+		return futurehead::qualified_root (futurehead::block_hash (root_a), futurehead::block_hash (root_a));
+	};
+	auto info = [&root](uint64_t root_a, double multiplier_a) {
+		return futurehead::conflict_info{ root (root_a), multiplier_a, multiplier_a, nullptr, futurehead::epoch::epoch_0, 0 };
+	};
+	ASSERT_TRUE (roots.insert (info (1, 1.0)).second);
+	ASSERT_TRUE (roots.insert (info (2, 4.0)).second);
+	ASSERT_TRUE (roots.insert (info (3, 1.0)).second);
+	ASSERT_TRUE (roots.insert (info (4, 1.01)).second);
+	ASSERT_TRUE (roots.insert (info (5, 1000.0)).second);
+	ASSERT_FALSE (roots.insert (info (5, 2.0)).second);
+	ASSERT_EQ (5, roots.size ());
+	ASSERT_EQ (1000.0, roots.find (root (5))->multiplier);
+
+	auto top = [&roots](size_t count_a) {
+		std::vector<futurehead::qualified_root> result;
+		for (auto info : roots.top (count_a))
+		{
+			result.push_back (info->root);
+		}
+		return result;
+	};
+	auto expected = [&root](std::vector<uint64_t> const & roots_a) {
+		std::vector<futurehead::qualified_root> result;
+		for (auto root_l : roots_a)
+		{
+			result.push_back (root (root_l));
+		}
+		return result;
+	};
+	// Equal multipliers keep insertion order
+	ASSERT_EQ (expected ({ 5, 2, 4, 1, 3 }), top (5));
+	ASSERT_EQ (expected ({ 5, 2 }), top (2));
+
+	// Within the same bucket and moving to another bucket
+	roots.adjusted_multiplier_set (roots.find (root (1)), 1.02);
+	roots.adjusted_multiplier_set (roots.find (root (5)), 1.5);
+	ASSERT_EQ (expected ({ 2, 5, 1, 4, 3 }), top (5));
+	ASSERT_EQ (1000.0, roots.find (root (5))->multiplier);
+	roots.multiplier_set (roots.find (root (5)), 2.0);
+	ASSERT_EQ (2.0, roots.find (root (5))->multiplier);
+	ASSERT_EQ (1.5, roots.find (root (5))->adjusted_multiplier);
+
+	roots.erase (roots.find (root (2)));
+	roots.erase (roots.find (root (4)));
+	ASSERT_EQ (roots.end (), roots.find (root (2)));
+	ASSERT_EQ (expected ({ 5, 1, 3 }), top (5));
+	roots.clear ();
+	ASSERT_TRUE (roots.empty ());
+	ASSERT_TRUE (roots.top ().empty ());
+}
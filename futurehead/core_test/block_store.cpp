@@ -275,6 +275,31 @@ TEST (block_store, pending_iterator)
 	ASSERT_EQ (futurehead::epoch::epoch_1, pending.epoch);
 }
 
+TEST (block_store, pending_totals)
+{
+	futurehead::logger_mt logger;
+	auto store = futurehead::make_store (logger, futurehead::unique_path ());
+	ASSERT_TRUE (!store->init_error ());
+	auto transaction (store->tx_begin_write ());
+	futurehead::account account (1);
+	futurehead::pending_totals totals;
+	ASSERT_TRUE (store->pending_totals_get (transaction, account, totals));
+	store->pending_put (transaction, futurehead::pending_key (account, 2), { 2, 3, futurehead::epoch::epoch_0 });
+	store->pending_put (transaction, futurehead::pending_key (account, 3), { 2, 5, futurehead::epoch::epoch_1 });
+	ASSERT_FALSE (store->pending_totals_get (transaction, account, totals));
+	ASSERT_EQ (futurehead::pending_totals (8, 2), totals);
+	// Overwriting an entry replaces its amount
+	store->pending_put (transaction, futurehead::pending_key (account, 3), { 2, 6, futurehead::epoch::epoch_1 });
+	ASSERT_FALSE (store->pending_totals_get (transaction, account, totals));
+	ASSERT_EQ (futurehead::pending_totals (9, 2), totals);
+	store->pending_del (transaction, futurehead::pending_key (account, 2));
+	ASSERT_FALSE (store->pending_totals_get (transaction, account, totals));
+	ASSERT_EQ (futurehead::pending_totals (6, 1), totals);
+	store->pending_del (transaction, futurehead::pending_key (account, 3));
+	ASSERT_TRUE (store->pending_totals_get (transaction, account, totals));
+	ASSERT_EQ (store->pending_totals_end (), store->pending_totals_begin (transaction));
+}
+
 /**
  * Regression test for Issue 1164
  * This reconstructs the situation where a key is larger in pending than the account being iterated in pending_v1, leaving
@@ -2035,6 +2060,173 @@ TEST (mdb_block_store, upgrade_v17_v18)
 	ASSERT_LT (17, store.version_get (transaction));
 }
 
+TEST (mdb_block_store, upgrade_v17_v18_cached)
+{
+	auto path (futurehead::unique_path ());
+	futurehead::genesis genesis;
+	futurehead::work_pool pool (std::numeric_limits<unsigned>::max ());
+	futurehead::state_block state_send (futurehead::test_genesis_key.pub, genesis.hash (), futurehead::test_genesis_key.pub, futurehead::genesis_amount - futurehead::Gxrb_ratio, futurehead::test_genesis_key.pub, futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub, *pool.generate (genesis.hash ()));
+	futurehead::state_block state_receive (futurehead::test_genesis_key.pub, state_send.hash (), futurehead::test_genesis_key.pub, futurehead::genesis_amount, state_send.hash (), futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub, *pool.generate (state_send.hash ()));
+	{
+		futurehead::logger_mt logger;
+		futurehead::mdb_store store (logger, path);
+		auto transaction (store.tx_begin_write ());
+		futurehead::stat stats;
+		futurehead::ledger ledger (store, stats);
+		store.initialize (transaction, genesis, ledger.cache);
+		ASSERT_EQ (futurehead::process_result::progress, ledger.process (transaction, state_send).code);
+		ASSERT_EQ (futurehead::process_result::progress, ledger.process (transaction, state_receive).code);
+		store.version_put (transaction, 17);
+		write_sideband_v15 (store, transaction, state_send);
+		write_sideband_v15 (store, transaction, state_receive);
+	}
+	// The upgrade reads state_send as the previous block of state_receive, the second round is answered by the block cache
+	futurehead::logger_mt logger;
+	futurehead::mdb_store store (logger, path);
+	ASSERT_FALSE (store.init_error ());
+	for (auto i (0); i < 2; ++i)
+	{
+		auto transaction (store.tx_begin_read ());
+		auto send (store.block_get (transaction, state_send.hash ()));
+		ASSERT_NE (nullptr, send);
+		ASSERT_TRUE (send->sideband ().details.is_send);
+		ASSERT_FALSE (send->sideband ().details.is_receive);
+		auto receive (store.block_get (transaction, state_receive.hash ()));
+		ASSERT_NE (nullptr, receive);
+		ASSERT_FALSE (receive->sideband ().details.is_send);
+		ASSERT_TRUE (receive->sideband ().details.is_receive);
+	}
+}
+
+TEST (mdb_block_store, upgrade_v18_v19)
+{
+	auto path (futurehead::unique_path ());
+	futurehead::genesis genesis;
+	{
+		futurehead::logger_mt logger;
+		futurehead::mdb_store store (logger, path);
+		futurehead::stat stats;
+		futurehead::ledger ledger (store, stats);
+		auto transaction (store.tx_begin_write ());
+		store.initialize (transaction, genesis, ledger.cache);
+		ASSERT_EQ (0, mdb_drop (store.env.tx (transaction), store.pruned, 1));
+		store.version_put (transaction, 18);
+	}
+	// Upgrading creates the pruned table
+	futurehead::logger_mt logger;
+	futurehead::mdb_store store (logger, path);
+	ASSERT_FALSE (store.init_error ());
+	auto transaction (store.tx_begin_write ());
+	ASSERT_LT (18, store.version_get (transaction));
+	ASSERT_EQ (0, store.pruned_count (transaction));
+	futurehead::block_hash hash (1);
+	store.pruned_put (transaction, hash);
+	ASSERT_TRUE (store.pruned_exists (transaction, hash));
+	ASSERT_EQ (1, store.pruned_count (transaction));
+	ASSERT_EQ (hash, store.pruned_begin (transaction)->first);
+	store.pruned_del (transaction, hash);
+	ASSERT_FALSE (store.pruned_exists (transaction, hash));
+	ASSERT_EQ (0, store.pruned_count (transaction));
+}
+
+TEST (mdb_block_store, upgrade_v19_v20)
+{
+	auto path (futurehead::unique_path ());
+	futurehead::genesis genesis;
+	futurehead::keypair key1;
+	futurehead::work_pool pool (std::numeric_limits<unsigned>::max ());
+	futurehead::send_block send (genesis.hash (), key1.pub, futurehead::genesis_amount - 100, futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub, *pool.generate (genesis.hash ()));
+	futurehead::open_block open (send.hash (), key1.pub, key1.pub, key1.prv, key1.pub, *pool.generate (key1.pub));
+	{
+		futurehead::logger_mt logger;
+		futurehead::mdb_store store (logger, path);
+		futurehead::stat stats;
+		futurehead::ledger ledger (store, stats);
+		auto transaction (store.tx_begin_write ());
+		store.initialize (transaction, genesis, ledger.cache);
+		ASSERT_EQ (futurehead::process_result::progress, ledger.process (transaction, send).code);
+		ASSERT_EQ (futurehead::process_result::progress, ledger.process (transaction, open).code);
+		ASSERT_EQ (0, mdb_drop (store.env.tx (transaction), store.delegators, 1));
+		store.version_put (transaction, 19);
+	}
+	// Upgrading indexes the representative of every account
+	futurehead::logger_mt logger;
+	futurehead::mdb_store store (logger, path);
+	ASSERT_FALSE (store.init_error ());
+	auto transaction (store.tx_begin_read ());
+	ASSERT_LT (19, store.version_get (transaction));
+	ASSERT_EQ (2, store.count (transaction, store.delegators));
+	ASSERT_TRUE (store.delegator_exists (transaction, futurehead::genesis_account, futurehead::genesis_account));
+	ASSERT_TRUE (store.delegator_exists (transaction, key1.pub, key1.pub));
+}
+
+TEST (mdb_block_store, upgrade_resume)
+{
+	auto path (futurehead::unique_path ());
+	futurehead::genesis genesis;
+	futurehead::keypair key1;
+	futurehead::work_pool pool (std::numeric_limits<unsigned>::max ());
+	futurehead::send_block send (genesis.hash (), key1.pub, futurehead::genesis_amount - 100, futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub, *pool.generate (genesis.hash ()));
+	futurehead::open_block open (send.hash (), key1.pub, key1.pub, key1.prv, key1.pub, *pool.generate (key1.pub));
+	auto first (std::min (futurehead::genesis_account, key1.pub));
+	auto second (std::max (futurehead::genesis_account, key1.pub));
+	{
+		futurehead::logger_mt logger;
+		futurehead::mdb_store store (logger, path);
+		futurehead::stat stats;
+		futurehead::ledger ledger (store, stats);
+		auto transaction (store.tx_begin_write ());
+		store.initialize (transaction, genesis, ledger.cache);
+		ASSERT_EQ (futurehead::process_result::progress, ledger.process (transaction, send).code);
+		ASSERT_EQ (futurehead::process_result::progress, ledger.process (transaction, open).code);
+		ASSERT_EQ (0, mdb_drop (store.env.tx (transaction), store.delegators, 1));
+		store.version_put (transaction, 19);
+		// An interrupted upgrade committed the first account
+		store.upgrade_progress_put (transaction, first);
+	}
+	futurehead::logger_mt logger;
+	futurehead::mdb_store store (logger, path);
+	ASSERT_FALSE (store.init_error ());
+	auto transaction (store.tx_begin_read ());
+	ASSERT_LT (19, store.version_get (transaction));
+	// Only the accounts after the progress marker are upgraded
+	ASSERT_EQ (1, store.count (transaction, store.delegators));
+	ASSERT_TRUE (store.delegator_exists (transaction, second, second));
+	futurehead::uint256_union progress;
+	ASSERT_TRUE (store.upgrade_progress_get (transaction, progress));
+}
+
+TEST (mdb_block_store, upgrade_v20_v21)
+{
+	auto path (futurehead::unique_path ());
+	futurehead::genesis genesis;
+	{
+		futurehead::logger_mt logger;
+		futurehead::mdb_store store (logger, path);
+		futurehead::stat stats;
+		futurehead::ledger ledger (store, stats);
+		auto transaction (store.tx_begin_write ());
+		store.initialize (transaction, genesis, ledger.cache);
+		store.pending_put (transaction, futurehead::pending_key (1, 2), { 2, 3, futurehead::epoch::epoch_0 });
+		store.pending_put (transaction, futurehead::pending_key (1, 3), { 2, 4, futurehead::epoch::epoch_0 });
+		store.pending_put (transaction, futurehead::pending_key (5, 2), { 2, 7, futurehead::epoch::epoch_0 });
+		ASSERT_EQ (0, mdb_drop (store.env.tx (transaction), store.pending_totals, 1));
+		store.version_put (transaction, 20);
+	}
+	// Upgrading sums the existing pending entries of every account
+	futurehead::logger_mt logger;
+	futurehead::mdb_store store (logger, path);
+	ASSERT_FALSE (store.init_error ());
+	auto transaction (store.tx_begin_read ());
+	ASSERT_LT (20, store.version_get (transaction));
+	ASSERT_EQ (2, store.count (transaction, store.pending_totals));
+	futurehead::pending_totals totals;
+	ASSERT_FALSE (store.pending_totals_get (transaction, 1, totals));
+	ASSERT_EQ (futurehead::pending_totals (7, 2), totals);
+	ASSERT_FALSE (store.pending_totals_get (transaction, 5, totals));
+	ASSERT_EQ (futurehead::pending_totals (7, 1), totals);
+}
+
 TEST (mdb_block_store, upgrade_backup)
 {
 	auto dir (futurehead::unique_path ());
@@ -2071,6 +2263,64 @@ TEST (mdb_block_store, upgrade_backup)
 	ASSERT_NE (get_backup_path ().string (), dir.string ());
 }
 
+TEST (mdb_block_store, compact_online)
+{
+	auto path (futurehead::unique_path ());
+	futurehead::genesis genesis;
+	futurehead::logger_mt logger;
+	futurehead::mdb_store store (logger, path);
+	ASSERT_FALSE (store.init_error ());
+	{
+		futurehead::ledger_cache ledger_cache;
+		auto transaction (store.tx_begin_write ());
+		store.initialize (transaction, genesis, ledger_cache);
+		store.pending_put (transaction, futurehead::pending_key (1, 2), { 2, 3, futurehead::epoch::epoch_0 });
+		store.pending_put (transaction, futurehead::pending_key (1, 3), { 2, 4, futurehead::epoch::epoch_0 });
+	}
+	ASSERT_FALSE (store.compact_online ());
+	ASSERT_TRUE (store.compact_online ());
+	// A reset transaction gives up its handle, so it can be kept across the swap
+	auto kept (store.tx_begin_read ());
+	kept.reset ();
+	{
+		// An open transaction keeps the ledger file in place
+		auto transaction (store.tx_begin_read ());
+		auto deadline (std::chrono::steady_clock::now () + std::chrono::seconds (10));
+		while (!store.compaction->copied ())
+		{
+			ASSERT_LT (std::chrono::steady_clock::now (), deadline);
+			std::this_thread::sleep_for (std::chrono::milliseconds (10));
+		}
+		std::this_thread::sleep_for (std::chrono::milliseconds (100));
+		ASSERT_FALSE (store.compaction->swapped ());
+		ASSERT_TRUE (boost::filesystem::exists (path.parent_path () / "compacted.ldb"));
+	}
+	{
+		// Replayed into the copy, or written to the compacted file directly if it already replaced the ledger file
+		auto transaction (store.tx_begin_write ());
+		store.pending_del (transaction, futurehead::pending_key (1, 2));
+		store.pending_put (transaction, futurehead::pending_key (5, 2), { 2, 7, futurehead::epoch::epoch_0 });
+	}
+	// The copy replaces the ledger file once no transaction is open, without closing the store
+	auto deadline (std::chrono::steady_clock::now () + std::chrono::seconds (10));
+	while (!store.compaction->swapped ())
+	{
+		ASSERT_LT (std::chrono::steady_clock::now (), deadline);
+		std::this_thread::sleep_for (std::chrono::milliseconds (10));
+	}
+	ASSERT_FALSE (boost::filesystem::exists (path.parent_path () / "compacted.ldb"));
+	auto transaction (store.tx_begin_read ());
+	ASSERT_TRUE (store.block_exists (transaction, genesis.hash ()));
+	ASSERT_FALSE (store.pending_exists (transaction, futurehead::pending_key (1, 2)));
+	ASSERT_TRUE (store.pending_exists (transaction, futurehead::pending_key (1, 3)));
+	ASSERT_TRUE (store.pending_exists (transaction, futurehead::pending_key (5, 2)));
+	futurehead::pending_totals totals;
+	ASSERT_FALSE (store.pending_totals_get (transaction, 1, totals));
+	ASSERT_EQ (futurehead::pending_totals (4, 1), totals);
+	kept.renew ();
+	ASSERT_TRUE (store.pending_exists (kept, futurehead::pending_key (5, 2)));
+}
+
 // Test various confirmation height values as well as clearing them
 TEST (block_store, confirmation_height)
 {
@@ -2223,6 +2473,162 @@ TEST (block_store, reset_renew_existing_transaction)
 	ASSERT_NE (nullptr, block_existing);
 }
 
+TEST (block_store, account_cache_hit)
+{
+	futurehead::logger_mt logger;
+	futurehead::mdb_store store (logger, futurehead::unique_path ());
+	ASSERT_FALSE (store.init_error ());
+	futurehead::account account (1);
+	futurehead::account_info info (2, 3, 4, 5, 6, 7, futurehead::epoch::epoch_0);
+	{
+		auto transaction (store.tx_begin_write ());
+		store.account_put (transaction, account, info);
+		store.confirmation_height_put (transaction, account, futurehead::confirmation_height_info (8, 9));
+	}
+	auto & cache (store.get_store_cache ());
+	// Committed writes are cached directly
+	ASSERT_EQ (1, cache.accounts.size ());
+	ASSERT_EQ (1, cache.confirmation_heights.size ());
+	auto transaction (store.tx_begin_read ());
+	auto hits (cache.accounts.hits.load ());
+	futurehead::account_info info2;
+	ASSERT_FALSE (store.account_get (transaction, account, info2));
+	ASSERT_EQ (info, info2);
+	ASSERT_EQ (hits + 1, cache.accounts.hits);
+	futurehead::confirmation_height_info confirmation_height_info;
+	ASSERT_FALSE (store.confirmation_height_get (transaction, account, confirmation_height_info));
+	ASSERT_EQ (8, confirmation_height_info.height);
+	ASSERT_EQ (futurehead::block_hash (9), confirmation_height_info.frontier);
+	// Lookups for missing accounts are never cached
+	ASSERT_TRUE (store.account_get (transaction, futurehead::account (2), info2));
+	ASSERT_EQ (1, cache.accounts.size ());
+}
+
+TEST (block_store, account_cache_fill_lru)
+{
+	futurehead::logger_mt logger;
+	auto path (futurehead::unique_path ());
+	{
+		futurehead::mdb_store store (logger, path);
+		ASSERT_FALSE (store.init_error ());
+		auto transaction (store.tx_begin_write ());
+		for (auto i (1); i <= 3; ++i)
+		{
+			store.account_put (transaction, futurehead::account (i), futurehead::account_info (i, i, i, i, i, i, futurehead::epoch::epoch_0));
+		}
+	}
+	futurehead::mdb_store store (logger, path, futurehead::txn_tracking_config{}, std::chrono::milliseconds (5000), futurehead::lmdb_config{}, 512, false, 2);
+	ASSERT_FALSE (store.init_error ());
+	auto & cache (store.get_store_cache ());
+	ASSERT_EQ (0, cache.accounts.size ());
+	auto transaction (store.tx_begin_read ());
+	futurehead::account_info info;
+	for (auto i (1); i <= 3; ++i)
+	{
+		ASSERT_FALSE (store.account_get (transaction, futurehead::account (i), info));
+		ASSERT_EQ (futurehead::block_hash (i), info.head);
+	}
+	ASSERT_EQ (2, cache.accounts.size ());
+	// The least recently used account was evicted
+	auto hits (cache.accounts.hits.load ());
+	ASSERT_FALSE (store.account_get (transaction, futurehead::account (1), info));
+	ASSERT_EQ (hits, cache.accounts.hits);
+	ASSERT_FALSE (store.account_get (transaction, futurehead::account (3), info));
+	ASSERT_EQ (hits + 1, cache.accounts.hits);
+}
+
+TEST (block_store, account_cache_snapshot_isolation)
+{
+	futurehead::logger_mt logger;
+	futurehead::mdb_store store (logger, futurehead::unique_path ());
+	ASSERT_FALSE (store.init_error ());
+	futurehead::account account (1);
+	futurehead::account_info info1 (1, 1, 1, 1, 1, 1, futurehead::epoch::epoch_0);
+	futurehead::account_info info2 (2, 2, 2, 2, 2, 2, futurehead::epoch::epoch_0);
+	{
+		auto transaction (store.tx_begin_write ());
+		store.account_put (transaction, account, info1);
+	}
+	auto old_read (store.tx_begin_read ());
+	futurehead::account_info info;
+	{
+		auto transaction (store.tx_begin_write ());
+		store.account_put (transaction, account, info2);
+		// Uncommitted writes are only visible to the writing transaction
+		ASSERT_FALSE (store.account_get (transaction, account, info));
+		ASSERT_EQ (info2, info);
+		ASSERT_FALSE (store.account_get (old_read, account, info));
+		ASSERT_EQ (info1, info);
+	}
+	// Transactions started before the commit keep reading their snapshot
+	ASSERT_FALSE (store.account_get (old_read, account, info));
+	ASSERT_EQ (info1, info);
+	auto new_read (store.tx_begin_read ());
+	ASSERT_FALSE (store.account_get (new_read, account, info));
+	ASSERT_EQ (info2, info);
+	old_read.refresh ();
+	ASSERT_FALSE (store.account_get (old_read, account, info));
+	ASSERT_EQ (info2, info);
+	{
+		auto transaction (store.tx_begin_write ());
+		store.account_del (transaction, account);
+		ASSERT_TRUE (store.account_exists (new_read, account));
+		ASSERT_TRUE (store.account_get (transaction, account, info));
+	}
+	ASSERT_FALSE (store.account_get (new_read, account, info));
+	new_read.refresh ();
+	ASSERT_TRUE (store.account_get (new_read, account, info));
+	ASSERT_FALSE (store.account_exists (new_read, account));
+}
+
+TEST (block_store, block_cache)
+{
+	futurehead::logger_mt logger;
+	futurehead::mdb_store store (logger, futurehead::unique_path ());
+	ASSERT_FALSE (store.init_error ());
+	futurehead::genesis genesis;
+	futurehead::stat stats;
+	futurehead::ledger ledger (store, stats);
+	futurehead::work_pool pool (std::numeric_limits<unsigned>::max ());
+	auto send1 (std::make_shared<futurehead::send_block> (genesis.hash (), futurehead::test_genesis_key.pub, futurehead::genesis_amount - 100, futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub, *pool.generate (genesis.hash ())));
+	{
+		auto transaction (store.tx_begin_write ());
+		store.initialize (transaction, genesis, ledger.cache);
+		ASSERT_EQ (futurehead::process_result::progress, ledger.process (transaction, *send1).code);
+		store.block_cache_put (transaction, send1);
+		// The predecessor was modified by this transaction, it is read from the database
+		auto genesis_block (store.block_get (transaction, genesis.hash ()));
+		ASSERT_NE (nullptr, genesis_block);
+		ASSERT_EQ (send1->hash (), genesis_block->sideband ().successor);
+	}
+	auto & cache (store.get_store_cache ());
+	ASSERT_EQ (1, cache.blocks.size ());
+	auto transaction (store.tx_begin_read ());
+	// Processed blocks are shared without being deserialized again
+	ASSERT_EQ (send1, store.block_get (transaction, send1->hash ()));
+	auto genesis_block (store.block_get (transaction, genesis.hash ()));
+	ASSERT_EQ (2, cache.blocks.size ());
+	ASSERT_EQ (genesis_block, store.block_get (transaction, genesis.hash ()));
+	auto send2 (std::make_shared<futurehead::send_block> (send1->hash (), futurehead::test_genesis_key.pub, futurehead::genesis_amount - 200, futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub, *pool.generate (send1->hash ())));
+	{
+		auto transaction (store.tx_begin_write ());
+		ASSERT_EQ (futurehead::process_result::progress, ledger.process (transaction, *send2).code);
+	}
+	// The successor of send1 changed, older snapshots keep the cached block
+	ASSERT_EQ (send1, store.block_get (transaction, send1->hash ()));
+	transaction.refresh ();
+	auto send1_updated (store.block_get (transaction, send1->hash ()));
+	ASSERT_NE (send1, send1_updated);
+	ASSERT_EQ (send2->hash (), send1_updated->sideband ().successor);
+	{
+		auto transaction (store.tx_begin_write ());
+		ASSERT_FALSE (ledger.rollback (transaction, send2->hash ()));
+	}
+	transaction.refresh ();
+	ASSERT_EQ (nullptr, store.block_get (transaction, send2->hash ()));
+	ASSERT_TRUE (store.block_get (transaction, send1->hash ())->sideband ().successor.is_zero ());
+}
+
 TEST (block_store, rocksdb_force_test_env_variable)
 {
 	futurehead::logger_mt logger;
@@ -139,6 +139,58 @@ TEST (bulk_pull, by_block_single)
 	ASSERT_EQ (nullptr, block);
 }
 
+TEST (bulk_pull, pruned)
+{
+	futurehead::system system (1);
+	auto node (system.nodes[0]);
+	node->ledger.pruning = true;
+	futurehead::genesis genesis;
+	futurehead::block_builder builder;
+	auto send1 = builder.state ()
+	             .account (futurehead::genesis_account)
+	             .previous (genesis.hash ())
+	             .representative (futurehead::genesis_account)
+	             .balance (futurehead::genesis_amount - 100)
+	             .link (futurehead::genesis_account)
+	             .sign (futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub)
+	             .work (*system.work.generate (genesis.hash ()))
+	             .build ();
+	auto send2 = builder.state ()
+	             .account (futurehead::genesis_account)
+	             .previous (send1->hash ())
+	             .representative (futurehead::genesis_account)
+	             .balance (futurehead::genesis_amount - 200)
+	             .link (futurehead::genesis_account)
+	             .sign (futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub)
+	             .work (*system.work.generate (send1->hash ()))
+	             .build ();
+	ASSERT_EQ (futurehead::process_result::progress, node->process (*send1).code);
+	ASSERT_EQ (futurehead::process_result::progress, node->process (*send2).code);
+	{
+		auto transaction (node->store.tx_begin_write ());
+		node->store.confirmation_height_put (transaction, futurehead::genesis_account, { 3, send2->hash () });
+		ASSERT_EQ (1, node->ledger.pruning_action (transaction, send1->hash (), 1));
+	}
+	auto connection (std::make_shared<futurehead::bootstrap_server> (nullptr, node));
+	// The response ends at the pruned block
+	auto req = std::make_unique<futurehead::bulk_pull> ();
+	req->start = futurehead::genesis_account;
+	req->end.clear ();
+	connection->requests.push (std::unique_ptr<futurehead::message>{});
+	auto request (std::make_shared<futurehead::bulk_pull_server> (connection, std::move (req)));
+	auto block (request->get_next ());
+	ASSERT_NE (nullptr, block);
+	ASSERT_EQ (send2->hash (), block->hash ());
+	ASSERT_EQ (nullptr, request->get_next ());
+	// Nothing is sent when starting from a pruned block
+	auto req2 = std::make_unique<futurehead::bulk_pull> ();
+	req2->start = send1->hash ();
+	req2->end.clear ();
+	auto request2 (std::make_shared<futurehead::bulk_pull_server> (connection, std::move (req2)));
+	ASSERT_EQ (request2->current, request2->request->end);
+	ASSERT_EQ (nullptr, request2->get_next ());
+}
+
 TEST (bulk_pull, count_limit)
 {
 	futurehead::system system (1);
@@ -170,6 +222,61 @@ TEST (bulk_pull, count_limit)
 	ASSERT_EQ (nullptr, block);
 }
 
+TEST (bulk_pull, compact_codec)
+{
+	futurehead::keypair key1;
+	futurehead::keypair key2;
+	futurehead::state_block state1 (key1.pub, 1, key1.pub, 10, 2, key1.prv, key1.pub, 3);
+	futurehead::state_block state2 (key1.pub, 4, key1.pub, 11, 5, key1.prv, key1.pub, 6);
+	futurehead::state_block state3 (key1.pub, 7, key2.pub, 12, 8, key1.prv, key1.pub, 9);
+	futurehead::send_block send (10, key2.pub, 13, key1.prv, key1.pub, 11);
+	futurehead::state_block state4 (key2.pub, 12, key2.pub, 14, 13, key2.prv, key2.pub, 14);
+	futurehead::bulk_pull_compact_codec encoder;
+	std::vector<uint8_t> buffer;
+	// The first state block of a response has nothing to refer to
+	ASSERT_EQ (0, encoder.encode (state1, buffer));
+	ASSERT_EQ (1 + futurehead::state_block::size, buffer.size ());
+	ASSERT_EQ (64, encoder.encode (state2, buffer));
+	ASSERT_EQ (32, encoder.encode (state3, buffer));
+	ASSERT_EQ (0, encoder.encode (send, buffer));
+	// Blocks of other types do not reset the reference, the representative is repeated from state3
+	ASSERT_EQ (32, encoder.encode (state4, buffer));
+	futurehead::bulk_pull_compact_codec decoder;
+	futurehead::bufferstream stream (buffer.data (), buffer.size ());
+	std::vector<std::shared_ptr<futurehead::block>> blocks;
+	uint8_t type;
+	while (!futurehead::try_read (stream, type))
+	{
+		std::shared_ptr<futurehead::block> block;
+		if (futurehead::bulk_pull_compact_codec::is_compact (type))
+		{
+			std::vector<uint8_t> compact (futurehead::bulk_pull_compact_codec::size (type));
+			ASSERT_EQ (compact.size (), static_cast<size_t> (stream.sgetn (compact.data (), compact.size ())));
+			std::vector<uint8_t> plain;
+			ASSERT_FALSE (decoder.decode (type, compact.data (), plain));
+			futurehead::bufferstream plain_stream (plain.data (), plain.size ());
+			block = futurehead::deserialize_block (plain_stream, futurehead::block_type::state);
+		}
+		else
+		{
+			block = futurehead::deserialize_block (stream, static_cast<futurehead::block_type> (type));
+		}
+		ASSERT_NE (nullptr, block);
+		decoder.update (*block);
+		blocks.push_back (block);
+	}
+	ASSERT_EQ (5, blocks.size ());
+	ASSERT_EQ (state1, *blocks[0]);
+	ASSERT_EQ (state2, *blocks[1]);
+	ASSERT_EQ (state3, *blocks[2]);
+	ASSERT_EQ (send, *blocks[3]);
+	ASSERT_EQ (state4, *blocks[4]);
+	// A compact block cannot be decoded without a preceding state block
+	futurehead::bulk_pull_compact_codec empty;
+	std::vector<uint8_t> plain;
+	ASSERT_TRUE (empty.decode (futurehead::bulk_pull_compact_codec::marker | futurehead::bulk_pull_compact_codec::account_elided, buffer.data (), plain));
+}
+
 TEST (bootstrap_processor, DISABLED_process_none)
 {
 	futurehead::system system (1);
@@ -1133,6 +1240,115 @@ TEST (frontier_req, time_cutoff)
 	ASSERT_TRUE (request2->frontier.is_zero ());
 }
 
+TEST (frontier_req, batched)
+{
+	futurehead::system system;
+	futurehead::node_config config (futurehead::get_available_port (), system.logging);
+	config.frontiers_confirmation = futurehead::frontiers_confirmation_mode::disabled;
+	futurehead::node_flags node_flags;
+	node_flags.disable_bootstrap_bulk_push_client = true;
+	node_flags.disable_lazy_bootstrap = true;
+	// Smaller than the number of accounts so frontiers are split over several writes
+	node_flags.frontier_req_batch_size = 2;
+	auto node1 = system.add_node (config, node_flags);
+	futurehead::genesis genesis;
+	futurehead::block_hash previous (genesis.hash ());
+	futurehead::uint128_t balance (futurehead::genesis_amount);
+	std::vector<futurehead::keypair> keys (4);
+	for (auto const & key : keys)
+	{
+		balance -= futurehead::Gxrb_ratio;
+		futurehead::state_block send (futurehead::test_genesis_key.pub, previous, futurehead::test_genesis_key.pub, balance, key.pub, futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub, *system.work.generate (previous));
+		ASSERT_EQ (futurehead::process_result::progress, node1->process (send).code);
+		futurehead::state_block open (key.pub, 0, key.pub, futurehead::Gxrb_ratio, send.hash (), key.prv, key.pub, *system.work.generate (key.pub));
+		ASSERT_EQ (futurehead::process_result::progress, node1->process (open).code);
+		previous = send.hash ();
+	}
+	config.peering_port = futurehead::get_available_port ();
+	node_flags.frontier_req_batch_size = 1;
+	auto node2 = system.add_node (config, node_flags);
+	node2->bootstrap_initiator.bootstrap (node1->network.endpoint ());
+	ASSERT_TIMELY (10s, node2->ledger.cache.block_count == node1->ledger.cache.block_count);
+	for (auto const & key : keys)
+	{
+		ASSERT_EQ (node1->latest (key.pub), node2->latest (key.pub));
+	}
+	ASSERT_LE (keys.size () + 1, node1->stats.count (futurehead::stat::type::bootstrap, futurehead::stat::detail::frontier_sent, futurehead::stat::dir::out));
+}
+
+TEST (frontier_req, ranges)
+{
+	futurehead::system system;
+	futurehead::node_config config (futurehead::get_available_port (), system.logging);
+	config.frontiers_confirmation = futurehead::frontiers_confirmation_mode::disabled;
+	futurehead::node_flags node_flags;
+	node_flags.disable_bootstrap_bulk_push_client = true;
+	node_flags.disable_lazy_bootstrap = true;
+	auto node1 = system.add_node (config, node_flags);
+	futurehead::genesis genesis;
+	futurehead::block_hash previous (genesis.hash ());
+	futurehead::uint128_t balance (futurehead::genesis_amount);
+	std::vector<futurehead::keypair> keys (8);
+	for (auto const & key : keys)
+	{
+		balance -= futurehead::Gxrb_ratio;
+		futurehead::state_block send (futurehead::test_genesis_key.pub, previous, futurehead::test_genesis_key.pub, balance, key.pub, futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub, *system.work.generate (previous));
+		ASSERT_EQ (futurehead::process_result::progress, node1->process (send).code);
+		futurehead::state_block open (key.pub, 0, key.pub, futurehead::Gxrb_ratio, send.hash (), key.prv, key.pub, *system.work.generate (key.pub));
+		ASSERT_EQ (futurehead::process_result::progress, node1->process (open).code);
+		previous = send.hash ();
+	}
+	config.peering_port = futurehead::get_available_port ();
+	node_flags.bootstrap_frontier_ranges = 4;
+	node_flags.allow_bootstrap_peers_duplicates = true;
+	auto node2 = system.add_node (config, node_flags);
+	node2->bootstrap_initiator.bootstrap (node1->network.endpoint ());
+	ASSERT_TIMELY (10s, node2->ledger.cache.block_count == node1->ledger.cache.block_count);
+	for (auto const & key : keys)
+	{
+		ASSERT_EQ (node1->latest (key.pub), node2->latest (key.pub));
+	}
+	// Each range is a separate frontier request
+	ASSERT_LE (4, node1->stats.count (futurehead::stat::type::bootstrap, futurehead::stat::detail::frontier_req, futurehead::stat::dir::in));
+}
+
+TEST (bulk, pipelined)
+{
+	futurehead::system system;
+	futurehead::node_config config (futurehead::get_available_port (), system.logging);
+	config.frontiers_confirmation = futurehead::frontiers_confirmation_mode::disabled;
+	futurehead::node_flags node_flags;
+	node_flags.disable_bootstrap_bulk_push_client = true;
+	node_flags.disable_lazy_bootstrap = true;
+	auto node1 = system.add_node (config, node_flags);
+	futurehead::genesis genesis;
+	futurehead::block_hash previous (genesis.hash ());
+	futurehead::uint128_t balance (futurehead::genesis_amount);
+	std::vector<futurehead::keypair> keys (8);
+	for (auto const & key : keys)
+	{
+		balance -= futurehead::Gxrb_ratio;
+		futurehead::state_block send (futurehead::test_genesis_key.pub, previous, futurehead::test_genesis_key.pub, balance, key.pub, futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub, *system.work.generate (previous));
+		ASSERT_EQ (futurehead::process_result::progress, node1->process (send).code);
+		futurehead::state_block open (key.pub, 0, key.pub, futurehead::Gxrb_ratio, send.hash (), key.prv, key.pub, *system.work.generate (key.pub));
+		ASSERT_EQ (futurehead::process_result::progress, node1->process (open).code);
+		previous = send.hash ();
+	}
+	config.peering_port = futurehead::get_available_port ();
+	config.bootstrap_connections = 1;
+	config.bootstrap_connections_max = 1;
+	node_flags.bootstrap_pull_pipeline = 4;
+	auto node2 = system.add_node (config, node_flags);
+	node2->bootstrap_initiator.bootstrap (node1->network.endpoint ());
+	ASSERT_TIMELY (10s, node2->ledger.cache.block_count == node1->ledger.cache.block_count);
+	for (auto const & key : keys)
+	{
+		ASSERT_EQ (node1->latest (key.pub), node2->latest (key.pub));
+	}
+	// Pulls beyond the first on a connection were sent before the previous response finished
+	ASSERT_LT (0, node2->stats.count (futurehead::stat::type::bootstrap, futurehead::stat::detail::bulk_pull_pipelined, futurehead::stat::dir::out));
+}
+
 TEST (bulk, genesis)
 {
 	futurehead::system system;
@@ -1260,3 +1476,277 @@ TEST (bulk_pull_account, basics)
 		ASSERT_EQ (nullptr, block_data.second.get ());
 	}
 }
+
+TEST (bootstrap_checkpoint, file)
+{
+	std::vector<futurehead::bootstrap_checkpoint::entry> entries;
+	entries.push_back (futurehead::bootstrap_checkpoint::entry{ futurehead::test_genesis_key.pub, futurehead::genesis ().hash (), 1 });
+	entries.push_back (futurehead::bootstrap_checkpoint::entry{ futurehead::keypair ().pub, futurehead::block_hash (42), 1000 });
+	auto path (futurehead::unique_path ());
+	ASSERT_FALSE (futurehead::bootstrap_checkpoint::write (path, entries));
+	auto commitment (futurehead::bootstrap_checkpoint::commitment (entries));
+	std::vector<futurehead::bootstrap_checkpoint::entry> read;
+	ASSERT_FALSE (futurehead::bootstrap_checkpoint::read (path, commitment, read));
+	ASSERT_EQ (entries.size (), read.size ());
+	for (size_t i (0); i < entries.size (); ++i)
+	{
+		ASSERT_EQ (entries[i].account, read[i].account);
+		ASSERT_EQ (entries[i].frontier, read[i].frontier);
+		ASSERT_EQ (entries[i].height, read[i].height);
+	}
+	// Any change to the entries changes the commitment
+	entries[1].height = 1001;
+	ASSERT_NE (commitment, futurehead::bootstrap_checkpoint::commitment (entries));
+	std::vector<futurehead::bootstrap_checkpoint::entry> mismatch;
+	ASSERT_TRUE (futurehead::bootstrap_checkpoint::read (path, futurehead::bootstrap_checkpoint::commitment (entries), mismatch));
+	ASSERT_TRUE (mismatch.empty ());
+	ASSERT_TRUE (futurehead::bootstrap_checkpoint::read (futurehead::unique_path (), commitment, mismatch));
+}
+
+TEST (bootstrap_checkpoint, signature_skipped)
+{
+	futurehead::system system (1);
+	auto & node (*system.nodes[0]);
+	futurehead::genesis genesis;
+	futurehead::keypair key;
+	auto send1 (std::make_shared<futurehead::state_block> (futurehead::test_genesis_key.pub, genesis.hash (), futurehead::test_genesis_key.pub, futurehead::genesis_amount - 100, key.pub, futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub, *system.work.generate (genesis.hash ())));
+	auto send2 (std::make_shared<futurehead::state_block> (futurehead::test_genesis_key.pub, send1->hash (), futurehead::test_genesis_key.pub, futurehead::genesis_amount - 200, key.pub, futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub, *system.work.generate (send1->hash ())));
+	// The signature is not part of the hash, a block committed to by the checkpoint is accepted without checking it
+	send1->signature.clear ();
+	send2->signature.clear ();
+	node.bootstrap_checkpoint.trust ({ futurehead::bootstrap_checkpoint::entry{ futurehead::test_genesis_key.pub, send1->hash (), 2 } });
+	// Blocks which did not come from bootstrap are always verified
+	node.block_processor.add (send1);
+	node.block_processor.flush ();
+	ASSERT_FALSE (node.ledger.block_exists (send1->hash ()));
+	ASSERT_EQ (0, node.stats.count (futurehead::stat::type::bootstrap, futurehead::stat::detail::checkpoint_trusted));
+	node.block_processor.add_bootstrap (futurehead::unchecked_info (send2, 0, 0, futurehead::signature_verification::unknown));
+	node.block_processor.add_bootstrap (futurehead::unchecked_info (send1, 0, 0, futurehead::signature_verification::unknown));
+	node.block_processor.flush ();
+	ASSERT_TRUE (node.ledger.block_exists (send1->hash ()));
+	ASSERT_FALSE (node.ledger.block_exists (send2->hash ()));
+	ASSERT_EQ (1, node.stats.count (futurehead::stat::type::bootstrap, futurehead::stat::detail::checkpoint_trusted));
+	// Trust moved down the chain to the predecessor
+	ASSERT_EQ (1, node.bootstrap_checkpoint.size ());
+}
+
+TEST (bootstrap_checkpoint, bootstrap)
+{
+	futurehead::system system;
+	futurehead::node_config config (futurehead::get_available_port (), system.logging);
+	config.frontiers_confirmation = futurehead::frontiers_confirmation_mode::disabled;
+	futurehead::node_flags node_flags;
+	node_flags.disable_bootstrap_bulk_push_client = true;
+	node_flags.disable_lazy_bootstrap = true;
+	auto node1 = system.add_node (config, node_flags);
+	futurehead::genesis genesis;
+	futurehead::block_hash previous (genesis.hash ());
+	futurehead::uint128_t balance (futurehead::genesis_amount);
+	std::vector<futurehead::keypair> keys (4);
+	std::vector<futurehead::bootstrap_checkpoint::entry> entries;
+	for (auto const & key : keys)
+	{
+		balance -= futurehead::Gxrb_ratio;
+		futurehead::state_block send (futurehead::test_genesis_key.pub, previous, futurehead::test_genesis_key.pub, balance, key.pub, futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub, *system.work.generate (previous));
+		ASSERT_EQ (futurehead::process_result::progress, node1->process (send).code);
+		futurehead::state_block open (key.pub, 0, key.pub, futurehead::Gxrb_ratio, send.hash (), key.prv, key.pub, *system.work.generate (key.pub));
+		ASSERT_EQ (futurehead::process_result::progress, node1->process (open).code);
+		entries.push_back (futurehead::bootstrap_checkpoint::entry{ key.pub, open.hash (), 1 });
+		previous = send.hash ();
+	}
+	entries.push_back (futurehead::bootstrap_checkpoint::entry{ futurehead::test_genesis_key.pub, previous, keys.size () + 1 });
+	auto path (futurehead::unique_path ());
+	ASSERT_FALSE (futurehead::bootstrap_checkpoint::write (path, entries));
+	config.peering_port = futurehead::get_available_port ();
+	node_flags.bootstrap_checkpoint = path.string ();
+	node_flags.bootstrap_checkpoint_commitment = futurehead::bootstrap_checkpoint::commitment (entries);
+	auto node2 = system.add_node (config, node_flags);
+	ASSERT_EQ (entries.size (), node2->bootstrap_checkpoint.size ());
+	node2->bootstrap_initiator.bootstrap (node1->network.endpoint ());
+	ASSERT_TIMELY (10s, node2->ledger.cache.block_count == node1->ledger.cache.block_count);
+	ASSERT_EQ (2 * keys.size (), node2->stats.count (futurehead::stat::type::bootstrap, futurehead::stat::detail::checkpoint_trusted));
+}
+
+TEST (lazy_hash_table, insert_erase)
+{
+	futurehead::lazy_hash_table<uint64_t> table;
+	std::vector<futurehead::block_hash> hashes;
+	for (uint64_t i (0); i < 1000; ++i)
+	{
+		futurehead::block_hash hash;
+		futurehead::random_pool::generate_block (hash.bytes.data (), hash.bytes.size ());
+		hashes.push_back (hash);
+		ASSERT_TRUE (table.insert (hash, i).second);
+	}
+	ASSERT_EQ (1000, table.size ());
+	ASSERT_FALSE (table.insert (hashes[0], 5000).second);
+	ASSERT_EQ (0, *table.find (hashes[0]));
+	// Erasing every other entry must not break probing for the remaining ones
+	for (size_t i (0); i < hashes.size (); i += 2)
+	{
+		ASSERT_TRUE (table.erase (hashes[i]));
+	}
+	ASSERT_FALSE (table.erase (hashes[0]));
+	ASSERT_EQ (500, table.size ());
+	for (size_t i (0); i < hashes.size (); ++i)
+	{
+		auto existing (table.find (hashes[i]));
+		if (i % 2 == 0)
+		{
+			ASSERT_EQ (nullptr, existing);
+		}
+		else
+		{
+			ASSERT_NE (nullptr, existing);
+			ASSERT_EQ (i, *existing);
+		}
+	}
+	uint64_t total (0);
+	table.for_each ([&total](uint64_t value_a) { total += value_a; });
+	ASSERT_EQ (250000, total);
+	table.clear ();
+	ASSERT_TRUE (table.empty ());
+	ASSERT_EQ (nullptr, table.find (hashes[1]));
+}
+
+TEST (lazy_state_backlog, spill)
+{
+	auto path (futurehead::unique_path ());
+	std::vector<futurehead::block_hash> previous (10);
+	{
+		futurehead::lazy_state_backlog backlog (path, 2);
+		for (size_t i (0); i < previous.size (); ++i)
+		{
+			futurehead::random_pool::generate_block (previous[i].bytes.data (), previous[i].bytes.size ());
+			backlog.insert (previous[i], futurehead::lazy_state_backlog_item{ futurehead::link (i), i, static_cast<unsigned> (i) });
+		}
+		ASSERT_EQ (10, backlog.size ());
+		ASSERT_EQ (8, backlog.spilled ());
+		ASSERT_TRUE (boost::filesystem::exists (path));
+		// Entries in memory are taken directly
+		auto taken (backlog.take (previous[0]));
+		ASSERT_TRUE (taken);
+		ASSERT_EQ (futurehead::link (0), taken->link);
+		// Spilled entries are left for cleanup
+		ASSERT_FALSE (backlog.take (previous[9]));
+		ASSERT_EQ (9, backlog.size ());
+		// Resolve odd entries, retained spilled entries move back in memory while there is room
+		std::unordered_set<futurehead::block_hash> visited;
+		auto resolve ([&visited](futurehead::block_hash const & previous_a, futurehead::lazy_state_backlog_item const & item_a) {
+			visited.insert (previous_a);
+			return item_a.retry_limit % 2 == 1;
+		});
+		backlog.cleanup (resolve);
+		boost::filesystem::path spill_file;
+		ASSERT_TRUE (backlog.spill_detach (true, spill_file));
+		ASSERT_EQ (0, backlog.spilled ());
+		{
+			boost::filesystem::ifstream input (spill_file, std::ios::in | std::ios::binary);
+			futurehead::block_hash previous_l;
+			futurehead::lazy_state_backlog_item item;
+			size_t in_memory (0);
+			while (futurehead::lazy_state_backlog::spill_read (input, previous_l, item))
+			{
+				if (!resolve (previous_l, item) && backlog.insert (previous_l, item))
+				{
+					++in_memory;
+				}
+			}
+			ASSERT_EQ (2, in_memory);
+		}
+		boost::filesystem::remove (spill_file);
+		ASSERT_EQ (9, visited.size ());
+		ASSERT_EQ (4, backlog.size ());
+		ASSERT_EQ (2, backlog.spilled ());
+		// Nothing spilled was taken since, a partial pass does not read the file
+		ASSERT_FALSE (backlog.spill_detach (false, spill_file));
+		backlog.cleanup ([](futurehead::block_hash const &, futurehead::lazy_state_backlog_item const & item_a) {
+			EXPECT_EQ (0, item_a.retry_limit % 2);
+			EXPECT_EQ (item_a.retry_limit, item_a.balance);
+			return true;
+		});
+		ASSERT_EQ (2, backlog.size ());
+	}
+	// The spill file is removed with the backlog
+	auto path_next (path);
+	path_next += ".next";
+	ASSERT_FALSE (boost::filesystem::exists (path));
+	ASSERT_FALSE (boost::filesystem::exists (path_next));
+}
+
+TEST (lazy_state_backlog, remove_stale)
+{
+	auto directory (futurehead::unique_path ());
+	boost::filesystem::create_directories (directory);
+	auto spill_path (futurehead::lazy_state_backlog::spill_path_unique (directory));
+	auto spill_next (spill_path);
+	spill_next += ".next";
+	auto other (directory / "other.tmp");
+	for (auto const & path : { spill_path, spill_next, other })
+	{
+		boost::filesystem::ofstream (path) << "data";
+	}
+	futurehead::lazy_state_backlog::remove_stale (directory);
+	ASSERT_FALSE (boost::filesystem::exists (spill_path));
+	ASSERT_FALSE (boost::filesystem::exists (spill_next));
+	ASSERT_TRUE (boost::filesystem::exists (other));
+}
+
+TEST (bulk, compact_stream)
+{
+	futurehead::system system;
+	futurehead::node_config config (futurehead::get_available_port (), system.logging);
+	config.frontiers_confirmation = futurehead::frontiers_confirmation_mode::disabled;
+	futurehead::node_flags node_flags;
+	node_flags.disable_bootstrap_bulk_push_client = true;
+	node_flags.disable_lazy_bootstrap = true;
+	auto node1 = system.add_node (config, node_flags);
+	futurehead::block_hash previous (node1->latest (futurehead::test_genesis_key.pub));
+	futurehead::uint128_t balance (futurehead::genesis_amount);
+	for (auto i (0); i < 8; ++i)
+	{
+		futurehead::keypair key;
+		balance -= futurehead::Gxrb_ratio;
+		futurehead::state_block send (futurehead::test_genesis_key.pub, previous, futurehead::test_genesis_key.pub, balance, key.pub, futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub, *system.work.generate (previous));
+		ASSERT_EQ (futurehead::process_result::progress, node1->process (send).code);
+		previous = send.hash ();
+	}
+	config.peering_port = futurehead::get_available_port ();
+	auto node2 = system.add_node (config, node_flags);
+	node2->bootstrap_initiator.bootstrap (node1->network.endpoint ());
+	ASSERT_TIMELY (10s, node2->latest (futurehead::test_genesis_key.pub) == previous);
+	// Account and representative are repeated by every state block after the first
+	auto saved (node1->stats.count (futurehead::stat::type::bootstrap, futurehead::stat::detail::bulk_pull_compact_saved, futurehead::stat::dir::out));
+	ASSERT_LE (7 * 64, saved);
+	ASSERT_EQ (saved, node2->stats.count (futurehead::stat::type::bootstrap, futurehead::stat::detail::bulk_pull_compact_saved, futurehead::stat::dir::in));
+}
+
+TEST (bootstrap_connection_controller, adjust)
+{
+	futurehead::bootstrap_connection_controller controller;
+	// Starts at the floor and only grows while throughput improves
+	ASSERT_EQ (4, controller.update (4, 64, 0, 0));
+	ASSERT_EQ (6, controller.update (4, 64, 100, 0));
+	ASSERT_EQ (7, controller.update (4, 64, 200, 0));
+	ASSERT_EQ (7, controller.update (4, 64, 205, 0));
+	// Shrinks when the block processor falls behind, holds while it is partially filled
+	ASSERT_EQ (5, controller.update (4, 64, 205, 0.6));
+	ASSERT_EQ (5, controller.update (4, 64, 1000, 0.3));
+	for (auto i (0); i < 10; ++i)
+	{
+		controller.update (4, 64, 205, 1);
+	}
+	ASSERT_EQ (4, controller.target ());
+	// Never above the pull based ceiling
+	for (auto i (0); i < 10; ++i)
+	{
+		controller.update (4, 8, 1000 * (i + 1), 0);
+	}
+	ASSERT_EQ (8, controller.target ());
+	// Growth is probed again after a plateau
+	for (auto i (0u); i < futurehead::bootstrap_connection_controller::reprobe_updates; ++i)
+	{
+		ASSERT_EQ (8, controller.update (4, 64, 10000, 0));
+	}
+	ASSERT_LT (8, controller.update (4, 64, 10000, 0));
+}
@@ -262,10 +262,10 @@ TEST (conflicts, adjusted_multiplier)
 	{
 		futurehead::lock_guard<std::mutex> guard (node1.active.mutex);
 		node1.active.update_adjusted_multiplier ();
-		ASSERT_EQ (node1.active.roots.get<1> ().begin ()->election->status.winner->hash (), send1->hash ());
-		for (auto i (node1.active.roots.get<1> ().begin ()), n (node1.active.roots.get<1> ().end ()); i != n; ++i)
+		ASSERT_EQ (node1.active.roots.top (1).front ()->election->status.winner->hash (), send1->hash ());
+		for (auto info : node1.active.roots.top ())
 		{
-			adjusted_multipliers.insert (std::make_pair (i->election->status.winner->hash (), i->adjusted_multiplier));
+			adjusted_multipliers.insert (std::make_pair (info->election->status.winner->hash (), info->adjusted_multiplier));
 		}
 	}
 	// genesis
@@ -297,6 +297,6 @@ TEST (conflicts, adjusted_multiplier)
 		futurehead::lock_guard<std::mutex> guard (node1.active.mutex);
 		node1.active.update_adjusted_multiplier ();
 		ASSERT_EQ (node1.active.roots.size (), 12);
-		ASSERT_EQ (node1.active.roots.get<1> ().begin ()->election->status.winner->hash (), open_epoch2->hash ());
+		ASSERT_EQ (node1.active.roots.top (1).front ()->election->status.winner->hash (), open_epoch2->hash ());
 	}
 }
@@ -175,3 +175,96 @@ TEST (election, dependencies_open_link)
 	ASSERT_EQ (3, node.active.size ());
 }
 }
+
+TEST (election, tally_incremental)
+{
+	futurehead::system system;
+	futurehead::node_flags flags;
+	flags.disable_request_loop = true;
+	auto & node = *system.add_node (flags);
+	futurehead::state_block_builder builder;
+	futurehead::keypair key1;
+	futurehead::keypair key2;
+	std::shared_ptr<futurehead::block> send1 = builder.make_block ()
+	                                     .account (futurehead::test_genesis_key.pub)
+	                                     .previous (futurehead::genesis_hash)
+	                                     .representative (futurehead::test_genesis_key.pub)
+	                                     .link (key1.pub)
+	                                     .balance (futurehead::genesis_amount - 1)
+	                                     .sign (futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub)
+	                                     .work (*system.work.generate (futurehead::genesis_hash))
+	                                     .build ();
+	std::shared_ptr<futurehead::block> send2 = builder.make_block ()
+	                                     .account (futurehead::test_genesis_key.pub)
+	                                     .previous (futurehead::genesis_hash)
+	                                     .representative (futurehead::test_genesis_key.pub)
+	                                     .link (key2.pub)
+	                                     .balance (futurehead::genesis_amount - 1)
+	                                     .sign (futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub)
+	                                     .work (*system.work.generate (futurehead::genesis_hash))
+	                                     .build ();
+	ASSERT_EQ (futurehead::process_result::progress, node.process (*send1).code);
+	auto election (node.active.insert (send1).election);
+	ASSERT_NE (nullptr, election);
+	// Weights far below the online weight minimum, so the election neither switches winners nor confirms
+	node.ledger.cache.rep_weights.representation_put (key1.pub, 100);
+	node.ledger.cache.rep_weights.representation_put (key2.pub, 50);
+	futurehead::lock_guard<std::mutex> guard (node.active.mutex);
+	ASSERT_FALSE (election->publish (send2));
+	ASSERT_TRUE (election->vote (key1.pub, 1, send1->hash ()).processed);
+	ASSERT_TRUE (election->vote (key2.pub, 1, send2->hash ()).processed);
+	auto tally1 (election->tally ());
+	ASSERT_EQ (2, tally1.size ());
+	ASSERT_EQ (100, tally1.begin ()->first);
+	ASSERT_EQ (send1->hash (), tally1.begin ()->second->hash ());
+	ASSERT_EQ (50, tally1.rbegin ()->first);
+	// A replaced vote moves its weight to the new block
+	election->last_votes[key1.pub].time = std::chrono::steady_clock::now () - std::chrono::seconds (20);
+	ASSERT_TRUE (election->vote (key1.pub, 2, send2->hash ()).processed);
+	auto tally2 (election->tally ());
+	ASSERT_EQ (150, tally2.begin ()->first);
+	ASSERT_EQ (send2->hash (), tally2.begin ()->second->hash ());
+	ASSERT_EQ (0, tally2.rbegin ()->first);
+	// Votes are weighed again once representative weights change
+	node.ledger.cache.rep_weights.representation_put (key2.pub, 10);
+	auto tally3 (election->tally ());
+	ASSERT_EQ (110, tally3.begin ()->first);
+	ASSERT_FALSE (election->confirmed ());
+}
+
+TEST (election, vote_quorum_check)
+{
+	futurehead::system system;
+	futurehead::node_flags flags;
+	flags.disable_request_loop = true;
+	auto & node = *system.add_node (flags);
+	futurehead::keypair key1;
+	futurehead::state_block_builder builder;
+	std::shared_ptr<futurehead::block> send1 = builder.make_block ()
+	                                     .account (futurehead::test_genesis_key.pub)
+	                                     .previous (futurehead::genesis_hash)
+	                                     .representative (futurehead::test_genesis_key.pub)
+	                                     .link (key1.pub)
+	                                     .balance (futurehead::genesis_amount - 1)
+	                                     .sign (futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub)
+	                                     .work (*system.work.generate (futurehead::genesis_hash))
+	                                     .build ();
+	ASSERT_EQ (futurehead::process_result::progress, node.process (*send1).code);
+	auto election (node.active.insert (send1).election);
+	ASSERT_NE (nullptr, election);
+	auto online_stake (node.online_reps.online_stake ());
+	// Votes are applied without the active mutex, a vote far below quorum needs no further check
+	auto quorum_check (true);
+	ASSERT_TRUE (election->vote (key1.pub, 1, send1->hash (), 100, online_stake, quorum_check).processed);
+	ASSERT_FALSE (quorum_check);
+	ASSERT_EQ (2, election->last_votes_size ());
+	// Reaching quorum is left to the caller, which confirms holding the active mutex
+	ASSERT_TRUE (election->vote (futurehead::test_genesis_key.pub, 1, send1->hash (), node.ledger.weight (futurehead::test_genesis_key.pub), online_stake, quorum_check).processed);
+	ASSERT_TRUE (quorum_check);
+	ASSERT_FALSE (election->confirmed ());
+	{
+		futurehead::lock_guard<std::mutex> guard (node.active.mutex);
+		election->confirm_if_quorum ();
+	}
+	ASSERT_TRUE (election->confirmed ());
+}
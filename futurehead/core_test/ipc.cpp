@@ -1,6 +1,8 @@
 #include <futurehead/core_test/testutil.hpp>
+#include <futurehead/ipc_flatbuffers_lib/flatbuffer_producer.hpp>
 #include <futurehead/lib/ipc_client.hpp>
 #include <futurehead/lib/tomlconfig.hpp>
+#include <futurehead/node/ipc/flatbuffers_handler.hpp>
 #include <futurehead/node/ipc/ipc_access_config.hpp>
 #include <futurehead/node/ipc/ipc_server.hpp>
 #include <futurehead/node/testing.hpp>
@@ -216,3 +218,88 @@ TEST (ipc, permissions_default_user_order)
 	futurehead::ipc::access access;
 	ASSERT_TRUE (access.deserialize_toml (toml));
 }
+
+TEST (ipc, flatbuffers_queries)
+{
+	futurehead::system system (1);
+	auto & node (*system.nodes[0]);
+	futurehead::keypair key;
+	system.wallet (0)->insert_adhoc (futurehead::test_genesis_key.prv);
+	auto send (system.wallet (0)->send_action (futurehead::test_genesis_key.pub, key.pub, 100));
+	ASSERT_NE (nullptr, send);
+	futurehead::node_rpc_config node_rpc_config;
+	futurehead::ipc::ipc_server ipc (node, node_rpc_config);
+	auto handler (std::make_shared<futurehead::ipc::flatbuffers_handler> (node, ipc, nullptr, node.config.ipc_config));
+	// The response envelope is valid while the returned builder is
+	auto query ([&handler](auto & message_a) {
+		auto request (futurehead::ipc::flatbuffer_producer::make_buffer (message_a));
+		std::shared_ptr<flatbuffers::FlatBufferBuilder> response;
+		handler->process (request->GetBufferPointer (), request->GetSize (), [&response](std::shared_ptr<flatbuffers::FlatBufferBuilder> fbb_a) {
+			response = fbb_a;
+		});
+		return response;
+	});
+
+	futureheadapi::AccountInfoT account_info;
+	account_info.account = futurehead::test_genesis_key.pub.to_account ();
+	account_info.include_pending = true;
+	auto account_info_buffer (query (account_info));
+	auto account_info_response (futureheadapi::GetEnvelope (account_info_buffer->GetBufferPointer ())->message_as_AccountInfoResponse ());
+	ASSERT_NE (nullptr, account_info_response);
+	ASSERT_EQ (send->hash ().to_string (), account_info_response->frontier ()->str ());
+	ASSERT_EQ ((futurehead::genesis_amount - 100).convert_to<std::string> (), account_info_response->balance ()->str ());
+	ASSERT_EQ (2, account_info_response->block_count ());
+	ASSERT_EQ ("0", account_info_response->pending ()->str ());
+	ASSERT_EQ (nullptr, account_info_response->representative ());
+
+	account_info.account = key.pub.to_account ();
+	auto not_found_buffer (query (account_info));
+	auto not_found (futureheadapi::GetEnvelope (not_found_buffer->GetBufferPointer ())->message_as_Error ());
+	ASSERT_NE (nullptr, not_found);
+	ASSERT_EQ (std::error_code (futurehead::error_common::account_not_found).message (), not_found->message ()->str ());
+
+	futureheadapi::AccountsBalancesT accounts_balances;
+	accounts_balances.accounts.push_back (futurehead::test_genesis_key.pub.to_account ());
+	accounts_balances.accounts.push_back (key.pub.to_account ());
+	auto accounts_balances_buffer (query (accounts_balances));
+	auto accounts_balances_response (futureheadapi::GetEnvelope (accounts_balances_buffer->GetBufferPointer ())->message_as_AccountsBalancesResponse ());
+	ASSERT_NE (nullptr, accounts_balances_response);
+	ASSERT_EQ (2, accounts_balances_response->balances ()->size ());
+	ASSERT_EQ (key.pub.to_account (), accounts_balances_response->balances ()->Get (1)->account ()->str ());
+	ASSERT_EQ ("0", accounts_balances_response->balances ()->Get (1)->balance ()->str ());
+	ASSERT_EQ ("100", accounts_balances_response->balances ()->Get (1)->pending ()->str ());
+
+	futureheadapi::BlocksInfoT blocks_info;
+	blocks_info.hashes.push_back (send->hash ().to_string ());
+	blocks_info.hashes.push_back (futurehead::block_hash (1).to_string ());
+	blocks_info.include_not_found = true;
+	auto blocks_info_buffer (query (blocks_info));
+	auto blocks_info_response (futureheadapi::GetEnvelope (blocks_info_buffer->GetBufferPointer ())->message_as_BlocksInfoResponse ());
+	ASSERT_NE (nullptr, blocks_info_response);
+	ASSERT_EQ (1, blocks_info_response->blocks ()->size ());
+	auto block_entry (blocks_info_response->blocks ()->Get (0));
+	ASSERT_EQ (futurehead::test_genesis_key.pub.to_account (), block_entry->block_account ()->str ());
+	ASSERT_EQ ("100", block_entry->amount ()->str ());
+	ASSERT_EQ (2, block_entry->height ());
+	ASSERT_NE (nullptr, block_entry->block_as_BlockState ());
+	ASSERT_EQ (futureheadapi::BlockSubType::BlockSubType_send, block_entry->block_as_BlockState ()->subtype ());
+	ASSERT_EQ (1, blocks_info_response->blocks_not_found ()->size ());
+
+	futureheadapi::PendingT pending;
+	pending.account = key.pub.to_account ();
+	pending.include_active = true;
+	auto pending_buffer (query (pending));
+	auto pending_response (futureheadapi::GetEnvelope (pending_buffer->GetBufferPointer ())->message_as_PendingResponse ());
+	ASSERT_NE (nullptr, pending_response);
+	ASSERT_EQ (1, pending_response->blocks ()->size ());
+	ASSERT_EQ (send->hash ().to_string (), pending_response->blocks ()->Get (0)->hash ()->str ());
+	ASSERT_EQ ("100", pending_response->blocks ()->Get (0)->amount ()->str ());
+	ASSERT_EQ (futurehead::test_genesis_key.pub.to_account (), pending_response->blocks ()->Get (0)->source ()->str ());
+
+	futureheadapi::BlockCountT block_count;
+	auto block_count_buffer (query (block_count));
+	auto block_count_response (futureheadapi::GetEnvelope (block_count_buffer->GetBufferPointer ())->message_as_BlockCountResponse ());
+	ASSERT_NE (nullptr, block_count_response);
+	ASSERT_EQ (2, block_count_response->count ());
+	ipc.stop ();
+}
@@ -0,0 +1,119 @@
+#include <futurehead/lib/json_writer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <boost/property_tree/json_parser.hpp>
+
+#include <limits>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+std::string write_json (boost::property_tree::ptree const & tree_a)
+{
+	std::stringstream ostream;
+	boost::property_tree::write_json (ostream, tree_a);
+	return ostream.str ();
+}
+}
+
+// The writer output must be identical to boost::property_tree::write_json
+TEST (json_writer, matches_ptree)
+{
+	futurehead::account account (67890);
+	futurehead::block_hash hash (12345);
+	futurehead::uint128_t amount (std::numeric_limits<futurehead::uint128_t>::max () - 1);
+	boost::property_tree::ptree expected;
+	expected.put ("text", "quote \" slash / backslash \\ tab \t control \x01 utf8 \xc3\xa9");
+	boost::property_tree::ptree object;
+	object.put ("hash", hash.to_string ());
+	object.put ("account", account.to_account ());
+	object.put ("amount", amount.convert_to<std::string> ());
+	object.put ("zero", futurehead::uint128_t (0).convert_to<std::string> ());
+	object.put ("chunk", futurehead::uint128_t (10000000000000000000ULL).convert_to<std::string> ());
+	object.put ("count", std::to_string (std::numeric_limits<uint64_t>::max ()));
+	expected.add_child ("object", object);
+	boost::property_tree::ptree array;
+	for (auto i (0); i < 3; ++i)
+	{
+		boost::property_tree::ptree entry;
+		entry.put ("", std::to_string (i));
+		array.push_back (std::make_pair ("", entry));
+	}
+	expected.add_child ("array", array);
+	expected.add_child ("empty", boost::property_tree::ptree ());
+
+	futurehead::json_writer writer;
+	writer.begin_object ();
+	writer.key ("text");
+	writer.value ("quote \" slash / backslash \\ tab \t control \x01 utf8 \xc3\xa9");
+	writer.key ("object");
+	writer.begin_object ();
+	writer.key ("hash");
+	writer.value (hash);
+	writer.key ("account");
+	writer.account (account);
+	writer.key ("amount");
+	writer.value (amount);
+	writer.key ("zero");
+	writer.value (futurehead::uint128_t (0));
+	writer.key ("chunk");
+	writer.value (futurehead::uint128_t (10000000000000000000ULL));
+	writer.key ("count");
+	writer.value (std::numeric_limits<uint64_t>::max ());
+	writer.end_object ();
+	writer.key ("array");
+	writer.begin_array ();
+	for (uint64_t i (0); i < 3; ++i)
+	{
+		writer.value (i);
+	}
+	writer.end_array ();
+	writer.key ("empty");
+	writer.begin_object ();
+	writer.end_object ();
+	writer.end_object ();
+	ASSERT_EQ (write_json (expected), writer.str ());
+}
+
+TEST (json_writer, tree)
+{
+	boost::property_tree::ptree expected;
+	expected.put ("a.b", "1");
+	expected.put ("a.c", "2");
+	boost::property_tree::ptree array;
+	boost::property_tree::ptree entry;
+	entry.put ("d", "3");
+	array.push_back (std::make_pair ("", entry));
+	array.push_back (std::make_pair ("", entry));
+	expected.add_child ("e", array);
+
+	futurehead::json_writer writer;
+	writer.tree (expected);
+	ASSERT_EQ (write_json (expected), writer.str ());
+}
+
+TEST (json_writer, chunks)
+{
+	boost::property_tree::ptree expected;
+	for (auto i (0); i < 100; ++i)
+	{
+		expected.put ("key" + std::to_string (i), std::to_string (i));
+	}
+	std::vector<std::string> chunks;
+	futurehead::json_writer writer ([&chunks](std::string const & chunk_a) {
+		chunks.push_back (chunk_a);
+	},
+	64);
+	writer.tree (expected);
+	ASSERT_LT (1, chunks.size ());
+	std::string joined;
+	for (auto const & chunk : chunks)
+	{
+		ASSERT_LE (64, chunk.size ());
+		joined += chunk;
+	}
+	ASSERT_GT (64 + 20, writer.str ().size ());
+	ASSERT_EQ (write_json (expected), joined + writer.str ());
+}
@@ -3,6 +3,7 @@
 #include <futurehead/lib/threading.hpp>
 #include <futurehead/node/election.hpp>
 #include <futurehead/node/testing.hpp>
+#include <futurehead/secure/ledger_snapshot.hpp>
 
 #include <gtest/gtest.h>
 
@@ -167,6 +168,7 @@ TEST (ledger, process_send)
 	ASSERT_EQ (futurehead::genesis_amount - 50, pending1.amount.number ());
 	ASSERT_EQ (0, ledger.account_balance (transaction, key2.pub));
 	ASSERT_EQ (futurehead::genesis_amount - 50, ledger.account_pending (transaction, key2.pub));
+	ASSERT_EQ (1, ledger.account_pending_totals (transaction, key2.pub).count);
 	ASSERT_EQ (50, ledger.account_balance (transaction, futurehead::test_genesis_key.pub));
 	ASSERT_EQ (50, ledger.weight (futurehead::test_genesis_key.pub));
 	ASSERT_EQ (0, ledger.weight (key2.pub));
@@ -185,6 +187,7 @@ TEST (ledger, process_send)
 	ASSERT_TRUE (ledger.store.pending_get (transaction, futurehead::pending_key (key2.pub, hash1), pending2));
 	ASSERT_EQ (futurehead::genesis_amount, ledger.account_balance (transaction, futurehead::test_genesis_key.pub));
 	ASSERT_EQ (0, ledger.account_pending (transaction, key2.pub));
+	ASSERT_EQ (0, ledger.account_pending_totals (transaction, key2.pub).count);
 	ASSERT_EQ (store->account_count (transaction), ledger.cache.account_count);
 }
 
@@ -638,6 +641,29 @@ TEST (ledger, representation_changes)
 	ASSERT_EQ (2, rep_weights.representation_get (key1.pub));
 }
 
+TEST (ledger, representation_generation)
+{
+	futurehead::keypair key1;
+	futurehead::rep_weights rep_weights;
+	auto generation (rep_weights.generation ());
+	rep_weights.representation_put (key1.pub, 1 << 20);
+	ASSERT_NE (generation, rep_weights.generation ());
+	generation = rep_weights.generation ();
+	// Small changes accumulate until the weight moved materially
+	rep_weights.representation_add (key1.pub, 512);
+	rep_weights.representation_add (key1.pub, 512);
+	ASSERT_EQ (generation, rep_weights.generation ());
+	rep_weights.representation_add (key1.pub, 1);
+	ASSERT_NE (generation, rep_weights.generation ());
+	generation = rep_weights.generation ();
+	// Changes which cancel out do not start a new generation
+	rep_weights.representation_add (key1.pub, 1024);
+	rep_weights.representation_put (key1.pub, (1 << 20) + 1025);
+	rep_weights.representation_add (key1.pub, 1024);
+	ASSERT_EQ (generation, rep_weights.generation ());
+	ASSERT_EQ ((1 << 20) + 2049, rep_weights.representation_get (key1.pub));
+}
+
 TEST (ledger, representation)
 {
 	futurehead::logger_mt logger;
@@ -3258,3 +3284,233 @@ TEST (ledger, backtrack)
 	ASSERT_EQ (nullptr, ledger.backtrack (transaction, nullptr, 0));
 	ASSERT_EQ (nullptr, ledger.backtrack (transaction, nullptr, 10));
 }
+
+TEST (ledger, pruning_action)
+{
+	futurehead::logger_mt logger;
+	auto store = futurehead::make_store (logger, futurehead::unique_path ());
+	ASSERT_FALSE (store->init_error ());
+	futurehead::stat stats;
+	futurehead::ledger ledger (*store, stats);
+	ledger.pruning = true;
+	futurehead::genesis genesis;
+	auto transaction (store->tx_begin_write ());
+	store->initialize (transaction, genesis, ledger.cache);
+	futurehead::work_pool pool (std::numeric_limits<unsigned>::max ());
+	futurehead::block_builder builder;
+	auto send1 = builder.state ()
+	             .account (futurehead::genesis_account)
+	             .previous (genesis.hash ())
+	             .representative (futurehead::genesis_account)
+	             .balance (futurehead::genesis_amount - 100)
+	             .link (futurehead::genesis_account)
+	             .sign (futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub)
+	             .work (*pool.generate (genesis.hash ()))
+	             .build ();
+	ASSERT_EQ (futurehead::process_result::progress, ledger.process (transaction, *send1).code);
+	auto receive1 = builder.state ()
+	                .account (futurehead::genesis_account)
+	                .previous (send1->hash ())
+	                .representative (futurehead::genesis_account)
+	                .balance (futurehead::genesis_amount)
+	                .link (send1->hash ())
+	                .sign (futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub)
+	                .work (*pool.generate (send1->hash ()))
+	                .build ();
+	ASSERT_EQ (futurehead::process_result::progress, ledger.process (transaction, *receive1).code);
+	store->confirmation_height_put (transaction, futurehead::genesis_account, { 3, receive1->hash () });
+	ASSERT_EQ (1, ledger.pruning_action (transaction, send1->hash (), 1));
+	ASSERT_FALSE (store->block_exists (transaction, send1->hash ()));
+	ASSERT_TRUE (store->pruned_exists (transaction, send1->hash ()));
+	ASSERT_TRUE (ledger.block_or_pruned_exists (transaction, send1->hash ()));
+	ASSERT_TRUE (ledger.block_confirmed (transaction, send1->hash ()));
+	ASSERT_TRUE (store->block_exists (transaction, genesis.hash ()));
+	ASSERT_TRUE (store->block_exists (transaction, receive1->hash ()));
+	ASSERT_EQ (1, store->pruned_count (transaction));
+	ASSERT_EQ (1, ledger.cache.pruned_count);
+	ASSERT_EQ (3, ledger.cache.block_count);
+	// Blocks already in the ledger are still recognized after their contents were removed
+	ASSERT_EQ (futurehead::process_result::old, ledger.process (transaction, *send1).code);
+	// Amounts of blocks following a pruned block cannot be computed
+	bool error (false);
+	ASSERT_EQ (0, ledger.amount_safe (transaction, receive1->hash (), error));
+	ASSERT_TRUE (error);
+	// Pruning stops at a block which was already pruned
+	ASSERT_EQ (1, ledger.pruning_action (transaction, receive1->hash (), 1));
+	ASSERT_EQ (2, store->pruned_count (transaction));
+	store->pruned_del (transaction, receive1->hash ());
+	ASSERT_FALSE (store->pruned_exists (transaction, receive1->hash ()));
+}
+
+TEST (ledger, delegators_index)
+{
+	futurehead::logger_mt logger;
+	auto store = futurehead::make_store (logger, futurehead::unique_path ());
+	ASSERT_FALSE (store->init_error ());
+	futurehead::stat stats;
+	futurehead::ledger ledger (*store, stats);
+	futurehead::genesis genesis;
+	auto transaction (store->tx_begin_write ());
+	store->initialize (transaction, genesis, ledger.cache);
+	ASSERT_TRUE (store->delegator_exists (transaction, futurehead::genesis_account, futurehead::genesis_account));
+	futurehead::work_pool pool (std::numeric_limits<unsigned>::max ());
+	futurehead::block_builder builder;
+	futurehead::keypair key1;
+	futurehead::keypair rep;
+	auto send1 = builder.state ()
+	             .account (futurehead::genesis_account)
+	             .previous (genesis.hash ())
+	             .representative (futurehead::genesis_account)
+	             .balance (futurehead::genesis_amount - 100)
+	             .link (key1.pub)
+	             .sign (futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub)
+	             .work (*pool.generate (genesis.hash ()))
+	             .build ();
+	ASSERT_EQ (futurehead::process_result::progress, ledger.process (transaction, *send1).code);
+	auto open1 = builder.open ()
+	             .source (send1->hash ())
+	             .representative (futurehead::genesis_account)
+	             .account (key1.pub)
+	             .sign (key1.prv, key1.pub)
+	             .work (*pool.generate (key1.pub))
+	             .build ();
+	ASSERT_EQ (futurehead::process_result::progress, ledger.process (transaction, *open1).code);
+	ASSERT_TRUE (store->delegator_exists (transaction, futurehead::genesis_account, key1.pub));
+	auto change1 = builder.state ()
+	               .account (key1.pub)
+	               .previous (open1->hash ())
+	               .representative (rep.pub)
+	               .balance (100)
+	               .link (0)
+	               .sign (key1.prv, key1.pub)
+	               .work (*pool.generate (open1->hash ()))
+	               .build ();
+	ASSERT_EQ (futurehead::process_result::progress, ledger.process (transaction, *change1).code);
+	ASSERT_FALSE (store->delegator_exists (transaction, futurehead::genesis_account, key1.pub));
+	ASSERT_TRUE (store->delegator_exists (transaction, rep.pub, key1.pub));
+	auto i (store->delegators_begin (transaction, rep.pub));
+	ASSERT_NE (store->delegators_end (), i);
+	ASSERT_EQ (futurehead::delegator_key (rep.pub, key1.pub), i->first);
+	++i;
+	ASSERT_EQ (store->delegators_end (), i);
+	// Rolling back restores the previous representative, rolling back the open removes the account
+	ASSERT_FALSE (ledger.rollback (transaction, change1->hash ()));
+	ASSERT_FALSE (store->delegator_exists (transaction, rep.pub, key1.pub));
+	ASSERT_TRUE (store->delegator_exists (transaction, futurehead::genesis_account, key1.pub));
+	ASSERT_FALSE (ledger.rollback (transaction, open1->hash ()));
+	ASSERT_FALSE (store->delegator_exists (transaction, futurehead::genesis_account, key1.pub));
+	ASSERT_TRUE (store->delegator_exists (transaction, futurehead::genesis_account, futurehead::genesis_account));
+}
+
+TEST (ledger, snapshot)
+{
+	futurehead::logger_mt logger;
+	auto store1 = futurehead::make_store (logger, futurehead::unique_path ());
+	ASSERT_TRUE (!store1->init_error ());
+	futurehead::stat stats;
+	futurehead::ledger ledger1 (*store1, stats);
+	futurehead::genesis genesis;
+	futurehead::work_pool pool (std::numeric_limits<unsigned>::max ());
+	futurehead::keypair key1;
+	futurehead::keypair key2;
+	futurehead::send_block send1 (genesis.hash (), key1.pub, futurehead::genesis_amount - 100, futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub, *pool.generate (genesis.hash ()));
+	futurehead::open_block open1 (send1.hash (), key1.pub, key1.pub, key1.prv, key1.pub, *pool.generate (key1.pub));
+	futurehead::state_block send2 (futurehead::genesis_account, send1.hash (), futurehead::genesis_account, futurehead::genesis_amount - 150, key2.pub, futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub, *pool.generate (send1.hash ()));
+	{
+		auto transaction (store1->tx_begin_write ());
+		store1->initialize (transaction, genesis, ledger1.cache);
+		ASSERT_EQ (futurehead::process_result::progress, ledger1.process (transaction, send1).code);
+		ASSERT_EQ (futurehead::process_result::progress, ledger1.process (transaction, open1).code);
+		ASSERT_EQ (futurehead::process_result::progress, ledger1.process (transaction, send2).code);
+		store1->confirmation_height_put (transaction, futurehead::genesis_account, { 2, send1.hash () });
+	}
+	auto path (futurehead::unique_path ());
+	futurehead::ledger_snapshot::counts exported;
+	ASSERT_FALSE (futurehead::ledger_snapshot::write (*store1, store1->tx_begin_read (), path, exported));
+	ASSERT_EQ (2, exported.accounts);
+	ASSERT_EQ (4, exported.blocks);
+	ASSERT_EQ (1, exported.pending);
+	ASSERT_EQ (0, exported.pruned);
+	auto store2 = futurehead::make_store (logger, futurehead::unique_path ());
+	ASSERT_TRUE (!store2->init_error ());
+	{
+		futurehead::ledger_cache cache;
+		store2->initialize (store2->tx_begin_write (), genesis, cache);
+	}
+	// A batch size of 2 commits several times during the import
+	futurehead::ledger_snapshot::counts imported;
+	ASSERT_FALSE (futurehead::ledger_snapshot::read (*store2, path, imported, 2));
+	ASSERT_EQ (exported.accounts, imported.accounts);
+	ASSERT_EQ (exported.blocks, imported.blocks);
+	ASSERT_EQ (exported.pending, imported.pending);
+	{
+		auto transaction1 (store1->tx_begin_read ());
+		auto transaction2 (store2->tx_begin_read ());
+		ASSERT_EQ (store1->account_count (transaction1), store2->account_count (transaction2));
+		for (auto i (store1->latest_begin (transaction1)), n (store1->latest_end ()); i != n; ++i)
+		{
+			futurehead::account_info info;
+			ASSERT_FALSE (store2->account_get (transaction2, i->first, info));
+			ASSERT_EQ (i->second, info);
+			futurehead::confirmation_height_info confirmation_height1;
+			futurehead::confirmation_height_info confirmation_height2;
+			ASSERT_EQ (store1->confirmation_height_get (transaction1, i->first, confirmation_height1), store2->confirmation_height_get (transaction2, i->first, confirmation_height2));
+			ASSERT_EQ (confirmation_height1.height, confirmation_height2.height);
+			ASSERT_EQ (confirmation_height1.frontier, confirmation_height2.frontier);
+			ASSERT_TRUE (store2->delegator_exists (transaction2, info.representative, i->first));
+		}
+		ASSERT_EQ (store1->block_count (transaction1).sum (), store2->block_count (transaction2).sum ());
+		for (auto hash : { genesis.hash (), send1.hash (), open1.hash (), send2.hash () })
+		{
+			auto block1 (store1->block_get (transaction1, hash));
+			auto block2 (store2->block_get (transaction2, hash));
+			ASSERT_NE (nullptr, block2);
+			ASSERT_EQ (*block1, *block2);
+			ASSERT_EQ (block1->sideband ().successor, block2->sideband ().successor);
+			ASSERT_EQ (block1->sideband ().height, block2->sideband ().height);
+			ASSERT_EQ (block1->sideband ().account, block2->sideband ().account);
+		}
+		ASSERT_TRUE (store2->frontier_get (transaction2, genesis.hash ()).is_zero ());
+		ASSERT_EQ (key1.pub, store2->frontier_get (transaction2, open1.hash ()));
+		futurehead::pending_info pending;
+		ASSERT_FALSE (store2->pending_get (transaction2, futurehead::pending_key (key2.pub, send2.hash ()), pending));
+		ASSERT_EQ (50, pending.amount.number ());
+	}
+	// The imported ledger continues from the snapshot
+	futurehead::stat stats2;
+	futurehead::ledger ledger2 (*store2, stats2);
+	ASSERT_EQ (ledger1.cache.rep_weights.get_rep_amounts (), ledger2.cache.rep_weights.get_rep_amounts ());
+	futurehead::state_block open2 (key2.pub, 0, key2.pub, 50, send2.hash (), key2.prv, key2.pub, *pool.generate (key2.pub));
+	ASSERT_EQ (futurehead::process_result::progress, ledger2.process (store2->tx_begin_write (), open2).code);
+	// A non empty ledger is not overwritten
+	futurehead::ledger_snapshot::counts repeated;
+	ASSERT_TRUE (futurehead::ledger_snapshot::read (*store2, path, repeated));
+}
+
+TEST (ledger, snapshot_corrupt)
+{
+	futurehead::logger_mt logger;
+	auto store1 = futurehead::make_store (logger, futurehead::unique_path ());
+	ASSERT_TRUE (!store1->init_error ());
+	futurehead::genesis genesis;
+	futurehead::ledger_cache cache;
+	store1->initialize (store1->tx_begin_write (), genesis, cache);
+	auto path (futurehead::unique_path ());
+	futurehead::ledger_snapshot::counts exported;
+	ASSERT_FALSE (futurehead::ledger_snapshot::write (*store1, store1->tx_begin_read (), path, exported));
+	{
+		// Flip a bit of the genesis account balance
+		std::fstream file (path.string (), std::ios::in | std::ios::out | std::ios::binary);
+		file.seekp (4 + 1 + 4 + 32 + 1 + 4 + 32 * 4);
+		file.put (1);
+	}
+	auto store2 = futurehead::make_store (logger, futurehead::unique_path ());
+	ASSERT_TRUE (!store2->init_error ());
+	store2->initialize (store2->tx_begin_write (), genesis, cache);
+	futurehead::ledger_snapshot::counts imported;
+	ASSERT_TRUE (futurehead::ledger_snapshot::read (*store2, path, imported));
+	ASSERT_EQ (0, imported.accounts);
+	futurehead::account_info info;
+	ASSERT_FALSE (store2->account_get (store2->tx_begin_read (), futurehead::genesis_account, info));
+	ASSERT_EQ (futurehead::genesis_amount, info.balance.number ());
+}
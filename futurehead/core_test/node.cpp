@@ -1,6 +1,7 @@
 #include <futurehead/core_test/testutil.hpp>
 #include <futurehead/lib/jsonconfig.hpp>
 #include <futurehead/node/election.hpp>
+#include <futurehead/node/lmdb/lmdb.hpp>
 #include <futurehead/node/testing.hpp>
 #include <futurehead/node/transport/udp.hpp>
 
@@ -4448,6 +4449,28 @@ TEST (node, deferred_dependent_elections)
 }
 }
 
+TEST (node, compact_ledger_live)
+{
+	futurehead::system system;
+	futurehead::node_flags flags;
+	flags.compact_ledger = true;
+	auto & node = *system.add_node (flags);
+	auto store (dynamic_cast<futurehead::mdb_store *> (&node.store));
+	if (store != nullptr)
+	{
+		futurehead::keypair key;
+		system.wallet (0)->insert_adhoc (futurehead::test_genesis_key.prv);
+		auto send1 (system.wallet (0)->send_action (futurehead::test_genesis_key.pub, key.pub, futurehead::Gxrb_ratio));
+		ASSERT_NE (nullptr, send1);
+		// The compacted copy replaces the ledger file while the node's components keep their transactions
+		ASSERT_TIMELY (10s, store->compaction->swapped ());
+		auto send2 (system.wallet (0)->send_action (futurehead::test_genesis_key.pub, key.pub, futurehead::Gxrb_ratio));
+		ASSERT_NE (nullptr, send2);
+		ASSERT_TIMELY (10s, node.block_confirmed (send2->hash ()));
+		ASSERT_TRUE (node.ledger.block_exists (send1->hash ()));
+	}
+}
+
 namespace
 {
 void add_required_children_node_config_tree (futurehead::jsonconfig & tree)
@@ -10,6 +10,8 @@
 
 #include <boost/filesystem.hpp>
 
+#include <future>
+
 using namespace std::chrono_literals;
 
 TEST (rate, basic)
@@ -115,6 +117,38 @@ TEST (thread, worker)
 	ASSERT_TRUE (passed_sleep);
 }
 
+TEST (thread, worker_threads)
+{
+	// Two tasks waiting for each other only complete if they run on separate threads
+	futurehead::worker worker (2, futurehead::thread_role::name::rpc_handling);
+	std::promise<void> first;
+	std::promise<void> second;
+	auto first_future (first.get_future ().share ());
+	auto second_future (second.get_future ().share ());
+	std::atomic<unsigned> completed{ 0 };
+	worker.push_task ([&first, second_future, &completed]() {
+		first.set_value ();
+		if (second_future.wait_for (std::chrono::seconds (10)) == std::future_status::ready)
+		{
+			++completed;
+		}
+	});
+	worker.push_task ([&second, first_future, &completed]() {
+		second.set_value ();
+		if (first_future.wait_for (std::chrono::seconds (10)) == std::future_status::ready)
+		{
+			++completed;
+		}
+	});
+	futurehead::timer<std::chrono::milliseconds> timer_l;
+	timer_l.start ();
+	while (completed < 2 && timer_l.since_start () < std::chrono::seconds (10))
+	{
+		std::this_thread::sleep_for (std::chrono::milliseconds (10));
+	}
+	ASSERT_EQ (2, completed);
+}
+
 TEST (filesystem, remove_all_files)
 {
 	auto path = futurehead::unique_path ();
@@ -89,6 +89,32 @@ TEST (vote_processor, invalid_signature)
 	ASSERT_EQ (2, election.election->last_votes.size ());
 }
 
+TEST (vote_processor, apply_threads)
+{
+	futurehead::system system;
+	futurehead::node_config node_config (futurehead::get_available_port (), system.logging);
+	node_config.vote_processor_threads = 4;
+	auto & node (*system.add_node (node_config));
+	futurehead::genesis genesis;
+	auto channel (std::make_shared<futurehead::transport::channel_udp> (node.network.udp_channels, node.network.endpoint (), node.network_params.protocol.protocol_version));
+	genesis.open->sideband_set (futurehead::block_sideband (futurehead::genesis_account, 0, futurehead::genesis_amount, 1, futurehead::seconds_since_epoch (), futurehead::epoch::epoch_0, false, false, false));
+	auto election (node.active.insert (genesis.open));
+	ASSERT_TRUE (election.election && election.inserted);
+	// Votes for many different blocks are spread over all apply threads
+	size_t const total{ 100 };
+	for (unsigned i = 0; i < total; ++i)
+	{
+		futurehead::keypair key;
+		ASSERT_FALSE (node.vote_processor.vote (std::make_shared<futurehead::vote> (key.pub, key.prv, 1, std::vector<futurehead::block_hash>{ genesis.open->hash () }), channel));
+		ASSERT_FALSE (node.vote_processor.vote (std::make_shared<futurehead::vote> (key.pub, key.prv, 1, std::vector<futurehead::block_hash>{ futurehead::block_hash (i + 1) }), channel));
+	}
+	node.vote_processor.flush ();
+	ASSERT_TRUE (node.vote_processor.empty ());
+	ASSERT_EQ (total + 1, election.election->last_votes.size ());
+	ASSERT_EQ (total, node.stats.count (futurehead::stat::type::vote, futurehead::stat::detail::vote_valid));
+	ASSERT_EQ (total, node.stats.count (futurehead::stat::type::vote, futurehead::stat::detail::vote_indeterminate));
+}
+
 TEST (vote_processor, no_capacity)
 {
 	futurehead::system system;
@@ -110,14 +136,15 @@ TEST (vote_processor, overflow)
 	auto & node (*system.add_node (node_flags));
 	futurehead::genesis genesis;
 	futurehead::keypair key;
-	auto vote (std::make_shared<futurehead::vote> (key.pub, key.prv, 1, std::vector<futurehead::block_hash>{ genesis.open->hash () }));
 	auto channel (std::make_shared<futurehead::transport::channel_udp> (node.network.udp_channels, node.network.endpoint (), node.network_params.protocol.protocol_version));
 
 	// No way to lock the processor, but queueing votes in quick succession must result in overflow
+	// Votes from the same representative for the same blocks replace each other, so every vote is for a different block
 	size_t not_processed{ 0 };
 	size_t const total{ 1000 };
 	for (unsigned i = 0; i < total; ++i)
 	{
+		auto vote (std::make_shared<futurehead::vote> (key.pub, key.prv, 1, std::vector<futurehead::block_hash>{ futurehead::block_hash (i + 1) }));
 		if (node.vote_processor.vote (vote, channel))
 		{
 			++not_processed;
@@ -126,10 +153,52 @@ TEST (vote_processor, overflow)
 	ASSERT_GT (not_processed, 0);
 	ASSERT_LT (not_processed, total);
 	ASSERT_EQ (not_processed, node.stats.count (futurehead::stat::type::vote, futurehead::stat::detail::vote_overflow));
+	ASSERT_EQ (not_processed, node.stats.count (futurehead::stat::type::vote_queue_drop, futurehead::stat::detail::bucket_0));
 }
 
-namespace futurehead
+TEST (vote_processor, duplicate)
+{
+	futurehead::system system (1);
+	auto & node (*system.nodes[0]);
+	futurehead::genesis genesis;
+	futurehead::keypair key;
+	auto vote (std::make_shared<futurehead::vote> (key.pub, key.prv, 1, std::vector<futurehead::block_hash>{ genesis.open->hash () }));
+	auto channel (std::make_shared<futurehead::transport::channel_udp> (node.network.udp_channels, node.network.endpoint (), node.network_params.protocol.protocol_version));
+	size_t const total{ 100 };
+	for (unsigned i = 0; i < total; ++i)
+	{
+		ASSERT_FALSE (node.vote_processor.vote (vote, channel));
+	}
+	node.vote_processor.flush ();
+	// Every vote is either verified or merged with the identical vote still in the queue
+	auto verified (node.stats.count (futurehead::stat::type::vote_queue, futurehead::stat::detail::bucket_0));
+	ASSERT_LE (1, verified);
+	ASSERT_EQ (total, verified + node.stats.count (futurehead::stat::type::vote, futurehead::stat::detail::vote_duplicate));
+	ASSERT_EQ (0, node.stats.count (futurehead::stat::type::vote, futurehead::stat::detail::vote_overflow));
+}
+
+TEST (vote_processor, replace)
 {
+	futurehead::system system (1);
+	auto & node (*system.nodes[0]);
+	futurehead::genesis genesis;
+	futurehead::keypair key;
+	auto channel (std::make_shared<futurehead::transport::channel_udp> (node.network.udp_channels, node.network.endpoint (), node.network_params.protocol.protocol_version));
+	size_t const total{ 100 };
+	for (unsigned i = 0; i < total; ++i)
+	{
+		ASSERT_FALSE (node.vote_processor.vote (std::make_shared<futurehead::vote> (key.pub, key.prv, i + 1, std::vector<futurehead::block_hash>{ genesis.open->hash () }), channel));
+	}
+	// An older vote is dropped while a newer one is still queued
+	ASSERT_FALSE (node.vote_processor.vote (std::make_shared<futurehead::vote> (key.pub, key.prv, 0, std::vector<futurehead::block_hash>{ genesis.open->hash () }), channel));
+	node.vote_processor.flush ();
+	// Every vote is either verified or replaced a queued vote from the same representative, the representative never holds more than one slot
+	auto verified (node.stats.count (futurehead::stat::type::vote_queue, futurehead::stat::detail::bucket_0));
+	ASSERT_LE (1, verified);
+	ASSERT_EQ (total + 1, verified + node.stats.count (futurehead::stat::type::vote, futurehead::stat::detail::vote_replaced) + node.stats.count (futurehead::stat::type::vote, futurehead::stat::detail::vote_duplicate));
+	ASSERT_EQ (0, node.stats.count (futurehead::stat::type::vote, futurehead::stat::detail::vote_overflow));
+}
+
 TEST (vote_processor, weights)
 {
 	futurehead::system system (4);
@@ -163,23 +232,59 @@ TEST (vote_processor, weights)
 	{
 		ASSERT_NO_ERROR (system.poll ());
 	}
-	node.vote_processor.calculate_weights ();
 
-	ASSERT_EQ (node.vote_processor.representatives_1.end (), node.vote_processor.representatives_1.find (key0.pub));
-	ASSERT_EQ (node.vote_processor.representatives_2.end (), node.vote_processor.representatives_2.find (key0.pub));
-	ASSERT_EQ (node.vote_processor.representatives_3.end (), node.vote_processor.representatives_3.find (key0.pub));
+	ASSERT_EQ (0, node.vote_processor.bucket (futurehead::keypair ().pub));
+	ASSERT_EQ (0, node.vote_processor.bucket (key0.pub));
+	ASSERT_EQ (1, node.vote_processor.bucket (key1.pub));
+	ASSERT_EQ (2, node.vote_processor.bucket (key2.pub));
+	ASSERT_EQ (3, node.vote_processor.bucket (futurehead::test_genesis_key.pub));
+}
 
-	ASSERT_NE (node.vote_processor.representatives_1.end (), node.vote_processor.representatives_1.find (key1.pub));
-	ASSERT_EQ (node.vote_processor.representatives_2.end (), node.vote_processor.representatives_2.find (key1.pub));
-	ASSERT_EQ (node.vote_processor.representatives_3.end (), node.vote_processor.representatives_3.find (key1.pub));
+namespace futurehead
+{
+TEST (vote_processor, bucket_eviction)
+{
+	futurehead::system system (1);
+	auto & node (*system.nodes[0]);
+	futurehead::genesis genesis;
+	auto channel (std::make_shared<futurehead::transport::channel_udp> (node.network.udp_channels, node.network.endpoint (), node.network_params.protocol.protocol_version));
+	auto & processor (node.vote_processor);
+	std::vector<std::shared_ptr<futurehead::vote>> votes;
+	futurehead::lock_guard<std::mutex> guard (processor.mutex);
+	auto queue = [&](size_t bucket_a) {
+		futurehead::keypair key;
+		auto vote (std::make_shared<futurehead::vote> (key.pub, key.prv, 1, std::vector<futurehead::block_hash>{ genesis.open->hash () }));
+		processor.buckets[bucket_a].push_back ({ vote, channel, processor.queue_key (*vote), std::chrono::steady_clock::now () });
+		processor.queued.emplace (processor.queue_key (*vote), &processor.buckets[bucket_a].back ());
+		++processor.votes_size;
+		votes.push_back (vote);
+	};
+	queue (0);
+	queue (0);
+	queue (0);
+	queue (3);
+	queue (1);
 
-	ASSERT_NE (node.vote_processor.representatives_1.end (), node.vote_processor.representatives_1.find (key2.pub));
-	ASSERT_NE (node.vote_processor.representatives_2.end (), node.vote_processor.representatives_2.find (key2.pub));
-	ASSERT_EQ (node.vote_processor.representatives_3.end (), node.vote_processor.representatives_3.find (key2.pub));
+	// Only votes of lower buckets can be evicted, oldest first
+	ASSERT_FALSE (processor.evict_below (0));
+	ASSERT_TRUE (processor.evict_below (2));
+	ASSERT_EQ (4, processor.votes_size);
+	ASSERT_EQ (2, processor.buckets[0].size ());
+	ASSERT_EQ (votes[1], processor.buckets[0].front ().vote);
+	ASSERT_EQ (processor.queued.end (), processor.queued.find (processor.queue_key (*votes[0])));
+	ASSERT_EQ (1, node.stats.count (futurehead::stat::type::vote_queue_drop, futurehead::stat::detail::bucket_0));
 
-	ASSERT_NE (node.vote_processor.representatives_1.end (), node.vote_processor.representatives_1.find (futurehead::test_genesis_key.pub));
-	ASSERT_NE (node.vote_processor.representatives_2.end (), node.vote_processor.representatives_2.find (futurehead::test_genesis_key.pub));
-	ASSERT_NE (node.vote_processor.representatives_3.end (), node.vote_processor.representatives_3.find (futurehead::test_genesis_key.pub));
+	// Buckets are served round-robin, highest weight first
+	auto batch (processor.dequeue_batch ());
+	ASSERT_EQ (4, batch.size ());
+	ASSERT_EQ (votes[3], batch[0].first);
+	ASSERT_EQ (votes[4], batch[1].first);
+	ASSERT_EQ (votes[1], batch[2].first);
+	ASSERT_EQ (votes[2], batch[3].first);
+	ASSERT_EQ (0, processor.votes_size);
+	ASSERT_TRUE (processor.queued.empty ());
+	ASSERT_EQ (2, node.stats.count (futurehead::stat::type::vote_queue, futurehead::stat::detail::bucket_0));
+	ASSERT_EQ (1, node.stats.count (futurehead::stat::type::vote_queue, futurehead::stat::detail::bucket_3));
 }
 }
 
@@ -448,6 +448,77 @@ TEST (websocket, confirmation_options_update)
 	}
 }
 
+// Sessions filtering on different accounts only receive their own confirmations, and share serialized messages with unfiltered sessions
+TEST (websocket, confirmation_accounts_index)
+{
+	futurehead::system system;
+	futurehead::node_config config (futurehead::get_available_port (), system.logging);
+	config.websocket_config.enabled = true;
+	config.websocket_config.port = futurehead::get_available_port ();
+	auto node1 (system.add_node (config));
+
+	futurehead::keypair key;
+	futurehead::keypair other;
+	std::atomic<bool> ack_ready{ false };
+	auto task = ([&ack_ready, &key, &other, config, &node1]() {
+		fake_websocket_client matching (config.websocket_config.port);
+		matching.send_message (boost::str (boost::format (R"json({"action": "subscribe", "topic": "confirmation", "ack": "true", "options": {"accounts": ["%1%"]}})json") % key.pub.to_account ()));
+		matching.await_ack ();
+		fake_websocket_client filtered (config.websocket_config.port);
+		filtered.send_message (boost::str (boost::format (R"json({"action": "subscribe", "topic": "confirmation", "ack": "true", "options": {"accounts": ["%1%"]}})json") % other.pub.to_account ()));
+		filtered.await_ack ();
+		fake_websocket_client unfiltered (config.websocket_config.port);
+		unfiltered.send_message (R"json({"action": "subscribe", "topic": "confirmation", "ack": "true", "options": {"include_block": "false"}})json");
+		unfiltered.await_ack ();
+		fake_websocket_client unfiltered_with_block (config.websocket_config.port);
+		unfiltered_with_block.send_message (R"json({"action": "subscribe", "topic": "confirmation", "ack": "true"})json");
+		unfiltered_with_block.await_ack ();
+		EXPECT_EQ (4, node1->websocket_server->subscriber_count (futurehead::websocket::topic::confirmation));
+		ack_ready = true;
+
+		auto response (matching.get_response ());
+		EXPECT_TRUE (response);
+		boost::property_tree::ptree event;
+		std::stringstream stream;
+		stream << response.get ();
+		boost::property_tree::read_json (stream, event);
+		EXPECT_EQ (key.pub.to_account (), event.get<std::string> ("message.block.link_as_account"));
+
+		auto response_unfiltered (unfiltered.get_response ());
+		EXPECT_TRUE (response_unfiltered);
+		boost::property_tree::ptree event_unfiltered;
+		std::stringstream stream_unfiltered;
+		stream_unfiltered << response_unfiltered.get ();
+		boost::property_tree::read_json (stream_unfiltered, event_unfiltered);
+		EXPECT_FALSE (event_unfiltered.get_child_optional ("message.block"));
+
+		// Both sessions including the block receive the same message
+		auto response_with_block (unfiltered_with_block.get_response ());
+		EXPECT_TRUE (response_with_block);
+		EXPECT_EQ (response.get (), response_with_block.get ());
+
+		EXPECT_FALSE (filtered.get_response (1s));
+	});
+	auto future = std::async (std::launch::async, task);
+
+	system.deadline_set (5s);
+	while (!ack_ready)
+	{
+		ASSERT_NO_ERROR (system.poll ());
+	}
+
+	system.wallet (0)->insert_adhoc (futurehead::test_genesis_key.prv);
+	auto previous (node1->latest (futurehead::test_genesis_key.pub));
+	auto send (std::make_shared<futurehead::state_block> (futurehead::test_genesis_key.pub, previous, futurehead::test_genesis_key.pub, futurehead::genesis_amount - futurehead::Gxrb_ratio, key.pub, futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub, *system.work.generate (previous)));
+	node1->process_active (send);
+
+	system.deadline_set (5s);
+	while (future.wait_for (0s) != std::future_status::ready)
+	{
+		ASSERT_NO_ERROR (system.poll ());
+	}
+}
+
 // Subscribes to votes, sends a block and awaits websocket notification of a vote arrival
 TEST (websocket, vote)
 {
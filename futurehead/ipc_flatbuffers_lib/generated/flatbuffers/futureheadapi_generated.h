@@ -40,6 +40,58 @@ struct BlockInfo;
 struct BlockInfoBuilder;
 struct BlockInfoT;
 
+struct AccountInfo;
+struct AccountInfoBuilder;
+struct AccountInfoT;
+
+struct AccountInfoResponse;
+struct AccountInfoResponseBuilder;
+struct AccountInfoResponseT;
+
+struct AccountsBalances;
+struct AccountsBalancesBuilder;
+struct AccountsBalancesT;
+
+struct AccountBalance;
+struct AccountBalanceBuilder;
+struct AccountBalanceT;
+
+struct AccountsBalancesResponse;
+struct AccountsBalancesResponseBuilder;
+struct AccountsBalancesResponseT;
+
+struct BlocksInfo;
+struct BlocksInfoBuilder;
+struct BlocksInfoT;
+
+struct BlocksInfoEntry;
+struct BlocksInfoEntryBuilder;
+struct BlocksInfoEntryT;
+
+struct BlocksInfoResponse;
+struct BlocksInfoResponseBuilder;
+struct BlocksInfoResponseT;
+
+struct Pending;
+struct PendingBuilder;
+struct PendingT;
+
+struct PendingBlock;
+struct PendingBlockBuilder;
+struct PendingBlockT;
+
+struct PendingResponse;
+struct PendingResponseBuilder;
+struct PendingResponseT;
+
+struct BlockCount;
+struct BlockCountBuilder;
+struct BlockCountT;
+
+struct BlockCountResponse;
+struct BlockCountResponseBuilder;
+struct BlockCountResponseT;
+
 struct ServiceRegister;
 struct ServiceRegisterBuilder;
 struct ServiceRegisterT;
@@ -108,6 +160,32 @@ inline const flatbuffers::TypeTable *BlockStateTypeTable();
 
 inline const flatbuffers::TypeTable *BlockInfoTypeTable();
 
+inline const flatbuffers::TypeTable *AccountInfoTypeTable();
+
+inline const flatbuffers::TypeTable *AccountInfoResponseTypeTable();
+
+inline const flatbuffers::TypeTable *AccountsBalancesTypeTable();
+
+inline const flatbuffers::TypeTable *AccountBalanceTypeTable();
+
+inline const flatbuffers::TypeTable *AccountsBalancesResponseTypeTable();
+
+inline const flatbuffers::TypeTable *BlocksInfoTypeTable();
+
+inline const flatbuffers::TypeTable *BlocksInfoEntryTypeTable();
+
+inline const flatbuffers::TypeTable *BlocksInfoResponseTypeTable();
+
+inline const flatbuffers::TypeTable *PendingTypeTable();
+
+inline const flatbuffers::TypeTable *PendingBlockTypeTable();
+
+inline const flatbuffers::TypeTable *PendingResponseTypeTable();
+
+inline const flatbuffers::TypeTable *BlockCountTypeTable();
+
+inline const flatbuffers::TypeTable *BlockCountResponseTypeTable();
+
 inline const flatbuffers::TypeTable *ServiceRegisterTypeTable();
 
 inline const flatbuffers::TypeTable *ServiceStopTypeTable();
@@ -403,11 +481,21 @@ enum Message {
   Message_ServiceStop = 11,
   Message_TopicServiceStop = 12,
   Message_EventServiceStop = 13,
+  Message_AccountInfo = 14,
+  Message_AccountInfoResponse = 15,
+  Message_AccountsBalances = 16,
+  Message_AccountsBalancesResponse = 17,
+  Message_BlocksInfo = 18,
+  Message_BlocksInfoResponse = 19,
+  Message_Pending = 20,
+  Message_PendingResponse = 21,
+  Message_BlockCount = 22,
+  Message_BlockCountResponse = 23,
   Message_MIN = Message_NONE,
-  Message_MAX = Message_EventServiceStop
+  Message_MAX = Message_BlockCountResponse
 };
 
-inline const Message (&EnumValuesMessage())[14] {
+inline const Message (&EnumValuesMessage())[24] {
   static const Message values[] = {
     Message_NONE,
     Message_Error,
@@ -422,13 +510,23 @@ inline const Message (&EnumValuesMessage())[14] {
     Message_ServiceRegister,
     Message_ServiceStop,
     Message_TopicServiceStop,
-    Message_EventServiceStop
+    Message_EventServiceStop,
+    Message_AccountInfo,
+    Message_AccountInfoResponse,
+    Message_AccountsBalances,
+    Message_AccountsBalancesResponse,
+    Message_BlocksInfo,
+    Message_BlocksInfoResponse,
+    Message_Pending,
+    Message_PendingResponse,
+    Message_BlockCount,
+    Message_BlockCountResponse
   };
   return values;
 }
 
 inline const char * const *EnumNamesMessage() {
-  static const char * const names[15] = {
+  static const char * const names[25] = {
     "NONE",
     "Error",
     "Success",
@@ -443,13 +541,23 @@ inline const char * const *EnumNamesMessage() {
     "ServiceStop",
     "TopicServiceStop",
     "EventServiceStop",
+    "AccountInfo",
+    "AccountInfoResponse",
+    "AccountsBalances",
+    "AccountsBalancesResponse",
+    "BlocksInfo",
+    "BlocksInfoResponse",
+    "Pending",
+    "PendingResponse",
+    "BlockCount",
+    "BlockCountResponse",
     nullptr
   };
   return names;
 }
 
 inline const char *EnumNameMessage(Message e) {
-  if (flatbuffers::IsOutRange(e, Message_NONE, Message_EventServiceStop)) return "";
+  if (flatbuffers::IsOutRange(e, Message_NONE, Message_BlockCountResponse)) return "";
   const size_t index = static_cast<size_t>(e);
   return EnumNamesMessage()[index];
 }
@@ -510,6 +618,46 @@ template<> struct MessageTraits<futureheadapi::EventServiceStop> {
   static const Message enum_value = Message_EventServiceStop;
 };
 
+template<> struct MessageTraits<futureheadapi::AccountInfo> {
+  static const Message enum_value = Message_AccountInfo;
+};
+
+template<> struct MessageTraits<futureheadapi::AccountInfoResponse> {
+  static const Message enum_value = Message_AccountInfoResponse;
+};
+
+template<> struct MessageTraits<futureheadapi::AccountsBalances> {
+  static const Message enum_value = Message_AccountsBalances;
+};
+
+template<> struct MessageTraits<futureheadapi::AccountsBalancesResponse> {
+  static const Message enum_value = Message_AccountsBalancesResponse;
+};
+
+template<> struct MessageTraits<futureheadapi::BlocksInfo> {
+  static const Message enum_value = Message_BlocksInfo;
+};
+
+template<> struct MessageTraits<futureheadapi::BlocksInfoResponse> {
+  static const Message enum_value = Message_BlocksInfoResponse;
+};
+
+template<> struct MessageTraits<futureheadapi::Pending> {
+  static const Message enum_value = Message_Pending;
+};
+
+template<> struct MessageTraits<futureheadapi::PendingResponse> {
+  static const Message enum_value = Message_PendingResponse;
+};
+
+template<> struct MessageTraits<futureheadapi::BlockCount> {
+  static const Message enum_value = Message_BlockCount;
+};
+
+template<> struct MessageTraits<futureheadapi::BlockCountResponse> {
+  static const Message enum_value = Message_BlockCountResponse;
+};
+
 struct MessageUnion {
   Message type;
   void *value;
@@ -646,6 +794,86 @@ struct MessageUnion {
     return type == Message_EventServiceStop ?
       reinterpret_cast<const futureheadapi::EventServiceStopT *>(value) : nullptr;
   }
+  futureheadapi::AccountInfoT *AsAccountInfo() {
+    return type == Message_AccountInfo ?
+      reinterpret_cast<futureheadapi::AccountInfoT *>(value) : nullptr;
+  }
+  const futureheadapi::AccountInfoT *AsAccountInfo() const {
+    return type == Message_AccountInfo ?
+      reinterpret_cast<const futureheadapi::AccountInfoT *>(value) : nullptr;
+  }
+  futureheadapi::AccountInfoResponseT *AsAccountInfoResponse() {
+    return type == Message_AccountInfoResponse ?
+      reinterpret_cast<futureheadapi::AccountInfoResponseT *>(value) : nullptr;
+  }
+  const futureheadapi::AccountInfoResponseT *AsAccountInfoResponse() const {
+    return type == Message_AccountInfoResponse ?
+      reinterpret_cast<const futureheadapi::AccountInfoResponseT *>(value) : nullptr;
+  }
+  futureheadapi::AccountsBalancesT *AsAccountsBalances() {
+    return type == Message_AccountsBalances ?
+      reinterpret_cast<futureheadapi::AccountsBalancesT *>(value) : nullptr;
+  }
+  const futureheadapi::AccountsBalancesT *AsAccountsBalances() const {
+    return type == Message_AccountsBalances ?
+      reinterpret_cast<const futureheadapi::AccountsBalancesT *>(value) : nullptr;
+  }
+  futureheadapi::AccountsBalancesResponseT *AsAccountsBalancesResponse() {
+    return type == Message_AccountsBalancesResponse ?
+      reinterpret_cast<futureheadapi::AccountsBalancesResponseT *>(value) : nullptr;
+  }
+  const futureheadapi::AccountsBalancesResponseT *AsAccountsBalancesResponse() const {
+    return type == Message_AccountsBalancesResponse ?
+      reinterpret_cast<const futureheadapi::AccountsBalancesResponseT *>(value) : nullptr;
+  }
+  futureheadapi::BlocksInfoT *AsBlocksInfo() {
+    return type == Message_BlocksInfo ?
+      reinterpret_cast<futureheadapi::BlocksInfoT *>(value) : nullptr;
+  }
+  const futureheadapi::BlocksInfoT *AsBlocksInfo() const {
+    return type == Message_BlocksInfo ?
+      reinterpret_cast<const futureheadapi::BlocksInfoT *>(value) : nullptr;
+  }
+  futureheadapi::BlocksInfoResponseT *AsBlocksInfoResponse() {
+    return type == Message_BlocksInfoResponse ?
+      reinterpret_cast<futureheadapi::BlocksInfoResponseT *>(value) : nullptr;
+  }
+  const futureheadapi::BlocksInfoResponseT *AsBlocksInfoResponse() const {
+    return type == Message_BlocksInfoResponse ?
+      reinterpret_cast<const futureheadapi::BlocksInfoResponseT *>(value) : nullptr;
+  }
+  futureheadapi::PendingT *AsPending() {
+    return type == Message_Pending ?
+      reinterpret_cast<futureheadapi::PendingT *>(value) : nullptr;
+  }
+  const futureheadapi::PendingT *AsPending() const {
+    return type == Message_Pending ?
+      reinterpret_cast<const futureheadapi::PendingT *>(value) : nullptr;
+  }
+  futureheadapi::PendingResponseT *AsPendingResponse() {
+    return type == Message_PendingResponse ?
+      reinterpret_cast<futureheadapi::PendingResponseT *>(value) : nullptr;
+  }
+  const futureheadapi::PendingResponseT *AsPendingResponse() const {
+    return type == Message_PendingResponse ?
+      reinterpret_cast<const futureheadapi::PendingResponseT *>(value) : nullptr;
+  }
+  futureheadapi::BlockCountT *AsBlockCount() {
+    return type == Message_BlockCount ?
+      reinterpret_cast<futureheadapi::BlockCountT *>(value) : nullptr;
+  }
+  const futureheadapi::BlockCountT *AsBlockCount() const {
+    return type == Message_BlockCount ?
+      reinterpret_cast<const futureheadapi::BlockCountT *>(value) : nullptr;
+  }
+  futureheadapi::BlockCountResponseT *AsBlockCountResponse() {
+    return type == Message_BlockCountResponse ?
+      reinterpret_cast<futureheadapi::BlockCountResponseT *>(value) : nullptr;
+  }
+  const futureheadapi::BlockCountResponseT *AsBlockCountResponse() const {
+    return type == Message_BlockCountResponse ?
+      reinterpret_cast<const futureheadapi::BlockCountResponseT *>(value) : nullptr;
+  }
 };
 
 bool VerifyMessage(flatbuffers::Verifier &verifier, const void *obj, Message type);
@@ -1791,634 +2019,853 @@ inline flatbuffers::Offset<BlockInfo> CreateBlockInfo(
 
 flatbuffers::Offset<BlockInfo> CreateBlockInfo(flatbuffers::FlatBufferBuilder &_fbb, const BlockInfoT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 
-struct ServiceRegisterT : public flatbuffers::NativeTable {
-  typedef ServiceRegister TableType;
+struct AccountInfoT : public flatbuffers::NativeTable {
+  typedef AccountInfo TableType;
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.ServiceRegisterT";
+    return "futureheadapi.AccountInfoT";
   }
-  std::string service_name;
-  ServiceRegisterT() {
+  std::string account;
+  bool include_representative;
+  bool include_voting_weight;
+  bool include_pending;
+  AccountInfoT()
+      : include_representative(false),
+        include_voting_weight(false),
+        include_pending(false) {
   }
 };
 
-struct ServiceRegister FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
-  typedef ServiceRegisterT NativeTableType;
-  typedef ServiceRegisterBuilder Builder;
+struct AccountInfo FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef AccountInfoT NativeTableType;
+  typedef AccountInfoBuilder Builder;
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
-    return ServiceRegisterTypeTable();
+    return AccountInfoTypeTable();
   }
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.ServiceRegister";
+    return "futureheadapi.AccountInfo";
   }
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_SERVICE_NAME = 4
+    VT_ACCOUNT = 4,
+    VT_INCLUDE_REPRESENTATIVE = 6,
+    VT_INCLUDE_VOTING_WEIGHT = 8,
+    VT_INCLUDE_PENDING = 10
   };
-  const flatbuffers::String *service_name() const {
-    return GetPointer<const flatbuffers::String *>(VT_SERVICE_NAME);
+  const flatbuffers::String *account() const {
+    return GetPointer<const flatbuffers::String *>(VT_ACCOUNT);
   }
-  flatbuffers::String *mutable_service_name() {
-    return GetPointer<flatbuffers::String *>(VT_SERVICE_NAME);
+  flatbuffers::String *mutable_account() {
+    return GetPointer<flatbuffers::String *>(VT_ACCOUNT);
+  }
+  bool include_representative() const {
+    return GetField<uint8_t>(VT_INCLUDE_REPRESENTATIVE, 0) != 0;
+  }
+  bool mutate_include_representative(bool _include_representative) {
+    return SetField<uint8_t>(VT_INCLUDE_REPRESENTATIVE, static_cast<uint8_t>(_include_representative), 0);
+  }
+  bool include_voting_weight() const {
+    return GetField<uint8_t>(VT_INCLUDE_VOTING_WEIGHT, 0) != 0;
+  }
+  bool mutate_include_voting_weight(bool _include_voting_weight) {
+    return SetField<uint8_t>(VT_INCLUDE_VOTING_WEIGHT, static_cast<uint8_t>(_include_voting_weight), 0);
+  }
+  bool include_pending() const {
+    return GetField<uint8_t>(VT_INCLUDE_PENDING, 0) != 0;
+  }
+  bool mutate_include_pending(bool _include_pending) {
+    return SetField<uint8_t>(VT_INCLUDE_PENDING, static_cast<uint8_t>(_include_pending), 0);
   }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
-           VerifyOffset(verifier, VT_SERVICE_NAME) &&
-           verifier.VerifyString(service_name()) &&
+           VerifyOffsetRequired(verifier, VT_ACCOUNT) &&
+           verifier.VerifyString(account()) &&
+           VerifyField<uint8_t>(verifier, VT_INCLUDE_REPRESENTATIVE) &&
+           VerifyField<uint8_t>(verifier, VT_INCLUDE_VOTING_WEIGHT) &&
+           VerifyField<uint8_t>(verifier, VT_INCLUDE_PENDING) &&
            verifier.EndTable();
   }
-  ServiceRegisterT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  void UnPackTo(ServiceRegisterT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  static flatbuffers::Offset<ServiceRegister> Pack(flatbuffers::FlatBufferBuilder &_fbb, const ServiceRegisterT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  AccountInfoT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(AccountInfoT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<AccountInfo> Pack(flatbuffers::FlatBufferBuilder &_fbb, const AccountInfoT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
-struct ServiceRegisterBuilder {
-  typedef ServiceRegister Table;
+struct AccountInfoBuilder {
+  typedef AccountInfo Table;
   flatbuffers::FlatBufferBuilder &fbb_;
   flatbuffers::uoffset_t start_;
-  void add_service_name(flatbuffers::Offset<flatbuffers::String> service_name) {
-    fbb_.AddOffset(ServiceRegister::VT_SERVICE_NAME, service_name);
+  void add_account(flatbuffers::Offset<flatbuffers::String> account) {
+    fbb_.AddOffset(AccountInfo::VT_ACCOUNT, account);
   }
-  explicit ServiceRegisterBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+  void add_include_representative(bool include_representative) {
+    fbb_.AddElement<uint8_t>(AccountInfo::VT_INCLUDE_REPRESENTATIVE, static_cast<uint8_t>(include_representative), 0);
+  }
+  void add_include_voting_weight(bool include_voting_weight) {
+    fbb_.AddElement<uint8_t>(AccountInfo::VT_INCLUDE_VOTING_WEIGHT, static_cast<uint8_t>(include_voting_weight), 0);
+  }
+  void add_include_pending(bool include_pending) {
+    fbb_.AddElement<uint8_t>(AccountInfo::VT_INCLUDE_PENDING, static_cast<uint8_t>(include_pending), 0);
+  }
+  explicit AccountInfoBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
   }
-  ServiceRegisterBuilder &operator=(const ServiceRegisterBuilder &);
-  flatbuffers::Offset<ServiceRegister> Finish() {
+  AccountInfoBuilder &operator=(const AccountInfoBuilder &);
+  flatbuffers::Offset<AccountInfo> Finish() {
     const auto end = fbb_.EndTable(start_);
-    auto o = flatbuffers::Offset<ServiceRegister>(end);
+    auto o = flatbuffers::Offset<AccountInfo>(end);
+    fbb_.Required(o, AccountInfo::VT_ACCOUNT);
     return o;
   }
 };
 
-inline flatbuffers::Offset<ServiceRegister> CreateServiceRegister(
+inline flatbuffers::Offset<AccountInfo> CreateAccountInfo(
     flatbuffers::FlatBufferBuilder &_fbb,
-    flatbuffers::Offset<flatbuffers::String> service_name = 0) {
-  ServiceRegisterBuilder builder_(_fbb);
-  builder_.add_service_name(service_name);
+    flatbuffers::Offset<flatbuffers::String> account = 0,
+    bool include_representative = false,
+    bool include_voting_weight = false,
+    bool include_pending = false) {
+  AccountInfoBuilder builder_(_fbb);
+  builder_.add_account(account);
+  builder_.add_include_pending(include_pending);
+  builder_.add_include_voting_weight(include_voting_weight);
+  builder_.add_include_representative(include_representative);
   return builder_.Finish();
 }
 
-inline flatbuffers::Offset<ServiceRegister> CreateServiceRegisterDirect(
+inline flatbuffers::Offset<AccountInfo> CreateAccountInfoDirect(
     flatbuffers::FlatBufferBuilder &_fbb,
-    const char *service_name = nullptr) {
-  auto service_name__ = service_name ? _fbb.CreateString(service_name) : 0;
-  return futureheadapi::CreateServiceRegister(
+    const char *account = nullptr,
+    bool include_representative = false,
+    bool include_voting_weight = false,
+    bool include_pending = false) {
+  auto account__ = account ? _fbb.CreateString(account) : 0;
+  return futureheadapi::CreateAccountInfo(
       _fbb,
-      service_name__);
+      account__,
+      include_representative,
+      include_voting_weight,
+      include_pending);
 }
 
-flatbuffers::Offset<ServiceRegister> CreateServiceRegister(flatbuffers::FlatBufferBuilder &_fbb, const ServiceRegisterT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+flatbuffers::Offset<AccountInfo> CreateAccountInfo(flatbuffers::FlatBufferBuilder &_fbb, const AccountInfoT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 
-struct ServiceStopT : public flatbuffers::NativeTable {
-  typedef ServiceStop TableType;
+struct AccountInfoResponseT : public flatbuffers::NativeTable {
+  typedef AccountInfoResponse TableType;
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.ServiceStopT";
+    return "futureheadapi.AccountInfoResponseT";
   }
-  std::string service_name;
-  bool restart;
-  ServiceStopT()
-      : restart(false) {
+  std::string frontier;
+  std::string open_block;
+  std::string representative_block;
+  std::string balance;
+  uint64_t modified_timestamp;
+  uint64_t block_count;
+  uint8_t account_version;
+  uint64_t confirmation_height;
+  std::string confirmation_height_frontier;
+  std::string representative;
+  std::string voting_weight;
+  std::string pending;
+  AccountInfoResponseT()
+      : modified_timestamp(0),
+        block_count(0),
+        account_version(0),
+        confirmation_height(0) {
   }
 };
 
-struct ServiceStop FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
-  typedef ServiceStopT NativeTableType;
-  typedef ServiceStopBuilder Builder;
+struct AccountInfoResponse FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef AccountInfoResponseT NativeTableType;
+  typedef AccountInfoResponseBuilder Builder;
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
-    return ServiceStopTypeTable();
+    return AccountInfoResponseTypeTable();
   }
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.ServiceStop";
+    return "futureheadapi.AccountInfoResponse";
   }
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_SERVICE_NAME = 4,
-    VT_RESTART = 6
+    VT_FRONTIER = 4,
+    VT_OPEN_BLOCK = 6,
+    VT_REPRESENTATIVE_BLOCK = 8,
+    VT_BALANCE = 10,
+    VT_MODIFIED_TIMESTAMP = 12,
+    VT_BLOCK_COUNT = 14,
+    VT_ACCOUNT_VERSION = 16,
+    VT_CONFIRMATION_HEIGHT = 18,
+    VT_CONFIRMATION_HEIGHT_FRONTIER = 20,
+    VT_REPRESENTATIVE = 22,
+    VT_VOTING_WEIGHT = 24,
+    VT_PENDING = 26
   };
-  const flatbuffers::String *service_name() const {
-    return GetPointer<const flatbuffers::String *>(VT_SERVICE_NAME);
+  const flatbuffers::String *frontier() const {
+    return GetPointer<const flatbuffers::String *>(VT_FRONTIER);
   }
-  flatbuffers::String *mutable_service_name() {
-    return GetPointer<flatbuffers::String *>(VT_SERVICE_NAME);
+  flatbuffers::String *mutable_frontier() {
+    return GetPointer<flatbuffers::String *>(VT_FRONTIER);
   }
-  bool restart() const {
-    return GetField<uint8_t>(VT_RESTART, 0) != 0;
+  const flatbuffers::String *open_block() const {
+    return GetPointer<const flatbuffers::String *>(VT_OPEN_BLOCK);
   }
-  bool mutate_restart(bool _restart) {
-    return SetField<uint8_t>(VT_RESTART, static_cast<uint8_t>(_restart), 0);
+  flatbuffers::String *mutable_open_block() {
+    return GetPointer<flatbuffers::String *>(VT_OPEN_BLOCK);
+  }
+  const flatbuffers::String *representative_block() const {
+    return GetPointer<const flatbuffers::String *>(VT_REPRESENTATIVE_BLOCK);
+  }
+  flatbuffers::String *mutable_representative_block() {
+    return GetPointer<flatbuffers::String *>(VT_REPRESENTATIVE_BLOCK);
+  }
+  const flatbuffers::String *balance() const {
+    return GetPointer<const flatbuffers::String *>(VT_BALANCE);
+  }
+  flatbuffers::String *mutable_balance() {
+    return GetPointer<flatbuffers::String *>(VT_BALANCE);
+  }
+  uint64_t modified_timestamp() const {
+    return GetField<uint64_t>(VT_MODIFIED_TIMESTAMP, 0);
+  }
+  bool mutate_modified_timestamp(uint64_t _modified_timestamp) {
+    return SetField<uint64_t>(VT_MODIFIED_TIMESTAMP, _modified_timestamp, 0);
+  }
+  uint64_t block_count() const {
+    return GetField<uint64_t>(VT_BLOCK_COUNT, 0);
+  }
+  bool mutate_block_count(uint64_t _block_count) {
+    return SetField<uint64_t>(VT_BLOCK_COUNT, _block_count, 0);
+  }
+  uint8_t account_version() const {
+    return GetField<uint8_t>(VT_ACCOUNT_VERSION, 0);
+  }
+  bool mutate_account_version(uint8_t _account_version) {
+    return SetField<uint8_t>(VT_ACCOUNT_VERSION, _account_version, 0);
+  }
+  uint64_t confirmation_height() const {
+    return GetField<uint64_t>(VT_CONFIRMATION_HEIGHT, 0);
+  }
+  bool mutate_confirmation_height(uint64_t _confirmation_height) {
+    return SetField<uint64_t>(VT_CONFIRMATION_HEIGHT, _confirmation_height, 0);
+  }
+  const flatbuffers::String *confirmation_height_frontier() const {
+    return GetPointer<const flatbuffers::String *>(VT_CONFIRMATION_HEIGHT_FRONTIER);
+  }
+  flatbuffers::String *mutable_confirmation_height_frontier() {
+    return GetPointer<flatbuffers::String *>(VT_CONFIRMATION_HEIGHT_FRONTIER);
+  }
+  const flatbuffers::String *representative() const {
+    return GetPointer<const flatbuffers::String *>(VT_REPRESENTATIVE);
+  }
+  flatbuffers::String *mutable_representative() {
+    return GetPointer<flatbuffers::String *>(VT_REPRESENTATIVE);
+  }
+  const flatbuffers::String *voting_weight() const {
+    return GetPointer<const flatbuffers::String *>(VT_VOTING_WEIGHT);
+  }
+  flatbuffers::String *mutable_voting_weight() {
+    return GetPointer<flatbuffers::String *>(VT_VOTING_WEIGHT);
+  }
+  const flatbuffers::String *pending() const {
+    return GetPointer<const flatbuffers::String *>(VT_PENDING);
+  }
+  flatbuffers::String *mutable_pending() {
+    return GetPointer<flatbuffers::String *>(VT_PENDING);
   }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
-           VerifyOffsetRequired(verifier, VT_SERVICE_NAME) &&
-           verifier.VerifyString(service_name()) &&
-           VerifyField<uint8_t>(verifier, VT_RESTART) &&
+           VerifyOffset(verifier, VT_FRONTIER) &&
+           verifier.VerifyString(frontier()) &&
+           VerifyOffset(verifier, VT_OPEN_BLOCK) &&
+           verifier.VerifyString(open_block()) &&
+           VerifyOffset(verifier, VT_REPRESENTATIVE_BLOCK) &&
+           verifier.VerifyString(representative_block()) &&
+           VerifyOffset(verifier, VT_BALANCE) &&
+           verifier.VerifyString(balance()) &&
+           VerifyField<uint64_t>(verifier, VT_MODIFIED_TIMESTAMP) &&
+           VerifyField<uint64_t>(verifier, VT_BLOCK_COUNT) &&
+           VerifyField<uint8_t>(verifier, VT_ACCOUNT_VERSION) &&
+           VerifyField<uint64_t>(verifier, VT_CONFIRMATION_HEIGHT) &&
+           VerifyOffset(verifier, VT_CONFIRMATION_HEIGHT_FRONTIER) &&
+           verifier.VerifyString(confirmation_height_frontier()) &&
+           VerifyOffset(verifier, VT_REPRESENTATIVE) &&
+           verifier.VerifyString(representative()) &&
+           VerifyOffset(verifier, VT_VOTING_WEIGHT) &&
+           verifier.VerifyString(voting_weight()) &&
+           VerifyOffset(verifier, VT_PENDING) &&
+           verifier.VerifyString(pending()) &&
            verifier.EndTable();
   }
-  ServiceStopT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  void UnPackTo(ServiceStopT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  static flatbuffers::Offset<ServiceStop> Pack(flatbuffers::FlatBufferBuilder &_fbb, const ServiceStopT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  AccountInfoResponseT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(AccountInfoResponseT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<AccountInfoResponse> Pack(flatbuffers::FlatBufferBuilder &_fbb, const AccountInfoResponseT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
-struct ServiceStopBuilder {
-  typedef ServiceStop Table;
+struct AccountInfoResponseBuilder {
+  typedef AccountInfoResponse Table;
   flatbuffers::FlatBufferBuilder &fbb_;
   flatbuffers::uoffset_t start_;
-  void add_service_name(flatbuffers::Offset<flatbuffers::String> service_name) {
-    fbb_.AddOffset(ServiceStop::VT_SERVICE_NAME, service_name);
+  void add_frontier(flatbuffers::Offset<flatbuffers::String> frontier) {
+    fbb_.AddOffset(AccountInfoResponse::VT_FRONTIER, frontier);
   }
-  void add_restart(bool restart) {
-    fbb_.AddElement<uint8_t>(ServiceStop::VT_RESTART, static_cast<uint8_t>(restart), 0);
+  void add_open_block(flatbuffers::Offset<flatbuffers::String> open_block) {
+    fbb_.AddOffset(AccountInfoResponse::VT_OPEN_BLOCK, open_block);
   }
-  explicit ServiceStopBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+  void add_representative_block(flatbuffers::Offset<flatbuffers::String> representative_block) {
+    fbb_.AddOffset(AccountInfoResponse::VT_REPRESENTATIVE_BLOCK, representative_block);
+  }
+  void add_balance(flatbuffers::Offset<flatbuffers::String> balance) {
+    fbb_.AddOffset(AccountInfoResponse::VT_BALANCE, balance);
+  }
+  void add_modified_timestamp(uint64_t modified_timestamp) {
+    fbb_.AddElement<uint64_t>(AccountInfoResponse::VT_MODIFIED_TIMESTAMP, modified_timestamp, 0);
+  }
+  void add_block_count(uint64_t block_count) {
+    fbb_.AddElement<uint64_t>(AccountInfoResponse::VT_BLOCK_COUNT, block_count, 0);
+  }
+  void add_account_version(uint8_t account_version) {
+    fbb_.AddElement<uint8_t>(AccountInfoResponse::VT_ACCOUNT_VERSION, account_version, 0);
+  }
+  void add_confirmation_height(uint64_t confirmation_height) {
+    fbb_.AddElement<uint64_t>(AccountInfoResponse::VT_CONFIRMATION_HEIGHT, confirmation_height, 0);
+  }
+  void add_confirmation_height_frontier(flatbuffers::Offset<flatbuffers::String> confirmation_height_frontier) {
+    fbb_.AddOffset(AccountInfoResponse::VT_CONFIRMATION_HEIGHT_FRONTIER, confirmation_height_frontier);
+  }
+  void add_representative(flatbuffers::Offset<flatbuffers::String> representative) {
+    fbb_.AddOffset(AccountInfoResponse::VT_REPRESENTATIVE, representative);
+  }
+  void add_voting_weight(flatbuffers::Offset<flatbuffers::String> voting_weight) {
+    fbb_.AddOffset(AccountInfoResponse::VT_VOTING_WEIGHT, voting_weight);
+  }
+  void add_pending(flatbuffers::Offset<flatbuffers::String> pending) {
+    fbb_.AddOffset(AccountInfoResponse::VT_PENDING, pending);
+  }
+  explicit AccountInfoResponseBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
   }
-  ServiceStopBuilder &operator=(const ServiceStopBuilder &);
-  flatbuffers::Offset<ServiceStop> Finish() {
+  AccountInfoResponseBuilder &operator=(const AccountInfoResponseBuilder &);
+  flatbuffers::Offset<AccountInfoResponse> Finish() {
     const auto end = fbb_.EndTable(start_);
-    auto o = flatbuffers::Offset<ServiceStop>(end);
-    fbb_.Required(o, ServiceStop::VT_SERVICE_NAME);
+    auto o = flatbuffers::Offset<AccountInfoResponse>(end);
     return o;
   }
 };
 
-inline flatbuffers::Offset<ServiceStop> CreateServiceStop(
+inline flatbuffers::Offset<AccountInfoResponse> CreateAccountInfoResponse(
     flatbuffers::FlatBufferBuilder &_fbb,
-    flatbuffers::Offset<flatbuffers::String> service_name = 0,
-    bool restart = false) {
-  ServiceStopBuilder builder_(_fbb);
-  builder_.add_service_name(service_name);
-  builder_.add_restart(restart);
+    flatbuffers::Offset<flatbuffers::String> frontier = 0,
+    flatbuffers::Offset<flatbuffers::String> open_block = 0,
+    flatbuffers::Offset<flatbuffers::String> representative_block = 0,
+    flatbuffers::Offset<flatbuffers::String> balance = 0,
+    uint64_t modified_timestamp = 0,
+    uint64_t block_count = 0,
+    uint8_t account_version = 0,
+    uint64_t confirmation_height = 0,
+    flatbuffers::Offset<flatbuffers::String> confirmation_height_frontier = 0,
+    flatbuffers::Offset<flatbuffers::String> representative = 0,
+    flatbuffers::Offset<flatbuffers::String> voting_weight = 0,
+    flatbuffers::Offset<flatbuffers::String> pending = 0) {
+  AccountInfoResponseBuilder builder_(_fbb);
+  builder_.add_confirmation_height(confirmation_height);
+  builder_.add_block_count(block_count);
+  builder_.add_modified_timestamp(modified_timestamp);
+  builder_.add_pending(pending);
+  builder_.add_voting_weight(voting_weight);
+  builder_.add_representative(representative);
+  builder_.add_confirmation_height_frontier(confirmation_height_frontier);
+  builder_.add_balance(balance);
+  builder_.add_representative_block(representative_block);
+  builder_.add_open_block(open_block);
+  builder_.add_frontier(frontier);
+  builder_.add_account_version(account_version);
   return builder_.Finish();
 }
 
-inline flatbuffers::Offset<ServiceStop> CreateServiceStopDirect(
+inline flatbuffers::Offset<AccountInfoResponse> CreateAccountInfoResponseDirect(
     flatbuffers::FlatBufferBuilder &_fbb,
-    const char *service_name = nullptr,
-    bool restart = false) {
-  auto service_name__ = service_name ? _fbb.CreateString(service_name) : 0;
-  return futureheadapi::CreateServiceStop(
+    const char *frontier = nullptr,
+    const char *open_block = nullptr,
+    const char *representative_block = nullptr,
+    const char *balance = nullptr,
+    uint64_t modified_timestamp = 0,
+    uint64_t block_count = 0,
+    uint8_t account_version = 0,
+    uint64_t confirmation_height = 0,
+    const char *confirmation_height_frontier = nullptr,
+    const char *representative = nullptr,
+    const char *voting_weight = nullptr,
+    const char *pending = nullptr) {
+  auto frontier__ = frontier ? _fbb.CreateString(frontier) : 0;
+  auto open_block__ = open_block ? _fbb.CreateString(open_block) : 0;
+  auto representative_block__ = representative_block ? _fbb.CreateString(representative_block) : 0;
+  auto balance__ = balance ? _fbb.CreateString(balance) : 0;
+  auto confirmation_height_frontier__ = confirmation_height_frontier ? _fbb.CreateString(confirmation_height_frontier) : 0;
+  auto representative__ = representative ? _fbb.CreateString(representative) : 0;
+  auto voting_weight__ = voting_weight ? _fbb.CreateString(voting_weight) : 0;
+  auto pending__ = pending ? _fbb.CreateString(pending) : 0;
+  return futureheadapi::CreateAccountInfoResponse(
       _fbb,
-      service_name__,
-      restart);
+      frontier__,
+      open_block__,
+      representative_block__,
+      balance__,
+      modified_timestamp,
+      block_count,
+      account_version,
+      confirmation_height,
+      confirmation_height_frontier__,
+      representative__,
+      voting_weight__,
+      pending__);
 }
 
-flatbuffers::Offset<ServiceStop> CreateServiceStop(flatbuffers::FlatBufferBuilder &_fbb, const ServiceStopT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+flatbuffers::Offset<AccountInfoResponse> CreateAccountInfoResponse(flatbuffers::FlatBufferBuilder &_fbb, const AccountInfoResponseT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 
-struct TopicServiceStopT : public flatbuffers::NativeTable {
-  typedef TopicServiceStop TableType;
+struct AccountsBalancesT : public flatbuffers::NativeTable {
+  typedef AccountsBalances TableType;
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.TopicServiceStopT";
+    return "futureheadapi.AccountsBalancesT";
   }
-  bool unsubscribe;
-  TopicServiceStopT()
-      : unsubscribe(false) {
+  std::vector<std::string> accounts;
+  AccountsBalancesT() {
   }
 };
 
-struct TopicServiceStop FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
-  typedef TopicServiceStopT NativeTableType;
-  typedef TopicServiceStopBuilder Builder;
+struct AccountsBalances FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef AccountsBalancesT NativeTableType;
+  typedef AccountsBalancesBuilder Builder;
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
-    return TopicServiceStopTypeTable();
+    return AccountsBalancesTypeTable();
   }
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.TopicServiceStop";
+    return "futureheadapi.AccountsBalances";
   }
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_UNSUBSCRIBE = 4
+    VT_ACCOUNTS = 4
   };
-  bool unsubscribe() const {
-    return GetField<uint8_t>(VT_UNSUBSCRIBE, 0) != 0;
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *accounts() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_ACCOUNTS);
   }
-  bool mutate_unsubscribe(bool _unsubscribe) {
-    return SetField<uint8_t>(VT_UNSUBSCRIBE, static_cast<uint8_t>(_unsubscribe), 0);
+  flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *mutable_accounts() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_ACCOUNTS);
   }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
-           VerifyField<uint8_t>(verifier, VT_UNSUBSCRIBE) &&
+           VerifyOffsetRequired(verifier, VT_ACCOUNTS) &&
+           verifier.VerifyVector(accounts()) &&
+           verifier.VerifyVectorOfStrings(accounts()) &&
            verifier.EndTable();
   }
-  TopicServiceStopT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  void UnPackTo(TopicServiceStopT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  static flatbuffers::Offset<TopicServiceStop> Pack(flatbuffers::FlatBufferBuilder &_fbb, const TopicServiceStopT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  AccountsBalancesT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(AccountsBalancesT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<AccountsBalances> Pack(flatbuffers::FlatBufferBuilder &_fbb, const AccountsBalancesT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
-struct TopicServiceStopBuilder {
-  typedef TopicServiceStop Table;
+struct AccountsBalancesBuilder {
+  typedef AccountsBalances Table;
   flatbuffers::FlatBufferBuilder &fbb_;
   flatbuffers::uoffset_t start_;
-  void add_unsubscribe(bool unsubscribe) {
-    fbb_.AddElement<uint8_t>(TopicServiceStop::VT_UNSUBSCRIBE, static_cast<uint8_t>(unsubscribe), 0);
+  void add_accounts(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> accounts) {
+    fbb_.AddOffset(AccountsBalances::VT_ACCOUNTS, accounts);
   }
-  explicit TopicServiceStopBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+  explicit AccountsBalancesBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
   }
-  TopicServiceStopBuilder &operator=(const TopicServiceStopBuilder &);
-  flatbuffers::Offset<TopicServiceStop> Finish() {
+  AccountsBalancesBuilder &operator=(const AccountsBalancesBuilder &);
+  flatbuffers::Offset<AccountsBalances> Finish() {
     const auto end = fbb_.EndTable(start_);
-    auto o = flatbuffers::Offset<TopicServiceStop>(end);
+    auto o = flatbuffers::Offset<AccountsBalances>(end);
+    fbb_.Required(o, AccountsBalances::VT_ACCOUNTS);
     return o;
   }
 };
 
-inline flatbuffers::Offset<TopicServiceStop> CreateTopicServiceStop(
+inline flatbuffers::Offset<AccountsBalances> CreateAccountsBalances(
     flatbuffers::FlatBufferBuilder &_fbb,
-    bool unsubscribe = false) {
-  TopicServiceStopBuilder builder_(_fbb);
-  builder_.add_unsubscribe(unsubscribe);
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> accounts = 0) {
+  AccountsBalancesBuilder builder_(_fbb);
+  builder_.add_accounts(accounts);
   return builder_.Finish();
 }
 
-flatbuffers::Offset<TopicServiceStop> CreateTopicServiceStop(flatbuffers::FlatBufferBuilder &_fbb, const TopicServiceStopT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+inline flatbuffers::Offset<AccountsBalances> CreateAccountsBalancesDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<flatbuffers::Offset<flatbuffers::String>> *accounts = nullptr) {
+  auto accounts__ = accounts ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*accounts) : 0;
+  return futureheadapi::CreateAccountsBalances(
+      _fbb,
+      accounts__);
+}
 
-struct EventServiceStopT : public flatbuffers::NativeTable {
-  typedef EventServiceStop TableType;
+flatbuffers::Offset<AccountsBalances> CreateAccountsBalances(flatbuffers::FlatBufferBuilder &_fbb, const AccountsBalancesT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct AccountBalanceT : public flatbuffers::NativeTable {
+  typedef AccountBalance TableType;
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.EventServiceStopT";
+    return "futureheadapi.AccountBalanceT";
   }
-  EventServiceStopT() {
+  std::string account;
+  std::string balance;
+  std::string pending;
+  AccountBalanceT() {
   }
 };
 
-struct EventServiceStop FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
-  typedef EventServiceStopT NativeTableType;
-  typedef EventServiceStopBuilder Builder;
+struct AccountBalance FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef AccountBalanceT NativeTableType;
+  typedef AccountBalanceBuilder Builder;
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
-    return EventServiceStopTypeTable();
+    return AccountBalanceTypeTable();
   }
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.EventServiceStop";
+    return "futureheadapi.AccountBalance";
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ACCOUNT = 4,
+    VT_BALANCE = 6,
+    VT_PENDING = 8
+  };
+  const flatbuffers::String *account() const {
+    return GetPointer<const flatbuffers::String *>(VT_ACCOUNT);
+  }
+  flatbuffers::String *mutable_account() {
+    return GetPointer<flatbuffers::String *>(VT_ACCOUNT);
+  }
+  const flatbuffers::String *balance() const {
+    return GetPointer<const flatbuffers::String *>(VT_BALANCE);
+  }
+  flatbuffers::String *mutable_balance() {
+    return GetPointer<flatbuffers::String *>(VT_BALANCE);
+  }
+  const flatbuffers::String *pending() const {
+    return GetPointer<const flatbuffers::String *>(VT_PENDING);
+  }
+  flatbuffers::String *mutable_pending() {
+    return GetPointer<flatbuffers::String *>(VT_PENDING);
   }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_ACCOUNT) &&
+           verifier.VerifyString(account()) &&
+           VerifyOffset(verifier, VT_BALANCE) &&
+           verifier.VerifyString(balance()) &&
+           VerifyOffset(verifier, VT_PENDING) &&
+           verifier.VerifyString(pending()) &&
            verifier.EndTable();
   }
-  EventServiceStopT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  void UnPackTo(EventServiceStopT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  static flatbuffers::Offset<EventServiceStop> Pack(flatbuffers::FlatBufferBuilder &_fbb, const EventServiceStopT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  AccountBalanceT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(AccountBalanceT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<AccountBalance> Pack(flatbuffers::FlatBufferBuilder &_fbb, const AccountBalanceT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
-struct EventServiceStopBuilder {
-  typedef EventServiceStop Table;
+struct AccountBalanceBuilder {
+  typedef AccountBalance Table;
   flatbuffers::FlatBufferBuilder &fbb_;
   flatbuffers::uoffset_t start_;
-  explicit EventServiceStopBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+  void add_account(flatbuffers::Offset<flatbuffers::String> account) {
+    fbb_.AddOffset(AccountBalance::VT_ACCOUNT, account);
+  }
+  void add_balance(flatbuffers::Offset<flatbuffers::String> balance) {
+    fbb_.AddOffset(AccountBalance::VT_BALANCE, balance);
+  }
+  void add_pending(flatbuffers::Offset<flatbuffers::String> pending) {
+    fbb_.AddOffset(AccountBalance::VT_PENDING, pending);
+  }
+  explicit AccountBalanceBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
   }
-  EventServiceStopBuilder &operator=(const EventServiceStopBuilder &);
-  flatbuffers::Offset<EventServiceStop> Finish() {
+  AccountBalanceBuilder &operator=(const AccountBalanceBuilder &);
+  flatbuffers::Offset<AccountBalance> Finish() {
     const auto end = fbb_.EndTable(start_);
-    auto o = flatbuffers::Offset<EventServiceStop>(end);
+    auto o = flatbuffers::Offset<AccountBalance>(end);
     return o;
   }
 };
 
-inline flatbuffers::Offset<EventServiceStop> CreateEventServiceStop(
-    flatbuffers::FlatBufferBuilder &_fbb) {
-  EventServiceStopBuilder builder_(_fbb);
+inline flatbuffers::Offset<AccountBalance> CreateAccountBalance(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> account = 0,
+    flatbuffers::Offset<flatbuffers::String> balance = 0,
+    flatbuffers::Offset<flatbuffers::String> pending = 0) {
+  AccountBalanceBuilder builder_(_fbb);
+  builder_.add_pending(pending);
+  builder_.add_balance(balance);
+  builder_.add_account(account);
   return builder_.Finish();
 }
 
-flatbuffers::Offset<EventServiceStop> CreateEventServiceStop(flatbuffers::FlatBufferBuilder &_fbb, const EventServiceStopT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+inline flatbuffers::Offset<AccountBalance> CreateAccountBalanceDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *account = nullptr,
+    const char *balance = nullptr,
+    const char *pending = nullptr) {
+  auto account__ = account ? _fbb.CreateString(account) : 0;
+  auto balance__ = balance ? _fbb.CreateString(balance) : 0;
+  auto pending__ = pending ? _fbb.CreateString(pending) : 0;
+  return futureheadapi::CreateAccountBalance(
+      _fbb,
+      account__,
+      balance__,
+      pending__);
+}
 
-struct EventAckT : public flatbuffers::NativeTable {
-  typedef EventAck TableType;
+flatbuffers::Offset<AccountBalance> CreateAccountBalance(flatbuffers::FlatBufferBuilder &_fbb, const AccountBalanceT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct AccountsBalancesResponseT : public flatbuffers::NativeTable {
+  typedef AccountsBalancesResponse TableType;
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.EventAckT";
+    return "futureheadapi.AccountsBalancesResponseT";
   }
-  EventAckT() {
+  std::vector<std::unique_ptr<futureheadapi::AccountBalanceT>> balances;
+  AccountsBalancesResponseT() {
   }
 };
 
-struct EventAck FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
-  typedef EventAckT NativeTableType;
-  typedef EventAckBuilder Builder;
+struct AccountsBalancesResponse FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef AccountsBalancesResponseT NativeTableType;
+  typedef AccountsBalancesResponseBuilder Builder;
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
-    return EventAckTypeTable();
+    return AccountsBalancesResponseTypeTable();
   }
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.EventAck";
+    return "futureheadapi.AccountsBalancesResponse";
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_BALANCES = 4
+  };
+  const flatbuffers::Vector<flatbuffers::Offset<futureheadapi::AccountBalance>> *balances() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<futureheadapi::AccountBalance>> *>(VT_BALANCES);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<futureheadapi::AccountBalance>> *mutable_balances() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<futureheadapi::AccountBalance>> *>(VT_BALANCES);
   }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_BALANCES) &&
+           verifier.VerifyVector(balances()) &&
+           verifier.VerifyVectorOfTables(balances()) &&
            verifier.EndTable();
   }
-  EventAckT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  void UnPackTo(EventAckT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  static flatbuffers::Offset<EventAck> Pack(flatbuffers::FlatBufferBuilder &_fbb, const EventAckT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  AccountsBalancesResponseT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(AccountsBalancesResponseT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<AccountsBalancesResponse> Pack(flatbuffers::FlatBufferBuilder &_fbb, const AccountsBalancesResponseT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
-struct EventAckBuilder {
-  typedef EventAck Table;
+struct AccountsBalancesResponseBuilder {
+  typedef AccountsBalancesResponse Table;
   flatbuffers::FlatBufferBuilder &fbb_;
   flatbuffers::uoffset_t start_;
-  explicit EventAckBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+  void add_balances(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<futureheadapi::AccountBalance>>> balances) {
+    fbb_.AddOffset(AccountsBalancesResponse::VT_BALANCES, balances);
+  }
+  explicit AccountsBalancesResponseBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
   }
-  EventAckBuilder &operator=(const EventAckBuilder &);
-  flatbuffers::Offset<EventAck> Finish() {
+  AccountsBalancesResponseBuilder &operator=(const AccountsBalancesResponseBuilder &);
+  flatbuffers::Offset<AccountsBalancesResponse> Finish() {
     const auto end = fbb_.EndTable(start_);
-    auto o = flatbuffers::Offset<EventAck>(end);
+    auto o = flatbuffers::Offset<AccountsBalancesResponse>(end);
     return o;
   }
 };
 
-inline flatbuffers::Offset<EventAck> CreateEventAck(
-    flatbuffers::FlatBufferBuilder &_fbb) {
-  EventAckBuilder builder_(_fbb);
+inline flatbuffers::Offset<AccountsBalancesResponse> CreateAccountsBalancesResponse(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<futureheadapi::AccountBalance>>> balances = 0) {
+  AccountsBalancesResponseBuilder builder_(_fbb);
+  builder_.add_balances(balances);
   return builder_.Finish();
 }
 
-flatbuffers::Offset<EventAck> CreateEventAck(flatbuffers::FlatBufferBuilder &_fbb, const EventAckT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+inline flatbuffers::Offset<AccountsBalancesResponse> CreateAccountsBalancesResponseDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<flatbuffers::Offset<futureheadapi::AccountBalance>> *balances = nullptr) {
+  auto balances__ = balances ? _fbb.CreateVector<flatbuffers::Offset<futureheadapi::AccountBalance>>(*balances) : 0;
+  return futureheadapi::CreateAccountsBalancesResponse(
+      _fbb,
+      balances__);
+}
 
-struct TopicConfirmationT : public flatbuffers::NativeTable {
-  typedef TopicConfirmation TableType;
+flatbuffers::Offset<AccountsBalancesResponse> CreateAccountsBalancesResponse(flatbuffers::FlatBufferBuilder &_fbb, const AccountsBalancesResponseT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct BlocksInfoT : public flatbuffers::NativeTable {
+  typedef BlocksInfo TableType;
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.TopicConfirmationT";
+    return "futureheadapi.BlocksInfoT";
   }
-  bool unsubscribe;
-  std::unique_ptr<futureheadapi::TopicConfirmationOptionsT> options;
-  TopicConfirmationT()
-      : unsubscribe(false) {
+  std::vector<std::string> hashes;
+  bool include_not_found;
+  BlocksInfoT()
+      : include_not_found(false) {
   }
 };
 
-struct TopicConfirmation FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
-  typedef TopicConfirmationT NativeTableType;
-  typedef TopicConfirmationBuilder Builder;
+struct BlocksInfo FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef BlocksInfoT NativeTableType;
+  typedef BlocksInfoBuilder Builder;
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
-    return TopicConfirmationTypeTable();
+    return BlocksInfoTypeTable();
   }
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.TopicConfirmation";
+    return "futureheadapi.BlocksInfo";
   }
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_UNSUBSCRIBE = 4,
-    VT_OPTIONS = 6
+    VT_HASHES = 4,
+    VT_INCLUDE_NOT_FOUND = 6
   };
-  bool unsubscribe() const {
-    return GetField<uint8_t>(VT_UNSUBSCRIBE, 0) != 0;
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *hashes() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_HASHES);
   }
-  bool mutate_unsubscribe(bool _unsubscribe) {
-    return SetField<uint8_t>(VT_UNSUBSCRIBE, static_cast<uint8_t>(_unsubscribe), 0);
+  flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *mutable_hashes() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_HASHES);
   }
-  const futureheadapi::TopicConfirmationOptions *options() const {
-    return GetPointer<const futureheadapi::TopicConfirmationOptions *>(VT_OPTIONS);
+  bool include_not_found() const {
+    return GetField<uint8_t>(VT_INCLUDE_NOT_FOUND, 0) != 0;
   }
-  futureheadapi::TopicConfirmationOptions *mutable_options() {
-    return GetPointer<futureheadapi::TopicConfirmationOptions *>(VT_OPTIONS);
+  bool mutate_include_not_found(bool _include_not_found) {
+    return SetField<uint8_t>(VT_INCLUDE_NOT_FOUND, static_cast<uint8_t>(_include_not_found), 0);
   }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
-           VerifyField<uint8_t>(verifier, VT_UNSUBSCRIBE) &&
-           VerifyOffset(verifier, VT_OPTIONS) &&
-           verifier.VerifyTable(options()) &&
+           VerifyOffsetRequired(verifier, VT_HASHES) &&
+           verifier.VerifyVector(hashes()) &&
+           verifier.VerifyVectorOfStrings(hashes()) &&
+           VerifyField<uint8_t>(verifier, VT_INCLUDE_NOT_FOUND) &&
            verifier.EndTable();
   }
-  TopicConfirmationT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  void UnPackTo(TopicConfirmationT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  static flatbuffers::Offset<TopicConfirmation> Pack(flatbuffers::FlatBufferBuilder &_fbb, const TopicConfirmationT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  BlocksInfoT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(BlocksInfoT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<BlocksInfo> Pack(flatbuffers::FlatBufferBuilder &_fbb, const BlocksInfoT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
-struct TopicConfirmationBuilder {
-  typedef TopicConfirmation Table;
+struct BlocksInfoBuilder {
+  typedef BlocksInfo Table;
   flatbuffers::FlatBufferBuilder &fbb_;
   flatbuffers::uoffset_t start_;
-  void add_unsubscribe(bool unsubscribe) {
-    fbb_.AddElement<uint8_t>(TopicConfirmation::VT_UNSUBSCRIBE, static_cast<uint8_t>(unsubscribe), 0);
+  void add_hashes(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> hashes) {
+    fbb_.AddOffset(BlocksInfo::VT_HASHES, hashes);
   }
-  void add_options(flatbuffers::Offset<futureheadapi::TopicConfirmationOptions> options) {
-    fbb_.AddOffset(TopicConfirmation::VT_OPTIONS, options);
+  void add_include_not_found(bool include_not_found) {
+    fbb_.AddElement<uint8_t>(BlocksInfo::VT_INCLUDE_NOT_FOUND, static_cast<uint8_t>(include_not_found), 0);
   }
-  explicit TopicConfirmationBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+  explicit BlocksInfoBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
   }
-  TopicConfirmationBuilder &operator=(const TopicConfirmationBuilder &);
-  flatbuffers::Offset<TopicConfirmation> Finish() {
+  BlocksInfoBuilder &operator=(const BlocksInfoBuilder &);
+  flatbuffers::Offset<BlocksInfo> Finish() {
     const auto end = fbb_.EndTable(start_);
-    auto o = flatbuffers::Offset<TopicConfirmation>(end);
+    auto o = flatbuffers::Offset<BlocksInfo>(end);
+    fbb_.Required(o, BlocksInfo::VT_HASHES);
     return o;
   }
 };
 
-inline flatbuffers::Offset<TopicConfirmation> CreateTopicConfirmation(
+inline flatbuffers::Offset<BlocksInfo> CreateBlocksInfo(
     flatbuffers::FlatBufferBuilder &_fbb,
-    bool unsubscribe = false,
-    flatbuffers::Offset<futureheadapi::TopicConfirmationOptions> options = 0) {
-  TopicConfirmationBuilder builder_(_fbb);
-  builder_.add_options(options);
-  builder_.add_unsubscribe(unsubscribe);
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> hashes = 0,
+    bool include_not_found = false) {
+  BlocksInfoBuilder builder_(_fbb);
+  builder_.add_hashes(hashes);
+  builder_.add_include_not_found(include_not_found);
   return builder_.Finish();
 }
 
-flatbuffers::Offset<TopicConfirmation> CreateTopicConfirmation(flatbuffers::FlatBufferBuilder &_fbb, const TopicConfirmationT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+inline flatbuffers::Offset<BlocksInfo> CreateBlocksInfoDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<flatbuffers::Offset<flatbuffers::String>> *hashes = nullptr,
+    bool include_not_found = false) {
+  auto hashes__ = hashes ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*hashes) : 0;
+  return futureheadapi::CreateBlocksInfo(
+      _fbb,
+      hashes__,
+      include_not_found);
+}
 
-struct TopicConfirmationOptionsT : public flatbuffers::NativeTable {
-  typedef TopicConfirmationOptions TableType;
+flatbuffers::Offset<BlocksInfo> CreateBlocksInfo(flatbuffers::FlatBufferBuilder &_fbb, const BlocksInfoT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct BlocksInfoEntryT : public flatbuffers::NativeTable {
+  typedef BlocksInfoEntry TableType;
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.TopicConfirmationOptionsT";
+    return "futureheadapi.BlocksInfoEntryT";
   }
-  futureheadapi::TopicConfirmationTypeFilter confirmation_type_filter;
-  bool all_local_accounts;
-  std::vector<std::string> accounts;
-  bool include_block;
-  bool include_election_info;
-  TopicConfirmationOptionsT()
-      : confirmation_type_filter(futureheadapi::TopicConfirmationTypeFilter_all),
-        all_local_accounts(false),
-        include_block(true),
-        include_election_info(true) {
+  std::string hash;
+  std::string block_account;
+  std::string amount;
+  std::string balance;
+  uint64_t height;
+  uint64_t local_timestamp;
+  bool confirmed;
+  futureheadapi::BlockUnion block;
+  BlocksInfoEntryT()
+      : height(0),
+        local_timestamp(0),
+        confirmed(false) {
   }
 };
 
-struct TopicConfirmationOptions FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
-  typedef TopicConfirmationOptionsT NativeTableType;
-  typedef TopicConfirmationOptionsBuilder Builder;
+struct BlocksInfoEntry FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef BlocksInfoEntryT NativeTableType;
+  typedef BlocksInfoEntryBuilder Builder;
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
-    return TopicConfirmationOptionsTypeTable();
+    return BlocksInfoEntryTypeTable();
   }
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.TopicConfirmationOptions";
+    return "futureheadapi.BlocksInfoEntry";
   }
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_CONFIRMATION_TYPE_FILTER = 4,
-    VT_ALL_LOCAL_ACCOUNTS = 6,
-    VT_ACCOUNTS = 8,
-    VT_INCLUDE_BLOCK = 10,
-    VT_INCLUDE_ELECTION_INFO = 12
+    VT_HASH = 4,
+    VT_BLOCK_ACCOUNT = 6,
+    VT_AMOUNT = 8,
+    VT_BALANCE = 10,
+    VT_HEIGHT = 12,
+    VT_LOCAL_TIMESTAMP = 14,
+    VT_CONFIRMED = 16,
+    VT_BLOCK_TYPE = 18,
+    VT_BLOCK = 20
   };
-  futureheadapi::TopicConfirmationTypeFilter confirmation_type_filter() const {
-    return static_cast<futureheadapi::TopicConfirmationTypeFilter>(GetField<int8_t>(VT_CONFIRMATION_TYPE_FILTER, 0));
+  const flatbuffers::String *hash() const {
+    return GetPointer<const flatbuffers::String *>(VT_HASH);
   }
-  bool mutate_confirmation_type_filter(futureheadapi::TopicConfirmationTypeFilter _confirmation_type_filter) {
-    return SetField<int8_t>(VT_CONFIRMATION_TYPE_FILTER, static_cast<int8_t>(_confirmation_type_filter), 0);
+  flatbuffers::String *mutable_hash() {
+    return GetPointer<flatbuffers::String *>(VT_HASH);
   }
-  bool all_local_accounts() const {
-    return GetField<uint8_t>(VT_ALL_LOCAL_ACCOUNTS, 0) != 0;
+  const flatbuffers::String *block_account() const {
+    return GetPointer<const flatbuffers::String *>(VT_BLOCK_ACCOUNT);
   }
-  bool mutate_all_local_accounts(bool _all_local_accounts) {
-    return SetField<uint8_t>(VT_ALL_LOCAL_ACCOUNTS, static_cast<uint8_t>(_all_local_accounts), 0);
+  flatbuffers::String *mutable_block_account() {
+    return GetPointer<flatbuffers::String *>(VT_BLOCK_ACCOUNT);
   }
-  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *accounts() const {
-    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_ACCOUNTS);
+  const flatbuffers::String *amount() const {
+    return GetPointer<const flatbuffers::String *>(VT_AMOUNT);
   }
-  flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *mutable_accounts() {
-    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_ACCOUNTS);
+  flatbuffers::String *mutable_amount() {
+    return GetPointer<flatbuffers::String *>(VT_AMOUNT);
   }
-  bool include_block() const {
-    return GetField<uint8_t>(VT_INCLUDE_BLOCK, 1) != 0;
+  const flatbuffers::String *balance() const {
+    return GetPointer<const flatbuffers::String *>(VT_BALANCE);
   }
-  bool mutate_include_block(bool _include_block) {
-    return SetField<uint8_t>(VT_INCLUDE_BLOCK, static_cast<uint8_t>(_include_block), 1);
+  flatbuffers::String *mutable_balance() {
+    return GetPointer<flatbuffers::String *>(VT_BALANCE);
   }
-  bool include_election_info() const {
-    return GetField<uint8_t>(VT_INCLUDE_ELECTION_INFO, 1) != 0;
+  uint64_t height() const {
+    return GetField<uint64_t>(VT_HEIGHT, 0);
   }
-  bool mutate_include_election_info(bool _include_election_info) {
-    return SetField<uint8_t>(VT_INCLUDE_ELECTION_INFO, static_cast<uint8_t>(_include_election_info), 1);
+  bool mutate_height(uint64_t _height) {
+    return SetField<uint64_t>(VT_HEIGHT, _height, 0);
   }
-  bool Verify(flatbuffers::Verifier &verifier) const {
-    return VerifyTableStart(verifier) &&
-           VerifyField<int8_t>(verifier, VT_CONFIRMATION_TYPE_FILTER) &&
-           VerifyField<uint8_t>(verifier, VT_ALL_LOCAL_ACCOUNTS) &&
-           VerifyOffset(verifier, VT_ACCOUNTS) &&
-           verifier.VerifyVector(accounts()) &&
-           verifier.VerifyVectorOfStrings(accounts()) &&
-           VerifyField<uint8_t>(verifier, VT_INCLUDE_BLOCK) &&
-           VerifyField<uint8_t>(verifier, VT_INCLUDE_ELECTION_INFO) &&
-           verifier.EndTable();
-  }
-  TopicConfirmationOptionsT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  void UnPackTo(TopicConfirmationOptionsT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  static flatbuffers::Offset<TopicConfirmationOptions> Pack(flatbuffers::FlatBufferBuilder &_fbb, const TopicConfirmationOptionsT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
-};
-
-struct TopicConfirmationOptionsBuilder {
-  typedef TopicConfirmationOptions Table;
-  flatbuffers::FlatBufferBuilder &fbb_;
-  flatbuffers::uoffset_t start_;
-  void add_confirmation_type_filter(futureheadapi::TopicConfirmationTypeFilter confirmation_type_filter) {
-    fbb_.AddElement<int8_t>(TopicConfirmationOptions::VT_CONFIRMATION_TYPE_FILTER, static_cast<int8_t>(confirmation_type_filter), 0);
-  }
-  void add_all_local_accounts(bool all_local_accounts) {
-    fbb_.AddElement<uint8_t>(TopicConfirmationOptions::VT_ALL_LOCAL_ACCOUNTS, static_cast<uint8_t>(all_local_accounts), 0);
-  }
-  void add_accounts(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> accounts) {
-    fbb_.AddOffset(TopicConfirmationOptions::VT_ACCOUNTS, accounts);
-  }
-  void add_include_block(bool include_block) {
-    fbb_.AddElement<uint8_t>(TopicConfirmationOptions::VT_INCLUDE_BLOCK, static_cast<uint8_t>(include_block), 1);
-  }
-  void add_include_election_info(bool include_election_info) {
-    fbb_.AddElement<uint8_t>(TopicConfirmationOptions::VT_INCLUDE_ELECTION_INFO, static_cast<uint8_t>(include_election_info), 1);
-  }
-  explicit TopicConfirmationOptionsBuilder(flatbuffers::FlatBufferBuilder &_fbb)
-        : fbb_(_fbb) {
-    start_ = fbb_.StartTable();
-  }
-  TopicConfirmationOptionsBuilder &operator=(const TopicConfirmationOptionsBuilder &);
-  flatbuffers::Offset<TopicConfirmationOptions> Finish() {
-    const auto end = fbb_.EndTable(start_);
-    auto o = flatbuffers::Offset<TopicConfirmationOptions>(end);
-    return o;
-  }
-};
-
-inline flatbuffers::Offset<TopicConfirmationOptions> CreateTopicConfirmationOptions(
-    flatbuffers::FlatBufferBuilder &_fbb,
-    futureheadapi::TopicConfirmationTypeFilter confirmation_type_filter = futureheadapi::TopicConfirmationTypeFilter_all,
-    bool all_local_accounts = false,
-    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> accounts = 0,
-    bool include_block = true,
-    bool include_election_info = true) {
-  TopicConfirmationOptionsBuilder builder_(_fbb);
-  builder_.add_accounts(accounts);
-  builder_.add_include_election_info(include_election_info);
-  builder_.add_include_block(include_block);
-  builder_.add_all_local_accounts(all_local_accounts);
-  builder_.add_confirmation_type_filter(confirmation_type_filter);
-  return builder_.Finish();
-}
-
-inline flatbuffers::Offset<TopicConfirmationOptions> CreateTopicConfirmationOptionsDirect(
-    flatbuffers::FlatBufferBuilder &_fbb,
-    futureheadapi::TopicConfirmationTypeFilter confirmation_type_filter = futureheadapi::TopicConfirmationTypeFilter_all,
-    bool all_local_accounts = false,
-    const std::vector<flatbuffers::Offset<flatbuffers::String>> *accounts = nullptr,
-    bool include_block = true,
-    bool include_election_info = true) {
-  auto accounts__ = accounts ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*accounts) : 0;
-  return futureheadapi::CreateTopicConfirmationOptions(
-      _fbb,
-      confirmation_type_filter,
-      all_local_accounts,
-      accounts__,
-      include_block,
-      include_election_info);
-}
-
-flatbuffers::Offset<TopicConfirmationOptions> CreateTopicConfirmationOptions(flatbuffers::FlatBufferBuilder &_fbb, const TopicConfirmationOptionsT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
-
-struct EventConfirmationT : public flatbuffers::NativeTable {
-  typedef EventConfirmation TableType;
-  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.EventConfirmationT";
-  }
-  futureheadapi::TopicConfirmationType confirmation_type;
-  std::string account;
-  std::string amount;
-  std::string hash;
-  futureheadapi::BlockUnion block;
-  std::unique_ptr<futureheadapi::ElectionInfoT> election_info;
-  EventConfirmationT()
-      : confirmation_type(futureheadapi::TopicConfirmationType_active_quorum) {
-  }
-};
-
-struct EventConfirmation FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
-  typedef EventConfirmationT NativeTableType;
-  typedef EventConfirmationBuilder Builder;
-  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
-    return EventConfirmationTypeTable();
-  }
-  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.EventConfirmation";
-  }
-  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_CONFIRMATION_TYPE = 4,
-    VT_ACCOUNT = 6,
-    VT_AMOUNT = 8,
-    VT_HASH = 10,
-    VT_BLOCK_TYPE = 12,
-    VT_BLOCK = 14,
-    VT_ELECTION_INFO = 16
-  };
-  futureheadapi::TopicConfirmationType confirmation_type() const {
-    return static_cast<futureheadapi::TopicConfirmationType>(GetField<int8_t>(VT_CONFIRMATION_TYPE, 0));
-  }
-  bool mutate_confirmation_type(futureheadapi::TopicConfirmationType _confirmation_type) {
-    return SetField<int8_t>(VT_CONFIRMATION_TYPE, static_cast<int8_t>(_confirmation_type), 0);
-  }
-  const flatbuffers::String *account() const {
-    return GetPointer<const flatbuffers::String *>(VT_ACCOUNT);
-  }
-  flatbuffers::String *mutable_account() {
-    return GetPointer<flatbuffers::String *>(VT_ACCOUNT);
-  }
-  const flatbuffers::String *amount() const {
-    return GetPointer<const flatbuffers::String *>(VT_AMOUNT);
+  uint64_t local_timestamp() const {
+    return GetField<uint64_t>(VT_LOCAL_TIMESTAMP, 0);
   }
-  flatbuffers::String *mutable_amount() {
-    return GetPointer<flatbuffers::String *>(VT_AMOUNT);
+  bool mutate_local_timestamp(uint64_t _local_timestamp) {
+    return SetField<uint64_t>(VT_LOCAL_TIMESTAMP, _local_timestamp, 0);
   }
-  const flatbuffers::String *hash() const {
-    return GetPointer<const flatbuffers::String *>(VT_HASH);
+  bool confirmed() const {
+    return GetField<uint8_t>(VT_CONFIRMED, 0) != 0;
   }
-  flatbuffers::String *mutable_hash() {
-    return GetPointer<flatbuffers::String *>(VT_HASH);
+  bool mutate_confirmed(bool _confirmed) {
+    return SetField<uint8_t>(VT_CONFIRMED, static_cast<uint8_t>(_confirmed), 0);
   }
   futureheadapi::Block block_type() const {
     return static_cast<futureheadapi::Block>(GetField<uint8_t>(VT_BLOCK_TYPE, 0));
@@ -2445,1059 +2892,2964 @@ struct EventConfirmation FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   void *mutable_block() {
     return GetPointer<void *>(VT_BLOCK);
   }
-  const futureheadapi::ElectionInfo *election_info() const {
-    return GetPointer<const futureheadapi::ElectionInfo *>(VT_ELECTION_INFO);
-  }
-  futureheadapi::ElectionInfo *mutable_election_info() {
-    return GetPointer<futureheadapi::ElectionInfo *>(VT_ELECTION_INFO);
-  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
-           VerifyField<int8_t>(verifier, VT_CONFIRMATION_TYPE) &&
-           VerifyOffset(verifier, VT_ACCOUNT) &&
-           verifier.VerifyString(account()) &&
-           VerifyOffset(verifier, VT_AMOUNT) &&
-           verifier.VerifyString(amount()) &&
            VerifyOffset(verifier, VT_HASH) &&
            verifier.VerifyString(hash()) &&
+           VerifyOffset(verifier, VT_BLOCK_ACCOUNT) &&
+           verifier.VerifyString(block_account()) &&
+           VerifyOffset(verifier, VT_AMOUNT) &&
+           verifier.VerifyString(amount()) &&
+           VerifyOffset(verifier, VT_BALANCE) &&
+           verifier.VerifyString(balance()) &&
+           VerifyField<uint64_t>(verifier, VT_HEIGHT) &&
+           VerifyField<uint64_t>(verifier, VT_LOCAL_TIMESTAMP) &&
+           VerifyField<uint8_t>(verifier, VT_CONFIRMED) &&
            VerifyField<uint8_t>(verifier, VT_BLOCK_TYPE) &&
            VerifyOffset(verifier, VT_BLOCK) &&
            VerifyBlock(verifier, block(), block_type()) &&
-           VerifyOffset(verifier, VT_ELECTION_INFO) &&
-           verifier.VerifyTable(election_info()) &&
            verifier.EndTable();
   }
-  EventConfirmationT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  void UnPackTo(EventConfirmationT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  static flatbuffers::Offset<EventConfirmation> Pack(flatbuffers::FlatBufferBuilder &_fbb, const EventConfirmationT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  BlocksInfoEntryT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(BlocksInfoEntryT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<BlocksInfoEntry> Pack(flatbuffers::FlatBufferBuilder &_fbb, const BlocksInfoEntryT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
-template<> inline const futureheadapi::BlockState *EventConfirmation::block_as<futureheadapi::BlockState>() const {
+template<> inline const futureheadapi::BlockState *BlocksInfoEntry::block_as<futureheadapi::BlockState>() const {
   return block_as_BlockState();
 }
 
-template<> inline const futureheadapi::BlockOpen *EventConfirmation::block_as<futureheadapi::BlockOpen>() const {
+template<> inline const futureheadapi::BlockOpen *BlocksInfoEntry::block_as<futureheadapi::BlockOpen>() const {
   return block_as_BlockOpen();
 }
 
-template<> inline const futureheadapi::BlockReceive *EventConfirmation::block_as<futureheadapi::BlockReceive>() const {
+template<> inline const futureheadapi::BlockReceive *BlocksInfoEntry::block_as<futureheadapi::BlockReceive>() const {
   return block_as_BlockReceive();
 }
 
-template<> inline const futureheadapi::BlockSend *EventConfirmation::block_as<futureheadapi::BlockSend>() const {
+template<> inline const futureheadapi::BlockSend *BlocksInfoEntry::block_as<futureheadapi::BlockSend>() const {
   return block_as_BlockSend();
 }
 
-template<> inline const futureheadapi::BlockChange *EventConfirmation::block_as<futureheadapi::BlockChange>() const {
+template<> inline const futureheadapi::BlockChange *BlocksInfoEntry::block_as<futureheadapi::BlockChange>() const {
   return block_as_BlockChange();
 }
 
-struct EventConfirmationBuilder {
-  typedef EventConfirmation Table;
+struct BlocksInfoEntryBuilder {
+  typedef BlocksInfoEntry Table;
   flatbuffers::FlatBufferBuilder &fbb_;
   flatbuffers::uoffset_t start_;
-  void add_confirmation_type(futureheadapi::TopicConfirmationType confirmation_type) {
-    fbb_.AddElement<int8_t>(EventConfirmation::VT_CONFIRMATION_TYPE, static_cast<int8_t>(confirmation_type), 0);
+  void add_hash(flatbuffers::Offset<flatbuffers::String> hash) {
+    fbb_.AddOffset(BlocksInfoEntry::VT_HASH, hash);
   }
-  void add_account(flatbuffers::Offset<flatbuffers::String> account) {
-    fbb_.AddOffset(EventConfirmation::VT_ACCOUNT, account);
+  void add_block_account(flatbuffers::Offset<flatbuffers::String> block_account) {
+    fbb_.AddOffset(BlocksInfoEntry::VT_BLOCK_ACCOUNT, block_account);
   }
   void add_amount(flatbuffers::Offset<flatbuffers::String> amount) {
-    fbb_.AddOffset(EventConfirmation::VT_AMOUNT, amount);
+    fbb_.AddOffset(BlocksInfoEntry::VT_AMOUNT, amount);
   }
-  void add_hash(flatbuffers::Offset<flatbuffers::String> hash) {
-    fbb_.AddOffset(EventConfirmation::VT_HASH, hash);
+  void add_balance(flatbuffers::Offset<flatbuffers::String> balance) {
+    fbb_.AddOffset(BlocksInfoEntry::VT_BALANCE, balance);
+  }
+  void add_height(uint64_t height) {
+    fbb_.AddElement<uint64_t>(BlocksInfoEntry::VT_HEIGHT, height, 0);
+  }
+  void add_local_timestamp(uint64_t local_timestamp) {
+    fbb_.AddElement<uint64_t>(BlocksInfoEntry::VT_LOCAL_TIMESTAMP, local_timestamp, 0);
+  }
+  void add_confirmed(bool confirmed) {
+    fbb_.AddElement<uint8_t>(BlocksInfoEntry::VT_CONFIRMED, static_cast<uint8_t>(confirmed), 0);
   }
   void add_block_type(futureheadapi::Block block_type) {
-    fbb_.AddElement<uint8_t>(EventConfirmation::VT_BLOCK_TYPE, static_cast<uint8_t>(block_type), 0);
+    fbb_.AddElement<uint8_t>(BlocksInfoEntry::VT_BLOCK_TYPE, static_cast<uint8_t>(block_type), 0);
   }
   void add_block(flatbuffers::Offset<void> block) {
-    fbb_.AddOffset(EventConfirmation::VT_BLOCK, block);
+    fbb_.AddOffset(BlocksInfoEntry::VT_BLOCK, block);
   }
-  void add_election_info(flatbuffers::Offset<futureheadapi::ElectionInfo> election_info) {
-    fbb_.AddOffset(EventConfirmation::VT_ELECTION_INFO, election_info);
-  }
-  explicit EventConfirmationBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+  explicit BlocksInfoEntryBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
   }
-  EventConfirmationBuilder &operator=(const EventConfirmationBuilder &);
-  flatbuffers::Offset<EventConfirmation> Finish() {
+  BlocksInfoEntryBuilder &operator=(const BlocksInfoEntryBuilder &);
+  flatbuffers::Offset<BlocksInfoEntry> Finish() {
     const auto end = fbb_.EndTable(start_);
-    auto o = flatbuffers::Offset<EventConfirmation>(end);
+    auto o = flatbuffers::Offset<BlocksInfoEntry>(end);
     return o;
   }
 };
 
-inline flatbuffers::Offset<EventConfirmation> CreateEventConfirmation(
+inline flatbuffers::Offset<BlocksInfoEntry> CreateBlocksInfoEntry(
     flatbuffers::FlatBufferBuilder &_fbb,
-    futureheadapi::TopicConfirmationType confirmation_type = futureheadapi::TopicConfirmationType_active_quorum,
-    flatbuffers::Offset<flatbuffers::String> account = 0,
-    flatbuffers::Offset<flatbuffers::String> amount = 0,
     flatbuffers::Offset<flatbuffers::String> hash = 0,
+    flatbuffers::Offset<flatbuffers::String> block_account = 0,
+    flatbuffers::Offset<flatbuffers::String> amount = 0,
+    flatbuffers::Offset<flatbuffers::String> balance = 0,
+    uint64_t height = 0,
+    uint64_t local_timestamp = 0,
+    bool confirmed = false,
     futureheadapi::Block block_type = futureheadapi::Block_NONE,
-    flatbuffers::Offset<void> block = 0,
-    flatbuffers::Offset<futureheadapi::ElectionInfo> election_info = 0) {
-  EventConfirmationBuilder builder_(_fbb);
-  builder_.add_election_info(election_info);
+    flatbuffers::Offset<void> block = 0) {
+  BlocksInfoEntryBuilder builder_(_fbb);
+  builder_.add_local_timestamp(local_timestamp);
+  builder_.add_height(height);
   builder_.add_block(block);
-  builder_.add_hash(hash);
+  builder_.add_balance(balance);
   builder_.add_amount(amount);
-  builder_.add_account(account);
+  builder_.add_block_account(block_account);
+  builder_.add_hash(hash);
   builder_.add_block_type(block_type);
-  builder_.add_confirmation_type(confirmation_type);
+  builder_.add_confirmed(confirmed);
   return builder_.Finish();
 }
 
-inline flatbuffers::Offset<EventConfirmation> CreateEventConfirmationDirect(
+inline flatbuffers::Offset<BlocksInfoEntry> CreateBlocksInfoEntryDirect(
     flatbuffers::FlatBufferBuilder &_fbb,
-    futureheadapi::TopicConfirmationType confirmation_type = futureheadapi::TopicConfirmationType_active_quorum,
-    const char *account = nullptr,
-    const char *amount = nullptr,
     const char *hash = nullptr,
+    const char *block_account = nullptr,
+    const char *amount = nullptr,
+    const char *balance = nullptr,
+    uint64_t height = 0,
+    uint64_t local_timestamp = 0,
+    bool confirmed = false,
     futureheadapi::Block block_type = futureheadapi::Block_NONE,
-    flatbuffers::Offset<void> block = 0,
-    flatbuffers::Offset<futureheadapi::ElectionInfo> election_info = 0) {
-  auto account__ = account ? _fbb.CreateString(account) : 0;
-  auto amount__ = amount ? _fbb.CreateString(amount) : 0;
+    flatbuffers::Offset<void> block = 0) {
   auto hash__ = hash ? _fbb.CreateString(hash) : 0;
-  return futureheadapi::CreateEventConfirmation(
+  auto block_account__ = block_account ? _fbb.CreateString(block_account) : 0;
+  auto amount__ = amount ? _fbb.CreateString(amount) : 0;
+  auto balance__ = balance ? _fbb.CreateString(balance) : 0;
+  return futureheadapi::CreateBlocksInfoEntry(
       _fbb,
-      confirmation_type,
-      account__,
-      amount__,
       hash__,
+      block_account__,
+      amount__,
+      balance__,
+      height,
+      local_timestamp,
+      confirmed,
       block_type,
-      block,
-      election_info);
+      block);
 }
 
-flatbuffers::Offset<EventConfirmation> CreateEventConfirmation(flatbuffers::FlatBufferBuilder &_fbb, const EventConfirmationT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+flatbuffers::Offset<BlocksInfoEntry> CreateBlocksInfoEntry(flatbuffers::FlatBufferBuilder &_fbb, const BlocksInfoEntryT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 
-struct ElectionInfoT : public flatbuffers::NativeTable {
-  typedef ElectionInfo TableType;
+struct BlocksInfoResponseT : public flatbuffers::NativeTable {
+  typedef BlocksInfoResponse TableType;
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.ElectionInfoT";
+    return "futureheadapi.BlocksInfoResponseT";
   }
-  uint64_t duration;
-  uint64_t time;
-  std::string tally;
-  uint64_t request_count;
-  uint64_t block_count;
-  uint64_t voter_count;
-  ElectionInfoT()
-      : duration(0),
-        time(0),
-        request_count(0),
-        block_count(0),
-        voter_count(0) {
+  std::vector<std::unique_ptr<futureheadapi::BlocksInfoEntryT>> blocks;
+  std::vector<std::string> blocks_not_found;
+  BlocksInfoResponseT() {
   }
 };
 
-struct ElectionInfo FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
-  typedef ElectionInfoT NativeTableType;
-  typedef ElectionInfoBuilder Builder;
+struct BlocksInfoResponse FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef BlocksInfoResponseT NativeTableType;
+  typedef BlocksInfoResponseBuilder Builder;
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
-    return ElectionInfoTypeTable();
+    return BlocksInfoResponseTypeTable();
   }
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.ElectionInfo";
+    return "futureheadapi.BlocksInfoResponse";
   }
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_DURATION = 4,
-    VT_TIME = 6,
-    VT_TALLY = 8,
-    VT_REQUEST_COUNT = 10,
-    VT_BLOCK_COUNT = 12,
-    VT_VOTER_COUNT = 14
+    VT_BLOCKS = 4,
+    VT_BLOCKS_NOT_FOUND = 6
   };
-  uint64_t duration() const {
-    return GetField<uint64_t>(VT_DURATION, 0);
+  const flatbuffers::Vector<flatbuffers::Offset<futureheadapi::BlocksInfoEntry>> *blocks() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<futureheadapi::BlocksInfoEntry>> *>(VT_BLOCKS);
   }
-  bool mutate_duration(uint64_t _duration) {
-    return SetField<uint64_t>(VT_DURATION, _duration, 0);
+  flatbuffers::Vector<flatbuffers::Offset<futureheadapi::BlocksInfoEntry>> *mutable_blocks() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<futureheadapi::BlocksInfoEntry>> *>(VT_BLOCKS);
   }
-  uint64_t time() const {
-    return GetField<uint64_t>(VT_TIME, 0);
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *blocks_not_found() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_BLOCKS_NOT_FOUND);
   }
-  bool mutate_time(uint64_t _time) {
-    return SetField<uint64_t>(VT_TIME, _time, 0);
-  }
-  const flatbuffers::String *tally() const {
-    return GetPointer<const flatbuffers::String *>(VT_TALLY);
-  }
-  flatbuffers::String *mutable_tally() {
-    return GetPointer<flatbuffers::String *>(VT_TALLY);
-  }
-  uint64_t request_count() const {
-    return GetField<uint64_t>(VT_REQUEST_COUNT, 0);
-  }
-  bool mutate_request_count(uint64_t _request_count) {
-    return SetField<uint64_t>(VT_REQUEST_COUNT, _request_count, 0);
-  }
-  uint64_t block_count() const {
-    return GetField<uint64_t>(VT_BLOCK_COUNT, 0);
-  }
-  bool mutate_block_count(uint64_t _block_count) {
-    return SetField<uint64_t>(VT_BLOCK_COUNT, _block_count, 0);
-  }
-  uint64_t voter_count() const {
-    return GetField<uint64_t>(VT_VOTER_COUNT, 0);
-  }
-  bool mutate_voter_count(uint64_t _voter_count) {
-    return SetField<uint64_t>(VT_VOTER_COUNT, _voter_count, 0);
+  flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *mutable_blocks_not_found() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_BLOCKS_NOT_FOUND);
   }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
-           VerifyField<uint64_t>(verifier, VT_DURATION) &&
-           VerifyField<uint64_t>(verifier, VT_TIME) &&
-           VerifyOffset(verifier, VT_TALLY) &&
-           verifier.VerifyString(tally()) &&
-           VerifyField<uint64_t>(verifier, VT_REQUEST_COUNT) &&
-           VerifyField<uint64_t>(verifier, VT_BLOCK_COUNT) &&
-           VerifyField<uint64_t>(verifier, VT_VOTER_COUNT) &&
+           VerifyOffset(verifier, VT_BLOCKS) &&
+           verifier.VerifyVector(blocks()) &&
+           verifier.VerifyVectorOfTables(blocks()) &&
+           VerifyOffset(verifier, VT_BLOCKS_NOT_FOUND) &&
+           verifier.VerifyVector(blocks_not_found()) &&
+           verifier.VerifyVectorOfStrings(blocks_not_found()) &&
            verifier.EndTable();
   }
-  ElectionInfoT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  void UnPackTo(ElectionInfoT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  static flatbuffers::Offset<ElectionInfo> Pack(flatbuffers::FlatBufferBuilder &_fbb, const ElectionInfoT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  BlocksInfoResponseT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(BlocksInfoResponseT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<BlocksInfoResponse> Pack(flatbuffers::FlatBufferBuilder &_fbb, const BlocksInfoResponseT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
-struct ElectionInfoBuilder {
-  typedef ElectionInfo Table;
+struct BlocksInfoResponseBuilder {
+  typedef BlocksInfoResponse Table;
   flatbuffers::FlatBufferBuilder &fbb_;
   flatbuffers::uoffset_t start_;
-  void add_duration(uint64_t duration) {
-    fbb_.AddElement<uint64_t>(ElectionInfo::VT_DURATION, duration, 0);
-  }
-  void add_time(uint64_t time) {
-    fbb_.AddElement<uint64_t>(ElectionInfo::VT_TIME, time, 0);
-  }
-  void add_tally(flatbuffers::Offset<flatbuffers::String> tally) {
-    fbb_.AddOffset(ElectionInfo::VT_TALLY, tally);
-  }
-  void add_request_count(uint64_t request_count) {
-    fbb_.AddElement<uint64_t>(ElectionInfo::VT_REQUEST_COUNT, request_count, 0);
-  }
-  void add_block_count(uint64_t block_count) {
-    fbb_.AddElement<uint64_t>(ElectionInfo::VT_BLOCK_COUNT, block_count, 0);
+  void add_blocks(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<futureheadapi::BlocksInfoEntry>>> blocks) {
+    fbb_.AddOffset(BlocksInfoResponse::VT_BLOCKS, blocks);
   }
-  void add_voter_count(uint64_t voter_count) {
-    fbb_.AddElement<uint64_t>(ElectionInfo::VT_VOTER_COUNT, voter_count, 0);
+  void add_blocks_not_found(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> blocks_not_found) {
+    fbb_.AddOffset(BlocksInfoResponse::VT_BLOCKS_NOT_FOUND, blocks_not_found);
   }
-  explicit ElectionInfoBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+  explicit BlocksInfoResponseBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
   }
-  ElectionInfoBuilder &operator=(const ElectionInfoBuilder &);
-  flatbuffers::Offset<ElectionInfo> Finish() {
+  BlocksInfoResponseBuilder &operator=(const BlocksInfoResponseBuilder &);
+  flatbuffers::Offset<BlocksInfoResponse> Finish() {
     const auto end = fbb_.EndTable(start_);
-    auto o = flatbuffers::Offset<ElectionInfo>(end);
+    auto o = flatbuffers::Offset<BlocksInfoResponse>(end);
     return o;
   }
 };
 
-inline flatbuffers::Offset<ElectionInfo> CreateElectionInfo(
+inline flatbuffers::Offset<BlocksInfoResponse> CreateBlocksInfoResponse(
     flatbuffers::FlatBufferBuilder &_fbb,
-    uint64_t duration = 0,
-    uint64_t time = 0,
-    flatbuffers::Offset<flatbuffers::String> tally = 0,
-    uint64_t request_count = 0,
-    uint64_t block_count = 0,
-    uint64_t voter_count = 0) {
-  ElectionInfoBuilder builder_(_fbb);
-  builder_.add_voter_count(voter_count);
-  builder_.add_block_count(block_count);
-  builder_.add_request_count(request_count);
-  builder_.add_time(time);
-  builder_.add_duration(duration);
-  builder_.add_tally(tally);
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<futureheadapi::BlocksInfoEntry>>> blocks = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> blocks_not_found = 0) {
+  BlocksInfoResponseBuilder builder_(_fbb);
+  builder_.add_blocks_not_found(blocks_not_found);
+  builder_.add_blocks(blocks);
   return builder_.Finish();
 }
 
-inline flatbuffers::Offset<ElectionInfo> CreateElectionInfoDirect(
+inline flatbuffers::Offset<BlocksInfoResponse> CreateBlocksInfoResponseDirect(
     flatbuffers::FlatBufferBuilder &_fbb,
-    uint64_t duration = 0,
-    uint64_t time = 0,
-    const char *tally = nullptr,
-    uint64_t request_count = 0,
-    uint64_t block_count = 0,
-    uint64_t voter_count = 0) {
-  auto tally__ = tally ? _fbb.CreateString(tally) : 0;
-  return futureheadapi::CreateElectionInfo(
+    const std::vector<flatbuffers::Offset<futureheadapi::BlocksInfoEntry>> *blocks = nullptr,
+    const std::vector<flatbuffers::Offset<flatbuffers::String>> *blocks_not_found = nullptr) {
+  auto blocks__ = blocks ? _fbb.CreateVector<flatbuffers::Offset<futureheadapi::BlocksInfoEntry>>(*blocks) : 0;
+  auto blocks_not_found__ = blocks_not_found ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*blocks_not_found) : 0;
+  return futureheadapi::CreateBlocksInfoResponse(
       _fbb,
-      duration,
-      time,
-      tally__,
-      request_count,
-      block_count,
-      voter_count);
+      blocks__,
+      blocks_not_found__);
 }
 
-flatbuffers::Offset<ElectionInfo> CreateElectionInfo(flatbuffers::FlatBufferBuilder &_fbb, const ElectionInfoT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+flatbuffers::Offset<BlocksInfoResponse> CreateBlocksInfoResponse(flatbuffers::FlatBufferBuilder &_fbb, const BlocksInfoResponseT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 
-struct ErrorT : public flatbuffers::NativeTable {
-  typedef Error TableType;
+struct PendingT : public flatbuffers::NativeTable {
+  typedef Pending TableType;
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.ErrorT";
+    return "futureheadapi.PendingT";
   }
-  int32_t code;
-  int32_t category;
-  std::string message;
-  ErrorT()
-      : code(0),
-        category(0) {
+  std::string account;
+  uint64_t count;
+  std::string threshold;
+  bool include_active;
+  bool include_only_confirmed;
+  PendingT()
+      : count(0),
+        include_active(false),
+        include_only_confirmed(false) {
   }
 };
 
-struct Error FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
-  typedef ErrorT NativeTableType;
-  typedef ErrorBuilder Builder;
+struct Pending FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef PendingT NativeTableType;
+  typedef PendingBuilder Builder;
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
-    return ErrorTypeTable();
+    return PendingTypeTable();
   }
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.Error";
+    return "futureheadapi.Pending";
   }
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_CODE = 4,
-    VT_CATEGORY = 6,
-    VT_MESSAGE = 8
+    VT_ACCOUNT = 4,
+    VT_COUNT = 6,
+    VT_THRESHOLD = 8,
+    VT_INCLUDE_ACTIVE = 10,
+    VT_INCLUDE_ONLY_CONFIRMED = 12
   };
-  int32_t code() const {
-    return GetField<int32_t>(VT_CODE, 0);
+  const flatbuffers::String *account() const {
+    return GetPointer<const flatbuffers::String *>(VT_ACCOUNT);
   }
-  bool mutate_code(int32_t _code) {
-    return SetField<int32_t>(VT_CODE, _code, 0);
+  flatbuffers::String *mutable_account() {
+    return GetPointer<flatbuffers::String *>(VT_ACCOUNT);
   }
-  int32_t category() const {
-    return GetField<int32_t>(VT_CATEGORY, 0);
+  uint64_t count() const {
+    return GetField<uint64_t>(VT_COUNT, 0);
   }
-  bool mutate_category(int32_t _category) {
-    return SetField<int32_t>(VT_CATEGORY, _category, 0);
+  bool mutate_count(uint64_t _count) {
+    return SetField<uint64_t>(VT_COUNT, _count, 0);
   }
-  const flatbuffers::String *message() const {
-    return GetPointer<const flatbuffers::String *>(VT_MESSAGE);
+  const flatbuffers::String *threshold() const {
+    return GetPointer<const flatbuffers::String *>(VT_THRESHOLD);
   }
-  flatbuffers::String *mutable_message() {
-    return GetPointer<flatbuffers::String *>(VT_MESSAGE);
+  flatbuffers::String *mutable_threshold() {
+    return GetPointer<flatbuffers::String *>(VT_THRESHOLD);
+  }
+  bool include_active() const {
+    return GetField<uint8_t>(VT_INCLUDE_ACTIVE, 0) != 0;
+  }
+  bool mutate_include_active(bool _include_active) {
+    return SetField<uint8_t>(VT_INCLUDE_ACTIVE, static_cast<uint8_t>(_include_active), 0);
+  }
+  bool include_only_confirmed() const {
+    return GetField<uint8_t>(VT_INCLUDE_ONLY_CONFIRMED, 0) != 0;
+  }
+  bool mutate_include_only_confirmed(bool _include_only_confirmed) {
+    return SetField<uint8_t>(VT_INCLUDE_ONLY_CONFIRMED, static_cast<uint8_t>(_include_only_confirmed), 0);
   }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
-           VerifyField<int32_t>(verifier, VT_CODE) &&
-           VerifyField<int32_t>(verifier, VT_CATEGORY) &&
-           VerifyOffset(verifier, VT_MESSAGE) &&
-           verifier.VerifyString(message()) &&
+           VerifyOffsetRequired(verifier, VT_ACCOUNT) &&
+           verifier.VerifyString(account()) &&
+           VerifyField<uint64_t>(verifier, VT_COUNT) &&
+           VerifyOffset(verifier, VT_THRESHOLD) &&
+           verifier.VerifyString(threshold()) &&
+           VerifyField<uint8_t>(verifier, VT_INCLUDE_ACTIVE) &&
+           VerifyField<uint8_t>(verifier, VT_INCLUDE_ONLY_CONFIRMED) &&
            verifier.EndTable();
   }
-  ErrorT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  void UnPackTo(ErrorT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  static flatbuffers::Offset<Error> Pack(flatbuffers::FlatBufferBuilder &_fbb, const ErrorT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  PendingT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(PendingT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<Pending> Pack(flatbuffers::FlatBufferBuilder &_fbb, const PendingT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
-struct ErrorBuilder {
-  typedef Error Table;
+struct PendingBuilder {
+  typedef Pending Table;
   flatbuffers::FlatBufferBuilder &fbb_;
   flatbuffers::uoffset_t start_;
-  void add_code(int32_t code) {
-    fbb_.AddElement<int32_t>(Error::VT_CODE, code, 0);
+  void add_account(flatbuffers::Offset<flatbuffers::String> account) {
+    fbb_.AddOffset(Pending::VT_ACCOUNT, account);
   }
-  void add_category(int32_t category) {
-    fbb_.AddElement<int32_t>(Error::VT_CATEGORY, category, 0);
+  void add_count(uint64_t count) {
+    fbb_.AddElement<uint64_t>(Pending::VT_COUNT, count, 0);
   }
-  void add_message(flatbuffers::Offset<flatbuffers::String> message) {
-    fbb_.AddOffset(Error::VT_MESSAGE, message);
+  void add_threshold(flatbuffers::Offset<flatbuffers::String> threshold) {
+    fbb_.AddOffset(Pending::VT_THRESHOLD, threshold);
   }
-  explicit ErrorBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+  void add_include_active(bool include_active) {
+    fbb_.AddElement<uint8_t>(Pending::VT_INCLUDE_ACTIVE, static_cast<uint8_t>(include_active), 0);
+  }
+  void add_include_only_confirmed(bool include_only_confirmed) {
+    fbb_.AddElement<uint8_t>(Pending::VT_INCLUDE_ONLY_CONFIRMED, static_cast<uint8_t>(include_only_confirmed), 0);
+  }
+  explicit PendingBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
   }
-  ErrorBuilder &operator=(const ErrorBuilder &);
-  flatbuffers::Offset<Error> Finish() {
+  PendingBuilder &operator=(const PendingBuilder &);
+  flatbuffers::Offset<Pending> Finish() {
     const auto end = fbb_.EndTable(start_);
-    auto o = flatbuffers::Offset<Error>(end);
+    auto o = flatbuffers::Offset<Pending>(end);
+    fbb_.Required(o, Pending::VT_ACCOUNT);
     return o;
   }
 };
 
-inline flatbuffers::Offset<Error> CreateError(
+inline flatbuffers::Offset<Pending> CreatePending(
     flatbuffers::FlatBufferBuilder &_fbb,
-    int32_t code = 0,
-    int32_t category = 0,
-    flatbuffers::Offset<flatbuffers::String> message = 0) {
-  ErrorBuilder builder_(_fbb);
-  builder_.add_message(message);
-  builder_.add_category(category);
-  builder_.add_code(code);
+    flatbuffers::Offset<flatbuffers::String> account = 0,
+    uint64_t count = 0,
+    flatbuffers::Offset<flatbuffers::String> threshold = 0,
+    bool include_active = false,
+    bool include_only_confirmed = false) {
+  PendingBuilder builder_(_fbb);
+  builder_.add_count(count);
+  builder_.add_threshold(threshold);
+  builder_.add_account(account);
+  builder_.add_include_only_confirmed(include_only_confirmed);
+  builder_.add_include_active(include_active);
   return builder_.Finish();
 }
 
-inline flatbuffers::Offset<Error> CreateErrorDirect(
+inline flatbuffers::Offset<Pending> CreatePendingDirect(
     flatbuffers::FlatBufferBuilder &_fbb,
-    int32_t code = 0,
-    int32_t category = 0,
-    const char *message = nullptr) {
-  auto message__ = message ? _fbb.CreateString(message) : 0;
-  return futureheadapi::CreateError(
+    const char *account = nullptr,
+    uint64_t count = 0,
+    const char *threshold = nullptr,
+    bool include_active = false,
+    bool include_only_confirmed = false) {
+  auto account__ = account ? _fbb.CreateString(account) : 0;
+  auto threshold__ = threshold ? _fbb.CreateString(threshold) : 0;
+  return futureheadapi::CreatePending(
       _fbb,
-      code,
-      category,
-      message__);
+      account__,
+      count,
+      threshold__,
+      include_active,
+      include_only_confirmed);
 }
 
-flatbuffers::Offset<Error> CreateError(flatbuffers::FlatBufferBuilder &_fbb, const ErrorT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+flatbuffers::Offset<Pending> CreatePending(flatbuffers::FlatBufferBuilder &_fbb, const PendingT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 
-struct SuccessT : public flatbuffers::NativeTable {
-  typedef Success TableType;
+struct PendingBlockT : public flatbuffers::NativeTable {
+  typedef PendingBlock TableType;
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.SuccessT";
+    return "futureheadapi.PendingBlockT";
   }
-  std::string message;
-  SuccessT() {
+  std::string hash;
+  std::string amount;
+  std::string source;
+  uint8_t min_version;
+  PendingBlockT()
+      : min_version(0) {
   }
 };
 
-struct Success FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
-  typedef SuccessT NativeTableType;
-  typedef SuccessBuilder Builder;
+struct PendingBlock FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef PendingBlockT NativeTableType;
+  typedef PendingBlockBuilder Builder;
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
-    return SuccessTypeTable();
+    return PendingBlockTypeTable();
   }
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.Success";
+    return "futureheadapi.PendingBlock";
   }
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_MESSAGE = 4
+    VT_HASH = 4,
+    VT_AMOUNT = 6,
+    VT_SOURCE = 8,
+    VT_MIN_VERSION = 10
   };
-  const flatbuffers::String *message() const {
-    return GetPointer<const flatbuffers::String *>(VT_MESSAGE);
+  const flatbuffers::String *hash() const {
+    return GetPointer<const flatbuffers::String *>(VT_HASH);
   }
-  flatbuffers::String *mutable_message() {
-    return GetPointer<flatbuffers::String *>(VT_MESSAGE);
+  flatbuffers::String *mutable_hash() {
+    return GetPointer<flatbuffers::String *>(VT_HASH);
+  }
+  const flatbuffers::String *amount() const {
+    return GetPointer<const flatbuffers::String *>(VT_AMOUNT);
+  }
+  flatbuffers::String *mutable_amount() {
+    return GetPointer<flatbuffers::String *>(VT_AMOUNT);
+  }
+  const flatbuffers::String *source() const {
+    return GetPointer<const flatbuffers::String *>(VT_SOURCE);
+  }
+  flatbuffers::String *mutable_source() {
+    return GetPointer<flatbuffers::String *>(VT_SOURCE);
+  }
+  uint8_t min_version() const {
+    return GetField<uint8_t>(VT_MIN_VERSION, 0);
+  }
+  bool mutate_min_version(uint8_t _min_version) {
+    return SetField<uint8_t>(VT_MIN_VERSION, _min_version, 0);
   }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
-           VerifyOffset(verifier, VT_MESSAGE) &&
-           verifier.VerifyString(message()) &&
+           VerifyOffset(verifier, VT_HASH) &&
+           verifier.VerifyString(hash()) &&
+           VerifyOffset(verifier, VT_AMOUNT) &&
+           verifier.VerifyString(amount()) &&
+           VerifyOffset(verifier, VT_SOURCE) &&
+           verifier.VerifyString(source()) &&
+           VerifyField<uint8_t>(verifier, VT_MIN_VERSION) &&
            verifier.EndTable();
   }
-  SuccessT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  void UnPackTo(SuccessT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  static flatbuffers::Offset<Success> Pack(flatbuffers::FlatBufferBuilder &_fbb, const SuccessT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  PendingBlockT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(PendingBlockT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<PendingBlock> Pack(flatbuffers::FlatBufferBuilder &_fbb, const PendingBlockT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
-struct SuccessBuilder {
-  typedef Success Table;
+struct PendingBlockBuilder {
+  typedef PendingBlock Table;
   flatbuffers::FlatBufferBuilder &fbb_;
   flatbuffers::uoffset_t start_;
-  void add_message(flatbuffers::Offset<flatbuffers::String> message) {
-    fbb_.AddOffset(Success::VT_MESSAGE, message);
+  void add_hash(flatbuffers::Offset<flatbuffers::String> hash) {
+    fbb_.AddOffset(PendingBlock::VT_HASH, hash);
   }
-  explicit SuccessBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+  void add_amount(flatbuffers::Offset<flatbuffers::String> amount) {
+    fbb_.AddOffset(PendingBlock::VT_AMOUNT, amount);
+  }
+  void add_source(flatbuffers::Offset<flatbuffers::String> source) {
+    fbb_.AddOffset(PendingBlock::VT_SOURCE, source);
+  }
+  void add_min_version(uint8_t min_version) {
+    fbb_.AddElement<uint8_t>(PendingBlock::VT_MIN_VERSION, min_version, 0);
+  }
+  explicit PendingBlockBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
   }
-  SuccessBuilder &operator=(const SuccessBuilder &);
-  flatbuffers::Offset<Success> Finish() {
+  PendingBlockBuilder &operator=(const PendingBlockBuilder &);
+  flatbuffers::Offset<PendingBlock> Finish() {
     const auto end = fbb_.EndTable(start_);
-    auto o = flatbuffers::Offset<Success>(end);
+    auto o = flatbuffers::Offset<PendingBlock>(end);
     return o;
   }
 };
 
-inline flatbuffers::Offset<Success> CreateSuccess(
+inline flatbuffers::Offset<PendingBlock> CreatePendingBlock(
     flatbuffers::FlatBufferBuilder &_fbb,
-    flatbuffers::Offset<flatbuffers::String> message = 0) {
-  SuccessBuilder builder_(_fbb);
-  builder_.add_message(message);
+    flatbuffers::Offset<flatbuffers::String> hash = 0,
+    flatbuffers::Offset<flatbuffers::String> amount = 0,
+    flatbuffers::Offset<flatbuffers::String> source = 0,
+    uint8_t min_version = 0) {
+  PendingBlockBuilder builder_(_fbb);
+  builder_.add_source(source);
+  builder_.add_amount(amount);
+  builder_.add_hash(hash);
+  builder_.add_min_version(min_version);
   return builder_.Finish();
 }
 
-inline flatbuffers::Offset<Success> CreateSuccessDirect(
+inline flatbuffers::Offset<PendingBlock> CreatePendingBlockDirect(
     flatbuffers::FlatBufferBuilder &_fbb,
-    const char *message = nullptr) {
-  auto message__ = message ? _fbb.CreateString(message) : 0;
-  return futureheadapi::CreateSuccess(
+    const char *hash = nullptr,
+    const char *amount = nullptr,
+    const char *source = nullptr,
+    uint8_t min_version = 0) {
+  auto hash__ = hash ? _fbb.CreateString(hash) : 0;
+  auto amount__ = amount ? _fbb.CreateString(amount) : 0;
+  auto source__ = source ? _fbb.CreateString(source) : 0;
+  return futureheadapi::CreatePendingBlock(
       _fbb,
-      message__);
-}
-
-flatbuffers::Offset<Success> CreateSuccess(flatbuffers::FlatBufferBuilder &_fbb, const SuccessT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+      hash__,
+      amount__,
+      source__,
+      min_version);
+}
 
-struct IsAliveT : public flatbuffers::NativeTable {
-  typedef IsAlive TableType;
+flatbuffers::Offset<PendingBlock> CreatePendingBlock(flatbuffers::FlatBufferBuilder &_fbb, const PendingBlockT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct PendingResponseT : public flatbuffers::NativeTable {
+  typedef PendingResponse TableType;
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.IsAliveT";
+    return "futureheadapi.PendingResponseT";
   }
-  IsAliveT() {
+  std::vector<std::unique_ptr<futureheadapi::PendingBlockT>> blocks;
+  PendingResponseT() {
   }
 };
 
-struct IsAlive FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
-  typedef IsAliveT NativeTableType;
-  typedef IsAliveBuilder Builder;
+struct PendingResponse FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef PendingResponseT NativeTableType;
+  typedef PendingResponseBuilder Builder;
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
-    return IsAliveTypeTable();
+    return PendingResponseTypeTable();
   }
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.IsAlive";
+    return "futureheadapi.PendingResponse";
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_BLOCKS = 4
+  };
+  const flatbuffers::Vector<flatbuffers::Offset<futureheadapi::PendingBlock>> *blocks() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<futureheadapi::PendingBlock>> *>(VT_BLOCKS);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<futureheadapi::PendingBlock>> *mutable_blocks() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<futureheadapi::PendingBlock>> *>(VT_BLOCKS);
   }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_BLOCKS) &&
+           verifier.VerifyVector(blocks()) &&
+           verifier.VerifyVectorOfTables(blocks()) &&
            verifier.EndTable();
   }
-  IsAliveT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  void UnPackTo(IsAliveT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  static flatbuffers::Offset<IsAlive> Pack(flatbuffers::FlatBufferBuilder &_fbb, const IsAliveT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  PendingResponseT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(PendingResponseT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<PendingResponse> Pack(flatbuffers::FlatBufferBuilder &_fbb, const PendingResponseT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
-struct IsAliveBuilder {
-  typedef IsAlive Table;
+struct PendingResponseBuilder {
+  typedef PendingResponse Table;
   flatbuffers::FlatBufferBuilder &fbb_;
   flatbuffers::uoffset_t start_;
-  explicit IsAliveBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+  void add_blocks(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<futureheadapi::PendingBlock>>> blocks) {
+    fbb_.AddOffset(PendingResponse::VT_BLOCKS, blocks);
+  }
+  explicit PendingResponseBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
   }
-  IsAliveBuilder &operator=(const IsAliveBuilder &);
-  flatbuffers::Offset<IsAlive> Finish() {
+  PendingResponseBuilder &operator=(const PendingResponseBuilder &);
+  flatbuffers::Offset<PendingResponse> Finish() {
     const auto end = fbb_.EndTable(start_);
-    auto o = flatbuffers::Offset<IsAlive>(end);
+    auto o = flatbuffers::Offset<PendingResponse>(end);
     return o;
   }
 };
 
-inline flatbuffers::Offset<IsAlive> CreateIsAlive(
-    flatbuffers::FlatBufferBuilder &_fbb) {
-  IsAliveBuilder builder_(_fbb);
+inline flatbuffers::Offset<PendingResponse> CreatePendingResponse(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<futureheadapi::PendingBlock>>> blocks = 0) {
+  PendingResponseBuilder builder_(_fbb);
+  builder_.add_blocks(blocks);
   return builder_.Finish();
 }
 
-flatbuffers::Offset<IsAlive> CreateIsAlive(flatbuffers::FlatBufferBuilder &_fbb, const IsAliveT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+inline flatbuffers::Offset<PendingResponse> CreatePendingResponseDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<flatbuffers::Offset<futureheadapi::PendingBlock>> *blocks = nullptr) {
+  auto blocks__ = blocks ? _fbb.CreateVector<flatbuffers::Offset<futureheadapi::PendingBlock>>(*blocks) : 0;
+  return futureheadapi::CreatePendingResponse(
+      _fbb,
+      blocks__);
+}
 
-struct EnvelopeT : public flatbuffers::NativeTable {
-  typedef Envelope TableType;
+flatbuffers::Offset<PendingResponse> CreatePendingResponse(flatbuffers::FlatBufferBuilder &_fbb, const PendingResponseT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct BlockCountT : public flatbuffers::NativeTable {
+  typedef BlockCount TableType;
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.EnvelopeT";
+    return "futureheadapi.BlockCountT";
   }
-  uint64_t time;
-  std::string credentials;
-  std::string correlation_id;
-  futureheadapi::MessageUnion message;
-  EnvelopeT()
-      : time(0) {
+  BlockCountT() {
   }
 };
 
-struct Envelope FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
-  typedef EnvelopeT NativeTableType;
-  typedef EnvelopeBuilder Builder;
+struct BlockCount FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef BlockCountT NativeTableType;
+  typedef BlockCountBuilder Builder;
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
-    return EnvelopeTypeTable();
+    return BlockCountTypeTable();
   }
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
-    return "futureheadapi.Envelope";
-  }
-  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_TIME = 4,
-    VT_CREDENTIALS = 6,
-    VT_CORRELATION_ID = 8,
-    VT_MESSAGE_TYPE = 10,
-    VT_MESSAGE = 12
-  };
-  uint64_t time() const {
-    return GetField<uint64_t>(VT_TIME, 0);
-  }
-  bool mutate_time(uint64_t _time) {
-    return SetField<uint64_t>(VT_TIME, _time, 0);
-  }
-  const flatbuffers::String *credentials() const {
-    return GetPointer<const flatbuffers::String *>(VT_CREDENTIALS);
-  }
-  flatbuffers::String *mutable_credentials() {
-    return GetPointer<flatbuffers::String *>(VT_CREDENTIALS);
-  }
-  const flatbuffers::String *correlation_id() const {
-    return GetPointer<const flatbuffers::String *>(VT_CORRELATION_ID);
-  }
-  flatbuffers::String *mutable_correlation_id() {
-    return GetPointer<flatbuffers::String *>(VT_CORRELATION_ID);
-  }
-  futureheadapi::Message message_type() const {
-    return static_cast<futureheadapi::Message>(GetField<uint8_t>(VT_MESSAGE_TYPE, 0));
+    return "futureheadapi.BlockCount";
   }
-  const void *message() const {
-    return GetPointer<const void *>(VT_MESSAGE);
-  }
-  template<typename T> const T *message_as() const;
-  const futureheadapi::Error *message_as_Error() const {
-    return message_type() == futureheadapi::Message_Error ? static_cast<const futureheadapi::Error *>(message()) : nullptr;
-  }
-  const futureheadapi::Success *message_as_Success() const {
-    return message_type() == futureheadapi::Message_Success ? static_cast<const futureheadapi::Success *>(message()) : nullptr;
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           verifier.EndTable();
   }
-  const futureheadapi::IsAlive *message_as_IsAlive() const {
-    return message_type() == futureheadapi::Message_IsAlive ? static_cast<const futureheadapi::IsAlive *>(message()) : nullptr;
+  BlockCountT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(BlockCountT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<BlockCount> Pack(flatbuffers::FlatBufferBuilder &_fbb, const BlockCountT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct BlockCountBuilder {
+  typedef BlockCount Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  explicit BlockCountBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
   }
-  const futureheadapi::EventAck *message_as_EventAck() const {
-    return message_type() == futureheadapi::Message_EventAck ? static_cast<const futureheadapi::EventAck *>(message()) : nullptr;
+  BlockCountBuilder &operator=(const BlockCountBuilder &);
+  flatbuffers::Offset<BlockCount> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<BlockCount>(end);
+    return o;
   }
-  const futureheadapi::BlockInfo *message_as_BlockInfo() const {
-    return message_type() == futureheadapi::Message_BlockInfo ? static_cast<const futureheadapi::BlockInfo *>(message()) : nullptr;
+};
+
+inline flatbuffers::Offset<BlockCount> CreateBlockCount(
+    flatbuffers::FlatBufferBuilder &_fbb) {
+  BlockCountBuilder builder_(_fbb);
+  return builder_.Finish();
+}
+
+flatbuffers::Offset<BlockCount> CreateBlockCount(flatbuffers::FlatBufferBuilder &_fbb, const BlockCountT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct BlockCountResponseT : public flatbuffers::NativeTable {
+  typedef BlockCountResponse TableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.BlockCountResponseT";
   }
-  const futureheadapi::AccountWeight *message_as_AccountWeight() const {
-    return message_type() == futureheadapi::Message_AccountWeight ? static_cast<const futureheadapi::AccountWeight *>(message()) : nullptr;
+  uint64_t count;
+  uint64_t unchecked;
+  uint64_t cemented;
+  BlockCountResponseT()
+      : count(0),
+        unchecked(0),
+        cemented(0) {
   }
-  const futureheadapi::AccountWeightResponse *message_as_AccountWeightResponse() const {
-    return message_type() == futureheadapi::Message_AccountWeightResponse ? static_cast<const futureheadapi::AccountWeightResponse *>(message()) : nullptr;
+};
+
+struct BlockCountResponse FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef BlockCountResponseT NativeTableType;
+  typedef BlockCountResponseBuilder Builder;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return BlockCountResponseTypeTable();
   }
-  const futureheadapi::TopicConfirmation *message_as_TopicConfirmation() const {
-    return message_type() == futureheadapi::Message_TopicConfirmation ? static_cast<const futureheadapi::TopicConfirmation *>(message()) : nullptr;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.BlockCountResponse";
   }
-  const futureheadapi::EventConfirmation *message_as_EventConfirmation() const {
-    return message_type() == futureheadapi::Message_EventConfirmation ? static_cast<const futureheadapi::EventConfirmation *>(message()) : nullptr;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_COUNT = 4,
+    VT_UNCHECKED = 6,
+    VT_CEMENTED = 8
+  };
+  uint64_t count() const {
+    return GetField<uint64_t>(VT_COUNT, 0);
   }
-  const futureheadapi::ServiceRegister *message_as_ServiceRegister() const {
-    return message_type() == futureheadapi::Message_ServiceRegister ? static_cast<const futureheadapi::ServiceRegister *>(message()) : nullptr;
+  bool mutate_count(uint64_t _count) {
+    return SetField<uint64_t>(VT_COUNT, _count, 0);
   }
-  const futureheadapi::ServiceStop *message_as_ServiceStop() const {
-    return message_type() == futureheadapi::Message_ServiceStop ? static_cast<const futureheadapi::ServiceStop *>(message()) : nullptr;
+  uint64_t unchecked() const {
+    return GetField<uint64_t>(VT_UNCHECKED, 0);
   }
-  const futureheadapi::TopicServiceStop *message_as_TopicServiceStop() const {
-    return message_type() == futureheadapi::Message_TopicServiceStop ? static_cast<const futureheadapi::TopicServiceStop *>(message()) : nullptr;
+  bool mutate_unchecked(uint64_t _unchecked) {
+    return SetField<uint64_t>(VT_UNCHECKED, _unchecked, 0);
   }
-  const futureheadapi::EventServiceStop *message_as_EventServiceStop() const {
-    return message_type() == futureheadapi::Message_EventServiceStop ? static_cast<const futureheadapi::EventServiceStop *>(message()) : nullptr;
+  uint64_t cemented() const {
+    return GetField<uint64_t>(VT_CEMENTED, 0);
   }
-  void *mutable_message() {
-    return GetPointer<void *>(VT_MESSAGE);
+  bool mutate_cemented(uint64_t _cemented) {
+    return SetField<uint64_t>(VT_CEMENTED, _cemented, 0);
   }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
-           VerifyField<uint64_t>(verifier, VT_TIME) &&
-           VerifyOffset(verifier, VT_CREDENTIALS) &&
-           verifier.VerifyString(credentials()) &&
-           VerifyOffset(verifier, VT_CORRELATION_ID) &&
-           verifier.VerifyString(correlation_id()) &&
-           VerifyField<uint8_t>(verifier, VT_MESSAGE_TYPE) &&
-           VerifyOffset(verifier, VT_MESSAGE) &&
-           VerifyMessage(verifier, message(), message_type()) &&
+           VerifyField<uint64_t>(verifier, VT_COUNT) &&
+           VerifyField<uint64_t>(verifier, VT_UNCHECKED) &&
+           VerifyField<uint64_t>(verifier, VT_CEMENTED) &&
            verifier.EndTable();
   }
-  EnvelopeT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  void UnPackTo(EnvelopeT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  static flatbuffers::Offset<Envelope> Pack(flatbuffers::FlatBufferBuilder &_fbb, const EnvelopeT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  BlockCountResponseT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(BlockCountResponseT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<BlockCountResponse> Pack(flatbuffers::FlatBufferBuilder &_fbb, const BlockCountResponseT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
-template<> inline const futureheadapi::Error *Envelope::message_as<futureheadapi::Error>() const {
-  return message_as_Error();
-}
-
-template<> inline const futureheadapi::Success *Envelope::message_as<futureheadapi::Success>() const {
-  return message_as_Success();
-}
-
-template<> inline const futureheadapi::IsAlive *Envelope::message_as<futureheadapi::IsAlive>() const {
-  return message_as_IsAlive();
-}
-
-template<> inline const futureheadapi::EventAck *Envelope::message_as<futureheadapi::EventAck>() const {
-  return message_as_EventAck();
-}
-
-template<> inline const futureheadapi::BlockInfo *Envelope::message_as<futureheadapi::BlockInfo>() const {
-  return message_as_BlockInfo();
-}
-
-template<> inline const futureheadapi::AccountWeight *Envelope::message_as<futureheadapi::AccountWeight>() const {
-  return message_as_AccountWeight();
-}
-
-template<> inline const futureheadapi::AccountWeightResponse *Envelope::message_as<futureheadapi::AccountWeightResponse>() const {
-  return message_as_AccountWeightResponse();
-}
-
-template<> inline const futureheadapi::TopicConfirmation *Envelope::message_as<futureheadapi::TopicConfirmation>() const {
-  return message_as_TopicConfirmation();
-}
-
-template<> inline const futureheadapi::EventConfirmation *Envelope::message_as<futureheadapi::EventConfirmation>() const {
-  return message_as_EventConfirmation();
-}
-
-template<> inline const futureheadapi::ServiceRegister *Envelope::message_as<futureheadapi::ServiceRegister>() const {
-  return message_as_ServiceRegister();
-}
-
-template<> inline const futureheadapi::ServiceStop *Envelope::message_as<futureheadapi::ServiceStop>() const {
-  return message_as_ServiceStop();
-}
-
-template<> inline const futureheadapi::TopicServiceStop *Envelope::message_as<futureheadapi::TopicServiceStop>() const {
-  return message_as_TopicServiceStop();
-}
-
-template<> inline const futureheadapi::EventServiceStop *Envelope::message_as<futureheadapi::EventServiceStop>() const {
-  return message_as_EventServiceStop();
-}
-
-struct EnvelopeBuilder {
-  typedef Envelope Table;
+struct BlockCountResponseBuilder {
+  typedef BlockCountResponse Table;
   flatbuffers::FlatBufferBuilder &fbb_;
   flatbuffers::uoffset_t start_;
-  void add_time(uint64_t time) {
-    fbb_.AddElement<uint64_t>(Envelope::VT_TIME, time, 0);
-  }
-  void add_credentials(flatbuffers::Offset<flatbuffers::String> credentials) {
-    fbb_.AddOffset(Envelope::VT_CREDENTIALS, credentials);
+  void add_count(uint64_t count) {
+    fbb_.AddElement<uint64_t>(BlockCountResponse::VT_COUNT, count, 0);
   }
-  void add_correlation_id(flatbuffers::Offset<flatbuffers::String> correlation_id) {
-    fbb_.AddOffset(Envelope::VT_CORRELATION_ID, correlation_id);
-  }
-  void add_message_type(futureheadapi::Message message_type) {
-    fbb_.AddElement<uint8_t>(Envelope::VT_MESSAGE_TYPE, static_cast<uint8_t>(message_type), 0);
+  void add_unchecked(uint64_t unchecked) {
+    fbb_.AddElement<uint64_t>(BlockCountResponse::VT_UNCHECKED, unchecked, 0);
   }
-  void add_message(flatbuffers::Offset<void> message) {
-    fbb_.AddOffset(Envelope::VT_MESSAGE, message);
+  void add_cemented(uint64_t cemented) {
+    fbb_.AddElement<uint64_t>(BlockCountResponse::VT_CEMENTED, cemented, 0);
   }
-  explicit EnvelopeBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+  explicit BlockCountResponseBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
   }
-  EnvelopeBuilder &operator=(const EnvelopeBuilder &);
-  flatbuffers::Offset<Envelope> Finish() {
+  BlockCountResponseBuilder &operator=(const BlockCountResponseBuilder &);
+  flatbuffers::Offset<BlockCountResponse> Finish() {
     const auto end = fbb_.EndTable(start_);
-    auto o = flatbuffers::Offset<Envelope>(end);
+    auto o = flatbuffers::Offset<BlockCountResponse>(end);
     return o;
   }
 };
 
-inline flatbuffers::Offset<Envelope> CreateEnvelope(
+inline flatbuffers::Offset<BlockCountResponse> CreateBlockCountResponse(
     flatbuffers::FlatBufferBuilder &_fbb,
-    uint64_t time = 0,
-    flatbuffers::Offset<flatbuffers::String> credentials = 0,
-    flatbuffers::Offset<flatbuffers::String> correlation_id = 0,
-    futureheadapi::Message message_type = futureheadapi::Message_NONE,
-    flatbuffers::Offset<void> message = 0) {
-  EnvelopeBuilder builder_(_fbb);
-  builder_.add_time(time);
-  builder_.add_message(message);
-  builder_.add_correlation_id(correlation_id);
-  builder_.add_credentials(credentials);
-  builder_.add_message_type(message_type);
+    uint64_t count = 0,
+    uint64_t unchecked = 0,
+    uint64_t cemented = 0) {
+  BlockCountResponseBuilder builder_(_fbb);
+  builder_.add_cemented(cemented);
+  builder_.add_unchecked(unchecked);
+  builder_.add_count(count);
   return builder_.Finish();
 }
 
-inline flatbuffers::Offset<Envelope> CreateEnvelopeDirect(
-    flatbuffers::FlatBufferBuilder &_fbb,
-    uint64_t time = 0,
-    const char *credentials = nullptr,
-    const char *correlation_id = nullptr,
-    futureheadapi::Message message_type = futureheadapi::Message_NONE,
-    flatbuffers::Offset<void> message = 0) {
-  auto credentials__ = credentials ? _fbb.CreateString(credentials) : 0;
-  auto correlation_id__ = correlation_id ? _fbb.CreateString(correlation_id) : 0;
-  return futureheadapi::CreateEnvelope(
-      _fbb,
-      time,
-      credentials__,
-      correlation_id__,
-      message_type,
-      message);
+flatbuffers::Offset<BlockCountResponse> CreateBlockCountResponse(flatbuffers::FlatBufferBuilder &_fbb, const BlockCountResponseT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct ServiceRegisterT : public flatbuffers::NativeTable {
+  typedef ServiceRegister TableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.ServiceRegisterT";
+  }
+  std::string service_name;
+  ServiceRegisterT() {
+  }
+};
+
+struct ServiceRegister FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ServiceRegisterT NativeTableType;
+  typedef ServiceRegisterBuilder Builder;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return ServiceRegisterTypeTable();
+  }
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.ServiceRegister";
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_SERVICE_NAME = 4
+  };
+  const flatbuffers::String *service_name() const {
+    return GetPointer<const flatbuffers::String *>(VT_SERVICE_NAME);
+  }
+  flatbuffers::String *mutable_service_name() {
+    return GetPointer<flatbuffers::String *>(VT_SERVICE_NAME);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_SERVICE_NAME) &&
+           verifier.VerifyString(service_name()) &&
+           verifier.EndTable();
+  }
+  ServiceRegisterT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(ServiceRegisterT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<ServiceRegister> Pack(flatbuffers::FlatBufferBuilder &_fbb, const ServiceRegisterT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct ServiceRegisterBuilder {
+  typedef ServiceRegister Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_service_name(flatbuffers::Offset<flatbuffers::String> service_name) {
+    fbb_.AddOffset(ServiceRegister::VT_SERVICE_NAME, service_name);
+  }
+  explicit ServiceRegisterBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ServiceRegisterBuilder &operator=(const ServiceRegisterBuilder &);
+  flatbuffers::Offset<ServiceRegister> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ServiceRegister>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ServiceRegister> CreateServiceRegister(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> service_name = 0) {
+  ServiceRegisterBuilder builder_(_fbb);
+  builder_.add_service_name(service_name);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<ServiceRegister> CreateServiceRegisterDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *service_name = nullptr) {
+  auto service_name__ = service_name ? _fbb.CreateString(service_name) : 0;
+  return futureheadapi::CreateServiceRegister(
+      _fbb,
+      service_name__);
+}
+
+flatbuffers::Offset<ServiceRegister> CreateServiceRegister(flatbuffers::FlatBufferBuilder &_fbb, const ServiceRegisterT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct ServiceStopT : public flatbuffers::NativeTable {
+  typedef ServiceStop TableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.ServiceStopT";
+  }
+  std::string service_name;
+  bool restart;
+  ServiceStopT()
+      : restart(false) {
+  }
+};
+
+struct ServiceStop FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ServiceStopT NativeTableType;
+  typedef ServiceStopBuilder Builder;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return ServiceStopTypeTable();
+  }
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.ServiceStop";
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_SERVICE_NAME = 4,
+    VT_RESTART = 6
+  };
+  const flatbuffers::String *service_name() const {
+    return GetPointer<const flatbuffers::String *>(VT_SERVICE_NAME);
+  }
+  flatbuffers::String *mutable_service_name() {
+    return GetPointer<flatbuffers::String *>(VT_SERVICE_NAME);
+  }
+  bool restart() const {
+    return GetField<uint8_t>(VT_RESTART, 0) != 0;
+  }
+  bool mutate_restart(bool _restart) {
+    return SetField<uint8_t>(VT_RESTART, static_cast<uint8_t>(_restart), 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffsetRequired(verifier, VT_SERVICE_NAME) &&
+           verifier.VerifyString(service_name()) &&
+           VerifyField<uint8_t>(verifier, VT_RESTART) &&
+           verifier.EndTable();
+  }
+  ServiceStopT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(ServiceStopT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<ServiceStop> Pack(flatbuffers::FlatBufferBuilder &_fbb, const ServiceStopT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct ServiceStopBuilder {
+  typedef ServiceStop Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_service_name(flatbuffers::Offset<flatbuffers::String> service_name) {
+    fbb_.AddOffset(ServiceStop::VT_SERVICE_NAME, service_name);
+  }
+  void add_restart(bool restart) {
+    fbb_.AddElement<uint8_t>(ServiceStop::VT_RESTART, static_cast<uint8_t>(restart), 0);
+  }
+  explicit ServiceStopBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ServiceStopBuilder &operator=(const ServiceStopBuilder &);
+  flatbuffers::Offset<ServiceStop> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ServiceStop>(end);
+    fbb_.Required(o, ServiceStop::VT_SERVICE_NAME);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ServiceStop> CreateServiceStop(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> service_name = 0,
+    bool restart = false) {
+  ServiceStopBuilder builder_(_fbb);
+  builder_.add_service_name(service_name);
+  builder_.add_restart(restart);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<ServiceStop> CreateServiceStopDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *service_name = nullptr,
+    bool restart = false) {
+  auto service_name__ = service_name ? _fbb.CreateString(service_name) : 0;
+  return futureheadapi::CreateServiceStop(
+      _fbb,
+      service_name__,
+      restart);
+}
+
+flatbuffers::Offset<ServiceStop> CreateServiceStop(flatbuffers::FlatBufferBuilder &_fbb, const ServiceStopT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct TopicServiceStopT : public flatbuffers::NativeTable {
+  typedef TopicServiceStop TableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.TopicServiceStopT";
+  }
+  bool unsubscribe;
+  TopicServiceStopT()
+      : unsubscribe(false) {
+  }
+};
+
+struct TopicServiceStop FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef TopicServiceStopT NativeTableType;
+  typedef TopicServiceStopBuilder Builder;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return TopicServiceStopTypeTable();
+  }
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.TopicServiceStop";
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_UNSUBSCRIBE = 4
+  };
+  bool unsubscribe() const {
+    return GetField<uint8_t>(VT_UNSUBSCRIBE, 0) != 0;
+  }
+  bool mutate_unsubscribe(bool _unsubscribe) {
+    return SetField<uint8_t>(VT_UNSUBSCRIBE, static_cast<uint8_t>(_unsubscribe), 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint8_t>(verifier, VT_UNSUBSCRIBE) &&
+           verifier.EndTable();
+  }
+  TopicServiceStopT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(TopicServiceStopT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<TopicServiceStop> Pack(flatbuffers::FlatBufferBuilder &_fbb, const TopicServiceStopT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct TopicServiceStopBuilder {
+  typedef TopicServiceStop Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_unsubscribe(bool unsubscribe) {
+    fbb_.AddElement<uint8_t>(TopicServiceStop::VT_UNSUBSCRIBE, static_cast<uint8_t>(unsubscribe), 0);
+  }
+  explicit TopicServiceStopBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  TopicServiceStopBuilder &operator=(const TopicServiceStopBuilder &);
+  flatbuffers::Offset<TopicServiceStop> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<TopicServiceStop>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<TopicServiceStop> CreateTopicServiceStop(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    bool unsubscribe = false) {
+  TopicServiceStopBuilder builder_(_fbb);
+  builder_.add_unsubscribe(unsubscribe);
+  return builder_.Finish();
+}
+
+flatbuffers::Offset<TopicServiceStop> CreateTopicServiceStop(flatbuffers::FlatBufferBuilder &_fbb, const TopicServiceStopT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct EventServiceStopT : public flatbuffers::NativeTable {
+  typedef EventServiceStop TableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.EventServiceStopT";
+  }
+  EventServiceStopT() {
+  }
+};
+
+struct EventServiceStop FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef EventServiceStopT NativeTableType;
+  typedef EventServiceStopBuilder Builder;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return EventServiceStopTypeTable();
+  }
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.EventServiceStop";
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           verifier.EndTable();
+  }
+  EventServiceStopT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(EventServiceStopT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<EventServiceStop> Pack(flatbuffers::FlatBufferBuilder &_fbb, const EventServiceStopT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct EventServiceStopBuilder {
+  typedef EventServiceStop Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  explicit EventServiceStopBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  EventServiceStopBuilder &operator=(const EventServiceStopBuilder &);
+  flatbuffers::Offset<EventServiceStop> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<EventServiceStop>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<EventServiceStop> CreateEventServiceStop(
+    flatbuffers::FlatBufferBuilder &_fbb) {
+  EventServiceStopBuilder builder_(_fbb);
+  return builder_.Finish();
+}
+
+flatbuffers::Offset<EventServiceStop> CreateEventServiceStop(flatbuffers::FlatBufferBuilder &_fbb, const EventServiceStopT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct EventAckT : public flatbuffers::NativeTable {
+  typedef EventAck TableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.EventAckT";
+  }
+  EventAckT() {
+  }
+};
+
+struct EventAck FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef EventAckT NativeTableType;
+  typedef EventAckBuilder Builder;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return EventAckTypeTable();
+  }
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.EventAck";
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           verifier.EndTable();
+  }
+  EventAckT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(EventAckT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<EventAck> Pack(flatbuffers::FlatBufferBuilder &_fbb, const EventAckT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct EventAckBuilder {
+  typedef EventAck Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  explicit EventAckBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  EventAckBuilder &operator=(const EventAckBuilder &);
+  flatbuffers::Offset<EventAck> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<EventAck>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<EventAck> CreateEventAck(
+    flatbuffers::FlatBufferBuilder &_fbb) {
+  EventAckBuilder builder_(_fbb);
+  return builder_.Finish();
+}
+
+flatbuffers::Offset<EventAck> CreateEventAck(flatbuffers::FlatBufferBuilder &_fbb, const EventAckT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct TopicConfirmationT : public flatbuffers::NativeTable {
+  typedef TopicConfirmation TableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.TopicConfirmationT";
+  }
+  bool unsubscribe;
+  std::unique_ptr<futureheadapi::TopicConfirmationOptionsT> options;
+  TopicConfirmationT()
+      : unsubscribe(false) {
+  }
+};
+
+struct TopicConfirmation FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef TopicConfirmationT NativeTableType;
+  typedef TopicConfirmationBuilder Builder;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return TopicConfirmationTypeTable();
+  }
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.TopicConfirmation";
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_UNSUBSCRIBE = 4,
+    VT_OPTIONS = 6
+  };
+  bool unsubscribe() const {
+    return GetField<uint8_t>(VT_UNSUBSCRIBE, 0) != 0;
+  }
+  bool mutate_unsubscribe(bool _unsubscribe) {
+    return SetField<uint8_t>(VT_UNSUBSCRIBE, static_cast<uint8_t>(_unsubscribe), 0);
+  }
+  const futureheadapi::TopicConfirmationOptions *options() const {
+    return GetPointer<const futureheadapi::TopicConfirmationOptions *>(VT_OPTIONS);
+  }
+  futureheadapi::TopicConfirmationOptions *mutable_options() {
+    return GetPointer<futureheadapi::TopicConfirmationOptions *>(VT_OPTIONS);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint8_t>(verifier, VT_UNSUBSCRIBE) &&
+           VerifyOffset(verifier, VT_OPTIONS) &&
+           verifier.VerifyTable(options()) &&
+           verifier.EndTable();
+  }
+  TopicConfirmationT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(TopicConfirmationT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<TopicConfirmation> Pack(flatbuffers::FlatBufferBuilder &_fbb, const TopicConfirmationT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct TopicConfirmationBuilder {
+  typedef TopicConfirmation Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_unsubscribe(bool unsubscribe) {
+    fbb_.AddElement<uint8_t>(TopicConfirmation::VT_UNSUBSCRIBE, static_cast<uint8_t>(unsubscribe), 0);
+  }
+  void add_options(flatbuffers::Offset<futureheadapi::TopicConfirmationOptions> options) {
+    fbb_.AddOffset(TopicConfirmation::VT_OPTIONS, options);
+  }
+  explicit TopicConfirmationBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  TopicConfirmationBuilder &operator=(const TopicConfirmationBuilder &);
+  flatbuffers::Offset<TopicConfirmation> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<TopicConfirmation>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<TopicConfirmation> CreateTopicConfirmation(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    bool unsubscribe = false,
+    flatbuffers::Offset<futureheadapi::TopicConfirmationOptions> options = 0) {
+  TopicConfirmationBuilder builder_(_fbb);
+  builder_.add_options(options);
+  builder_.add_unsubscribe(unsubscribe);
+  return builder_.Finish();
+}
+
+flatbuffers::Offset<TopicConfirmation> CreateTopicConfirmation(flatbuffers::FlatBufferBuilder &_fbb, const TopicConfirmationT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct TopicConfirmationOptionsT : public flatbuffers::NativeTable {
+  typedef TopicConfirmationOptions TableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.TopicConfirmationOptionsT";
+  }
+  futureheadapi::TopicConfirmationTypeFilter confirmation_type_filter;
+  bool all_local_accounts;
+  std::vector<std::string> accounts;
+  bool include_block;
+  bool include_election_info;
+  TopicConfirmationOptionsT()
+      : confirmation_type_filter(futureheadapi::TopicConfirmationTypeFilter_all),
+        all_local_accounts(false),
+        include_block(true),
+        include_election_info(true) {
+  }
+};
+
+struct TopicConfirmationOptions FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef TopicConfirmationOptionsT NativeTableType;
+  typedef TopicConfirmationOptionsBuilder Builder;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return TopicConfirmationOptionsTypeTable();
+  }
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.TopicConfirmationOptions";
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_CONFIRMATION_TYPE_FILTER = 4,
+    VT_ALL_LOCAL_ACCOUNTS = 6,
+    VT_ACCOUNTS = 8,
+    VT_INCLUDE_BLOCK = 10,
+    VT_INCLUDE_ELECTION_INFO = 12
+  };
+  futureheadapi::TopicConfirmationTypeFilter confirmation_type_filter() const {
+    return static_cast<futureheadapi::TopicConfirmationTypeFilter>(GetField<int8_t>(VT_CONFIRMATION_TYPE_FILTER, 0));
+  }
+  bool mutate_confirmation_type_filter(futureheadapi::TopicConfirmationTypeFilter _confirmation_type_filter) {
+    return SetField<int8_t>(VT_CONFIRMATION_TYPE_FILTER, static_cast<int8_t>(_confirmation_type_filter), 0);
+  }
+  bool all_local_accounts() const {
+    return GetField<uint8_t>(VT_ALL_LOCAL_ACCOUNTS, 0) != 0;
+  }
+  bool mutate_all_local_accounts(bool _all_local_accounts) {
+    return SetField<uint8_t>(VT_ALL_LOCAL_ACCOUNTS, static_cast<uint8_t>(_all_local_accounts), 0);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *accounts() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_ACCOUNTS);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *mutable_accounts() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_ACCOUNTS);
+  }
+  bool include_block() const {
+    return GetField<uint8_t>(VT_INCLUDE_BLOCK, 1) != 0;
+  }
+  bool mutate_include_block(bool _include_block) {
+    return SetField<uint8_t>(VT_INCLUDE_BLOCK, static_cast<uint8_t>(_include_block), 1);
+  }
+  bool include_election_info() const {
+    return GetField<uint8_t>(VT_INCLUDE_ELECTION_INFO, 1) != 0;
+  }
+  bool mutate_include_election_info(bool _include_election_info) {
+    return SetField<uint8_t>(VT_INCLUDE_ELECTION_INFO, static_cast<uint8_t>(_include_election_info), 1);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int8_t>(verifier, VT_CONFIRMATION_TYPE_FILTER) &&
+           VerifyField<uint8_t>(verifier, VT_ALL_LOCAL_ACCOUNTS) &&
+           VerifyOffset(verifier, VT_ACCOUNTS) &&
+           verifier.VerifyVector(accounts()) &&
+           verifier.VerifyVectorOfStrings(accounts()) &&
+           VerifyField<uint8_t>(verifier, VT_INCLUDE_BLOCK) &&
+           VerifyField<uint8_t>(verifier, VT_INCLUDE_ELECTION_INFO) &&
+           verifier.EndTable();
+  }
+  TopicConfirmationOptionsT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(TopicConfirmationOptionsT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<TopicConfirmationOptions> Pack(flatbuffers::FlatBufferBuilder &_fbb, const TopicConfirmationOptionsT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct TopicConfirmationOptionsBuilder {
+  typedef TopicConfirmationOptions Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_confirmation_type_filter(futureheadapi::TopicConfirmationTypeFilter confirmation_type_filter) {
+    fbb_.AddElement<int8_t>(TopicConfirmationOptions::VT_CONFIRMATION_TYPE_FILTER, static_cast<int8_t>(confirmation_type_filter), 0);
+  }
+  void add_all_local_accounts(bool all_local_accounts) {
+    fbb_.AddElement<uint8_t>(TopicConfirmationOptions::VT_ALL_LOCAL_ACCOUNTS, static_cast<uint8_t>(all_local_accounts), 0);
+  }
+  void add_accounts(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> accounts) {
+    fbb_.AddOffset(TopicConfirmationOptions::VT_ACCOUNTS, accounts);
+  }
+  void add_include_block(bool include_block) {
+    fbb_.AddElement<uint8_t>(TopicConfirmationOptions::VT_INCLUDE_BLOCK, static_cast<uint8_t>(include_block), 1);
+  }
+  void add_include_election_info(bool include_election_info) {
+    fbb_.AddElement<uint8_t>(TopicConfirmationOptions::VT_INCLUDE_ELECTION_INFO, static_cast<uint8_t>(include_election_info), 1);
+  }
+  explicit TopicConfirmationOptionsBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  TopicConfirmationOptionsBuilder &operator=(const TopicConfirmationOptionsBuilder &);
+  flatbuffers::Offset<TopicConfirmationOptions> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<TopicConfirmationOptions>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<TopicConfirmationOptions> CreateTopicConfirmationOptions(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    futureheadapi::TopicConfirmationTypeFilter confirmation_type_filter = futureheadapi::TopicConfirmationTypeFilter_all,
+    bool all_local_accounts = false,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> accounts = 0,
+    bool include_block = true,
+    bool include_election_info = true) {
+  TopicConfirmationOptionsBuilder builder_(_fbb);
+  builder_.add_accounts(accounts);
+  builder_.add_include_election_info(include_election_info);
+  builder_.add_include_block(include_block);
+  builder_.add_all_local_accounts(all_local_accounts);
+  builder_.add_confirmation_type_filter(confirmation_type_filter);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<TopicConfirmationOptions> CreateTopicConfirmationOptionsDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    futureheadapi::TopicConfirmationTypeFilter confirmation_type_filter = futureheadapi::TopicConfirmationTypeFilter_all,
+    bool all_local_accounts = false,
+    const std::vector<flatbuffers::Offset<flatbuffers::String>> *accounts = nullptr,
+    bool include_block = true,
+    bool include_election_info = true) {
+  auto accounts__ = accounts ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*accounts) : 0;
+  return futureheadapi::CreateTopicConfirmationOptions(
+      _fbb,
+      confirmation_type_filter,
+      all_local_accounts,
+      accounts__,
+      include_block,
+      include_election_info);
+}
+
+flatbuffers::Offset<TopicConfirmationOptions> CreateTopicConfirmationOptions(flatbuffers::FlatBufferBuilder &_fbb, const TopicConfirmationOptionsT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct EventConfirmationT : public flatbuffers::NativeTable {
+  typedef EventConfirmation TableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.EventConfirmationT";
+  }
+  futureheadapi::TopicConfirmationType confirmation_type;
+  std::string account;
+  std::string amount;
+  std::string hash;
+  futureheadapi::BlockUnion block;
+  std::unique_ptr<futureheadapi::ElectionInfoT> election_info;
+  EventConfirmationT()
+      : confirmation_type(futureheadapi::TopicConfirmationType_active_quorum) {
+  }
+};
+
+struct EventConfirmation FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef EventConfirmationT NativeTableType;
+  typedef EventConfirmationBuilder Builder;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return EventConfirmationTypeTable();
+  }
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.EventConfirmation";
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_CONFIRMATION_TYPE = 4,
+    VT_ACCOUNT = 6,
+    VT_AMOUNT = 8,
+    VT_HASH = 10,
+    VT_BLOCK_TYPE = 12,
+    VT_BLOCK = 14,
+    VT_ELECTION_INFO = 16
+  };
+  futureheadapi::TopicConfirmationType confirmation_type() const {
+    return static_cast<futureheadapi::TopicConfirmationType>(GetField<int8_t>(VT_CONFIRMATION_TYPE, 0));
+  }
+  bool mutate_confirmation_type(futureheadapi::TopicConfirmationType _confirmation_type) {
+    return SetField<int8_t>(VT_CONFIRMATION_TYPE, static_cast<int8_t>(_confirmation_type), 0);
+  }
+  const flatbuffers::String *account() const {
+    return GetPointer<const flatbuffers::String *>(VT_ACCOUNT);
+  }
+  flatbuffers::String *mutable_account() {
+    return GetPointer<flatbuffers::String *>(VT_ACCOUNT);
+  }
+  const flatbuffers::String *amount() const {
+    return GetPointer<const flatbuffers::String *>(VT_AMOUNT);
+  }
+  flatbuffers::String *mutable_amount() {
+    return GetPointer<flatbuffers::String *>(VT_AMOUNT);
+  }
+  const flatbuffers::String *hash() const {
+    return GetPointer<const flatbuffers::String *>(VT_HASH);
+  }
+  flatbuffers::String *mutable_hash() {
+    return GetPointer<flatbuffers::String *>(VT_HASH);
+  }
+  futureheadapi::Block block_type() const {
+    return static_cast<futureheadapi::Block>(GetField<uint8_t>(VT_BLOCK_TYPE, 0));
+  }
+  const void *block() const {
+    return GetPointer<const void *>(VT_BLOCK);
+  }
+  template<typename T> const T *block_as() const;
+  const futureheadapi::BlockState *block_as_BlockState() const {
+    return block_type() == futureheadapi::Block_BlockState ? static_cast<const futureheadapi::BlockState *>(block()) : nullptr;
+  }
+  const futureheadapi::BlockOpen *block_as_BlockOpen() const {
+    return block_type() == futureheadapi::Block_BlockOpen ? static_cast<const futureheadapi::BlockOpen *>(block()) : nullptr;
+  }
+  const futureheadapi::BlockReceive *block_as_BlockReceive() const {
+    return block_type() == futureheadapi::Block_BlockReceive ? static_cast<const futureheadapi::BlockReceive *>(block()) : nullptr;
+  }
+  const futureheadapi::BlockSend *block_as_BlockSend() const {
+    return block_type() == futureheadapi::Block_BlockSend ? static_cast<const futureheadapi::BlockSend *>(block()) : nullptr;
+  }
+  const futureheadapi::BlockChange *block_as_BlockChange() const {
+    return block_type() == futureheadapi::Block_BlockChange ? static_cast<const futureheadapi::BlockChange *>(block()) : nullptr;
+  }
+  void *mutable_block() {
+    return GetPointer<void *>(VT_BLOCK);
+  }
+  const futureheadapi::ElectionInfo *election_info() const {
+    return GetPointer<const futureheadapi::ElectionInfo *>(VT_ELECTION_INFO);
+  }
+  futureheadapi::ElectionInfo *mutable_election_info() {
+    return GetPointer<futureheadapi::ElectionInfo *>(VT_ELECTION_INFO);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int8_t>(verifier, VT_CONFIRMATION_TYPE) &&
+           VerifyOffset(verifier, VT_ACCOUNT) &&
+           verifier.VerifyString(account()) &&
+           VerifyOffset(verifier, VT_AMOUNT) &&
+           verifier.VerifyString(amount()) &&
+           VerifyOffset(verifier, VT_HASH) &&
+           verifier.VerifyString(hash()) &&
+           VerifyField<uint8_t>(verifier, VT_BLOCK_TYPE) &&
+           VerifyOffset(verifier, VT_BLOCK) &&
+           VerifyBlock(verifier, block(), block_type()) &&
+           VerifyOffset(verifier, VT_ELECTION_INFO) &&
+           verifier.VerifyTable(election_info()) &&
+           verifier.EndTable();
+  }
+  EventConfirmationT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(EventConfirmationT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<EventConfirmation> Pack(flatbuffers::FlatBufferBuilder &_fbb, const EventConfirmationT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+template<> inline const futureheadapi::BlockState *EventConfirmation::block_as<futureheadapi::BlockState>() const {
+  return block_as_BlockState();
+}
+
+template<> inline const futureheadapi::BlockOpen *EventConfirmation::block_as<futureheadapi::BlockOpen>() const {
+  return block_as_BlockOpen();
+}
+
+template<> inline const futureheadapi::BlockReceive *EventConfirmation::block_as<futureheadapi::BlockReceive>() const {
+  return block_as_BlockReceive();
+}
+
+template<> inline const futureheadapi::BlockSend *EventConfirmation::block_as<futureheadapi::BlockSend>() const {
+  return block_as_BlockSend();
+}
+
+template<> inline const futureheadapi::BlockChange *EventConfirmation::block_as<futureheadapi::BlockChange>() const {
+  return block_as_BlockChange();
+}
+
+struct EventConfirmationBuilder {
+  typedef EventConfirmation Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_confirmation_type(futureheadapi::TopicConfirmationType confirmation_type) {
+    fbb_.AddElement<int8_t>(EventConfirmation::VT_CONFIRMATION_TYPE, static_cast<int8_t>(confirmation_type), 0);
+  }
+  void add_account(flatbuffers::Offset<flatbuffers::String> account) {
+    fbb_.AddOffset(EventConfirmation::VT_ACCOUNT, account);
+  }
+  void add_amount(flatbuffers::Offset<flatbuffers::String> amount) {
+    fbb_.AddOffset(EventConfirmation::VT_AMOUNT, amount);
+  }
+  void add_hash(flatbuffers::Offset<flatbuffers::String> hash) {
+    fbb_.AddOffset(EventConfirmation::VT_HASH, hash);
+  }
+  void add_block_type(futureheadapi::Block block_type) {
+    fbb_.AddElement<uint8_t>(EventConfirmation::VT_BLOCK_TYPE, static_cast<uint8_t>(block_type), 0);
+  }
+  void add_block(flatbuffers::Offset<void> block) {
+    fbb_.AddOffset(EventConfirmation::VT_BLOCK, block);
+  }
+  void add_election_info(flatbuffers::Offset<futureheadapi::ElectionInfo> election_info) {
+    fbb_.AddOffset(EventConfirmation::VT_ELECTION_INFO, election_info);
+  }
+  explicit EventConfirmationBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  EventConfirmationBuilder &operator=(const EventConfirmationBuilder &);
+  flatbuffers::Offset<EventConfirmation> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<EventConfirmation>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<EventConfirmation> CreateEventConfirmation(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    futureheadapi::TopicConfirmationType confirmation_type = futureheadapi::TopicConfirmationType_active_quorum,
+    flatbuffers::Offset<flatbuffers::String> account = 0,
+    flatbuffers::Offset<flatbuffers::String> amount = 0,
+    flatbuffers::Offset<flatbuffers::String> hash = 0,
+    futureheadapi::Block block_type = futureheadapi::Block_NONE,
+    flatbuffers::Offset<void> block = 0,
+    flatbuffers::Offset<futureheadapi::ElectionInfo> election_info = 0) {
+  EventConfirmationBuilder builder_(_fbb);
+  builder_.add_election_info(election_info);
+  builder_.add_block(block);
+  builder_.add_hash(hash);
+  builder_.add_amount(amount);
+  builder_.add_account(account);
+  builder_.add_block_type(block_type);
+  builder_.add_confirmation_type(confirmation_type);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<EventConfirmation> CreateEventConfirmationDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    futureheadapi::TopicConfirmationType confirmation_type = futureheadapi::TopicConfirmationType_active_quorum,
+    const char *account = nullptr,
+    const char *amount = nullptr,
+    const char *hash = nullptr,
+    futureheadapi::Block block_type = futureheadapi::Block_NONE,
+    flatbuffers::Offset<void> block = 0,
+    flatbuffers::Offset<futureheadapi::ElectionInfo> election_info = 0) {
+  auto account__ = account ? _fbb.CreateString(account) : 0;
+  auto amount__ = amount ? _fbb.CreateString(amount) : 0;
+  auto hash__ = hash ? _fbb.CreateString(hash) : 0;
+  return futureheadapi::CreateEventConfirmation(
+      _fbb,
+      confirmation_type,
+      account__,
+      amount__,
+      hash__,
+      block_type,
+      block,
+      election_info);
+}
+
+flatbuffers::Offset<EventConfirmation> CreateEventConfirmation(flatbuffers::FlatBufferBuilder &_fbb, const EventConfirmationT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct ElectionInfoT : public flatbuffers::NativeTable {
+  typedef ElectionInfo TableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.ElectionInfoT";
+  }
+  uint64_t duration;
+  uint64_t time;
+  std::string tally;
+  uint64_t request_count;
+  uint64_t block_count;
+  uint64_t voter_count;
+  ElectionInfoT()
+      : duration(0),
+        time(0),
+        request_count(0),
+        block_count(0),
+        voter_count(0) {
+  }
+};
+
+struct ElectionInfo FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ElectionInfoT NativeTableType;
+  typedef ElectionInfoBuilder Builder;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return ElectionInfoTypeTable();
+  }
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.ElectionInfo";
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_DURATION = 4,
+    VT_TIME = 6,
+    VT_TALLY = 8,
+    VT_REQUEST_COUNT = 10,
+    VT_BLOCK_COUNT = 12,
+    VT_VOTER_COUNT = 14
+  };
+  uint64_t duration() const {
+    return GetField<uint64_t>(VT_DURATION, 0);
+  }
+  bool mutate_duration(uint64_t _duration) {
+    return SetField<uint64_t>(VT_DURATION, _duration, 0);
+  }
+  uint64_t time() const {
+    return GetField<uint64_t>(VT_TIME, 0);
+  }
+  bool mutate_time(uint64_t _time) {
+    return SetField<uint64_t>(VT_TIME, _time, 0);
+  }
+  const flatbuffers::String *tally() const {
+    return GetPointer<const flatbuffers::String *>(VT_TALLY);
+  }
+  flatbuffers::String *mutable_tally() {
+    return GetPointer<flatbuffers::String *>(VT_TALLY);
+  }
+  uint64_t request_count() const {
+    return GetField<uint64_t>(VT_REQUEST_COUNT, 0);
+  }
+  bool mutate_request_count(uint64_t _request_count) {
+    return SetField<uint64_t>(VT_REQUEST_COUNT, _request_count, 0);
+  }
+  uint64_t block_count() const {
+    return GetField<uint64_t>(VT_BLOCK_COUNT, 0);
+  }
+  bool mutate_block_count(uint64_t _block_count) {
+    return SetField<uint64_t>(VT_BLOCK_COUNT, _block_count, 0);
+  }
+  uint64_t voter_count() const {
+    return GetField<uint64_t>(VT_VOTER_COUNT, 0);
+  }
+  bool mutate_voter_count(uint64_t _voter_count) {
+    return SetField<uint64_t>(VT_VOTER_COUNT, _voter_count, 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint64_t>(verifier, VT_DURATION) &&
+           VerifyField<uint64_t>(verifier, VT_TIME) &&
+           VerifyOffset(verifier, VT_TALLY) &&
+           verifier.VerifyString(tally()) &&
+           VerifyField<uint64_t>(verifier, VT_REQUEST_COUNT) &&
+           VerifyField<uint64_t>(verifier, VT_BLOCK_COUNT) &&
+           VerifyField<uint64_t>(verifier, VT_VOTER_COUNT) &&
+           verifier.EndTable();
+  }
+  ElectionInfoT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(ElectionInfoT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<ElectionInfo> Pack(flatbuffers::FlatBufferBuilder &_fbb, const ElectionInfoT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct ElectionInfoBuilder {
+  typedef ElectionInfo Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_duration(uint64_t duration) {
+    fbb_.AddElement<uint64_t>(ElectionInfo::VT_DURATION, duration, 0);
+  }
+  void add_time(uint64_t time) {
+    fbb_.AddElement<uint64_t>(ElectionInfo::VT_TIME, time, 0);
+  }
+  void add_tally(flatbuffers::Offset<flatbuffers::String> tally) {
+    fbb_.AddOffset(ElectionInfo::VT_TALLY, tally);
+  }
+  void add_request_count(uint64_t request_count) {
+    fbb_.AddElement<uint64_t>(ElectionInfo::VT_REQUEST_COUNT, request_count, 0);
+  }
+  void add_block_count(uint64_t block_count) {
+    fbb_.AddElement<uint64_t>(ElectionInfo::VT_BLOCK_COUNT, block_count, 0);
+  }
+  void add_voter_count(uint64_t voter_count) {
+    fbb_.AddElement<uint64_t>(ElectionInfo::VT_VOTER_COUNT, voter_count, 0);
+  }
+  explicit ElectionInfoBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ElectionInfoBuilder &operator=(const ElectionInfoBuilder &);
+  flatbuffers::Offset<ElectionInfo> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ElectionInfo>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ElectionInfo> CreateElectionInfo(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t duration = 0,
+    uint64_t time = 0,
+    flatbuffers::Offset<flatbuffers::String> tally = 0,
+    uint64_t request_count = 0,
+    uint64_t block_count = 0,
+    uint64_t voter_count = 0) {
+  ElectionInfoBuilder builder_(_fbb);
+  builder_.add_voter_count(voter_count);
+  builder_.add_block_count(block_count);
+  builder_.add_request_count(request_count);
+  builder_.add_time(time);
+  builder_.add_duration(duration);
+  builder_.add_tally(tally);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<ElectionInfo> CreateElectionInfoDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t duration = 0,
+    uint64_t time = 0,
+    const char *tally = nullptr,
+    uint64_t request_count = 0,
+    uint64_t block_count = 0,
+    uint64_t voter_count = 0) {
+  auto tally__ = tally ? _fbb.CreateString(tally) : 0;
+  return futureheadapi::CreateElectionInfo(
+      _fbb,
+      duration,
+      time,
+      tally__,
+      request_count,
+      block_count,
+      voter_count);
+}
+
+flatbuffers::Offset<ElectionInfo> CreateElectionInfo(flatbuffers::FlatBufferBuilder &_fbb, const ElectionInfoT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct ErrorT : public flatbuffers::NativeTable {
+  typedef Error TableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.ErrorT";
+  }
+  int32_t code;
+  int32_t category;
+  std::string message;
+  ErrorT()
+      : code(0),
+        category(0) {
+  }
+};
+
+struct Error FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ErrorT NativeTableType;
+  typedef ErrorBuilder Builder;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return ErrorTypeTable();
+  }
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.Error";
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_CODE = 4,
+    VT_CATEGORY = 6,
+    VT_MESSAGE = 8
+  };
+  int32_t code() const {
+    return GetField<int32_t>(VT_CODE, 0);
+  }
+  bool mutate_code(int32_t _code) {
+    return SetField<int32_t>(VT_CODE, _code, 0);
+  }
+  int32_t category() const {
+    return GetField<int32_t>(VT_CATEGORY, 0);
+  }
+  bool mutate_category(int32_t _category) {
+    return SetField<int32_t>(VT_CATEGORY, _category, 0);
+  }
+  const flatbuffers::String *message() const {
+    return GetPointer<const flatbuffers::String *>(VT_MESSAGE);
+  }
+  flatbuffers::String *mutable_message() {
+    return GetPointer<flatbuffers::String *>(VT_MESSAGE);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int32_t>(verifier, VT_CODE) &&
+           VerifyField<int32_t>(verifier, VT_CATEGORY) &&
+           VerifyOffset(verifier, VT_MESSAGE) &&
+           verifier.VerifyString(message()) &&
+           verifier.EndTable();
+  }
+  ErrorT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(ErrorT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<Error> Pack(flatbuffers::FlatBufferBuilder &_fbb, const ErrorT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct ErrorBuilder {
+  typedef Error Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_code(int32_t code) {
+    fbb_.AddElement<int32_t>(Error::VT_CODE, code, 0);
+  }
+  void add_category(int32_t category) {
+    fbb_.AddElement<int32_t>(Error::VT_CATEGORY, category, 0);
+  }
+  void add_message(flatbuffers::Offset<flatbuffers::String> message) {
+    fbb_.AddOffset(Error::VT_MESSAGE, message);
+  }
+  explicit ErrorBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ErrorBuilder &operator=(const ErrorBuilder &);
+  flatbuffers::Offset<Error> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Error>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Error> CreateError(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int32_t code = 0,
+    int32_t category = 0,
+    flatbuffers::Offset<flatbuffers::String> message = 0) {
+  ErrorBuilder builder_(_fbb);
+  builder_.add_message(message);
+  builder_.add_category(category);
+  builder_.add_code(code);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Error> CreateErrorDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int32_t code = 0,
+    int32_t category = 0,
+    const char *message = nullptr) {
+  auto message__ = message ? _fbb.CreateString(message) : 0;
+  return futureheadapi::CreateError(
+      _fbb,
+      code,
+      category,
+      message__);
+}
+
+flatbuffers::Offset<Error> CreateError(flatbuffers::FlatBufferBuilder &_fbb, const ErrorT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct SuccessT : public flatbuffers::NativeTable {
+  typedef Success TableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.SuccessT";
+  }
+  std::string message;
+  SuccessT() {
+  }
+};
+
+struct Success FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef SuccessT NativeTableType;
+  typedef SuccessBuilder Builder;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return SuccessTypeTable();
+  }
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.Success";
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_MESSAGE = 4
+  };
+  const flatbuffers::String *message() const {
+    return GetPointer<const flatbuffers::String *>(VT_MESSAGE);
+  }
+  flatbuffers::String *mutable_message() {
+    return GetPointer<flatbuffers::String *>(VT_MESSAGE);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_MESSAGE) &&
+           verifier.VerifyString(message()) &&
+           verifier.EndTable();
+  }
+  SuccessT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(SuccessT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<Success> Pack(flatbuffers::FlatBufferBuilder &_fbb, const SuccessT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct SuccessBuilder {
+  typedef Success Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_message(flatbuffers::Offset<flatbuffers::String> message) {
+    fbb_.AddOffset(Success::VT_MESSAGE, message);
+  }
+  explicit SuccessBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  SuccessBuilder &operator=(const SuccessBuilder &);
+  flatbuffers::Offset<Success> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Success>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Success> CreateSuccess(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> message = 0) {
+  SuccessBuilder builder_(_fbb);
+  builder_.add_message(message);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Success> CreateSuccessDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *message = nullptr) {
+  auto message__ = message ? _fbb.CreateString(message) : 0;
+  return futureheadapi::CreateSuccess(
+      _fbb,
+      message__);
+}
+
+flatbuffers::Offset<Success> CreateSuccess(flatbuffers::FlatBufferBuilder &_fbb, const SuccessT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct IsAliveT : public flatbuffers::NativeTable {
+  typedef IsAlive TableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.IsAliveT";
+  }
+  IsAliveT() {
+  }
+};
+
+struct IsAlive FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef IsAliveT NativeTableType;
+  typedef IsAliveBuilder Builder;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return IsAliveTypeTable();
+  }
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.IsAlive";
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           verifier.EndTable();
+  }
+  IsAliveT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(IsAliveT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<IsAlive> Pack(flatbuffers::FlatBufferBuilder &_fbb, const IsAliveT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct IsAliveBuilder {
+  typedef IsAlive Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  explicit IsAliveBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  IsAliveBuilder &operator=(const IsAliveBuilder &);
+  flatbuffers::Offset<IsAlive> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<IsAlive>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<IsAlive> CreateIsAlive(
+    flatbuffers::FlatBufferBuilder &_fbb) {
+  IsAliveBuilder builder_(_fbb);
+  return builder_.Finish();
+}
+
+flatbuffers::Offset<IsAlive> CreateIsAlive(flatbuffers::FlatBufferBuilder &_fbb, const IsAliveT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct EnvelopeT : public flatbuffers::NativeTable {
+  typedef Envelope TableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.EnvelopeT";
+  }
+  uint64_t time;
+  std::string credentials;
+  std::string correlation_id;
+  futureheadapi::MessageUnion message;
+  EnvelopeT()
+      : time(0) {
+  }
+};
+
+struct Envelope FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef EnvelopeT NativeTableType;
+  typedef EnvelopeBuilder Builder;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return EnvelopeTypeTable();
+  }
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "futureheadapi.Envelope";
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_TIME = 4,
+    VT_CREDENTIALS = 6,
+    VT_CORRELATION_ID = 8,
+    VT_MESSAGE_TYPE = 10,
+    VT_MESSAGE = 12
+  };
+  uint64_t time() const {
+    return GetField<uint64_t>(VT_TIME, 0);
+  }
+  bool mutate_time(uint64_t _time) {
+    return SetField<uint64_t>(VT_TIME, _time, 0);
+  }
+  const flatbuffers::String *credentials() const {
+    return GetPointer<const flatbuffers::String *>(VT_CREDENTIALS);
+  }
+  flatbuffers::String *mutable_credentials() {
+    return GetPointer<flatbuffers::String *>(VT_CREDENTIALS);
+  }
+  const flatbuffers::String *correlation_id() const {
+    return GetPointer<const flatbuffers::String *>(VT_CORRELATION_ID);
+  }
+  flatbuffers::String *mutable_correlation_id() {
+    return GetPointer<flatbuffers::String *>(VT_CORRELATION_ID);
+  }
+  futureheadapi::Message message_type() const {
+    return static_cast<futureheadapi::Message>(GetField<uint8_t>(VT_MESSAGE_TYPE, 0));
+  }
+  const void *message() const {
+    return GetPointer<const void *>(VT_MESSAGE);
+  }
+  template<typename T> const T *message_as() const;
+  const futureheadapi::Error *message_as_Error() const {
+    return message_type() == futureheadapi::Message_Error ? static_cast<const futureheadapi::Error *>(message()) : nullptr;
+  }
+  const futureheadapi::Success *message_as_Success() const {
+    return message_type() == futureheadapi::Message_Success ? static_cast<const futureheadapi::Success *>(message()) : nullptr;
+  }
+  const futureheadapi::IsAlive *message_as_IsAlive() const {
+    return message_type() == futureheadapi::Message_IsAlive ? static_cast<const futureheadapi::IsAlive *>(message()) : nullptr;
+  }
+  const futureheadapi::EventAck *message_as_EventAck() const {
+    return message_type() == futureheadapi::Message_EventAck ? static_cast<const futureheadapi::EventAck *>(message()) : nullptr;
+  }
+  const futureheadapi::BlockInfo *message_as_BlockInfo() const {
+    return message_type() == futureheadapi::Message_BlockInfo ? static_cast<const futureheadapi::BlockInfo *>(message()) : nullptr;
+  }
+  const futureheadapi::AccountWeight *message_as_AccountWeight() const {
+    return message_type() == futureheadapi::Message_AccountWeight ? static_cast<const futureheadapi::AccountWeight *>(message()) : nullptr;
+  }
+  const futureheadapi::AccountWeightResponse *message_as_AccountWeightResponse() const {
+    return message_type() == futureheadapi::Message_AccountWeightResponse ? static_cast<const futureheadapi::AccountWeightResponse *>(message()) : nullptr;
+  }
+  const futureheadapi::TopicConfirmation *message_as_TopicConfirmation() const {
+    return message_type() == futureheadapi::Message_TopicConfirmation ? static_cast<const futureheadapi::TopicConfirmation *>(message()) : nullptr;
+  }
+  const futureheadapi::EventConfirmation *message_as_EventConfirmation() const {
+    return message_type() == futureheadapi::Message_EventConfirmation ? static_cast<const futureheadapi::EventConfirmation *>(message()) : nullptr;
+  }
+  const futureheadapi::ServiceRegister *message_as_ServiceRegister() const {
+    return message_type() == futureheadapi::Message_ServiceRegister ? static_cast<const futureheadapi::ServiceRegister *>(message()) : nullptr;
+  }
+  const futureheadapi::ServiceStop *message_as_ServiceStop() const {
+    return message_type() == futureheadapi::Message_ServiceStop ? static_cast<const futureheadapi::ServiceStop *>(message()) : nullptr;
+  }
+  const futureheadapi::TopicServiceStop *message_as_TopicServiceStop() const {
+    return message_type() == futureheadapi::Message_TopicServiceStop ? static_cast<const futureheadapi::TopicServiceStop *>(message()) : nullptr;
+  }
+  const futureheadapi::EventServiceStop *message_as_EventServiceStop() const {
+    return message_type() == futureheadapi::Message_EventServiceStop ? static_cast<const futureheadapi::EventServiceStop *>(message()) : nullptr;
+  }
+  const futureheadapi::AccountInfo *message_as_AccountInfo() const {
+    return message_type() == futureheadapi::Message_AccountInfo ? static_cast<const futureheadapi::AccountInfo *>(message()) : nullptr;
+  }
+  const futureheadapi::AccountInfoResponse *message_as_AccountInfoResponse() const {
+    return message_type() == futureheadapi::Message_AccountInfoResponse ? static_cast<const futureheadapi::AccountInfoResponse *>(message()) : nullptr;
+  }
+  const futureheadapi::AccountsBalances *message_as_AccountsBalances() const {
+    return message_type() == futureheadapi::Message_AccountsBalances ? static_cast<const futureheadapi::AccountsBalances *>(message()) : nullptr;
+  }
+  const futureheadapi::AccountsBalancesResponse *message_as_AccountsBalancesResponse() const {
+    return message_type() == futureheadapi::Message_AccountsBalancesResponse ? static_cast<const futureheadapi::AccountsBalancesResponse *>(message()) : nullptr;
+  }
+  const futureheadapi::BlocksInfo *message_as_BlocksInfo() const {
+    return message_type() == futureheadapi::Message_BlocksInfo ? static_cast<const futureheadapi::BlocksInfo *>(message()) : nullptr;
+  }
+  const futureheadapi::BlocksInfoResponse *message_as_BlocksInfoResponse() const {
+    return message_type() == futureheadapi::Message_BlocksInfoResponse ? static_cast<const futureheadapi::BlocksInfoResponse *>(message()) : nullptr;
+  }
+  const futureheadapi::Pending *message_as_Pending() const {
+    return message_type() == futureheadapi::Message_Pending ? static_cast<const futureheadapi::Pending *>(message()) : nullptr;
+  }
+  const futureheadapi::PendingResponse *message_as_PendingResponse() const {
+    return message_type() == futureheadapi::Message_PendingResponse ? static_cast<const futureheadapi::PendingResponse *>(message()) : nullptr;
+  }
+  const futureheadapi::BlockCount *message_as_BlockCount() const {
+    return message_type() == futureheadapi::Message_BlockCount ? static_cast<const futureheadapi::BlockCount *>(message()) : nullptr;
+  }
+  const futureheadapi::BlockCountResponse *message_as_BlockCountResponse() const {
+    return message_type() == futureheadapi::Message_BlockCountResponse ? static_cast<const futureheadapi::BlockCountResponse *>(message()) : nullptr;
+  }
+  void *mutable_message() {
+    return GetPointer<void *>(VT_MESSAGE);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint64_t>(verifier, VT_TIME) &&
+           VerifyOffset(verifier, VT_CREDENTIALS) &&
+           verifier.VerifyString(credentials()) &&
+           VerifyOffset(verifier, VT_CORRELATION_ID) &&
+           verifier.VerifyString(correlation_id()) &&
+           VerifyField<uint8_t>(verifier, VT_MESSAGE_TYPE) &&
+           VerifyOffset(verifier, VT_MESSAGE) &&
+           VerifyMessage(verifier, message(), message_type()) &&
+           verifier.EndTable();
+  }
+  EnvelopeT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(EnvelopeT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<Envelope> Pack(flatbuffers::FlatBufferBuilder &_fbb, const EnvelopeT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+template<> inline const futureheadapi::Error *Envelope::message_as<futureheadapi::Error>() const {
+  return message_as_Error();
+}
+
+template<> inline const futureheadapi::Success *Envelope::message_as<futureheadapi::Success>() const {
+  return message_as_Success();
+}
+
+template<> inline const futureheadapi::IsAlive *Envelope::message_as<futureheadapi::IsAlive>() const {
+  return message_as_IsAlive();
+}
+
+template<> inline const futureheadapi::EventAck *Envelope::message_as<futureheadapi::EventAck>() const {
+  return message_as_EventAck();
+}
+
+template<> inline const futureheadapi::BlockInfo *Envelope::message_as<futureheadapi::BlockInfo>() const {
+  return message_as_BlockInfo();
+}
+
+template<> inline const futureheadapi::AccountWeight *Envelope::message_as<futureheadapi::AccountWeight>() const {
+  return message_as_AccountWeight();
+}
+
+template<> inline const futureheadapi::AccountWeightResponse *Envelope::message_as<futureheadapi::AccountWeightResponse>() const {
+  return message_as_AccountWeightResponse();
+}
+
+template<> inline const futureheadapi::TopicConfirmation *Envelope::message_as<futureheadapi::TopicConfirmation>() const {
+  return message_as_TopicConfirmation();
+}
+
+template<> inline const futureheadapi::EventConfirmation *Envelope::message_as<futureheadapi::EventConfirmation>() const {
+  return message_as_EventConfirmation();
+}
+
+template<> inline const futureheadapi::ServiceRegister *Envelope::message_as<futureheadapi::ServiceRegister>() const {
+  return message_as_ServiceRegister();
+}
+
+template<> inline const futureheadapi::ServiceStop *Envelope::message_as<futureheadapi::ServiceStop>() const {
+  return message_as_ServiceStop();
+}
+
+template<> inline const futureheadapi::TopicServiceStop *Envelope::message_as<futureheadapi::TopicServiceStop>() const {
+  return message_as_TopicServiceStop();
+}
+
+template<> inline const futureheadapi::EventServiceStop *Envelope::message_as<futureheadapi::EventServiceStop>() const {
+  return message_as_EventServiceStop();
+}
+
+template<> inline const futureheadapi::AccountInfo *Envelope::message_as<futureheadapi::AccountInfo>() const {
+  return message_as_AccountInfo();
+}
+
+template<> inline const futureheadapi::AccountInfoResponse *Envelope::message_as<futureheadapi::AccountInfoResponse>() const {
+  return message_as_AccountInfoResponse();
+}
+
+template<> inline const futureheadapi::AccountsBalances *Envelope::message_as<futureheadapi::AccountsBalances>() const {
+  return message_as_AccountsBalances();
+}
+
+template<> inline const futureheadapi::AccountsBalancesResponse *Envelope::message_as<futureheadapi::AccountsBalancesResponse>() const {
+  return message_as_AccountsBalancesResponse();
+}
+
+template<> inline const futureheadapi::BlocksInfo *Envelope::message_as<futureheadapi::BlocksInfo>() const {
+  return message_as_BlocksInfo();
+}
+
+template<> inline const futureheadapi::BlocksInfoResponse *Envelope::message_as<futureheadapi::BlocksInfoResponse>() const {
+  return message_as_BlocksInfoResponse();
+}
+
+template<> inline const futureheadapi::Pending *Envelope::message_as<futureheadapi::Pending>() const {
+  return message_as_Pending();
+}
+
+template<> inline const futureheadapi::PendingResponse *Envelope::message_as<futureheadapi::PendingResponse>() const {
+  return message_as_PendingResponse();
+}
+
+template<> inline const futureheadapi::BlockCount *Envelope::message_as<futureheadapi::BlockCount>() const {
+  return message_as_BlockCount();
+}
+
+template<> inline const futureheadapi::BlockCountResponse *Envelope::message_as<futureheadapi::BlockCountResponse>() const {
+  return message_as_BlockCountResponse();
+}
+
+struct EnvelopeBuilder {
+  typedef Envelope Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_time(uint64_t time) {
+    fbb_.AddElement<uint64_t>(Envelope::VT_TIME, time, 0);
+  }
+  void add_credentials(flatbuffers::Offset<flatbuffers::String> credentials) {
+    fbb_.AddOffset(Envelope::VT_CREDENTIALS, credentials);
+  }
+  void add_correlation_id(flatbuffers::Offset<flatbuffers::String> correlation_id) {
+    fbb_.AddOffset(Envelope::VT_CORRELATION_ID, correlation_id);
+  }
+  void add_message_type(futureheadapi::Message message_type) {
+    fbb_.AddElement<uint8_t>(Envelope::VT_MESSAGE_TYPE, static_cast<uint8_t>(message_type), 0);
+  }
+  void add_message(flatbuffers::Offset<void> message) {
+    fbb_.AddOffset(Envelope::VT_MESSAGE, message);
+  }
+  explicit EnvelopeBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  EnvelopeBuilder &operator=(const EnvelopeBuilder &);
+  flatbuffers::Offset<Envelope> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Envelope>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Envelope> CreateEnvelope(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t time = 0,
+    flatbuffers::Offset<flatbuffers::String> credentials = 0,
+    flatbuffers::Offset<flatbuffers::String> correlation_id = 0,
+    futureheadapi::Message message_type = futureheadapi::Message_NONE,
+    flatbuffers::Offset<void> message = 0) {
+  EnvelopeBuilder builder_(_fbb);
+  builder_.add_time(time);
+  builder_.add_message(message);
+  builder_.add_correlation_id(correlation_id);
+  builder_.add_credentials(credentials);
+  builder_.add_message_type(message_type);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Envelope> CreateEnvelopeDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t time = 0,
+    const char *credentials = nullptr,
+    const char *correlation_id = nullptr,
+    futureheadapi::Message message_type = futureheadapi::Message_NONE,
+    flatbuffers::Offset<void> message = 0) {
+  auto credentials__ = credentials ? _fbb.CreateString(credentials) : 0;
+  auto correlation_id__ = correlation_id ? _fbb.CreateString(correlation_id) : 0;
+  return futureheadapi::CreateEnvelope(
+      _fbb,
+      time,
+      credentials__,
+      correlation_id__,
+      message_type,
+      message);
+}
+
+flatbuffers::Offset<Envelope> CreateEnvelope(flatbuffers::FlatBufferBuilder &_fbb, const EnvelopeT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+inline AccountWeightT *AccountWeight::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new AccountWeightT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void AccountWeight::UnPackTo(AccountWeightT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = account(); if (_e) _o->account = _e->str(); }
+}
+
+inline flatbuffers::Offset<AccountWeight> AccountWeight::Pack(flatbuffers::FlatBufferBuilder &_fbb, const AccountWeightT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateAccountWeight(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<AccountWeight> CreateAccountWeight(flatbuffers::FlatBufferBuilder &_fbb, const AccountWeightT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const AccountWeightT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _account = _fbb.CreateString(_o->account);
+  return futureheadapi::CreateAccountWeight(
+      _fbb,
+      _account);
+}
+
+inline AccountWeightResponseT *AccountWeightResponse::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new AccountWeightResponseT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void AccountWeightResponse::UnPackTo(AccountWeightResponseT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = voting_weight(); if (_e) _o->voting_weight = _e->str(); }
+}
+
+inline flatbuffers::Offset<AccountWeightResponse> AccountWeightResponse::Pack(flatbuffers::FlatBufferBuilder &_fbb, const AccountWeightResponseT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateAccountWeightResponse(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<AccountWeightResponse> CreateAccountWeightResponse(flatbuffers::FlatBufferBuilder &_fbb, const AccountWeightResponseT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const AccountWeightResponseT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _voting_weight = _fbb.CreateString(_o->voting_weight);
+  return futureheadapi::CreateAccountWeightResponse(
+      _fbb,
+      _voting_weight);
+}
+
+inline BlockOpenT *BlockOpen::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new BlockOpenT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void BlockOpen::UnPackTo(BlockOpenT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = hash(); if (_e) _o->hash = _e->str(); }
+  { auto _e = account(); if (_e) _o->account = _e->str(); }
+  { auto _e = source(); if (_e) _o->source = _e->str(); }
+  { auto _e = representative(); if (_e) _o->representative = _e->str(); }
+  { auto _e = signature(); if (_e) _o->signature = _e->str(); }
+  { auto _e = work(); if (_e) _o->work = _e->str(); }
+}
+
+inline flatbuffers::Offset<BlockOpen> BlockOpen::Pack(flatbuffers::FlatBufferBuilder &_fbb, const BlockOpenT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateBlockOpen(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<BlockOpen> CreateBlockOpen(flatbuffers::FlatBufferBuilder &_fbb, const BlockOpenT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const BlockOpenT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _hash = _o->hash.empty() ? 0 : _fbb.CreateString(_o->hash);
+  auto _account = _o->account.empty() ? 0 : _fbb.CreateString(_o->account);
+  auto _source = _o->source.empty() ? 0 : _fbb.CreateString(_o->source);
+  auto _representative = _o->representative.empty() ? 0 : _fbb.CreateString(_o->representative);
+  auto _signature = _o->signature.empty() ? 0 : _fbb.CreateString(_o->signature);
+  auto _work = _o->work.empty() ? 0 : _fbb.CreateString(_o->work);
+  return futureheadapi::CreateBlockOpen(
+      _fbb,
+      _hash,
+      _account,
+      _source,
+      _representative,
+      _signature,
+      _work);
+}
+
+inline BlockReceiveT *BlockReceive::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new BlockReceiveT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void BlockReceive::UnPackTo(BlockReceiveT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = hash(); if (_e) _o->hash = _e->str(); }
+  { auto _e = previous(); if (_e) _o->previous = _e->str(); }
+  { auto _e = source(); if (_e) _o->source = _e->str(); }
+  { auto _e = signature(); if (_e) _o->signature = _e->str(); }
+  { auto _e = work(); if (_e) _o->work = _e->str(); }
+}
+
+inline flatbuffers::Offset<BlockReceive> BlockReceive::Pack(flatbuffers::FlatBufferBuilder &_fbb, const BlockReceiveT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateBlockReceive(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<BlockReceive> CreateBlockReceive(flatbuffers::FlatBufferBuilder &_fbb, const BlockReceiveT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const BlockReceiveT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _hash = _o->hash.empty() ? 0 : _fbb.CreateString(_o->hash);
+  auto _previous = _o->previous.empty() ? 0 : _fbb.CreateString(_o->previous);
+  auto _source = _o->source.empty() ? 0 : _fbb.CreateString(_o->source);
+  auto _signature = _o->signature.empty() ? 0 : _fbb.CreateString(_o->signature);
+  auto _work = _o->work.empty() ? 0 : _fbb.CreateString(_o->work);
+  return futureheadapi::CreateBlockReceive(
+      _fbb,
+      _hash,
+      _previous,
+      _source,
+      _signature,
+      _work);
+}
+
+inline BlockSendT *BlockSend::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new BlockSendT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void BlockSend::UnPackTo(BlockSendT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = hash(); if (_e) _o->hash = _e->str(); }
+  { auto _e = previous(); if (_e) _o->previous = _e->str(); }
+  { auto _e = destination(); if (_e) _o->destination = _e->str(); }
+  { auto _e = balance(); if (_e) _o->balance = _e->str(); }
+  { auto _e = signature(); if (_e) _o->signature = _e->str(); }
+  { auto _e = work(); if (_e) _o->work = _e->str(); }
+}
+
+inline flatbuffers::Offset<BlockSend> BlockSend::Pack(flatbuffers::FlatBufferBuilder &_fbb, const BlockSendT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateBlockSend(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<BlockSend> CreateBlockSend(flatbuffers::FlatBufferBuilder &_fbb, const BlockSendT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const BlockSendT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _hash = _o->hash.empty() ? 0 : _fbb.CreateString(_o->hash);
+  auto _previous = _o->previous.empty() ? 0 : _fbb.CreateString(_o->previous);
+  auto _destination = _o->destination.empty() ? 0 : _fbb.CreateString(_o->destination);
+  auto _balance = _o->balance.empty() ? 0 : _fbb.CreateString(_o->balance);
+  auto _signature = _o->signature.empty() ? 0 : _fbb.CreateString(_o->signature);
+  auto _work = _o->work.empty() ? 0 : _fbb.CreateString(_o->work);
+  return futureheadapi::CreateBlockSend(
+      _fbb,
+      _hash,
+      _previous,
+      _destination,
+      _balance,
+      _signature,
+      _work);
+}
+
+inline BlockChangeT *BlockChange::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new BlockChangeT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void BlockChange::UnPackTo(BlockChangeT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = hash(); if (_e) _o->hash = _e->str(); }
+  { auto _e = previous(); if (_e) _o->previous = _e->str(); }
+  { auto _e = representative(); if (_e) _o->representative = _e->str(); }
+  { auto _e = signature(); if (_e) _o->signature = _e->str(); }
+  { auto _e = work(); if (_e) _o->work = _e->str(); }
+}
+
+inline flatbuffers::Offset<BlockChange> BlockChange::Pack(flatbuffers::FlatBufferBuilder &_fbb, const BlockChangeT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateBlockChange(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<BlockChange> CreateBlockChange(flatbuffers::FlatBufferBuilder &_fbb, const BlockChangeT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const BlockChangeT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _hash = _o->hash.empty() ? 0 : _fbb.CreateString(_o->hash);
+  auto _previous = _o->previous.empty() ? 0 : _fbb.CreateString(_o->previous);
+  auto _representative = _o->representative.empty() ? 0 : _fbb.CreateString(_o->representative);
+  auto _signature = _o->signature.empty() ? 0 : _fbb.CreateString(_o->signature);
+  auto _work = _o->work.empty() ? 0 : _fbb.CreateString(_o->work);
+  return futureheadapi::CreateBlockChange(
+      _fbb,
+      _hash,
+      _previous,
+      _representative,
+      _signature,
+      _work);
+}
+
+inline BlockStateT *BlockState::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new BlockStateT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void BlockState::UnPackTo(BlockStateT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = hash(); if (_e) _o->hash = _e->str(); }
+  { auto _e = account(); if (_e) _o->account = _e->str(); }
+  { auto _e = previous(); if (_e) _o->previous = _e->str(); }
+  { auto _e = representative(); if (_e) _o->representative = _e->str(); }
+  { auto _e = balance(); if (_e) _o->balance = _e->str(); }
+  { auto _e = link(); if (_e) _o->link = _e->str(); }
+  { auto _e = link_as_account(); if (_e) _o->link_as_account = _e->str(); }
+  { auto _e = signature(); if (_e) _o->signature = _e->str(); }
+  { auto _e = work(); if (_e) _o->work = _e->str(); }
+  { auto _e = subtype(); _o->subtype = _e; }
+}
+
+inline flatbuffers::Offset<BlockState> BlockState::Pack(flatbuffers::FlatBufferBuilder &_fbb, const BlockStateT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateBlockState(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<BlockState> CreateBlockState(flatbuffers::FlatBufferBuilder &_fbb, const BlockStateT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const BlockStateT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _hash = _o->hash.empty() ? 0 : _fbb.CreateString(_o->hash);
+  auto _account = _o->account.empty() ? 0 : _fbb.CreateString(_o->account);
+  auto _previous = _o->previous.empty() ? 0 : _fbb.CreateString(_o->previous);
+  auto _representative = _o->representative.empty() ? 0 : _fbb.CreateString(_o->representative);
+  auto _balance = _o->balance.empty() ? 0 : _fbb.CreateString(_o->balance);
+  auto _link = _o->link.empty() ? 0 : _fbb.CreateString(_o->link);
+  auto _link_as_account = _o->link_as_account.empty() ? 0 : _fbb.CreateString(_o->link_as_account);
+  auto _signature = _o->signature.empty() ? 0 : _fbb.CreateString(_o->signature);
+  auto _work = _o->work.empty() ? 0 : _fbb.CreateString(_o->work);
+  auto _subtype = _o->subtype;
+  return futureheadapi::CreateBlockState(
+      _fbb,
+      _hash,
+      _account,
+      _previous,
+      _representative,
+      _balance,
+      _link,
+      _link_as_account,
+      _signature,
+      _work,
+      _subtype);
+}
+
+inline BlockInfoT *BlockInfo::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new BlockInfoT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void BlockInfo::UnPackTo(BlockInfoT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = block_type(); _o->block.type = _e; }
+  { auto _e = block(); if (_e) _o->block.value = futureheadapi::BlockUnion::UnPack(_e, block_type(), _resolver); }
+}
+
+inline flatbuffers::Offset<BlockInfo> BlockInfo::Pack(flatbuffers::FlatBufferBuilder &_fbb, const BlockInfoT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateBlockInfo(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<BlockInfo> CreateBlockInfo(flatbuffers::FlatBufferBuilder &_fbb, const BlockInfoT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const BlockInfoT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _block_type = _o->block.type;
+  auto _block = _o->block.Pack(_fbb);
+  return futureheadapi::CreateBlockInfo(
+      _fbb,
+      _block_type,
+      _block);
+}
+
+inline AccountInfoT *AccountInfo::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new AccountInfoT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void AccountInfo::UnPackTo(AccountInfoT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = account(); if (_e) _o->account = _e->str(); }
+  { auto _e = include_representative(); _o->include_representative = _e; }
+  { auto _e = include_voting_weight(); _o->include_voting_weight = _e; }
+  { auto _e = include_pending(); _o->include_pending = _e; }
+}
+
+inline flatbuffers::Offset<AccountInfo> AccountInfo::Pack(flatbuffers::FlatBufferBuilder &_fbb, const AccountInfoT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateAccountInfo(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<AccountInfo> CreateAccountInfo(flatbuffers::FlatBufferBuilder &_fbb, const AccountInfoT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const AccountInfoT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _account = _fbb.CreateString(_o->account);
+  auto _include_representative = _o->include_representative;
+  auto _include_voting_weight = _o->include_voting_weight;
+  auto _include_pending = _o->include_pending;
+  return futureheadapi::CreateAccountInfo(
+      _fbb,
+      _account,
+      _include_representative,
+      _include_voting_weight,
+      _include_pending);
+}
+
+inline AccountInfoResponseT *AccountInfoResponse::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new AccountInfoResponseT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void AccountInfoResponse::UnPackTo(AccountInfoResponseT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = frontier(); if (_e) _o->frontier = _e->str(); }
+  { auto _e = open_block(); if (_e) _o->open_block = _e->str(); }
+  { auto _e = representative_block(); if (_e) _o->representative_block = _e->str(); }
+  { auto _e = balance(); if (_e) _o->balance = _e->str(); }
+  { auto _e = modified_timestamp(); _o->modified_timestamp = _e; }
+  { auto _e = block_count(); _o->block_count = _e; }
+  { auto _e = account_version(); _o->account_version = _e; }
+  { auto _e = confirmation_height(); _o->confirmation_height = _e; }
+  { auto _e = confirmation_height_frontier(); if (_e) _o->confirmation_height_frontier = _e->str(); }
+  { auto _e = representative(); if (_e) _o->representative = _e->str(); }
+  { auto _e = voting_weight(); if (_e) _o->voting_weight = _e->str(); }
+  { auto _e = pending(); if (_e) _o->pending = _e->str(); }
+}
+
+inline flatbuffers::Offset<AccountInfoResponse> AccountInfoResponse::Pack(flatbuffers::FlatBufferBuilder &_fbb, const AccountInfoResponseT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateAccountInfoResponse(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<AccountInfoResponse> CreateAccountInfoResponse(flatbuffers::FlatBufferBuilder &_fbb, const AccountInfoResponseT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const AccountInfoResponseT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _frontier = _o->frontier.empty() ? 0 : _fbb.CreateString(_o->frontier);
+  auto _open_block = _o->open_block.empty() ? 0 : _fbb.CreateString(_o->open_block);
+  auto _representative_block = _o->representative_block.empty() ? 0 : _fbb.CreateString(_o->representative_block);
+  auto _balance = _o->balance.empty() ? 0 : _fbb.CreateString(_o->balance);
+  auto _modified_timestamp = _o->modified_timestamp;
+  auto _block_count = _o->block_count;
+  auto _account_version = _o->account_version;
+  auto _confirmation_height = _o->confirmation_height;
+  auto _confirmation_height_frontier = _o->confirmation_height_frontier.empty() ? 0 : _fbb.CreateString(_o->confirmation_height_frontier);
+  auto _representative = _o->representative.empty() ? 0 : _fbb.CreateString(_o->representative);
+  auto _voting_weight = _o->voting_weight.empty() ? 0 : _fbb.CreateString(_o->voting_weight);
+  auto _pending = _o->pending.empty() ? 0 : _fbb.CreateString(_o->pending);
+  return futureheadapi::CreateAccountInfoResponse(
+      _fbb,
+      _frontier,
+      _open_block,
+      _representative_block,
+      _balance,
+      _modified_timestamp,
+      _block_count,
+      _account_version,
+      _confirmation_height,
+      _confirmation_height_frontier,
+      _representative,
+      _voting_weight,
+      _pending);
+}
+
+inline AccountsBalancesT *AccountsBalances::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new AccountsBalancesT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void AccountsBalances::UnPackTo(AccountsBalancesT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = accounts(); if (_e) { _o->accounts.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->accounts[_i] = _e->Get(_i)->str(); } } }
+}
+
+inline flatbuffers::Offset<AccountsBalances> AccountsBalances::Pack(flatbuffers::FlatBufferBuilder &_fbb, const AccountsBalancesT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateAccountsBalances(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<AccountsBalances> CreateAccountsBalances(flatbuffers::FlatBufferBuilder &_fbb, const AccountsBalancesT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const AccountsBalancesT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _accounts = _fbb.CreateVectorOfStrings(_o->accounts);
+  return futureheadapi::CreateAccountsBalances(
+      _fbb,
+      _accounts);
+}
+
+inline AccountBalanceT *AccountBalance::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new AccountBalanceT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void AccountBalance::UnPackTo(AccountBalanceT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = account(); if (_e) _o->account = _e->str(); }
+  { auto _e = balance(); if (_e) _o->balance = _e->str(); }
+  { auto _e = pending(); if (_e) _o->pending = _e->str(); }
+}
+
+inline flatbuffers::Offset<AccountBalance> AccountBalance::Pack(flatbuffers::FlatBufferBuilder &_fbb, const AccountBalanceT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateAccountBalance(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<AccountBalance> CreateAccountBalance(flatbuffers::FlatBufferBuilder &_fbb, const AccountBalanceT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const AccountBalanceT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _account = _o->account.empty() ? 0 : _fbb.CreateString(_o->account);
+  auto _balance = _o->balance.empty() ? 0 : _fbb.CreateString(_o->balance);
+  auto _pending = _o->pending.empty() ? 0 : _fbb.CreateString(_o->pending);
+  return futureheadapi::CreateAccountBalance(
+      _fbb,
+      _account,
+      _balance,
+      _pending);
 }
 
-flatbuffers::Offset<Envelope> CreateEnvelope(flatbuffers::FlatBufferBuilder &_fbb, const EnvelopeT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
-
-inline AccountWeightT *AccountWeight::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
-  auto _o = new AccountWeightT();
+inline AccountsBalancesResponseT *AccountsBalancesResponse::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new AccountsBalancesResponseT();
   UnPackTo(_o, _resolver);
   return _o;
 }
 
-inline void AccountWeight::UnPackTo(AccountWeightT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+inline void AccountsBalancesResponse::UnPackTo(AccountsBalancesResponseT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = account(); if (_e) _o->account = _e->str(); }
+  { auto _e = balances(); if (_e) { _o->balances.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->balances[_i] = std::unique_ptr<futureheadapi::AccountBalanceT>(_e->Get(_i)->UnPack(_resolver)); } } }
 }
 
-inline flatbuffers::Offset<AccountWeight> AccountWeight::Pack(flatbuffers::FlatBufferBuilder &_fbb, const AccountWeightT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
-  return CreateAccountWeight(_fbb, _o, _rehasher);
+inline flatbuffers::Offset<AccountsBalancesResponse> AccountsBalancesResponse::Pack(flatbuffers::FlatBufferBuilder &_fbb, const AccountsBalancesResponseT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateAccountsBalancesResponse(_fbb, _o, _rehasher);
 }
 
-inline flatbuffers::Offset<AccountWeight> CreateAccountWeight(flatbuffers::FlatBufferBuilder &_fbb, const AccountWeightT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+inline flatbuffers::Offset<AccountsBalancesResponse> CreateAccountsBalancesResponse(flatbuffers::FlatBufferBuilder &_fbb, const AccountsBalancesResponseT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
-  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const AccountWeightT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
-  auto _account = _fbb.CreateString(_o->account);
-  return futureheadapi::CreateAccountWeight(
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const AccountsBalancesResponseT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _balances = _fbb.CreateVector<flatbuffers::Offset<futureheadapi::AccountBalance>> (_o->balances.size(), [](size_t i, _VectorArgs *__va) { return CreateAccountBalance(*__va->__fbb, __va->__o->balances[i].get(), __va->__rehasher); }, &_va );
+  return futureheadapi::CreateAccountsBalancesResponse(
       _fbb,
-      _account);
+      _balances);
 }
 
-inline AccountWeightResponseT *AccountWeightResponse::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
-  auto _o = new AccountWeightResponseT();
+inline BlocksInfoT *BlocksInfo::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new BlocksInfoT();
   UnPackTo(_o, _resolver);
   return _o;
 }
 
-inline void AccountWeightResponse::UnPackTo(AccountWeightResponseT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+inline void BlocksInfo::UnPackTo(BlocksInfoT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = voting_weight(); if (_e) _o->voting_weight = _e->str(); }
+  { auto _e = hashes(); if (_e) { _o->hashes.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->hashes[_i] = _e->Get(_i)->str(); } } }
+  { auto _e = include_not_found(); _o->include_not_found = _e; }
 }
 
-inline flatbuffers::Offset<AccountWeightResponse> AccountWeightResponse::Pack(flatbuffers::FlatBufferBuilder &_fbb, const AccountWeightResponseT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
-  return CreateAccountWeightResponse(_fbb, _o, _rehasher);
+inline flatbuffers::Offset<BlocksInfo> BlocksInfo::Pack(flatbuffers::FlatBufferBuilder &_fbb, const BlocksInfoT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateBlocksInfo(_fbb, _o, _rehasher);
 }
 
-inline flatbuffers::Offset<AccountWeightResponse> CreateAccountWeightResponse(flatbuffers::FlatBufferBuilder &_fbb, const AccountWeightResponseT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+inline flatbuffers::Offset<BlocksInfo> CreateBlocksInfo(flatbuffers::FlatBufferBuilder &_fbb, const BlocksInfoT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
-  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const AccountWeightResponseT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
-  auto _voting_weight = _fbb.CreateString(_o->voting_weight);
-  return futureheadapi::CreateAccountWeightResponse(
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const BlocksInfoT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _hashes = _fbb.CreateVectorOfStrings(_o->hashes);
+  auto _include_not_found = _o->include_not_found;
+  return futureheadapi::CreateBlocksInfo(
       _fbb,
-      _voting_weight);
+      _hashes,
+      _include_not_found);
 }
 
-inline BlockOpenT *BlockOpen::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
-  auto _o = new BlockOpenT();
+inline BlocksInfoEntryT *BlocksInfoEntry::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new BlocksInfoEntryT();
   UnPackTo(_o, _resolver);
   return _o;
 }
 
-inline void BlockOpen::UnPackTo(BlockOpenT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+inline void BlocksInfoEntry::UnPackTo(BlocksInfoEntryT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
   { auto _e = hash(); if (_e) _o->hash = _e->str(); }
-  { auto _e = account(); if (_e) _o->account = _e->str(); }
-  { auto _e = source(); if (_e) _o->source = _e->str(); }
-  { auto _e = representative(); if (_e) _o->representative = _e->str(); }
-  { auto _e = signature(); if (_e) _o->signature = _e->str(); }
-  { auto _e = work(); if (_e) _o->work = _e->str(); }
+  { auto _e = block_account(); if (_e) _o->block_account = _e->str(); }
+  { auto _e = amount(); if (_e) _o->amount = _e->str(); }
+  { auto _e = balance(); if (_e) _o->balance = _e->str(); }
+  { auto _e = height(); _o->height = _e; }
+  { auto _e = local_timestamp(); _o->local_timestamp = _e; }
+  { auto _e = confirmed(); _o->confirmed = _e; }
+  { auto _e = block_type(); _o->block.type = _e; }
+  { auto _e = block(); if (_e) _o->block.value = futureheadapi::BlockUnion::UnPack(_e, block_type(), _resolver); }
 }
 
-inline flatbuffers::Offset<BlockOpen> BlockOpen::Pack(flatbuffers::FlatBufferBuilder &_fbb, const BlockOpenT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
-  return CreateBlockOpen(_fbb, _o, _rehasher);
+inline flatbuffers::Offset<BlocksInfoEntry> BlocksInfoEntry::Pack(flatbuffers::FlatBufferBuilder &_fbb, const BlocksInfoEntryT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateBlocksInfoEntry(_fbb, _o, _rehasher);
 }
 
-inline flatbuffers::Offset<BlockOpen> CreateBlockOpen(flatbuffers::FlatBufferBuilder &_fbb, const BlockOpenT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+inline flatbuffers::Offset<BlocksInfoEntry> CreateBlocksInfoEntry(flatbuffers::FlatBufferBuilder &_fbb, const BlocksInfoEntryT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
-  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const BlockOpenT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const BlocksInfoEntryT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
   auto _hash = _o->hash.empty() ? 0 : _fbb.CreateString(_o->hash);
-  auto _account = _o->account.empty() ? 0 : _fbb.CreateString(_o->account);
-  auto _source = _o->source.empty() ? 0 : _fbb.CreateString(_o->source);
-  auto _representative = _o->representative.empty() ? 0 : _fbb.CreateString(_o->representative);
-  auto _signature = _o->signature.empty() ? 0 : _fbb.CreateString(_o->signature);
-  auto _work = _o->work.empty() ? 0 : _fbb.CreateString(_o->work);
-  return futureheadapi::CreateBlockOpen(
+  auto _block_account = _o->block_account.empty() ? 0 : _fbb.CreateString(_o->block_account);
+  auto _amount = _o->amount.empty() ? 0 : _fbb.CreateString(_o->amount);
+  auto _balance = _o->balance.empty() ? 0 : _fbb.CreateString(_o->balance);
+  auto _height = _o->height;
+  auto _local_timestamp = _o->local_timestamp;
+  auto _confirmed = _o->confirmed;
+  auto _block_type = _o->block.type;
+  auto _block = _o->block.Pack(_fbb);
+  return futureheadapi::CreateBlocksInfoEntry(
       _fbb,
       _hash,
-      _account,
-      _source,
-      _representative,
-      _signature,
-      _work);
+      _block_account,
+      _amount,
+      _balance,
+      _height,
+      _local_timestamp,
+      _confirmed,
+      _block_type,
+      _block);
 }
 
-inline BlockReceiveT *BlockReceive::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
-  auto _o = new BlockReceiveT();
+inline BlocksInfoResponseT *BlocksInfoResponse::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new BlocksInfoResponseT();
   UnPackTo(_o, _resolver);
   return _o;
 }
 
-inline void BlockReceive::UnPackTo(BlockReceiveT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+inline void BlocksInfoResponse::UnPackTo(BlocksInfoResponseT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = hash(); if (_e) _o->hash = _e->str(); }
-  { auto _e = previous(); if (_e) _o->previous = _e->str(); }
-  { auto _e = source(); if (_e) _o->source = _e->str(); }
-  { auto _e = signature(); if (_e) _o->signature = _e->str(); }
-  { auto _e = work(); if (_e) _o->work = _e->str(); }
+  { auto _e = blocks(); if (_e) { _o->blocks.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->blocks[_i] = std::unique_ptr<futureheadapi::BlocksInfoEntryT>(_e->Get(_i)->UnPack(_resolver)); } } }
+  { auto _e = blocks_not_found(); if (_e) { _o->blocks_not_found.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->blocks_not_found[_i] = _e->Get(_i)->str(); } } }
 }
 
-inline flatbuffers::Offset<BlockReceive> BlockReceive::Pack(flatbuffers::FlatBufferBuilder &_fbb, const BlockReceiveT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
-  return CreateBlockReceive(_fbb, _o, _rehasher);
+inline flatbuffers::Offset<BlocksInfoResponse> BlocksInfoResponse::Pack(flatbuffers::FlatBufferBuilder &_fbb, const BlocksInfoResponseT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateBlocksInfoResponse(_fbb, _o, _rehasher);
 }
 
-inline flatbuffers::Offset<BlockReceive> CreateBlockReceive(flatbuffers::FlatBufferBuilder &_fbb, const BlockReceiveT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+inline flatbuffers::Offset<BlocksInfoResponse> CreateBlocksInfoResponse(flatbuffers::FlatBufferBuilder &_fbb, const BlocksInfoResponseT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
-  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const BlockReceiveT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
-  auto _hash = _o->hash.empty() ? 0 : _fbb.CreateString(_o->hash);
-  auto _previous = _o->previous.empty() ? 0 : _fbb.CreateString(_o->previous);
-  auto _source = _o->source.empty() ? 0 : _fbb.CreateString(_o->source);
-  auto _signature = _o->signature.empty() ? 0 : _fbb.CreateString(_o->signature);
-  auto _work = _o->work.empty() ? 0 : _fbb.CreateString(_o->work);
-  return futureheadapi::CreateBlockReceive(
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const BlocksInfoResponseT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _blocks = _fbb.CreateVector<flatbuffers::Offset<futureheadapi::BlocksInfoEntry>> (_o->blocks.size(), [](size_t i, _VectorArgs *__va) { return CreateBlocksInfoEntry(*__va->__fbb, __va->__o->blocks[i].get(), __va->__rehasher); }, &_va );
+  auto _blocks_not_found = _fbb.CreateVectorOfStrings(_o->blocks_not_found);
+  return futureheadapi::CreateBlocksInfoResponse(
       _fbb,
-      _hash,
-      _previous,
-      _source,
-      _signature,
-      _work);
+      _blocks,
+      _blocks_not_found);
 }
 
-inline BlockSendT *BlockSend::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
-  auto _o = new BlockSendT();
+inline PendingT *Pending::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new PendingT();
   UnPackTo(_o, _resolver);
   return _o;
 }
 
-inline void BlockSend::UnPackTo(BlockSendT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+inline void Pending::UnPackTo(PendingT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = hash(); if (_e) _o->hash = _e->str(); }
-  { auto _e = previous(); if (_e) _o->previous = _e->str(); }
-  { auto _e = destination(); if (_e) _o->destination = _e->str(); }
-  { auto _e = balance(); if (_e) _o->balance = _e->str(); }
-  { auto _e = signature(); if (_e) _o->signature = _e->str(); }
-  { auto _e = work(); if (_e) _o->work = _e->str(); }
+  { auto _e = account(); if (_e) _o->account = _e->str(); }
+  { auto _e = count(); _o->count = _e; }
+  { auto _e = threshold(); if (_e) _o->threshold = _e->str(); }
+  { auto _e = include_active(); _o->include_active = _e; }
+  { auto _e = include_only_confirmed(); _o->include_only_confirmed = _e; }
 }
 
-inline flatbuffers::Offset<BlockSend> BlockSend::Pack(flatbuffers::FlatBufferBuilder &_fbb, const BlockSendT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
-  return CreateBlockSend(_fbb, _o, _rehasher);
+inline flatbuffers::Offset<Pending> Pending::Pack(flatbuffers::FlatBufferBuilder &_fbb, const PendingT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreatePending(_fbb, _o, _rehasher);
 }
 
-inline flatbuffers::Offset<BlockSend> CreateBlockSend(flatbuffers::FlatBufferBuilder &_fbb, const BlockSendT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+inline flatbuffers::Offset<Pending> CreatePending(flatbuffers::FlatBufferBuilder &_fbb, const PendingT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
-  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const BlockSendT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
-  auto _hash = _o->hash.empty() ? 0 : _fbb.CreateString(_o->hash);
-  auto _previous = _o->previous.empty() ? 0 : _fbb.CreateString(_o->previous);
-  auto _destination = _o->destination.empty() ? 0 : _fbb.CreateString(_o->destination);
-  auto _balance = _o->balance.empty() ? 0 : _fbb.CreateString(_o->balance);
-  auto _signature = _o->signature.empty() ? 0 : _fbb.CreateString(_o->signature);
-  auto _work = _o->work.empty() ? 0 : _fbb.CreateString(_o->work);
-  return futureheadapi::CreateBlockSend(
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const PendingT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _account = _fbb.CreateString(_o->account);
+  auto _count = _o->count;
+  auto _threshold = _o->threshold.empty() ? 0 : _fbb.CreateString(_o->threshold);
+  auto _include_active = _o->include_active;
+  auto _include_only_confirmed = _o->include_only_confirmed;
+  return futureheadapi::CreatePending(
       _fbb,
-      _hash,
-      _previous,
-      _destination,
-      _balance,
-      _signature,
-      _work);
+      _account,
+      _count,
+      _threshold,
+      _include_active,
+      _include_only_confirmed);
 }
 
-inline BlockChangeT *BlockChange::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
-  auto _o = new BlockChangeT();
+inline PendingBlockT *PendingBlock::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new PendingBlockT();
   UnPackTo(_o, _resolver);
   return _o;
 }
 
-inline void BlockChange::UnPackTo(BlockChangeT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+inline void PendingBlock::UnPackTo(PendingBlockT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
   { auto _e = hash(); if (_e) _o->hash = _e->str(); }
-  { auto _e = previous(); if (_e) _o->previous = _e->str(); }
-  { auto _e = representative(); if (_e) _o->representative = _e->str(); }
-  { auto _e = signature(); if (_e) _o->signature = _e->str(); }
-  { auto _e = work(); if (_e) _o->work = _e->str(); }
+  { auto _e = amount(); if (_e) _o->amount = _e->str(); }
+  { auto _e = source(); if (_e) _o->source = _e->str(); }
+  { auto _e = min_version(); _o->min_version = _e; }
 }
 
-inline flatbuffers::Offset<BlockChange> BlockChange::Pack(flatbuffers::FlatBufferBuilder &_fbb, const BlockChangeT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
-  return CreateBlockChange(_fbb, _o, _rehasher);
+inline flatbuffers::Offset<PendingBlock> PendingBlock::Pack(flatbuffers::FlatBufferBuilder &_fbb, const PendingBlockT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreatePendingBlock(_fbb, _o, _rehasher);
 }
 
-inline flatbuffers::Offset<BlockChange> CreateBlockChange(flatbuffers::FlatBufferBuilder &_fbb, const BlockChangeT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+inline flatbuffers::Offset<PendingBlock> CreatePendingBlock(flatbuffers::FlatBufferBuilder &_fbb, const PendingBlockT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
-  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const BlockChangeT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const PendingBlockT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
   auto _hash = _o->hash.empty() ? 0 : _fbb.CreateString(_o->hash);
-  auto _previous = _o->previous.empty() ? 0 : _fbb.CreateString(_o->previous);
-  auto _representative = _o->representative.empty() ? 0 : _fbb.CreateString(_o->representative);
-  auto _signature = _o->signature.empty() ? 0 : _fbb.CreateString(_o->signature);
-  auto _work = _o->work.empty() ? 0 : _fbb.CreateString(_o->work);
-  return futureheadapi::CreateBlockChange(
+  auto _amount = _o->amount.empty() ? 0 : _fbb.CreateString(_o->amount);
+  auto _source = _o->source.empty() ? 0 : _fbb.CreateString(_o->source);
+  auto _min_version = _o->min_version;
+  return futureheadapi::CreatePendingBlock(
       _fbb,
       _hash,
-      _previous,
-      _representative,
-      _signature,
-      _work);
+      _amount,
+      _source,
+      _min_version);
 }
 
-inline BlockStateT *BlockState::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
-  auto _o = new BlockStateT();
+inline PendingResponseT *PendingResponse::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new PendingResponseT();
   UnPackTo(_o, _resolver);
   return _o;
 }
 
-inline void BlockState::UnPackTo(BlockStateT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+inline void PendingResponse::UnPackTo(PendingResponseT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = hash(); if (_e) _o->hash = _e->str(); }
-  { auto _e = account(); if (_e) _o->account = _e->str(); }
-  { auto _e = previous(); if (_e) _o->previous = _e->str(); }
-  { auto _e = representative(); if (_e) _o->representative = _e->str(); }
-  { auto _e = balance(); if (_e) _o->balance = _e->str(); }
-  { auto _e = link(); if (_e) _o->link = _e->str(); }
-  { auto _e = link_as_account(); if (_e) _o->link_as_account = _e->str(); }
-  { auto _e = signature(); if (_e) _o->signature = _e->str(); }
-  { auto _e = work(); if (_e) _o->work = _e->str(); }
-  { auto _e = subtype(); _o->subtype = _e; }
+  { auto _e = blocks(); if (_e) { _o->blocks.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->blocks[_i] = std::unique_ptr<futureheadapi::PendingBlockT>(_e->Get(_i)->UnPack(_resolver)); } } }
 }
 
-inline flatbuffers::Offset<BlockState> BlockState::Pack(flatbuffers::FlatBufferBuilder &_fbb, const BlockStateT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
-  return CreateBlockState(_fbb, _o, _rehasher);
+inline flatbuffers::Offset<PendingResponse> PendingResponse::Pack(flatbuffers::FlatBufferBuilder &_fbb, const PendingResponseT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreatePendingResponse(_fbb, _o, _rehasher);
 }
 
-inline flatbuffers::Offset<BlockState> CreateBlockState(flatbuffers::FlatBufferBuilder &_fbb, const BlockStateT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+inline flatbuffers::Offset<PendingResponse> CreatePendingResponse(flatbuffers::FlatBufferBuilder &_fbb, const PendingResponseT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
-  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const BlockStateT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
-  auto _hash = _o->hash.empty() ? 0 : _fbb.CreateString(_o->hash);
-  auto _account = _o->account.empty() ? 0 : _fbb.CreateString(_o->account);
-  auto _previous = _o->previous.empty() ? 0 : _fbb.CreateString(_o->previous);
-  auto _representative = _o->representative.empty() ? 0 : _fbb.CreateString(_o->representative);
-  auto _balance = _o->balance.empty() ? 0 : _fbb.CreateString(_o->balance);
-  auto _link = _o->link.empty() ? 0 : _fbb.CreateString(_o->link);
-  auto _link_as_account = _o->link_as_account.empty() ? 0 : _fbb.CreateString(_o->link_as_account);
-  auto _signature = _o->signature.empty() ? 0 : _fbb.CreateString(_o->signature);
-  auto _work = _o->work.empty() ? 0 : _fbb.CreateString(_o->work);
-  auto _subtype = _o->subtype;
-  return futureheadapi::CreateBlockState(
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const PendingResponseT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _blocks = _fbb.CreateVector<flatbuffers::Offset<futureheadapi::PendingBlock>> (_o->blocks.size(), [](size_t i, _VectorArgs *__va) { return CreatePendingBlock(*__va->__fbb, __va->__o->blocks[i].get(), __va->__rehasher); }, &_va );
+  return futureheadapi::CreatePendingResponse(
       _fbb,
-      _hash,
-      _account,
-      _previous,
-      _representative,
-      _balance,
-      _link,
-      _link_as_account,
-      _signature,
-      _work,
-      _subtype);
+      _blocks);
 }
 
-inline BlockInfoT *BlockInfo::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
-  auto _o = new BlockInfoT();
+inline BlockCountT *BlockCount::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new BlockCountT();
   UnPackTo(_o, _resolver);
   return _o;
 }
 
-inline void BlockInfo::UnPackTo(BlockInfoT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+inline void BlockCount::UnPackTo(BlockCountT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = block_type(); _o->block.type = _e; }
-  { auto _e = block(); if (_e) _o->block.value = futureheadapi::BlockUnion::UnPack(_e, block_type(), _resolver); }
 }
 
-inline flatbuffers::Offset<BlockInfo> BlockInfo::Pack(flatbuffers::FlatBufferBuilder &_fbb, const BlockInfoT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
-  return CreateBlockInfo(_fbb, _o, _rehasher);
+inline flatbuffers::Offset<BlockCount> BlockCount::Pack(flatbuffers::FlatBufferBuilder &_fbb, const BlockCountT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateBlockCount(_fbb, _o, _rehasher);
 }
 
-inline flatbuffers::Offset<BlockInfo> CreateBlockInfo(flatbuffers::FlatBufferBuilder &_fbb, const BlockInfoT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+inline flatbuffers::Offset<BlockCount> CreateBlockCount(flatbuffers::FlatBufferBuilder &_fbb, const BlockCountT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
-  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const BlockInfoT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
-  auto _block_type = _o->block.type;
-  auto _block = _o->block.Pack(_fbb);
-  return futureheadapi::CreateBlockInfo(
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const BlockCountT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  return futureheadapi::CreateBlockCount(
+      _fbb);
+}
+
+inline BlockCountResponseT *BlockCountResponse::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new BlockCountResponseT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void BlockCountResponse::UnPackTo(BlockCountResponseT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = count(); _o->count = _e; }
+  { auto _e = unchecked(); _o->unchecked = _e; }
+  { auto _e = cemented(); _o->cemented = _e; }
+}
+
+inline flatbuffers::Offset<BlockCountResponse> BlockCountResponse::Pack(flatbuffers::FlatBufferBuilder &_fbb, const BlockCountResponseT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateBlockCountResponse(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<BlockCountResponse> CreateBlockCountResponse(flatbuffers::FlatBufferBuilder &_fbb, const BlockCountResponseT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const BlockCountResponseT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _count = _o->count;
+  auto _unchecked = _o->unchecked;
+  auto _cemented = _o->cemented;
+  return futureheadapi::CreateBlockCountResponse(
       _fbb,
-      _block_type,
-      _block);
+      _count,
+      _unchecked,
+      _cemented);
 }
 
 inline ServiceRegisterT *ServiceRegister::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
@@ -4108,6 +6460,46 @@ inline bool VerifyMessage(flatbuffers::Verifier &verifier, const void *obj, Mess
       auto ptr = reinterpret_cast<const futureheadapi::EventServiceStop *>(obj);
       return verifier.VerifyTable(ptr);
     }
+    case Message_AccountInfo: {
+      auto ptr = reinterpret_cast<const futureheadapi::AccountInfo *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case Message_AccountInfoResponse: {
+      auto ptr = reinterpret_cast<const futureheadapi::AccountInfoResponse *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case Message_AccountsBalances: {
+      auto ptr = reinterpret_cast<const futureheadapi::AccountsBalances *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case Message_AccountsBalancesResponse: {
+      auto ptr = reinterpret_cast<const futureheadapi::AccountsBalancesResponse *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case Message_BlocksInfo: {
+      auto ptr = reinterpret_cast<const futureheadapi::BlocksInfo *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case Message_BlocksInfoResponse: {
+      auto ptr = reinterpret_cast<const futureheadapi::BlocksInfoResponse *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case Message_Pending: {
+      auto ptr = reinterpret_cast<const futureheadapi::Pending *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case Message_PendingResponse: {
+      auto ptr = reinterpret_cast<const futureheadapi::PendingResponse *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case Message_BlockCount: {
+      auto ptr = reinterpret_cast<const futureheadapi::BlockCount *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case Message_BlockCountResponse: {
+      auto ptr = reinterpret_cast<const futureheadapi::BlockCountResponse *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
     default: return true;
   }
 }
@@ -4158,24 +6550,64 @@ inline void *MessageUnion::UnPack(const void *obj, Message type, const flatbuffe
       auto ptr = reinterpret_cast<const futureheadapi::TopicConfirmation *>(obj);
       return ptr->UnPack(resolver);
     }
-    case Message_EventConfirmation: {
-      auto ptr = reinterpret_cast<const futureheadapi::EventConfirmation *>(obj);
+    case Message_EventConfirmation: {
+      auto ptr = reinterpret_cast<const futureheadapi::EventConfirmation *>(obj);
+      return ptr->UnPack(resolver);
+    }
+    case Message_ServiceRegister: {
+      auto ptr = reinterpret_cast<const futureheadapi::ServiceRegister *>(obj);
+      return ptr->UnPack(resolver);
+    }
+    case Message_ServiceStop: {
+      auto ptr = reinterpret_cast<const futureheadapi::ServiceStop *>(obj);
+      return ptr->UnPack(resolver);
+    }
+    case Message_TopicServiceStop: {
+      auto ptr = reinterpret_cast<const futureheadapi::TopicServiceStop *>(obj);
+      return ptr->UnPack(resolver);
+    }
+    case Message_EventServiceStop: {
+      auto ptr = reinterpret_cast<const futureheadapi::EventServiceStop *>(obj);
+      return ptr->UnPack(resolver);
+    }
+    case Message_AccountInfo: {
+      auto ptr = reinterpret_cast<const futureheadapi::AccountInfo *>(obj);
+      return ptr->UnPack(resolver);
+    }
+    case Message_AccountInfoResponse: {
+      auto ptr = reinterpret_cast<const futureheadapi::AccountInfoResponse *>(obj);
+      return ptr->UnPack(resolver);
+    }
+    case Message_AccountsBalances: {
+      auto ptr = reinterpret_cast<const futureheadapi::AccountsBalances *>(obj);
+      return ptr->UnPack(resolver);
+    }
+    case Message_AccountsBalancesResponse: {
+      auto ptr = reinterpret_cast<const futureheadapi::AccountsBalancesResponse *>(obj);
+      return ptr->UnPack(resolver);
+    }
+    case Message_BlocksInfo: {
+      auto ptr = reinterpret_cast<const futureheadapi::BlocksInfo *>(obj);
+      return ptr->UnPack(resolver);
+    }
+    case Message_BlocksInfoResponse: {
+      auto ptr = reinterpret_cast<const futureheadapi::BlocksInfoResponse *>(obj);
       return ptr->UnPack(resolver);
     }
-    case Message_ServiceRegister: {
-      auto ptr = reinterpret_cast<const futureheadapi::ServiceRegister *>(obj);
+    case Message_Pending: {
+      auto ptr = reinterpret_cast<const futureheadapi::Pending *>(obj);
       return ptr->UnPack(resolver);
     }
-    case Message_ServiceStop: {
-      auto ptr = reinterpret_cast<const futureheadapi::ServiceStop *>(obj);
+    case Message_PendingResponse: {
+      auto ptr = reinterpret_cast<const futureheadapi::PendingResponse *>(obj);
       return ptr->UnPack(resolver);
     }
-    case Message_TopicServiceStop: {
-      auto ptr = reinterpret_cast<const futureheadapi::TopicServiceStop *>(obj);
+    case Message_BlockCount: {
+      auto ptr = reinterpret_cast<const futureheadapi::BlockCount *>(obj);
       return ptr->UnPack(resolver);
     }
-    case Message_EventServiceStop: {
-      auto ptr = reinterpret_cast<const futureheadapi::EventServiceStop *>(obj);
+    case Message_BlockCountResponse: {
+      auto ptr = reinterpret_cast<const futureheadapi::BlockCountResponse *>(obj);
       return ptr->UnPack(resolver);
     }
     default: return nullptr;
@@ -4236,6 +6668,46 @@ inline flatbuffers::Offset<void> MessageUnion::Pack(flatbuffers::FlatBufferBuild
       auto ptr = reinterpret_cast<const futureheadapi::EventServiceStopT *>(value);
       return CreateEventServiceStop(_fbb, ptr, _rehasher).Union();
     }
+    case Message_AccountInfo: {
+      auto ptr = reinterpret_cast<const futureheadapi::AccountInfoT *>(value);
+      return CreateAccountInfo(_fbb, ptr, _rehasher).Union();
+    }
+    case Message_AccountInfoResponse: {
+      auto ptr = reinterpret_cast<const futureheadapi::AccountInfoResponseT *>(value);
+      return CreateAccountInfoResponse(_fbb, ptr, _rehasher).Union();
+    }
+    case Message_AccountsBalances: {
+      auto ptr = reinterpret_cast<const futureheadapi::AccountsBalancesT *>(value);
+      return CreateAccountsBalances(_fbb, ptr, _rehasher).Union();
+    }
+    case Message_AccountsBalancesResponse: {
+      auto ptr = reinterpret_cast<const futureheadapi::AccountsBalancesResponseT *>(value);
+      return CreateAccountsBalancesResponse(_fbb, ptr, _rehasher).Union();
+    }
+    case Message_BlocksInfo: {
+      auto ptr = reinterpret_cast<const futureheadapi::BlocksInfoT *>(value);
+      return CreateBlocksInfo(_fbb, ptr, _rehasher).Union();
+    }
+    case Message_BlocksInfoResponse: {
+      auto ptr = reinterpret_cast<const futureheadapi::BlocksInfoResponseT *>(value);
+      return CreateBlocksInfoResponse(_fbb, ptr, _rehasher).Union();
+    }
+    case Message_Pending: {
+      auto ptr = reinterpret_cast<const futureheadapi::PendingT *>(value);
+      return CreatePending(_fbb, ptr, _rehasher).Union();
+    }
+    case Message_PendingResponse: {
+      auto ptr = reinterpret_cast<const futureheadapi::PendingResponseT *>(value);
+      return CreatePendingResponse(_fbb, ptr, _rehasher).Union();
+    }
+    case Message_BlockCount: {
+      auto ptr = reinterpret_cast<const futureheadapi::BlockCountT *>(value);
+      return CreateBlockCount(_fbb, ptr, _rehasher).Union();
+    }
+    case Message_BlockCountResponse: {
+      auto ptr = reinterpret_cast<const futureheadapi::BlockCountResponseT *>(value);
+      return CreateBlockCountResponse(_fbb, ptr, _rehasher).Union();
+    }
     default: return 0;
   }
 }
@@ -4294,6 +6766,46 @@ inline MessageUnion::MessageUnion(const MessageUnion &u) FLATBUFFERS_NOEXCEPT :
       value = new futureheadapi::EventServiceStopT(*reinterpret_cast<futureheadapi::EventServiceStopT *>(u.value));
       break;
     }
+    case Message_AccountInfo: {
+      value = new futureheadapi::AccountInfoT(*reinterpret_cast<futureheadapi::AccountInfoT *>(u.value));
+      break;
+    }
+    case Message_AccountInfoResponse: {
+      value = new futureheadapi::AccountInfoResponseT(*reinterpret_cast<futureheadapi::AccountInfoResponseT *>(u.value));
+      break;
+    }
+    case Message_AccountsBalances: {
+      value = new futureheadapi::AccountsBalancesT(*reinterpret_cast<futureheadapi::AccountsBalancesT *>(u.value));
+      break;
+    }
+    case Message_AccountsBalancesResponse: {
+      FLATBUFFERS_ASSERT(false);  // futureheadapi::AccountsBalancesResponseT not copyable.
+      break;
+    }
+    case Message_BlocksInfo: {
+      value = new futureheadapi::BlocksInfoT(*reinterpret_cast<futureheadapi::BlocksInfoT *>(u.value));
+      break;
+    }
+    case Message_BlocksInfoResponse: {
+      FLATBUFFERS_ASSERT(false);  // futureheadapi::BlocksInfoResponseT not copyable.
+      break;
+    }
+    case Message_Pending: {
+      value = new futureheadapi::PendingT(*reinterpret_cast<futureheadapi::PendingT *>(u.value));
+      break;
+    }
+    case Message_PendingResponse: {
+      FLATBUFFERS_ASSERT(false);  // futureheadapi::PendingResponseT not copyable.
+      break;
+    }
+    case Message_BlockCount: {
+      value = new futureheadapi::BlockCountT(*reinterpret_cast<futureheadapi::BlockCountT *>(u.value));
+      break;
+    }
+    case Message_BlockCountResponse: {
+      value = new futureheadapi::BlockCountResponseT(*reinterpret_cast<futureheadapi::BlockCountResponseT *>(u.value));
+      break;
+    }
     default:
       break;
   }
@@ -4366,6 +6878,56 @@ inline void MessageUnion::Reset() {
       delete ptr;
       break;
     }
+    case Message_AccountInfo: {
+      auto ptr = reinterpret_cast<futureheadapi::AccountInfoT *>(value);
+      delete ptr;
+      break;
+    }
+    case Message_AccountInfoResponse: {
+      auto ptr = reinterpret_cast<futureheadapi::AccountInfoResponseT *>(value);
+      delete ptr;
+      break;
+    }
+    case Message_AccountsBalances: {
+      auto ptr = reinterpret_cast<futureheadapi::AccountsBalancesT *>(value);
+      delete ptr;
+      break;
+    }
+    case Message_AccountsBalancesResponse: {
+      auto ptr = reinterpret_cast<futureheadapi::AccountsBalancesResponseT *>(value);
+      delete ptr;
+      break;
+    }
+    case Message_BlocksInfo: {
+      auto ptr = reinterpret_cast<futureheadapi::BlocksInfoT *>(value);
+      delete ptr;
+      break;
+    }
+    case Message_BlocksInfoResponse: {
+      auto ptr = reinterpret_cast<futureheadapi::BlocksInfoResponseT *>(value);
+      delete ptr;
+      break;
+    }
+    case Message_Pending: {
+      auto ptr = reinterpret_cast<futureheadapi::PendingT *>(value);
+      delete ptr;
+      break;
+    }
+    case Message_PendingResponse: {
+      auto ptr = reinterpret_cast<futureheadapi::PendingResponseT *>(value);
+      delete ptr;
+      break;
+    }
+    case Message_BlockCount: {
+      auto ptr = reinterpret_cast<futureheadapi::BlockCountT *>(value);
+      delete ptr;
+      break;
+    }
+    case Message_BlockCountResponse: {
+      auto ptr = reinterpret_cast<futureheadapi::BlockCountResponseT *>(value);
+      delete ptr;
+      break;
+    }
     default: break;
   }
   value = nullptr;
@@ -4485,7 +7047,17 @@ inline const flatbuffers::TypeTable *MessageTypeTable() {
     { flatbuffers::ET_SEQUENCE, 0, 9 },
     { flatbuffers::ET_SEQUENCE, 0, 10 },
     { flatbuffers::ET_SEQUENCE, 0, 11 },
-    { flatbuffers::ET_SEQUENCE, 0, 12 }
+    { flatbuffers::ET_SEQUENCE, 0, 12 },
+    { flatbuffers::ET_SEQUENCE, 0, 13 },
+    { flatbuffers::ET_SEQUENCE, 0, 14 },
+    { flatbuffers::ET_SEQUENCE, 0, 15 },
+    { flatbuffers::ET_SEQUENCE, 0, 16 },
+    { flatbuffers::ET_SEQUENCE, 0, 17 },
+    { flatbuffers::ET_SEQUENCE, 0, 18 },
+    { flatbuffers::ET_SEQUENCE, 0, 19 },
+    { flatbuffers::ET_SEQUENCE, 0, 20 },
+    { flatbuffers::ET_SEQUENCE, 0, 21 },
+    { flatbuffers::ET_SEQUENCE, 0, 22 }
   };
   static const flatbuffers::TypeFunction type_refs[] = {
     futureheadapi::ErrorTypeTable,
@@ -4500,7 +7072,17 @@ inline const flatbuffers::TypeTable *MessageTypeTable() {
     futureheadapi::ServiceRegisterTypeTable,
     futureheadapi::ServiceStopTypeTable,
     futureheadapi::TopicServiceStopTypeTable,
-    futureheadapi::EventServiceStopTypeTable
+    futureheadapi::EventServiceStopTypeTable,
+    futureheadapi::AccountInfoTypeTable,
+    futureheadapi::AccountInfoResponseTypeTable,
+    futureheadapi::AccountsBalancesTypeTable,
+    futureheadapi::AccountsBalancesResponseTypeTable,
+    futureheadapi::BlocksInfoTypeTable,
+    futureheadapi::BlocksInfoResponseTypeTable,
+    futureheadapi::PendingTypeTable,
+    futureheadapi::PendingResponseTypeTable,
+    futureheadapi::BlockCountTypeTable,
+    futureheadapi::BlockCountResponseTypeTable
   };
   static const char * const names[] = {
     "NONE",
@@ -4516,10 +7098,20 @@ inline const flatbuffers::TypeTable *MessageTypeTable() {
     "ServiceRegister",
     "ServiceStop",
     "TopicServiceStop",
-    "EventServiceStop"
+    "EventServiceStop",
+    "AccountInfo",
+    "AccountInfoResponse",
+    "AccountsBalances",
+    "AccountsBalancesResponse",
+    "BlocksInfo",
+    "BlocksInfoResponse",
+    "Pending",
+    "PendingResponse",
+    "BlockCount",
+    "BlockCountResponse"
   };
   static const flatbuffers::TypeTable tt = {
-    flatbuffers::ST_UNION, 14, type_codes, type_refs, nullptr, names
+    flatbuffers::ST_UNION, 24, type_codes, type_refs, nullptr, names
   };
   return &tt;
 }
@@ -4690,6 +7282,251 @@ inline const flatbuffers::TypeTable *BlockInfoTypeTable() {
   return &tt;
 }
 
+inline const flatbuffers::TypeTable *AccountInfoTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_BOOL, 0, -1 },
+    { flatbuffers::ET_BOOL, 0, -1 },
+    { flatbuffers::ET_BOOL, 0, -1 }
+  };
+  static const char * const names[] = {
+    "account",
+    "include_representative",
+    "include_voting_weight",
+    "include_pending"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 4, type_codes, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *AccountInfoResponseTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_ULONG, 0, -1 },
+    { flatbuffers::ET_ULONG, 0, -1 },
+    { flatbuffers::ET_UCHAR, 0, -1 },
+    { flatbuffers::ET_ULONG, 0, -1 },
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_STRING, 0, -1 }
+  };
+  static const char * const names[] = {
+    "frontier",
+    "open_block",
+    "representative_block",
+    "balance",
+    "modified_timestamp",
+    "block_count",
+    "account_version",
+    "confirmation_height",
+    "confirmation_height_frontier",
+    "representative",
+    "voting_weight",
+    "pending"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 12, type_codes, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *AccountsBalancesTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_STRING, 1, -1 }
+  };
+  static const char * const names[] = {
+    "accounts"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 1, type_codes, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *AccountBalanceTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_STRING, 0, -1 }
+  };
+  static const char * const names[] = {
+    "account",
+    "balance",
+    "pending"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 3, type_codes, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *AccountsBalancesResponseTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_SEQUENCE, 1, 0 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    futureheadapi::AccountBalanceTypeTable
+  };
+  static const char * const names[] = {
+    "balances"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 1, type_codes, type_refs, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *BlocksInfoTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_STRING, 1, -1 },
+    { flatbuffers::ET_BOOL, 0, -1 }
+  };
+  static const char * const names[] = {
+    "hashes",
+    "include_not_found"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 2, type_codes, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *BlocksInfoEntryTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_ULONG, 0, -1 },
+    { flatbuffers::ET_ULONG, 0, -1 },
+    { flatbuffers::ET_BOOL, 0, -1 },
+    { flatbuffers::ET_UTYPE, 0, 0 },
+    { flatbuffers::ET_SEQUENCE, 0, 0 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    futureheadapi::BlockTypeTable
+  };
+  static const char * const names[] = {
+    "hash",
+    "block_account",
+    "amount",
+    "balance",
+    "height",
+    "local_timestamp",
+    "confirmed",
+    "block_type",
+    "block"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 9, type_codes, type_refs, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *BlocksInfoResponseTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_SEQUENCE, 1, 0 },
+    { flatbuffers::ET_STRING, 1, -1 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    futureheadapi::BlocksInfoEntryTypeTable
+  };
+  static const char * const names[] = {
+    "blocks",
+    "blocks_not_found"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 2, type_codes, type_refs, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *PendingTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_ULONG, 0, -1 },
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_BOOL, 0, -1 },
+    { flatbuffers::ET_BOOL, 0, -1 }
+  };
+  static const char * const names[] = {
+    "account",
+    "count",
+    "threshold",
+    "include_active",
+    "include_only_confirmed"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 5, type_codes, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *PendingBlockTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_UCHAR, 0, -1 }
+  };
+  static const char * const names[] = {
+    "hash",
+    "amount",
+    "source",
+    "min_version"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 4, type_codes, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *PendingResponseTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_SEQUENCE, 1, 0 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    futureheadapi::PendingBlockTypeTable
+  };
+  static const char * const names[] = {
+    "blocks"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 1, type_codes, type_refs, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *BlockCountTypeTable() {
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 0, nullptr, nullptr, nullptr, nullptr
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *BlockCountResponseTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_ULONG, 0, -1 },
+    { flatbuffers::ET_ULONG, 0, -1 },
+    { flatbuffers::ET_ULONG, 0, -1 }
+  };
+  static const char * const names[] = {
+    "count",
+    "unchecked",
+    "cemented"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 3, type_codes, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
 inline const flatbuffers::TypeTable *ServiceRegisterTypeTable() {
   static const flatbuffers::TypeCode type_codes[] = {
     { flatbuffers::ET_STRING, 0, -1 }
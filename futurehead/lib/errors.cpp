@@ -114,6 +114,8 @@ std::string futurehead::error_blocks_messages::message (int ev) const
 			return "Invalid block type";
 		case futurehead::error_blocks::not_found:
 			return "Block not found";
+		case futurehead::error_blocks::pruned:
+			return "Block contents were removed by ledger pruning";
 		case futurehead::error_blocks::work_low:
 			return "Block work is less than threshold";
 	}
@@ -147,6 +149,10 @@ std::string futurehead::error_rpc_messages::message (int ev) const
 			return "Bad timeout number";
 		case futurehead::error_rpc::bad_work_version:
 			return "Bad work version";
+		case futurehead::error_rpc::batch_nested:
+			return "Batch requests cannot be nested";
+		case futurehead::error_rpc::batch_size_exceeded:
+			return "Too many requests in batch";
 		case futurehead::error_rpc::block_create_balance_mismatch:
 			return "Balance mismatch for previous block";
 		case futurehead::error_rpc::block_create_key_required:
@@ -181,6 +187,8 @@ std::string futurehead::error_rpc_messages::message (int ev) const
 			return "Legacy bootstrap is disabled";
 		case futurehead::error_rpc::invalid_balance:
 			return "Invalid balance number";
+		case futurehead::error_rpc::invalid_cursor:
+			return "Invalid cursor";
 		case futurehead::error_rpc::invalid_destinations:
 			return "Invalid destinations number";
 		case futurehead::error_rpc::invalid_epoch:
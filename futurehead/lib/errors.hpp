@@ -69,7 +69,8 @@ enum class error_blocks
 	invalid_block_hash,
 	invalid_type,
 	not_found,
-	work_low
+	work_low,
+	pruned
 };
 
 /** RPC related errors */
@@ -86,6 +87,8 @@ enum class error_rpc
 	bad_source,
 	bad_timeout,
 	bad_work_version,
+	batch_nested,
+	batch_size_exceeded,
 	block_create_balance_mismatch,
 	block_create_key_required,
 	block_create_public_key_mismatch,
@@ -103,6 +106,7 @@ enum class error_rpc
 	disabled_bootstrap_lazy,
 	disabled_bootstrap_legacy,
 	invalid_balance,
+	invalid_cursor,
 	invalid_destinations,
 	invalid_epoch,
 	invalid_epoch_signer,
@@ -70,7 +70,14 @@ namespace ipc
 		flatbuffers = 0x3,
 
 		/** JSON -> Flatbuffers -> JSON  */
-		flatbuffers_json = 0x4
+		flatbuffers_json = 0x4,
+
+		/**
+		 * Request is the same as json_v1.
+		 * Response is a sequence of 32-bit BE length prefixed chunks, ended by an empty chunk. The chunks
+		 * are sent as the response is produced, and concatenated they form the same payload as json_v1.
+		 */
+		json_v1_chunked = 0x5
 	};
 
 	/** IPC transport interface */
@@ -324,7 +324,7 @@ futurehead::shared_const_buffer futurehead::ipc::prepare_flatbuffers_request (st
 futurehead::shared_const_buffer futurehead::ipc::prepare_request (futurehead::ipc::payload_encoding encoding_a, std::string const & payload_a)
 {
 	std::vector<uint8_t> buffer_l;
-	if (encoding_a == futurehead::ipc::payload_encoding::json_v1 || encoding_a == futurehead::ipc::payload_encoding::flatbuffers_json)
+	if (encoding_a == futurehead::ipc::payload_encoding::json_v1 || encoding_a == futurehead::ipc::payload_encoding::json_v1_chunked || encoding_a == futurehead::ipc::payload_encoding::flatbuffers_json)
 	{
 		buffer_l = get_preamble (encoding_a);
 		auto payload_length = static_cast<uint32_t> (payload_a.size ());
@@ -0,0 +1,272 @@
+#include <futurehead/lib/json_writer.hpp>
+#include <futurehead/lib/utility.hpp>
+
+#include <boost/property_tree/ptree.hpp>
+
+namespace
+{
+char const * hex_digits = "0123456789ABCDEF";
+}
+
+futurehead::json_writer::json_writer (std::function<void(std::string const &)> const & chunk_a, size_t chunk_size_a) :
+chunk (chunk_a),
+chunk_size (chunk_size_a)
+{
+	buffer.reserve (chunk_size);
+}
+
+void futurehead::json_writer::begin_object ()
+{
+	if (!frames.empty () && !keyed)
+	{
+		next ();
+	}
+	keyed = false;
+	frames.push_back (frame{ false, 0 });
+}
+
+void futurehead::json_writer::end_object ()
+{
+	debug_assert (!frames.empty () && !frames.back ().array && !keyed);
+	end ();
+}
+
+void futurehead::json_writer::begin_array ()
+{
+	if (!frames.empty () && !keyed)
+	{
+		next ();
+	}
+	keyed = false;
+	frames.push_back (frame{ true, 0 });
+}
+
+void futurehead::json_writer::end_array ()
+{
+	debug_assert (!frames.empty () && frames.back ().array);
+	end ();
+}
+
+void futurehead::json_writer::key (std::string const & key_a)
+{
+	debug_assert (!frames.empty () && !frames.back ().array && !keyed);
+	next ();
+	buffer.push_back ('"');
+	append_escaped (key_a.data (), key_a.size ());
+	buffer.append ("\": ");
+	keyed = true;
+}
+
+void futurehead::json_writer::value (std::string const & value_a)
+{
+	debug_assert (!frames.empty ());
+	if (!keyed)
+	{
+		next ();
+	}
+	keyed = false;
+	buffer.push_back ('"');
+	append_escaped (value_a.data (), value_a.size ());
+	buffer.push_back ('"');
+}
+
+void futurehead::json_writer::value (char const * value_a)
+{
+	value (std::string (value_a));
+}
+
+void futurehead::json_writer::value (uint64_t value_a)
+{
+	value (std::to_string (value_a));
+}
+
+void futurehead::json_writer::value (futurehead::uint128_t const & value_a)
+{
+	// Formatted in chunks of 19 decimal digits, each fitting a 64 bit integer
+	debug_assert (!frames.empty ());
+	static uint64_t constexpr chunk_divisor{ 10000000000000000000ULL };
+	char digits[40];
+	auto end (digits + sizeof (digits));
+	auto position (end);
+	futurehead::uint128_t remaining (value_a);
+	do
+	{
+		uint64_t chunk;
+		if (remaining >= chunk_divisor)
+		{
+			chunk = static_cast<uint64_t> (remaining % chunk_divisor);
+			remaining /= chunk_divisor;
+			for (auto i (0); i < 19; ++i)
+			{
+				*--position = static_cast<char> ('0' + chunk % 10);
+				chunk /= 10;
+			}
+		}
+		else
+		{
+			chunk = static_cast<uint64_t> (remaining);
+			remaining = 0;
+			do
+			{
+				*--position = static_cast<char> ('0' + chunk % 10);
+				chunk /= 10;
+			} while (chunk != 0);
+		}
+	} while (remaining != 0);
+	if (!keyed)
+	{
+		next ();
+	}
+	keyed = false;
+	buffer.push_back ('"');
+	buffer.append (position, end);
+	buffer.push_back ('"');
+}
+
+void futurehead::json_writer::value (futurehead::uint256_union const & value_a)
+{
+	debug_assert (!frames.empty ());
+	if (!keyed)
+	{
+		next ();
+	}
+	keyed = false;
+	buffer.push_back ('"');
+	for (auto byte_l : value_a.bytes)
+	{
+		buffer.push_back (hex_digits[byte_l >> 4]);
+		buffer.push_back (hex_digits[byte_l & 0xf]);
+	}
+	buffer.push_back ('"');
+}
+
+void futurehead::json_writer::account (futurehead::account const & account_a)
+{
+	account_text.clear ();
+	account_a.encode_account (account_text);
+	value (account_text);
+}
+
+void futurehead::json_writer::tree (boost::property_tree::ptree const & tree_a)
+{
+	if (tree_a.empty () && !frames.empty ())
+	{
+		value (tree_a.data ());
+	}
+	else if (tree_a.count ("") == tree_a.size () && !frames.empty ())
+	{
+		begin_array ();
+		for (auto const & child : tree_a)
+		{
+			tree (child.second);
+		}
+		end_array ();
+	}
+	else
+	{
+		begin_object ();
+		for (auto const & child : tree_a)
+		{
+			key (child.first);
+			tree (child.second);
+		}
+		end_object ();
+	}
+}
+
+std::string const & futurehead::json_writer::str () const
+{
+	debug_assert (frames.empty ());
+	return buffer;
+}
+
+void futurehead::json_writer::next ()
+{
+	if (chunk && buffer.size () >= chunk_size)
+	{
+		chunk (buffer);
+		buffer.clear ();
+	}
+	auto & frame_l (frames.back ());
+	if (frame_l.size == 0)
+	{
+		buffer.push_back (frame_l.array ? '[' : '{');
+	}
+	else
+	{
+		buffer.push_back (',');
+	}
+	buffer.push_back ('\n');
+	buffer.append (4 * frames.size (), ' ');
+	++frame_l.size;
+}
+
+void futurehead::json_writer::end ()
+{
+	auto frame_l (frames.back ());
+	frames.pop_back ();
+	if (frame_l.size != 0)
+	{
+		buffer.push_back ('\n');
+		buffer.append (4 * frames.size (), ' ');
+		buffer.push_back (frame_l.array ? ']' : '}');
+	}
+	else if (!frames.empty ())
+	{
+		// An empty container has no children in a property tree, it is written as an empty value
+		buffer.append ("\"\"");
+	}
+	else
+	{
+		buffer.append ("{\n}");
+	}
+	if (frames.empty ())
+	{
+		buffer.push_back ('\n');
+	}
+}
+
+void futurehead::json_writer::append_escaped (char const * data_a, size_t size_a)
+{
+	// Same escapes as boost::property_tree::json_parser::create_escapes
+	for (auto i (data_a), n (data_a + size_a); i != n; ++i)
+	{
+		auto c (static_cast<unsigned char> (*i));
+		if (c == 0x20 || c == 0x21 || (c >= 0x23 && c <= 0x2E) || (c >= 0x30 && c <= 0x5B) || c >= 0x5D)
+		{
+			buffer.push_back (*i);
+		}
+		else
+		{
+			buffer.push_back ('\\');
+			switch (c)
+			{
+				case '\b':
+					buffer.push_back ('b');
+					break;
+				case '\f':
+					buffer.push_back ('f');
+					break;
+				case '\n':
+					buffer.push_back ('n');
+					break;
+				case '\r':
+					buffer.push_back ('r');
+					break;
+				case '\t':
+					buffer.push_back ('t');
+					break;
+				case '/':
+				case '"':
+				case '\\':
+					buffer.push_back (*i);
+					break;
+				default:
+					buffer.append ("u00");
+					buffer.push_back (hex_digits[c >> 4]);
+					buffer.push_back (hex_digits[c & 0xf]);
+					break;
+			}
+		}
+	}
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <futurehead/lib/numbers.hpp>
+
+#include <boost/property_tree/ptree_fwd.hpp>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace futurehead
+{
+/**
+ * Writes JSON directly into a growing buffer without building a property tree.
+ * The output is identical to boost::property_tree::write_json, so large responses can be streamed without changing
+ * what clients receive: every value is written as a string and an empty object or array is written as "".
+ */
+class json_writer final
+{
+public:
+	json_writer () = default;
+	/** Output is passed to \p chunk_a and cleared whenever it reaches \p chunk_size_a bytes, str () then only holds the remainder */
+	json_writer (std::function<void(std::string const &)> const & chunk_a, size_t chunk_size_a);
+	/** Starts an object as the next value */
+	void begin_object ();
+	void end_object ();
+	/** Starts an array as the next value, its elements are written without keys */
+	void begin_array ();
+	void end_array ();
+	/** Starts a member of the current object, the next call writes its value */
+	void key (std::string const &);
+	void value (std::string const &);
+	void value (char const *);
+	void value (uint64_t);
+	/** Decimal, as uint128_t::convert_to<std::string> () */
+	void value (futurehead::uint128_t const &);
+	/** Upper case hex, as uint256_union::to_string () */
+	void value (futurehead::uint256_union const &);
+	void account (futurehead::account const &);
+	/** Writes an existing property tree as the next value */
+	void tree (boost::property_tree::ptree const &);
+	/** The output, complete once the top level value has ended */
+	std::string const & str () const;
+
+private:
+	class frame final
+	{
+	public:
+		bool array;
+		size_t size;
+	};
+	/** Writes the separator and indentation preceding the next member or element of the current container */
+	void next ();
+	/** Closes the current container, finishing the output at the top level */
+	void end ();
+	void append_escaped (char const *, size_t);
+	std::string buffer;
+	std::function<void(std::string const &)> chunk;
+	size_t chunk_size{ 0 };
+	std::vector<frame> frames;
+	/** A key was written and is waiting for its value */
+	bool keyed{ false };
+	/** Scratch space for account encoding */
+	std::string account_text;
+};
+}
@@ -27,18 +27,43 @@ std::unordered_map<futurehead::account, futurehead::uint128_t> futurehead::rep_w
 	return rep_amounts;
 }
 
+constexpr unsigned futurehead::rep_weights::generation_shift;
+
+uint64_t futurehead::rep_weights::generation () const
+{
+	return generation_m;
+}
+
 void futurehead::rep_weights::put (futurehead::account const & account_a, futurehead::uint128_union const & representation_a)
 {
 	auto it = rep_amounts.find (account_a);
 	auto amount = representation_a.number ();
+	futurehead::uint128_t previous (0);
 	if (it != rep_amounts.end ())
 	{
+		previous = it->second;
 		it->second = amount;
 	}
 	else
 	{
 		rep_amounts.emplace (account_a, amount);
 	}
+	if (amount != previous)
+	{
+		// Every block changes some weight, small drifts are accumulated per representative so weighing votes again is only needed after material changes
+		auto existing (generation_amounts.emplace (account_a, previous).first);
+		auto reference (existing->second);
+		auto difference (amount > reference ? amount - reference : reference - amount);
+		if (difference > (reference >> generation_shift))
+		{
+			++generation_m;
+			generation_amounts.clear ();
+		}
+		else if (difference == 0)
+		{
+			generation_amounts.erase (existing);
+		}
+	}
 }
 
 futurehead::uint128_t futurehead::rep_weights::get (futurehead::account const & account_a)
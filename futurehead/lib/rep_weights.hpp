@@ -3,6 +3,7 @@
 #include <futurehead/lib/numbers.hpp>
 #include <futurehead/lib/utility.hpp>
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -19,10 +20,17 @@ public:
 	futurehead::uint128_t representation_get (futurehead::account const & account_a);
 	void representation_put (futurehead::account const & account_a, futurehead::uint128_union const & representation_a);
 	std::unordered_map<futurehead::account, futurehead::uint128_t> get_rep_amounts ();
+	/** Changes whenever a representative weight moves materially away from its value at the last change, lets callers keep weights read earlier */
+	uint64_t generation () const;
+	/** A weight changing by more than 1/2^generation_shift of its value at the last generation change starts a new generation */
+	static unsigned constexpr generation_shift{ 10 };
 
 private:
 	std::mutex mutex;
+	std::atomic<uint64_t> generation_m{ 0 };
 	std::unordered_map<futurehead::account, futurehead::uint128_t> rep_amounts;
+	/** Weights at the last generation change, for representatives whose weight drifted since */
+	std::unordered_map<futurehead::account, futurehead::uint128_t> generation_amounts;
 	void put (futurehead::account const & account_a, futurehead::uint128_union const & representation_a);
 	futurehead::uint128_t get (futurehead::account const & account_a);
 
@@ -58,6 +58,11 @@ public:
 	virtual ~rpc_handler_interface () = default;
 	/** Process RPC 1.0 request. */
 	virtual void process_request (std::string const & action, std::string const & body, std::function<void(std::string const &)> response) = 0;
+	/**
+	 * Process RPC 1.0 request. Large responses are passed to \p response_chunk in parts as they are produced, and \p response completes every response.
+	 * An empty chunk means the response failed after parts of it were passed on, \p response is not called and the client connection must be dropped
+	 */
+	virtual void process_request_chunked (std::string const & action, std::string const & body, std::function<void(std::string const &)> response_chunk, std::function<void(std::string const &)> response) = 0;
 	/** Process RPC 2.0 request. This is called via the IPC API */
 	virtual void process_request_v2 (rpc_handler_request_params const & params_a, std::string const & body, std::function<void(std::shared_ptr<std::string>)> response) = 0;
 	virtual void stop () = 0;
@@ -423,6 +423,15 @@ std::string futurehead::stat::type_to_string (uint32_t key)
 		case futurehead::stat::type::vote:
 			res = "vote";
 			break;
+		case futurehead::stat::type::vote_queue:
+			res = "vote_queue";
+			break;
+		case futurehead::stat::type::vote_queue_drop:
+			res = "vote_queue_drop";
+			break;
+		case futurehead::stat::type::vote_queue_latency:
+			res = "vote_queue_latency";
+			break;
 		case futurehead::stat::type::election:
 			res = "election";
 			break;
@@ -487,6 +496,12 @@ std::string futurehead::stat::detail_to_string (uint32_t key)
 		case futurehead::stat::detail::bulk_pull_request_failure:
 			res = "bulk_pull_request_failure";
 			break;
+		case futurehead::stat::detail::bulk_pull_pipelined:
+			res = "bulk_pull_pipelined";
+			break;
+		case futurehead::stat::detail::bulk_pull_compact_saved:
+			res = "bulk_pull_compact_saved";
+			break;
 		case futurehead::stat::detail::bulk_push:
 			res = "bulk_push";
 			break;
@@ -526,6 +541,9 @@ std::string futurehead::stat::detail_to_string (uint32_t key)
 		case futurehead::stat::detail::gap_source:
 			res = "gap_source";
 			break;
+		case futurehead::stat::detail::pruned:
+			res = "pruned";
+			break;
 		case futurehead::stat::detail::frontier_confirmation_failed:
 			res = "frontier_confirmation_failed";
 			break;
@@ -535,6 +553,12 @@ std::string futurehead::stat::detail_to_string (uint32_t key)
 		case futurehead::stat::detail::frontier_req:
 			res = "frontier_req";
 			break;
+		case futurehead::stat::detail::frontier_sent:
+			res = "frontier_sent";
+			break;
+		case futurehead::stat::detail::checkpoint_trusted:
+			res = "checkpoint_trusted";
+			break;
 		case futurehead::stat::detail::handshake:
 			res = "handshake";
 			break;
@@ -601,6 +625,24 @@ std::string futurehead::stat::detail_to_string (uint32_t key)
 		case futurehead::stat::detail::vote_overflow:
 			res = "vote_overflow";
 			break;
+		case futurehead::stat::detail::vote_duplicate:
+			res = "vote_duplicate";
+			break;
+		case futurehead::stat::detail::vote_replaced:
+			res = "vote_replaced";
+			break;
+		case futurehead::stat::detail::bucket_0:
+			res = "bucket_0";
+			break;
+		case futurehead::stat::detail::bucket_1:
+			res = "bucket_1";
+			break;
+		case futurehead::stat::detail::bucket_2:
+			res = "bucket_2";
+			break;
+		case futurehead::stat::detail::bucket_3:
+			res = "bucket_3";
+			break;
 		case futurehead::stat::detail::vote_new:
 			res = "vote_new";
 			break;
@@ -189,6 +189,9 @@ public:
 		rollback,
 		bootstrap,
 		vote,
+		vote_queue,
+		vote_queue_drop,
+		vote_queue_latency,
 		election,
 		http_callback,
 		peering,
@@ -231,6 +234,7 @@ public:
 		old,
 		gap_previous,
 		gap_source,
+		pruned,
 
 		// message specific
 		keepalive,
@@ -255,8 +259,12 @@ public:
 		bulk_pull_failed_account,
 		bulk_pull_receive_block_failure,
 		bulk_pull_request_failure,
+		bulk_pull_pipelined,
+		bulk_pull_compact_saved,
 		bulk_push,
 		frontier_req,
+		frontier_sent,
+		checkpoint_trusted,
 		frontier_confirmation_failed,
 		frontier_confirmation_successful,
 		error_socket_close,
@@ -267,6 +275,14 @@ public:
 		vote_indeterminate,
 		vote_invalid,
 		vote_overflow,
+		vote_duplicate,
+		vote_replaced,
+
+		// vote queue specific, one detail per weight bucket
+		bucket_0,
+		bucket_1,
+		bucket_2,
+		bucket_3,
 
 		// election specific
 		vote_new,
@@ -81,6 +81,15 @@ std::string futurehead::thread_role::get_string (futurehead::thread_role::name r
 		case futurehead::thread_role::name::epoch_upgrader:
 			thread_role_name_string = "Epoch upgrader";
 			break;
+		case futurehead::thread_role::name::vote_applying:
+			thread_role_name_string = "Vote applying";
+			break;
+		case futurehead::thread_role::name::ledger_compaction:
+			thread_role_name_string = "Compaction";
+			break;
+		case futurehead::thread_role::name::rpc_handling:
+			thread_role_name_string = "RPC handling";
+			break;
 	}
 
 	/*
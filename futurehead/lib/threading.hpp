@@ -35,7 +35,10 @@ namespace thread_role
 		worker,
 		request_aggregator,
 		state_block_signature_verification,
-		epoch_upgrader
+		epoch_upgrader,
+		vote_applying,
+		ledger_compaction,
+		rpc_handling
 	};
 	/*
 	 * Get/Set the identifier for the current thread
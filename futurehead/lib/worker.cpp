@@ -1,12 +1,17 @@
 #include <futurehead/lib/threading.hpp>
 #include <futurehead/lib/worker.hpp>
 
-futurehead::worker::worker () :
-thread ([this]() {
-	futurehead::thread_role::set (futurehead::thread_role::name::worker);
-	this->run ();
-})
+#include <algorithm>
+
+futurehead::worker::worker (unsigned threads_a, futurehead::thread_role::name role_a)
 {
+	for (auto i (0u); i < std::max (1u, threads_a); ++i)
+	{
+		threads.emplace_back ([this, role_a]() {
+			futurehead::thread_role::set (role_a);
+			this->run ();
+		});
+	}
 }
 
 void futurehead::worker::run ()
@@ -57,10 +62,13 @@ void futurehead::worker::stop ()
 		stopped = true;
 		queue.clear ();
 	}
-	cv.notify_one ();
-	if (thread.joinable ())
+	cv.notify_all ();
+	for (auto & thread : threads)
 	{
-		thread.join ();
+		if (thread.joinable ())
+		{
+			thread.join ();
+		}
 	}
 }
 
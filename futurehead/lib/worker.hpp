@@ -1,19 +1,22 @@
 #pragma once
 
 #include <futurehead/lib/locks.hpp>
+#include <futurehead/lib/threading.hpp>
 #include <futurehead/lib/utility.hpp>
 
 #include <deque>
 #include <functional>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 namespace futurehead
 {
+/** Runs queued tasks in order of submission on one or more threads */
 class worker final
 {
 public:
-	worker ();
+	worker (unsigned threads_a = 1, futurehead::thread_role::name role_a = futurehead::thread_role::name::worker);
 	~worker ();
 	void run ();
 	void push_task (std::function<void()> func);
@@ -24,7 +27,7 @@ private:
 	std::deque<std::function<void()>> queue;
 	std::mutex mutex;
 	bool stopped{ false };
-	std::thread thread;
+	std::vector<std::thread> threads;
 
 	friend std::unique_ptr<container_info_component> collect_container_info (worker &, const std::string &);
 };
@@ -228,11 +228,11 @@ void futurehead::active_transactions::request_confirm (futurehead::unique_lock<s
 	solicitor.prepare (node.rep_crawler.principal_representatives (std::numeric_limits<size_t>::max ()));
 
 	futurehead::vote_generator_session generator_session (generator);
-	auto & sorted_roots_l (roots.get<tag_difficulty> ());
 	auto const election_ttl_cutoff_l (std::chrono::steady_clock::now () - election_time_to_live);
 	bool const check_all_elections_l (std::chrono::steady_clock::now () - last_check_all_elections > check_all_elections_period);
-	size_t const this_loop_target_l (check_all_elections_l ? sorted_roots_l.size () : prioritized_cutoff);
+	size_t const this_loop_target_l (check_all_elections_l ? roots.size () : prioritized_cutoff);
 	size_t unconfirmed_count_l (0);
+	std::vector<futurehead::qualified_root> erased_l;
 	futurehead::timer<std::chrono::milliseconds> elapsed (futurehead::timer_state::started);
 
 	/*
@@ -242,27 +242,31 @@ void futurehead::active_transactions::request_confirm (futurehead::unique_lock<s
 	 * Elections extending the soft config.active_elections_size limit are flushed after a certain time-to-live cutoff
 	 * Flushed elections are later re-activated via frontier confirmation
 	 */
-	for (auto i = sorted_roots_l.begin (), n = sorted_roots_l.end (); i != n && unconfirmed_count_l < this_loop_target_l;)
+	if (this_loop_target_l > 0)
 	{
-		auto & election_l (i->election);
-		bool const confirmed_l (election_l->confirmed ());
+		roots.ordered ([&](futurehead::conflict_info const & info_a) {
+			auto & election_l (info_a.election);
+			bool const confirmed_l (election_l->confirmed ());
 
-		if (!election_l->prioritized () && unconfirmed_count_l < prioritized_cutoff)
-		{
-			election_l->prioritize_election (generator_session);
-		}
+			if (!election_l->prioritized () && unconfirmed_count_l < prioritized_cutoff)
+			{
+				election_l->prioritize_election (generator_session);
+			}
 
-		unconfirmed_count_l += !confirmed_l;
-		bool const overflow_l (unconfirmed_count_l > node.config.active_elections_size && election_l->election_start < election_ttl_cutoff_l && !node.wallets.watcher->is_watched (i->root));
-		if (overflow_l || election_l->transition_time (solicitor))
-		{
-			election_l->cleanup ();
-			i = sorted_roots_l.erase (i);
-		}
-		else
-		{
-			++i;
-		}
+			unconfirmed_count_l += !confirmed_l;
+			bool const overflow_l (unconfirmed_count_l > node.config.active_elections_size && election_l->election_start < election_ttl_cutoff_l && !node.wallets.watcher->is_watched (info_a.root));
+			if (overflow_l || election_l->transition_time (solicitor))
+			{
+				election_l->cleanup ();
+				erased_l.push_back (info_a.root);
+			}
+			return unconfirmed_count_l < this_loop_target_l;
+		});
+	}
+	// Erased after the ordered iteration which cannot be modified meanwhile
+	for (auto const & root_l : erased_l)
+	{
+		roots.erase (roots.find (root_l));
 	}
 	lock_a.unlock ();
 	solicitor.flush ();
@@ -616,8 +620,8 @@ futurehead::election_insertion_result futurehead::active_transactions::insert_im
 	if (!stopped)
 	{
 		auto root (block_a->qualified_root ());
-		auto existing (roots.get<tag_root> ().find (root));
-		if (existing == roots.get<tag_root> ().end ())
+		auto existing (roots.find (root));
+		if (existing == roots.end ())
 		{
 			if (recently_confirmed.get<tag_root> ().find (root) == recently_confirmed.get<tag_root> ().end ())
 			{
@@ -637,7 +641,7 @@ futurehead::election_insertion_result futurehead::active_transactions::insert_im
 				double multiplier (normalized_multiplier (*block_a));
 				bool prioritized = roots.size () < prioritized_cutoff || multiplier > last_prioritized_multiplier.value_or (0);
 				result.election = futurehead::make_shared<futurehead::election> (node, block_a, confirmation_action_a, prioritized);
-				roots.get<tag_root> ().emplace (futurehead::active_transactions::conflict_info{ root, multiplier, multiplier, result.election, epoch, previous_balance });
+				roots.insert (futurehead::conflict_info{ root, multiplier, multiplier, result.election, epoch, previous_balance });
 				blocks.emplace (hash, result.election);
 				add_adjust_difficulty (hash);
 				result.election->insert_inactive_votes_cache (hash);
@@ -667,50 +671,85 @@ futurehead::vote_code futurehead::active_transactions::vote (std::shared_ptr<fut
 	unsigned recently_confirmed_counter (0);
 	bool replay (false);
 	bool processed (false);
+	// Everything not depending on the elections is read before taking the mutex, which is only held to look the elections up
+	auto weight (node.ledger.weight (vote_a->account));
+	auto online_stake (node.online_reps.online_stake ());
+	std::vector<std::pair<futurehead::block_hash, futurehead::qualified_root>> block_roots;
+	for (auto const & vote_block : vote_a->blocks)
+	{
+		if (!vote_block.which ())
+		{
+			auto block (boost::get<std::shared_ptr<futurehead::block>> (vote_block));
+			block_roots.emplace_back (block->hash (), block->qualified_root ());
+		}
+	}
+	std::vector<std::pair<std::shared_ptr<futurehead::election>, futurehead::block_hash>> elections;
 	{
 		futurehead::lock_guard<std::mutex> lock (mutex);
+		auto block_root (block_roots.begin ());
 		for (auto vote_block : vote_a->blocks)
 		{
-			futurehead::election_vote_result result;
 			auto & recently_confirmed_by_hash (recently_confirmed.get<tag_hash> ());
+			std::shared_ptr<futurehead::election> election;
+			futurehead::block_hash block_hash;
 			if (vote_block.which ())
 			{
-				auto block_hash (boost::get<futurehead::block_hash> (vote_block));
+				block_hash = boost::get<futurehead::block_hash> (vote_block);
 				auto existing (blocks.find (block_hash));
 				if (existing != blocks.end ())
 				{
-					at_least_one = true;
-					result = existing->second->vote (vote_a->account, vote_a->sequence, block_hash);
-				}
-				else if (recently_confirmed_by_hash.count (block_hash) == 0)
-				{
-					add_inactive_votes_cache (block_hash, vote_a->account);
-				}
-				else
-				{
-					++recently_confirmed_counter;
+					election = existing->second;
 				}
 			}
 			else
 			{
-				auto block (boost::get<std::shared_ptr<futurehead::block>> (vote_block));
-				auto existing (roots.get<tag_root> ().find (block->qualified_root ()));
-				if (existing != roots.get<tag_root> ().end ())
-				{
-					at_least_one = true;
-					result = existing->election->vote (vote_a->account, vote_a->sequence, block->hash ());
-				}
-				else if (recently_confirmed_by_hash.count (block->hash ()) == 0)
+				block_hash = block_root->first;
+				auto existing (roots.find (block_root->second));
+				++block_root;
+				if (existing != roots.end ())
 				{
-					add_inactive_votes_cache (block->hash (), vote_a->account);
-				}
-				else
-				{
-					++recently_confirmed_counter;
+					election = existing->election;
 				}
 			}
-			processed = processed || result.processed;
-			replay = replay || result.replay;
+			if (election != nullptr)
+			{
+				at_least_one = true;
+				elections.emplace_back (election, block_hash);
+			}
+			else if (recently_confirmed_by_hash.count (block_hash) == 0)
+			{
+				add_inactive_votes_cache (block_hash, vote_a->account);
+			}
+			else
+			{
+				++recently_confirmed_counter;
+			}
+		}
+	}
+	// Votes are applied under the mutex of each election, so votes for different elections are applied in parallel
+	std::vector<std::shared_ptr<futurehead::election>> quorum_checks;
+	for (auto const & election : elections)
+	{
+		auto quorum_check (false);
+		auto result (election.first->vote (vote_a->account, vote_a->sequence, election.second, weight, online_stake, quorum_check));
+		processed = processed || result.processed;
+		replay = replay || result.replay;
+		if (quorum_check)
+		{
+			quorum_checks.push_back (election.first);
+		}
+	}
+	if (!quorum_checks.empty ())
+	{
+		// Changing the winner and confirming update the active elections, skipped if the election ended meanwhile
+		futurehead::lock_guard<std::mutex> lock (mutex);
+		for (auto const & election : quorum_checks)
+		{
+			auto existing (roots.find (election->status.winner->qualified_root ()));
+			if (existing != roots.end () && existing->election == election && !election->confirmed ())
+			{
+				election->confirm_if_quorum ();
+			}
 		}
 	}
 
@@ -740,7 +779,7 @@ futurehead::vote_code futurehead::active_transactions::vote (std::shared_ptr<fut
 bool futurehead::active_transactions::active (futurehead::qualified_root const & root_a)
 {
 	futurehead::lock_guard<std::mutex> lock (mutex);
-	return roots.get<tag_root> ().find (root_a) != roots.get<tag_root> ().end ();
+	return roots.find (root_a) != roots.end ();
 }
 
 bool futurehead::active_transactions::active (futurehead::block const & block_a)
@@ -752,8 +791,8 @@ std::shared_ptr<futurehead::election> futurehead::active_transactions::election
 {
 	std::shared_ptr<futurehead::election> result;
 	futurehead::lock_guard<std::mutex> lock (mutex);
-	auto existing = roots.get<tag_root> ().find (root_a);
-	if (existing != roots.get<tag_root> ().end ())
+	auto existing = roots.find (root_a);
+	if (existing != roots.end ())
 	{
 		result = existing->election;
 	}
@@ -812,8 +851,8 @@ futurehead::election_insertion_result futurehead::active_transactions::activate
 bool futurehead::active_transactions::update_difficulty (futurehead::block const & block_a)
 {
 	futurehead::lock_guard<std::mutex> guard (mutex);
-	auto existing_election (roots.get<tag_root> ().find (block_a.qualified_root ()));
-	bool error = existing_election == roots.get<tag_root> ().end () || update_difficulty_impl (existing_election, block_a);
+	auto existing_election (roots.find (block_a.qualified_root ()));
+	bool error = existing_election == roots.end () || update_difficulty_impl (existing_election, block_a);
 	return error;
 }
 
@@ -828,9 +867,7 @@ bool futurehead::active_transactions::update_difficulty_impl (futurehead::active
 		{
 			node.logger.try_log (boost::str (boost::format ("Election %1% difficulty updated with block %2% from multiplier %3% to %4%") % root_it_a->root.to_string () % block_a.hash ().to_string () % root_it_a->multiplier % multiplier));
 		}
-		roots.get<tag_root> ().modify (root_it_a, [multiplier](futurehead::active_transactions::conflict_info & info_a) {
-			info_a.multiplier = multiplier;
-		});
+		roots.multiplier_set (root_it_a, multiplier);
 		add_adjust_difficulty (block_a.hash ());
 		node.stats.inc (futurehead::stat::type::election, futurehead::stat::detail::election_difficulty_update);
 	}
@@ -852,6 +889,10 @@ bool futurehead::active_transactions::restart (std::shared_ptr<futurehead::block
 			{
 				// Re-writing the block is necessary to avoid the same work being received later to force restarting the election
 				// The existing block is re-written, not the arriving block, as that one might not have gone through a full signature check
+				// Blocks returned by the store can be shared with other readers, so a separate copy is modified
+				auto sideband (ledger_block->sideband ());
+				ledger_block = node.store.block_get_no_sideband (transaction_a, hash);
+				ledger_block->sideband_set (sideband);
 				ledger_block->block_work_set (block_a->block_work ());
 
 				auto block_count = node.ledger.cache.block_count.load ();
@@ -969,8 +1010,8 @@ void futurehead::active_transactions::update_adjusted_multiplier ()
 					}
 					processed_blocks.insert (hash);
 					futurehead::qualified_root root (previous, existing->second->status.winner->root ());
-					auto existing_root (roots.get<tag_root> ().find (root));
-					if (existing_root != roots.get<tag_root> ().end ())
+					auto existing_root (roots.find (root));
+					if (existing_root != roots.end ())
 					{
 						sum += existing_root->multiplier;
 						elections_list.emplace_back (root, level);
@@ -996,13 +1037,11 @@ void futurehead::active_transactions::update_adjusted_multiplier ()
 			// Set adjusted multiplier
 			for (auto & item : elections_list)
 			{
-				auto existing_root (roots.get<tag_root> ().find (item.first));
+				auto existing_root (roots.find (item.first));
 				double multiplier_a = avg_multiplier + (double)item.second * min_unit;
 				if (existing_root->adjusted_multiplier != multiplier_a)
 				{
-					roots.get<tag_root> ().modify (existing_root, [multiplier_a](futurehead::active_transactions::conflict_info & info_a) {
-						info_a.adjusted_multiplier = multiplier_a;
-					});
+					roots.adjusted_multiplier_set (existing_root, multiplier_a);
 				}
 			}
 		}
@@ -1017,16 +1056,15 @@ void futurehead::active_transactions::update_active_multiplier (futurehead::uniq
 	// Heurestic to filter out non-saturated network and frontier confirmation
 	if (roots.size () >= prioritized_cutoff || (node.network_params.network.is_test_network () && !roots.empty ()))
 	{
-		auto & sorted_roots = roots.get<tag_difficulty> ();
 		std::vector<double> prioritized;
-		prioritized.reserve (std::min (sorted_roots.size (), prioritized_cutoff));
-		for (auto it (sorted_roots.begin ()), end (sorted_roots.end ()); it != end && prioritized.size () < prioritized_cutoff; ++it)
-		{
-			if (!it->election->confirmed ())
+		prioritized.reserve (std::min (roots.size (), prioritized_cutoff));
+		roots.ordered ([&prioritized, prioritized_cutoff = prioritized_cutoff](futurehead::conflict_info const & info_a) {
+			if (!info_a.election->confirmed ())
 			{
-				prioritized.push_back (it->adjusted_multiplier);
+				prioritized.push_back (info_a.adjusted_multiplier);
 			}
-		}
+			return prioritized.size () < prioritized_cutoff;
+		});
 		if (prioritized.size () > 10 || (node.network_params.network.is_test_network () && !prioritized.empty ()))
 		{
 			multiplier = prioritized[prioritized.size () / 2];
@@ -1117,12 +1155,12 @@ void futurehead::active_transactions::add_recently_confirmed (futurehead::qualif
 void futurehead::active_transactions::erase (futurehead::block const & block_a)
 {
 	futurehead::unique_lock<std::mutex> lock (mutex);
-	auto root_it (roots.get<tag_root> ().find (block_a.qualified_root ()));
-	if (root_it != roots.get<tag_root> ().end ())
+	auto root_it (roots.find (block_a.qualified_root ()));
+	if (root_it != roots.end ())
 	{
 		root_it->election->cleanup ();
 		root_it->election->adjust_dependent_difficulty ();
-		roots.get<tag_root> ().erase (root_it);
+		roots.erase (root_it);
 		lock.unlock ();
 		node.logger.try_log (boost::str (boost::format ("Election erased for block block %1% root %2%") % block_a.hash ().to_string () % block_a.root ().to_string ()));
 	}
@@ -1143,9 +1181,9 @@ size_t futurehead::active_transactions::size ()
 bool futurehead::active_transactions::publish (std::shared_ptr<futurehead::block> block_a)
 {
 	futurehead::lock_guard<std::mutex> lock (mutex);
-	auto existing (roots.get<tag_root> ().find (block_a->qualified_root ()));
+	auto existing (roots.find (block_a->qualified_root ()));
 	auto result (true);
-	if (existing != roots.get<tag_root> ().end ())
+	if (existing != roots.end ())
 	{
 		update_difficulty_impl (existing, *block_a);
 		auto election (existing->election);
@@ -1364,7 +1402,7 @@ std::unique_ptr<futurehead::container_info_component> futurehead::collect_contai
 	}
 
 	auto composite = std::make_unique<container_info_composite> (name);
-	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "roots", roots_count, sizeof (decltype (active_transactions.roots)::value_type) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "roots", roots_count, sizeof (futurehead::conflict_info) }));
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "blocks", blocks_count, sizeof (decltype (active_transactions.blocks)::value_type) }));
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "election_winner_details", active_transactions.election_winner_details_size (), sizeof (decltype (active_transactions.election_winner_details)::value_type) }));
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "recently_confirmed", recently_confirmed_count, sizeof (decltype (active_transactions.recently_confirmed)::value_type) }));
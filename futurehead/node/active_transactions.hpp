@@ -1,6 +1,7 @@
 #pragma once
 
 #include <futurehead/lib/numbers.hpp>
+#include <futurehead/node/prioritized_roots.hpp>
 #include <futurehead/node/voting.hpp>
 #include <futurehead/secure/common.hpp>
 
@@ -96,22 +97,10 @@ public:
 // Holds all active blocks i.e. recently added blocks that need confirmation
 class active_transactions final
 {
-	class conflict_info final
-	{
-	public:
-		futurehead::qualified_root root;
-		double multiplier;
-		double adjusted_multiplier;
-		std::shared_ptr<futurehead::election> election;
-		futurehead::epoch epoch;
-		futurehead::uint128_t previous_balance;
-	};
-
 	friend class futurehead::election;
 
 	// clang-format off
 	class tag_account {};
-	class tag_difficulty {};
 	class tag_root {};
 	class tag_sequence {};
 	class tag_uncemented {};
@@ -120,17 +109,8 @@ class active_transactions final
 	// clang-format on
 
 public:
-	// clang-format off
-	using ordered_roots = boost::multi_index_container<conflict_info,
-	mi::indexed_by<
-		mi::hashed_unique<mi::tag<tag_root>,
-			mi::member<conflict_info, futurehead::qualified_root, &conflict_info::root>>,
-		mi::ordered_non_unique<mi::tag<tag_difficulty>,
-			mi::member<conflict_info, double, &conflict_info::adjusted_multiplier>,
-			std::greater<double>>>>;
-	// clang-format on
-	ordered_roots roots;
-	using roots_iterator = active_transactions::ordered_roots::index_iterator<tag_root>::type;
+	futurehead::prioritized_roots roots;
+	using roots_iterator = futurehead::prioritized_roots::iterator;
 
 	explicit active_transactions (futurehead::node &, futurehead::confirmation_height_processor &);
 	~active_transactions ();
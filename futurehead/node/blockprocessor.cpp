@@ -117,6 +117,21 @@ void futurehead::block_processor::add (futurehead::unchecked_info const & info_a
 	}
 }
 
+void futurehead::block_processor::add_bootstrap (futurehead::unchecked_info const & info_a)
+{
+	futurehead::unchecked_info info (info_a);
+	if (info.verified == futurehead::signature_verification::unknown && node.bootstrap_checkpoint.trusted (*info.block))
+	{
+		// Whether a state block with an epoch link is an epoch block, signed by the epoch signer, is only known once its previous balance is
+		if (info.block->type () != futurehead::block_type::state || !node.ledger.is_epoch_link (info.block->link ()))
+		{
+			node.stats.inc (futurehead::stat::type::bootstrap, futurehead::stat::detail::checkpoint_trusted);
+			info.verified = futurehead::signature_verification::valid;
+		}
+	}
+	add (info);
+}
+
 void futurehead::block_processor::force (std::shared_ptr<futurehead::block> block_a)
 {
 	{
@@ -214,7 +229,7 @@ void futurehead::block_processor::process_batch (futurehead::unique_lock<std::mu
 {
 	auto scoped_write_guard = write_database_queue.wait (futurehead::writer::process_batch);
 	block_post_events post_events;
-	auto transaction (node.store.tx_begin_write ({ tables::accounts, futurehead::tables::cached_counts, futurehead::tables::change_blocks, tables::frontiers, tables::open_blocks, tables::pending, tables::receive_blocks, tables::representation, tables::send_blocks, tables::state_blocks, tables::unchecked }, { tables::confirmation_height }));
+	auto transaction (node.store.tx_begin_write ({ tables::accounts, futurehead::tables::cached_counts, futurehead::tables::change_blocks, tables::delegators, tables::frontiers, tables::open_blocks, tables::pending, tables::pending_totals, tables::receive_blocks, tables::representation, tables::send_blocks, tables::state_blocks, tables::unchecked }, { tables::confirmation_height }));
 	futurehead::timer<std::chrono::milliseconds> timer_l;
 	lock_a.lock ();
 	timer_l.start ();
@@ -334,6 +349,7 @@ futurehead::process_return futurehead::block_processor::process_one (futurehead:
 		case futurehead::process_result::progress:
 		{
 			release_assert (info_a.account.is_zero () || info_a.account == result.account);
+			node.store.block_cache_put (transaction_a, info_a.block);
 			if (node.config.logging.ledger_logging ())
 			{
 				std::string block;
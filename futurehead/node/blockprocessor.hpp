@@ -50,6 +50,8 @@ public:
 	bool half_full ();
 	void add (futurehead::unchecked_info const &, const bool = false);
 	void add (std::shared_ptr<futurehead::block>, uint64_t = 0);
+	/** Adds a block pulled by bootstrap, whose signature is not checked if the bootstrap checkpoint commits to it */
+	void add_bootstrap (futurehead::unchecked_info const &);
 	void force (std::shared_ptr<futurehead::block>);
 	void wait_write ();
 	bool should_log ();
@@ -12,6 +12,8 @@
 futurehead::bootstrap_initiator::bootstrap_initiator (futurehead::node & node_a) :
 node (node_a)
 {
+	// Lazy attempts remove their spill files when they end, files remaining were left by a crash
+	futurehead::lazy_state_backlog::remove_stale (node.application_path);
 	connections = std::make_shared<futurehead::bootstrap_connections> (node);
 	bootstrap_initiator_threads.push_back (boost::thread ([this]() {
 		futurehead::thread_role::set (futurehead::thread_role::name::bootstrap_connections);
@@ -145,7 +145,7 @@ void futurehead::bootstrap_attempt::add_recent_pull (futurehead::block_hash cons
 bool futurehead::bootstrap_attempt::process_block (std::shared_ptr<futurehead::block> block_a, futurehead::account const & known_account_a, uint64_t pull_blocks, futurehead::bulk_pull::count_t max_blocks, bool block_expected, unsigned retry_limit)
 {
 	futurehead::unchecked_info info (block_a, known_account_a, 0, futurehead::signature_verification::unknown);
-	node->block_processor.add (info);
+	node->block_processor.add_bootstrap (info);
 	return false;
 }
 
@@ -235,6 +235,19 @@ void futurehead::bootstrap_attempt_legacy::stop ()
 		{
 		}
 	}
+	for (auto const & range : frontier_ranges)
+	{
+		if (auto i = range.lock ())
+		{
+			try
+			{
+				i->promise.set_value (true);
+			}
+			catch (std::future_error &)
+			{
+			}
+		}
+	}
 	if (auto i = push.lock ())
 	{
 		try
@@ -283,7 +296,17 @@ void futurehead::bootstrap_attempt_legacy::add_frontier (futurehead::pull_info c
 {
 	futurehead::pull_info pull (pull_a);
 	futurehead::lock_guard<std::mutex> lock (mutex);
-	frontier_pulls.push_back (pull);
+	if (!frontier_range_pulls.empty ())
+	{
+		// The first range starts at account zero, so every account has a range starting at or below it
+		auto range (frontier_range_pulls.upper_bound (pull.account_or_head));
+		debug_assert (range != frontier_range_pulls.begin ());
+		(--range)->second.push_back (pull);
+	}
+	else
+	{
+		frontier_pulls.push_back (pull);
+	}
 }
 
 void futurehead::bootstrap_attempt_legacy::add_bulk_push_target (futurehead::block_hash const & head, futurehead::block_hash const & end)
@@ -523,27 +546,8 @@ bool futurehead::bootstrap_attempt_legacy::request_frontier (futurehead::unique_
 		}
 		else
 		{
-			account_count = frontier_pulls.size ();
-			// Shuffle pulls
-			release_assert (std::numeric_limits<CryptoPP::word32>::max () > frontier_pulls.size ());
-			if (!frontier_pulls.empty ())
-			{
-				for (auto i = static_cast<CryptoPP::word32> (frontier_pulls.size () - 1); i > 0; --i)
-				{
-					auto k = futurehead::random_pool::generate_word32 (0, i);
-					std::swap (frontier_pulls[i], frontier_pulls[k]);
-				}
-			}
-			// Add to regular pulls
-			while (!frontier_pulls.empty ())
-			{
-				auto pull (frontier_pulls.front ());
-				lock_a.unlock ();
-				node->bootstrap_initiator.connections->add_pull (pull);
-				lock_a.lock ();
-				++pulling;
-				frontier_pulls.pop_front ();
-			}
+			account_count = 0;
+			add_frontier_pulls (lock_a, frontier_pulls);
 		}
 		if (node->config.logging.network_logging ())
 		{
@@ -560,6 +564,31 @@ bool futurehead::bootstrap_attempt_legacy::request_frontier (futurehead::unique_
 	return result;
 }
 
+void futurehead::bootstrap_attempt_legacy::add_frontier_pulls (futurehead::unique_lock<std::mutex> & lock_a, std::deque<futurehead::pull_info> & pulls_a)
+{
+	account_count += pulls_a.size ();
+	// Shuffle pulls
+	release_assert (std::numeric_limits<CryptoPP::word32>::max () > pulls_a.size ());
+	if (!pulls_a.empty ())
+	{
+		for (auto i = static_cast<CryptoPP::word32> (pulls_a.size () - 1); i > 0; --i)
+		{
+			auto k = futurehead::random_pool::generate_word32 (0, i);
+			std::swap (pulls_a[i], pulls_a[k]);
+		}
+	}
+	// Add to regular pulls
+	while (!pulls_a.empty ())
+	{
+		auto pull (pulls_a.front ());
+		lock_a.unlock ();
+		node->bootstrap_initiator.connections->add_pull (pull);
+		lock_a.lock ();
+		++pulling;
+		pulls_a.pop_front ();
+	}
+}
+
 void futurehead::bootstrap_attempt_legacy::run_start (futurehead::unique_lock<std::mutex> & lock_a)
 {
 	frontiers_received = false;
@@ -567,16 +596,94 @@ void futurehead::bootstrap_attempt_legacy::run_start (futurehead::unique_lock<st
 	total_blocks = 0;
 	requeued_pulls = 0;
 	recent_pulls_head.clear ();
-	auto frontier_failure (true);
-	uint64_t frontier_attempts (0);
-	while (!stopped && frontier_failure)
+	auto ranges (node->flags.bootstrap_frontier_ranges);
+	if (ranges > 1)
 	{
-		++frontier_attempts;
-		frontier_failure = request_frontier (lock_a, frontier_attempts == 1);
+		request_frontier_ranges (lock_a, ranges);
+	}
+	else
+	{
+		auto frontier_failure (true);
+		uint64_t frontier_attempts (0);
+		while (!stopped && frontier_failure)
+		{
+			++frontier_attempts;
+			frontier_failure = request_frontier (lock_a, frontier_attempts == 1);
+		}
 	}
 	frontiers_received = true;
 }
 
+void futurehead::bootstrap_attempt_legacy::request_frontier_ranges (futurehead::unique_lock<std::mutex> & lock_a, unsigned ranges_a)
+{
+	debug_assert (ranges_a > 1);
+	// Equal ranges of the account space, the last one extends to its end
+	std::deque<std::pair<futurehead::account, futurehead::account>> pending;
+	futurehead::uint256_t step (std::numeric_limits<futurehead::uint256_t>::max () / ranges_a);
+	for (auto i (0U); i < ranges_a; ++i)
+	{
+		pending.emplace_back (futurehead::account (step * i), i + 1 < ranges_a ? futurehead::account (step * (i + 1)) : futurehead::account (0));
+	}
+	account_count = 0;
+	for (auto const & range : pending)
+	{
+		frontier_range_pulls[range.first];
+	}
+	auto first_attempt (true);
+	while (!stopped && !pending.empty ())
+	{
+		// Start a request for every range an idle connection is available for, ranges which fail are retried in the next round
+		std::vector<std::pair<std::pair<futurehead::account, futurehead::account>, std::future<bool>>> requests;
+		frontier_ranges.clear ();
+		while (!stopped && !pending.empty ())
+		{
+			lock_a.unlock ();
+			auto connection_l (node->bootstrap_initiator.connections->connection (shared_from_this (), first_attempt));
+			lock_a.lock ();
+			if (connection_l == nullptr || stopped)
+			{
+				break;
+			}
+			if (first_attempt)
+			{
+				endpoint_frontier_request = connection_l->channel->get_tcp_endpoint ();
+				first_attempt = false;
+			}
+			auto range (pending.front ());
+			pending.pop_front ();
+			auto client (std::make_shared<futurehead::frontier_req_client> (connection_l, shared_from_this (), range.first, range.second));
+			client->run ();
+			frontier_ranges.push_back (client);
+			requests.emplace_back (range, client->promise.get_future ());
+		}
+		lock_a.unlock ();
+		for (auto & request : requests)
+		{
+			auto error (consume_future (request.second));
+			lock_a.lock ();
+			auto & pulls (frontier_range_pulls[request.first.first]);
+			if (!error)
+			{
+				add_frontier_pulls (lock_a, pulls);
+			}
+			else
+			{
+				// Frontiers of a failed range are dropped, the retry requests all of them again
+				node->stats.inc (futurehead::stat::type::error, futurehead::stat::detail::frontier_req, futurehead::stat::dir::out);
+				pulls.clear ();
+				pending.push_back (request.first);
+			}
+			lock_a.unlock ();
+		}
+		lock_a.lock ();
+	}
+	frontier_range_pulls.clear ();
+	if (node->config.logging.network_logging ())
+	{
+		node->logger.try_log (boost::str (boost::format ("Completed frontier requests of %1% account ranges, %2% out of sync accounts") % ranges_a % account_count));
+	}
+}
+
 void futurehead::bootstrap_attempt_legacy::run ()
 {
 	debug_assert (started);
@@ -5,6 +5,7 @@
 
 #include <atomic>
 #include <future>
+#include <map>
 
 namespace futurehead
 {
@@ -65,6 +66,8 @@ public:
 	bool consume_future (std::future<bool> &);
 	void stop () override;
 	bool request_frontier (futurehead::unique_lock<std::mutex> &, bool = false);
+	void request_frontier_ranges (futurehead::unique_lock<std::mutex> &, unsigned);
+	void add_frontier_pulls (futurehead::unique_lock<std::mutex> &, std::deque<futurehead::pull_info> &);
 	void request_pull (futurehead::unique_lock<std::mutex> &);
 	void request_push (futurehead::unique_lock<std::mutex> &);
 	void add_frontier (futurehead::pull_info const &) override;
@@ -78,8 +81,12 @@ public:
 	void get_information (boost::property_tree::ptree &) override;
 	futurehead::tcp_endpoint endpoint_frontier_request;
 	std::weak_ptr<futurehead::frontier_req_client> frontiers;
+	/** Clients of the account ranges requested concurrently by request_frontier_ranges */
+	std::vector<std::weak_ptr<futurehead::frontier_req_client>> frontier_ranges;
 	std::weak_ptr<futurehead::bulk_push_client> push;
 	std::deque<futurehead::pull_info> frontier_pulls;
+	/** Frontiers of the ranges requested by request_frontier_ranges keyed by range start, added to the pulls once their range completes */
+	std::map<futurehead::account, std::deque<futurehead::pull_info>> frontier_range_pulls;
 	std::deque<futurehead::block_hash> recent_pulls_head;
 	std::vector<std::pair<futurehead::block_hash, futurehead::block_hash>> bulk_push_targets;
 	std::atomic<unsigned> account_count{ 0 };
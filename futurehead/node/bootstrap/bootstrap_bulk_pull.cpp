@@ -7,6 +7,127 @@
 
 #include <boost/format.hpp>
 
+constexpr uint8_t futurehead::bulk_pull_compact_codec::marker;
+constexpr uint8_t futurehead::bulk_pull_compact_codec::account_elided;
+constexpr uint8_t futurehead::bulk_pull_compact_codec::representative_elided;
+
+namespace
+{
+// Offsets of the fields elided by the compact encoding in a serialized state block
+size_t constexpr state_account_offset{ 0 };
+size_t constexpr state_representative_offset{ 2 * sizeof (futurehead::account) };
+size_t constexpr state_field_size{ sizeof (futurehead::account) };
+}
+
+size_t futurehead::bulk_pull_compact_codec::encode (futurehead::block const & block_a, std::vector<uint8_t> & buffer_a)
+{
+	size_t result (0);
+	if (block_a.type () == futurehead::block_type::state)
+	{
+		auto const & state (static_cast<futurehead::state_block const &> (block_a));
+		uint8_t type (marker);
+		if (have_previous && state.hashables.account == account)
+		{
+			type |= account_elided;
+		}
+		if (have_previous && state.hashables.representative == representative)
+		{
+			type |= representative_elided;
+		}
+		if (type == marker)
+		{
+			futurehead::vectorstream stream (buffer_a);
+			futurehead::serialize_block (stream, block_a);
+		}
+		else
+		{
+			std::vector<uint8_t> block_l;
+			{
+				futurehead::vectorstream stream (block_l);
+				block_a.serialize (stream);
+			}
+			debug_assert (block_l.size () == futurehead::state_block::size);
+			buffer_a.push_back (type);
+			for (size_t i (0); i < block_l.size (); i += state_field_size)
+			{
+				auto length (std::min (state_field_size, block_l.size () - i));
+				if ((i == state_account_offset && (type & account_elided)) || (i == state_representative_offset && (type & representative_elided)))
+				{
+					result += length;
+				}
+				else
+				{
+					buffer_a.insert (buffer_a.end (), block_l.begin () + i, block_l.begin () + i + length);
+				}
+			}
+		}
+		account = state.hashables.account;
+		representative = state.hashables.representative;
+		have_previous = true;
+	}
+	else
+	{
+		futurehead::vectorstream stream (buffer_a);
+		futurehead::serialize_block (stream, block_a);
+	}
+	return result;
+}
+
+bool futurehead::bulk_pull_compact_codec::is_compact (uint8_t type_a)
+{
+	return (type_a & ~(account_elided | representative_elided)) == marker && type_a != marker;
+}
+
+size_t futurehead::bulk_pull_compact_codec::size (uint8_t type_a)
+{
+	debug_assert (is_compact (type_a));
+	size_t result (futurehead::state_block::size);
+	result -= (type_a & account_elided) ? state_field_size : 0;
+	result -= (type_a & representative_elided) ? state_field_size : 0;
+	return result;
+}
+
+bool futurehead::bulk_pull_compact_codec::decode (uint8_t type_a, uint8_t const * data_a, std::vector<uint8_t> & block_a) const
+{
+	auto error (!have_previous || !is_compact (type_a));
+	if (!error)
+	{
+		block_a.clear ();
+		block_a.reserve (futurehead::state_block::size);
+		auto remaining (futurehead::state_block::size);
+		for (size_t i (0); i < futurehead::state_block::size; i += state_field_size)
+		{
+			auto length (std::min (state_field_size, remaining));
+			if (i == state_account_offset && (type_a & account_elided))
+			{
+				block_a.insert (block_a.end (), account.bytes.begin (), account.bytes.end ());
+			}
+			else if (i == state_representative_offset && (type_a & representative_elided))
+			{
+				block_a.insert (block_a.end (), representative.bytes.begin (), representative.bytes.end ());
+			}
+			else
+			{
+				block_a.insert (block_a.end (), data_a, data_a + length);
+				data_a += length;
+			}
+			remaining -= length;
+		}
+	}
+	return error;
+}
+
+void futurehead::bulk_pull_compact_codec::update (futurehead::block const & block_a)
+{
+	if (block_a.type () == futurehead::block_type::state)
+	{
+		auto const & state (static_cast<futurehead::state_block const &> (block_a));
+		account = state.hashables.account;
+		representative = state.hashables.representative;
+		have_previous = true;
+	}
+}
+
 futurehead::pull_info::pull_info (futurehead::hash_or_account const & account_or_head_a, futurehead::block_hash const & head_a, futurehead::block_hash const & end_a, uint64_t bootstrap_id_a, count_t count_a, unsigned retry_limit_a) :
 account_or_head (account_or_head_a),
 head (head_a),
@@ -40,7 +161,8 @@ futurehead::bulk_pull_client::~bulk_pull_client ()
 			pull.account_or_head = expected;
 		}
 		pull.processed += pull_blocks - unexpected_count;
-		connection->node->bootstrap_initiator.connections->requeue_pull (pull, network_error);
+		// Pipelined pulls whose response was never reached are not charged an attempt
+		connection->node->bootstrap_initiator.connections->requeue_pull (pull, network_error || awaiting_response);
 		if (connection->node->config.logging.bulk_pull_logging ())
 		{
 			connection->node->logger.try_log (boost::str (boost::format ("Bulk pull end block is not expected %1% for account %2%") % pull.end.to_string () % pull.account_or_head.to_account ()));
@@ -53,7 +175,7 @@ futurehead::bulk_pull_client::~bulk_pull_client ()
 	attempt->pull_finished ();
 }
 
-void futurehead::bulk_pull_client::request ()
+void futurehead::bulk_pull_client::request (bool receive_a)
 {
 	debug_assert (!pull.head.is_zero () || pull.retry_limit != std::numeric_limits<unsigned>::max ());
 	expected = pull.head;
@@ -71,6 +193,8 @@ void futurehead::bulk_pull_client::request ()
 	req.end = pull.end;
 	req.count = pull.count;
 	req.set_count_present (pull.count != 0);
+	compact = !connection->node->flags.disable_bootstrap_compact_stream;
+	req.set_compact (compact);
 
 	if (connection->node->config.logging.bulk_pull_logging ())
 	{
@@ -80,12 +204,20 @@ void futurehead::bulk_pull_client::request ()
 	{
 		connection->node->logger.always_log (boost::str (boost::format ("%1% accounts in pull queue") % attempt->pulling));
 	}
+	awaiting_response = !receive_a;
+	if (!receive_a)
+	{
+		connection->node->stats.inc (futurehead::stat::type::bootstrap, futurehead::stat::detail::bulk_pull_pipelined, futurehead::stat::dir::out);
+	}
 	auto this_l (shared_from_this ());
 	connection->channel->send (
-	req, [this_l](boost::system::error_code const & ec, size_t size_a) {
+	req, [this_l, receive_a](boost::system::error_code const & ec, size_t size_a) {
 		if (!ec)
 		{
-			this_l->throttled_receive_block ();
+			if (receive_a)
+			{
+				this_l->throttled_receive_block ();
+			}
 		}
 		else
 		{
@@ -144,68 +276,123 @@ void futurehead::bulk_pull_client::receive_block ()
 void futurehead::bulk_pull_client::received_type ()
 {
 	auto this_l (shared_from_this ());
-	futurehead::block_type type (static_cast<futurehead::block_type> (connection->receive_buffer->data ()[0]));
+	auto type_byte (connection->receive_buffer->data ()[0]);
+	futurehead::block_type type (static_cast<futurehead::block_type> (type_byte));
 
 	if (auto socket_l = connection->channel->socket.lock ())
 	{
-		switch (type)
+		if (compact && futurehead::bulk_pull_compact_codec::is_compact (type_byte))
 		{
-			case futurehead::block_type::send:
-			{
-				socket_l->async_read (connection->receive_buffer, futurehead::send_block::size, [this_l, type](boost::system::error_code const & ec, size_t size_a) {
-					this_l->received_block (ec, size_a, type);
-				});
-				break;
-			}
-			case futurehead::block_type::receive:
-			{
-				socket_l->async_read (connection->receive_buffer, futurehead::receive_block::size, [this_l, type](boost::system::error_code const & ec, size_t size_a) {
-					this_l->received_block (ec, size_a, type);
-				});
-				break;
-			}
-			case futurehead::block_type::open:
-			{
-				socket_l->async_read (connection->receive_buffer, futurehead::open_block::size, [this_l, type](boost::system::error_code const & ec, size_t size_a) {
-					this_l->received_block (ec, size_a, type);
-				});
-				break;
-			}
-			case futurehead::block_type::change:
-			{
-				socket_l->async_read (connection->receive_buffer, futurehead::change_block::size, [this_l, type](boost::system::error_code const & ec, size_t size_a) {
-					this_l->received_block (ec, size_a, type);
-				});
-				break;
-			}
-			case futurehead::block_type::state:
-			{
-				socket_l->async_read (connection->receive_buffer, futurehead::state_block::size, [this_l, type](boost::system::error_code const & ec, size_t size_a) {
-					this_l->received_block (ec, size_a, type);
-				});
-				break;
-			}
-			case futurehead::block_type::not_a_block:
+			socket_l->async_read (connection->receive_buffer, futurehead::bulk_pull_compact_codec::size (type_byte), [this_l, type_byte](boost::system::error_code const & ec, size_t size_a) {
+				this_l->received_compact_block (ec, size_a, type_byte);
+			});
+		}
+		else
+		{
+			switch (type)
 			{
-				// Avoid re-using slow peers, or peers that sent the wrong blocks.
-				if (!connection->pending_stop && (expected == pull.end || (pull.count != 0 && pull.count == pull_blocks)))
+				case futurehead::block_type::send:
 				{
-					connection->connections->pool_connection (connection);
+					socket_l->async_read (connection->receive_buffer, futurehead::send_block::size, [this_l, type](boost::system::error_code const & ec, size_t size_a) {
+						this_l->received_block (ec, size_a, type);
+					});
+					break;
 				}
-				break;
-			}
-			default:
-			{
-				if (connection->node->config.logging.network_packet_logging ())
+				case futurehead::block_type::receive:
+				{
+					socket_l->async_read (connection->receive_buffer, futurehead::receive_block::size, [this_l, type](boost::system::error_code const & ec, size_t size_a) {
+						this_l->received_block (ec, size_a, type);
+					});
+					break;
+				}
+				case futurehead::block_type::open:
+				{
+					socket_l->async_read (connection->receive_buffer, futurehead::open_block::size, [this_l, type](boost::system::error_code const & ec, size_t size_a) {
+						this_l->received_block (ec, size_a, type);
+					});
+					break;
+				}
+				case futurehead::block_type::change:
 				{
-					connection->node->logger.try_log (boost::str (boost::format ("Unknown type received as block type: %1%") % static_cast<int> (type)));
+					socket_l->async_read (connection->receive_buffer, futurehead::change_block::size, [this_l, type](boost::system::error_code const & ec, size_t size_a) {
+						this_l->received_block (ec, size_a, type);
+					});
+					break;
+				}
+				case futurehead::block_type::state:
+				{
+					socket_l->async_read (connection->receive_buffer, futurehead::state_block::size, [this_l, type](boost::system::error_code const & ec, size_t size_a) {
+						this_l->received_block (ec, size_a, type);
+					});
+					break;
+				}
+				case futurehead::block_type::not_a_block:
+				{
+					// Avoid re-using slow peers, or peers that sent the wrong blocks.
+					if (!connection->pending_stop && (expected == pull.end || (pull.count != 0 && pull.count == pull_blocks)))
+					{
+						finished ();
+					}
+					break;
+				}
+				default:
+				{
+					if (connection->node->config.logging.network_packet_logging ())
+					{
+						connection->node->logger.try_log (boost::str (boost::format ("Unknown type received as block type: %1%") % static_cast<int> (type)));
+					}
+					break;
 				}
-				break;
 			}
 		}
 	}
 }
 
+void futurehead::bulk_pull_client::received_compact_block (boost::system::error_code const & ec, size_t size_a, uint8_t type_a)
+{
+	auto error (static_cast<bool> (ec));
+	if (!error)
+	{
+		std::vector<uint8_t> block_l;
+		error = codec.decode (type_a, connection->receive_buffer->data (), block_l);
+		if (!error)
+		{
+			connection->node->stats.add (futurehead::stat::type::bootstrap, futurehead::stat::detail::bulk_pull_compact_saved, futurehead::stat::dir::in, futurehead::state_block::size - size_a, true);
+			std::copy (block_l.begin (), block_l.end (), connection->receive_buffer->begin ());
+			received_block (ec, block_l.size (), futurehead::block_type::state);
+		}
+		else
+		{
+			// A compact block without a preceding state block cannot be decoded
+			connection->node->stats.inc (futurehead::stat::type::bootstrap, futurehead::stat::detail::bulk_pull_deserialize_receive_block, futurehead::stat::dir::in);
+		}
+	}
+	else
+	{
+		received_block (ec, size_a, futurehead::block_type::state);
+	}
+}
+
+void futurehead::bulk_pull_client::finished ()
+{
+	std::shared_ptr<futurehead::bulk_pull_client> next_l;
+	{
+		futurehead::lock_guard<std::mutex> guard (connection->pipeline_mutex);
+		next_l = std::move (next);
+	}
+	if (next_l != nullptr)
+	{
+		// Keep the pipeline as deep as it was, then read the response to the next request
+		connection->connections->pipeline_pull (next_l);
+		next_l->awaiting_response = false;
+		next_l->throttled_receive_block ();
+	}
+	else
+	{
+		connection->connections->pool_connection (connection);
+	}
+}
+
 void futurehead::bulk_pull_client::received_block (boost::system::error_code const & ec, size_t size_a, futurehead::block_type type_a)
 {
 	if (!ec)
@@ -215,6 +402,7 @@ void futurehead::bulk_pull_client::received_block (boost::system::error_code con
 		if (block != nullptr && !futurehead::work_validate_entry (*block))
 		{
 			auto hash (block->hash ());
+			codec.update (*block);
 			if (connection->node->config.logging.bulk_pull_logging ())
 			{
 				std::string block_l;
@@ -257,7 +445,18 @@ void futurehead::bulk_pull_client::received_block (boost::system::error_code con
 			}
 			else if (stop_pull && block_expected)
 			{
-				connection->connections->pool_connection (connection);
+				futurehead::unique_lock<std::mutex> lock (connection->pipeline_mutex);
+				auto pipelined (next != nullptr);
+				lock.unlock ();
+				if (!pipelined)
+				{
+					connection->connections->pool_connection (connection);
+				}
+				else
+				{
+					// Only legacy pulls are pipelined, which do not stop early. The rest of this response would be read as the response to the next request, pipelined pulls are requeued as this client is destroyed
+					connection->stop (true);
+				}
 			}
 		}
 		else
@@ -418,7 +617,16 @@ void futurehead::bulk_pull_server::set_current_end ()
 	include_start = false;
 	debug_assert (request != nullptr);
 	auto transaction (connection->node->store.tx_begin_read ());
-	if (!connection->node->store.block_exists (transaction, request->end))
+	// Pruned blocks cannot be sent, the response ends at the first pruned block of the chain
+	auto pruning (connection->node->ledger.pruning);
+	if (pruning && connection->node->store.pruned_exists (transaction, request->end))
+	{
+		if (connection->node->config.logging.bulk_pull_logging ())
+		{
+			connection->node->logger.try_log (boost::str (boost::format ("Bulk pull end block is pruned: %1%") % request->end.to_string ()));
+		}
+	}
+	else if (!connection->node->store.block_exists (transaction, request->end))
 	{
 		if (connection->node->config.logging.bulk_pull_logging ())
 		{
@@ -437,6 +645,14 @@ void futurehead::bulk_pull_server::set_current_end ()
 		current = request->start;
 		include_start = true;
 	}
+	else if (pruning && connection->node->store.pruned_exists (transaction, request->start))
+	{
+		if (connection->node->config.logging.bulk_pull_logging ())
+		{
+			connection->node->logger.try_log (boost::str (boost::format ("Bulk pull request for pruned block: %1%") % request->start.to_string ()));
+		}
+		current = request->end;
+	}
 	else
 	{
 		futurehead::account_info info;
@@ -484,6 +700,15 @@ void futurehead::bulk_pull_server::send_next ()
 	if (block != nullptr)
 	{
 		std::vector<uint8_t> send_buffer;
+		if (request->is_compact ())
+		{
+			auto saved (codec.encode (*block, send_buffer));
+			if (saved != 0)
+			{
+				connection->node->stats.add (futurehead::stat::type::bootstrap, futurehead::stat::detail::bulk_pull_compact_saved, futurehead::stat::dir::out, saved, true);
+			}
+		}
+		else
 		{
 			futurehead::vectorstream stream (send_buffer);
 			futurehead::serialize_block (stream, *block);
@@ -544,6 +769,7 @@ std::shared_ptr<futurehead::block> futurehead::bulk_pull_server::get_next ()
 
 	if (send_current)
 	{
+		// A null result for a pruned block ends the response
 		result = connection->node->block (current);
 		if (result != nullptr && set_current_to_end == false)
 		{
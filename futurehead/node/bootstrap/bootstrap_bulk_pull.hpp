@@ -24,17 +24,49 @@ public:
 	unsigned retry_limit{ 0 };
 	uint64_t bootstrap_id{ 0 };
 };
+/**
+ * Compact encoding of state blocks in bulk pull responses, used when the request has bulk_pull::is_compact set.
+ * Blocks in one response usually belong to one account and share a representative. A state block whose account or representative
+ * equals that of the previous state block in the response is sent without them, behind a type byte with the marker bit set.
+ * Other blocks keep the plain encoding, and peers which did not ask for the compact encoding never receive it.
+ */
+class bulk_pull_compact_codec final
+{
+public:
+	static uint8_t constexpr marker = 0x80;
+	static uint8_t constexpr account_elided = 0x01;
+	static uint8_t constexpr representative_elided = 0x02;
+	/** Appends the type byte and block to \p buffer_a, returns the number of bytes saved */
+	size_t encode (futurehead::block const &, std::vector<uint8_t> & buffer_a);
+	/** Whether \p type_a is the type byte of a compact state block */
+	static bool is_compact (uint8_t type_a);
+	/** Size of the block following a compact type byte */
+	static size_t size (uint8_t type_a);
+	/** Rebuilds a plain state block from a compact one into \p block_a, returns true on error */
+	bool decode (uint8_t type_a, uint8_t const * data_a, std::vector<uint8_t> & block_a) const;
+	/** Must be called for every state block received in the response, in order */
+	void update (futurehead::block const &);
+
+private:
+	futurehead::account account{ 0 };
+	futurehead::account representative{ 0 };
+	bool have_previous{ false };
+};
 class bootstrap_client;
 class bulk_pull_client final : public std::enable_shared_from_this<futurehead::bulk_pull_client>
 {
 public:
 	bulk_pull_client (std::shared_ptr<futurehead::bootstrap_client>, std::shared_ptr<futurehead::bootstrap_attempt>, futurehead::pull_info const &);
 	~bulk_pull_client ();
-	void request ();
+	/** Sends the request, \p receive_a is false for requests pipelined behind another pull on the same connection */
+	void request (bool receive_a = true);
+	/** The response was read completely, continues with the next pipelined pull or returns the connection to the pool */
+	void finished ();
 	void receive_block ();
 	void throttled_receive_block ();
 	void received_type ();
 	void received_block (boost::system::error_code const &, size_t, futurehead::block_type);
+	void received_compact_block (boost::system::error_code const &, size_t, uint8_t);
 	futurehead::block_hash first ();
 	std::shared_ptr<futurehead::bootstrap_client> connection;
 	std::shared_ptr<futurehead::bootstrap_attempt> attempt;
@@ -44,6 +76,12 @@ public:
 	uint64_t pull_blocks;
 	uint64_t unexpected_count;
 	bool network_error{ false };
+	/** Requested behind other pulls on the same connection and waiting for their responses to be read */
+	bool awaiting_response{ false };
+	/** Pull requested on the same connection after this one, its response follows this one's */
+	std::shared_ptr<futurehead::bulk_pull_client> next;
+	bool compact{ false };
+	futurehead::bulk_pull_compact_codec codec;
 };
 class bulk_pull_account_client final : public std::enable_shared_from_this<futurehead::bulk_pull_account_client>
 {
@@ -75,6 +113,7 @@ public:
 	bool include_start;
 	futurehead::bulk_pull::count_t max_count;
 	futurehead::bulk_pull::count_t sent_count;
+	futurehead::bulk_pull_compact_codec codec;
 };
 class bulk_pull_account;
 class bulk_pull_account_server final : public std::enable_shared_from_this<futurehead::bulk_pull_account_server>
@@ -0,0 +1,123 @@
+#include <futurehead/crypto/blake2/blake2.h>
+#include <futurehead/lib/utility.hpp>
+#include <futurehead/node/bootstrap/bootstrap_checkpoint.hpp>
+#include <futurehead/secure/blockstore.hpp>
+
+#include <boost/endian/conversion.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include <sstream>
+
+std::vector<futurehead::bootstrap_checkpoint::entry> futurehead::bootstrap_checkpoint::generate (futurehead::block_store & store_a, futurehead::transaction const & transaction_a)
+{
+	std::vector<entry> result;
+	for (auto i (store_a.confirmation_height_begin (transaction_a)), n (store_a.confirmation_height_end ()); i != n; ++i)
+	{
+		futurehead::confirmation_height_info const & info (i->second);
+		if (info.height != 0)
+		{
+			result.push_back (entry{ i->first, info.frontier, info.height });
+		}
+	}
+	return result;
+}
+
+futurehead::block_hash futurehead::bootstrap_checkpoint::commitment (std::vector<entry> const & entries_a)
+{
+	futurehead::block_hash result;
+	blake2b_state state;
+	blake2b_init (&state, sizeof (result.bytes));
+	for (auto const & entry_l : entries_a)
+	{
+		auto height (boost::endian::native_to_big (entry_l.height));
+		blake2b_update (&state, entry_l.account.bytes.data (), entry_l.account.bytes.size ());
+		blake2b_update (&state, entry_l.frontier.bytes.data (), entry_l.frontier.bytes.size ());
+		blake2b_update (&state, &height, sizeof (height));
+	}
+	blake2b_final (&state, result.bytes.data (), sizeof (result.bytes));
+	return result;
+}
+
+bool futurehead::bootstrap_checkpoint::write (boost::filesystem::path const & path_a, std::vector<entry> const & entries_a)
+{
+	boost::filesystem::ofstream stream (path_a, std::ios::out | std::ios::trunc);
+	for (auto const & entry_l : entries_a)
+	{
+		stream << entry_l.account.to_account () << ' ' << entry_l.frontier.to_string () << ' ' << entry_l.height << '\n';
+	}
+	stream.flush ();
+	return stream.fail ();
+}
+
+bool futurehead::bootstrap_checkpoint::read (boost::filesystem::path const & path_a, futurehead::block_hash const & commitment_a, std::vector<entry> & entries_a)
+{
+	boost::filesystem::ifstream stream (path_a);
+	auto error (!stream.is_open ());
+	std::string line;
+	while (!error && std::getline (stream, line))
+	{
+		if (!line.empty ())
+		{
+			std::istringstream line_stream (line);
+			std::string account_text;
+			std::string frontier_text;
+			entry entry_l;
+			error = !(line_stream >> account_text >> frontier_text >> entry_l.height) || entry_l.account.decode_account (account_text) || entry_l.frontier.decode_hex (frontier_text);
+			if (!error)
+			{
+				entries_a.push_back (entry_l);
+			}
+		}
+	}
+	error = error || stream.bad () || commitment (entries_a) != commitment_a;
+	if (error)
+	{
+		entries_a.clear ();
+	}
+	return error;
+}
+
+size_t futurehead::bootstrap_checkpoint::trust (std::vector<entry> const & entries_a)
+{
+	futurehead::lock_guard<std::mutex> lock (mutex);
+	for (auto const & entry_l : entries_a)
+	{
+		hashes.insert (entry_l.frontier);
+	}
+	return hashes.size ();
+}
+
+bool futurehead::bootstrap_checkpoint::trusted (futurehead::block const & block_a)
+{
+	auto result (false);
+	futurehead::lock_guard<std::mutex> lock (mutex);
+	if (!hashes.empty ())
+	{
+		auto existing (hashes.find (block_a.hash ()));
+		if (existing != hashes.end ())
+		{
+			result = true;
+			// Each block is only vouched for once, the set stays around the size of the checkpoint
+			hashes.erase (existing);
+			auto previous (block_a.previous ());
+			if (!previous.is_zero ())
+			{
+				hashes.insert (previous);
+			}
+		}
+	}
+	return result;
+}
+
+size_t futurehead::bootstrap_checkpoint::size ()
+{
+	futurehead::lock_guard<std::mutex> lock (mutex);
+	return hashes.size ();
+}
+
+std::unique_ptr<futurehead::container_info_component> futurehead::collect_container_info (bootstrap_checkpoint & checkpoint, const std::string & name)
+{
+	auto composite = std::make_unique<container_info_composite> (name);
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "hashes", checkpoint.size (), sizeof (decltype (checkpoint.hashes)::value_type) }));
+	return composite;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <futurehead/lib/numbers.hpp>
+
+#include <boost/filesystem/path.hpp>
+
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace futurehead
+{
+class block;
+class block_store;
+class container_info_component;
+class ledger;
+class transaction;
+
+/**
+ * Trusted account frontiers at a known cemented height, committed to by the hash of their contents.
+ * A block whose hash is committed to, directly or through the previous field of a committed block, cannot have been altered,
+ * so its signature does not need to be verified when it is pulled during bootstrap.
+ * The file holds one "<account> <frontier> <height>" line per account and is only loaded when it matches the commitment
+ * supplied by the operator, see node_flags::bootstrap_checkpoint.
+ */
+class bootstrap_checkpoint final
+{
+public:
+	class entry final
+	{
+	public:
+		futurehead::account account;
+		futurehead::block_hash frontier;
+		uint64_t height;
+	};
+	/** Cemented frontiers of every account in the ledger */
+	static std::vector<entry> generate (futurehead::block_store &, futurehead::transaction const &);
+	/** Blake2b hash over the account, frontier and big endian height of each entry in order */
+	static futurehead::block_hash commitment (std::vector<entry> const &);
+	/** Returns true on error */
+	static bool write (boost::filesystem::path const &, std::vector<entry> const &);
+	/** Returns true on error, which is also the case if the entries do not match \p commitment_a */
+	static bool read (boost::filesystem::path const &, futurehead::block_hash const & commitment_a, std::vector<entry> &);
+	/** Trusts the frontiers of \p entries_a, returns the number of hashes trusted */
+	size_t trust (std::vector<entry> const & entries_a);
+	/**
+	 * Returns true if \p block_a is committed to by the checkpoint. Its predecessor then becomes committed to as well,
+	 * bootstrap pulls chains from the frontier down so trust follows the order blocks arrive in
+	 */
+	bool trusted (futurehead::block const & block_a);
+	size_t size ();
+
+private:
+	std::mutex mutex;
+	std::unordered_set<futurehead::block_hash> hashes;
+
+	friend std::unique_ptr<container_info_component> collect_container_info (bootstrap_checkpoint & checkpoint, const std::string & name);
+};
+std::unique_ptr<container_info_component> collect_container_info (bootstrap_checkpoint & checkpoint, const std::string & name);
+}
@@ -12,6 +12,45 @@ constexpr double futurehead::bootstrap_limits::bootstrap_minimum_blocks_per_sec;
 constexpr double futurehead::bootstrap_limits::bootstrap_minimum_termination_time_sec;
 constexpr unsigned futurehead::bootstrap_limits::bootstrap_max_new_connections;
 constexpr unsigned futurehead::bootstrap_limits::requeued_pulls_processed_blocks_factor;
+constexpr size_t futurehead::bootstrap_limits::bootstrap_peer_rates_max;
+constexpr double futurehead::bootstrap_connection_controller::backlog_high;
+constexpr double futurehead::bootstrap_connection_controller::backlog_low;
+constexpr double futurehead::bootstrap_connection_controller::improvement;
+constexpr unsigned futurehead::bootstrap_connection_controller::reprobe_updates;
+
+unsigned futurehead::bootstrap_connection_controller::update (unsigned floor_a, unsigned ceiling_a, double rate_a, double backlog_a)
+{
+	auto target_l (target_m == 0 ? static_cast<double> (floor_a) : target_m);
+	if (backlog_a > backlog_high)
+	{
+		target_l *= 0.75;
+		best_rate = rate_a;
+		stalled = 0;
+	}
+	else if (backlog_a < backlog_low)
+	{
+		if (rate_a > best_rate * improvement)
+		{
+			// More connections still help, the network or peers are binding
+			best_rate = rate_a;
+			stalled = 0;
+			target_l += 1 + target_l / 8;
+		}
+		else if (++stalled >= reprobe_updates)
+		{
+			// Conditions may have changed since growth stopped, e.g. faster peers were found
+			best_rate = 0;
+			stalled = 0;
+		}
+	}
+	target_m = std::max<double> (std::min (floor_a, ceiling_a), std::min<double> (ceiling_a, target_l));
+	return target ();
+}
+
+unsigned futurehead::bootstrap_connection_controller::target () const
+{
+	return static_cast<unsigned> (target_m + 0.5);
+}
 
 futurehead::bootstrap_client::bootstrap_client (std::shared_ptr<futurehead::node> node_a, std::shared_ptr<futurehead::bootstrap_connections> connections_a, std::shared_ptr<futurehead::transport::channel_tcp> channel_a, std::shared_ptr<futurehead::socket> socket_a) :
 node (node_a),
@@ -148,7 +187,8 @@ std::shared_ptr<futurehead::bootstrap_client> futurehead::bootstrap_connections:
 void futurehead::bootstrap_connections::connect_client (futurehead::tcp_endpoint const & endpoint_a, bool push_front)
 {
 	++connections_count;
-	auto socket (std::make_shared<futurehead::socket> (node.shared ()));
+	// Pipelined bulk pull requests are written while earlier ones may still be in flight
+	auto socket (std::make_shared<futurehead::socket> (node.shared (), boost::none, node.flags.bootstrap_pull_pipeline > 1 ? futurehead::socket::concurrency::multi_writer : futurehead::socket::concurrency::single_writer));
 	auto this_l (shared_from_this ());
 	socket->async_connect (endpoint_a,
 	[this_l, socket, endpoint_a, push_front](boost::system::error_code const & ec) {
@@ -209,6 +249,7 @@ void futurehead::bootstrap_connections::populate_connections (bool repeat)
 {
 	double rate_sum = 0.0;
 	size_t num_pulls = 0;
+	unsigned active = 0;
 	size_t attempts_count = node.bootstrap_initiator.attempts.size ();
 	std::priority_queue<std::shared_ptr<futurehead::bootstrap_client>, std::vector<std::shared_ptr<futurehead::bootstrap_client>>, block_rate_cmp> sorted_connections;
 	std::unordered_set<futurehead::tcp_endpoint> endpoints;
@@ -230,6 +271,8 @@ void futurehead::bootstrap_connections::populate_connections (bool repeat)
 					if (client->elapsed_seconds () > futurehead::bootstrap_limits::bootstrap_connection_warmup_time_sec && client->block_count > 0)
 					{
 						sorted_connections.push (client);
+						auto & peer_rate (peer_rates[socket_l->remote_endpoint ()]);
+						peer_rate = peer_rate == 0 ? blocks_per_sec : (peer_rate + blocks_per_sec) / 2;
 					}
 					// Force-stop the slowest peers, since they can take the whole bootstrap hostage by dribbling out blocks on the last remaining pull.
 					// This is ~1.5kilobits/sec.
@@ -242,15 +285,33 @@ void futurehead::bootstrap_connections::populate_connections (bool repeat)
 
 						client->stop (true);
 						new_clients.pop_back ();
+						peer_rates.erase (socket_l->remote_endpoint ());
+					}
+					else if (!client->pending_stop)
+					{
+						++active;
 					}
 				}
 			}
 		}
 		// Cleanup expired clients
 		clients.swap (new_clients);
+		while (peer_rates.size () > futurehead::bootstrap_limits::bootstrap_peer_rates_max)
+		{
+			auto slowest (std::min_element (peer_rates.begin (), peer_rates.end (), [](auto const & lhs, auto const & rhs) { return lhs.second < rhs.second; }));
+			peer_rates.erase (slowest);
+		}
 	}
 
 	auto target = target_connections (num_pulls, attempts_count);
+	if (!node.flags.disable_bootstrap_adaptive_connections)
+	{
+		auto floor (std::max (1U, node.config.bootstrap_connections * static_cast<unsigned> (attempts_count)));
+		auto backlog (static_cast<double> (node.block_processor.size ()) / std::max<size_t> (1, node.flags.block_processor_full_size));
+		futurehead::lock_guard<std::mutex> lock (mutex);
+		// Only the periodic run moves the target, runs triggered by attempts reuse it
+		target = repeat ? controller.update (floor, target, rate_sum, backlog) : std::min (target, std::max (floor, controller.target ()));
+	}
 
 	// We only want to drop slow peers when more than 2/3 are active. 2/3 because 1/2 is too aggressive, and 100% rarely happens.
 	// Probably needs more tuning.
@@ -273,22 +334,46 @@ void futurehead::bootstrap_connections::populate_connections (bool repeat)
 				node.logger.try_log (boost::str (boost::format ("Dropping peer with block rate %1%, block count %2% (%3%) ") % client->block_rate () % client->block_count % client->channel->to_string ()));
 			}
 
+			if (!client->pending_stop)
+			{
+				--active;
+			}
 			client->stop (false);
 			sorted_connections.pop ();
 		}
 	}
+	// Shed the slowest connections when the adaptive target was lowered, stopping connections finish their current pull first
+	while (!node.flags.disable_bootstrap_adaptive_connections && active > target && !sorted_connections.empty ())
+	{
+		auto client (sorted_connections.top ());
+		sorted_connections.pop ();
+		if (!client->pending_stop)
+		{
+			client->stop (false);
+			--active;
+		}
+	}
 
 	if (node.config.logging.bulk_pull_logging ())
 	{
-		node.logger.try_log (boost::str (boost::format ("Bulk pull connections: %1%, rate: %2% blocks/sec, bootstrap attempts %3%, remaining pulls: %4%") % connections_count.load () % (int)rate_sum % attempts_count % num_pulls));
+		node.logger.try_log (boost::str (boost::format ("Bulk pull connections: %1%, target: %2%, rate: %3% blocks/sec, bootstrap attempts %4%, remaining pulls: %5%") % connections_count.load () % target % (int)rate_sum % attempts_count % num_pulls));
 	}
 
 	if (connections_count < target && (attempts_count != 0 || new_connections_empty) && !stopped)
 	{
 		auto delta = std::min ((target - connections_count) * 2, futurehead::bootstrap_limits::bootstrap_max_new_connections);
+		// Half of the new connections go to peers which were fast before, the others explore
+		auto preferred (preferred_peers (endpoints, delta / 2));
+		for (auto const & endpoint : preferred)
+		{
+			connect_client (endpoint);
+			endpoints.insert (endpoint);
+			futurehead::lock_guard<std::mutex> lock (mutex);
+			new_connections_empty = false;
+		}
 		// TODO - tune this better
 		// Not many peers respond, need to try to make more connections than we need.
-		for (auto i = 0u; i < delta; i++)
+		for (auto i = static_cast<unsigned> (preferred.size ()); i < delta; i++)
 		{
 			auto endpoint (node.network.bootstrap_peer (true));
 			if (endpoint != futurehead::tcp_endpoint (boost::asio::ip::address_v6::any (), 0) && (node.flags.allow_bootstrap_peers_duplicates || endpoints.find (endpoint) == endpoints.end ()) && !node.network.excluded_peers.check (endpoint))
@@ -328,6 +413,32 @@ void futurehead::bootstrap_connections::start_populate_connections ()
 	}
 }
 
+std::vector<futurehead::tcp_endpoint> futurehead::bootstrap_connections::preferred_peers (std::unordered_set<futurehead::tcp_endpoint> const & exclude_a, size_t count_a)
+{
+	std::vector<std::pair<futurehead::tcp_endpoint, double>> candidates;
+	{
+		futurehead::lock_guard<std::mutex> lock (mutex);
+		for (auto const & peer : peer_rates)
+		{
+			if (peer.second >= futurehead::bootstrap_limits::bootstrap_minimum_blocks_per_sec && exclude_a.find (peer.first) == exclude_a.end ())
+			{
+				candidates.push_back (peer);
+			}
+		}
+	}
+	auto count_l (std::min (count_a, candidates.size ()));
+	std::partial_sort (candidates.begin (), candidates.begin () + count_l, candidates.end (), [](auto const & lhs, auto const & rhs) { return lhs.second > rhs.second; });
+	std::vector<futurehead::tcp_endpoint> result;
+	for (auto i (candidates.begin ()), n (candidates.begin () + count_l); i != n; ++i)
+	{
+		if (!node.network.excluded_peers.check (i->first))
+		{
+			result.push_back (i->first);
+		}
+	}
+	return result;
+}
+
 void futurehead::bootstrap_connections::add_pull (futurehead::pull_info const & pull_a)
 {
 	futurehead::pull_info pull (pull_a);
@@ -346,32 +457,38 @@ void futurehead::bootstrap_connections::request_pull (futurehead::unique_lock<st
 	lock_a.lock ();
 	if (connection_l != nullptr && !pulls.empty ())
 	{
-		std::shared_ptr<futurehead::bootstrap_attempt> attempt_l;
 		futurehead::pull_info pull;
-		// Search pulls with existing attempts
-		while (attempt_l == nullptr && !pulls.empty ())
-		{
-			pull = pulls.front ();
-			pulls.pop_front ();
-			attempt_l = node.bootstrap_initiator.attempts.find (pull.bootstrap_id);
-			// Check if lazy pull is obsolete (head was processed or head is 0 for destinations requests)
-			if (attempt_l != nullptr && attempt_l->mode == futurehead::bootstrap_mode::lazy && !pull.head.is_zero () && attempt_l->lazy_processed_or_exists (pull.head))
-			{
-				attempt_l->pull_finished ();
-				attempt_l = nullptr;
-			}
-		}
+		auto attempt_l (next_pull (pull));
 		if (attempt_l != nullptr)
 		{
-			if (attempt_l->mode == futurehead::bootstrap_mode::legacy)
+			// Further pulls are requested on the same connection right away, their responses follow in request order
+			std::vector<std::pair<futurehead::pull_info, std::shared_ptr<futurehead::bootstrap_attempt>>> pipelined;
+			for (auto i (1u); i < node.flags.bootstrap_pull_pipeline && attempt_l->mode == futurehead::bootstrap_mode::legacy && !pulls.empty (); ++i)
 			{
-				attempt_l->add_recent_pull (pull.head);
+				futurehead::pull_info pipelined_pull;
+				auto pipelined_attempt (next_pipelined_pull (pipelined_pull));
+				if (pipelined_attempt == nullptr)
+				{
+					break;
+				}
+				pipelined.emplace_back (pipelined_pull, pipelined_attempt);
 			}
 			// The bulk_pull_client destructor attempt to requeue_pull which can cause a deadlock if this is the last reference
 			// Dispatch request in an external thread in case it needs to be destroyed
-			node.background ([connection_l, attempt_l, pull]() {
+			node.background ([connection_l, attempt_l, pull, pipelined]() {
 				auto client (std::make_shared<futurehead::bulk_pull_client> (connection_l, attempt_l, pull));
+				auto tail (client);
+				for (auto const & item : pipelined)
+				{
+					tail->next = std::make_shared<futurehead::bulk_pull_client> (connection_l, item.second, item.first);
+					tail = tail->next;
+				}
+				futurehead::lock_guard<std::mutex> guard (connection_l->pipeline_mutex);
 				client->request ();
+				for (auto i (client->next); i != nullptr; i = i->next)
+				{
+					i->request (false);
+				}
 			});
 		}
 	}
@@ -384,6 +501,66 @@ void futurehead::bootstrap_connections::request_pull (futurehead::unique_lock<st
 	}
 }
 
+std::shared_ptr<futurehead::bootstrap_attempt> futurehead::bootstrap_connections::next_pull (futurehead::pull_info & pull_a)
+{
+	std::shared_ptr<futurehead::bootstrap_attempt> result;
+	// Search pulls with existing attempts
+	while (result == nullptr && !pulls.empty ())
+	{
+		pull_a = pulls.front ();
+		pulls.pop_front ();
+		result = node.bootstrap_initiator.attempts.find (pull_a.bootstrap_id);
+		// Check if lazy pull is obsolete (head was processed or head is 0 for destinations requests)
+		if (result != nullptr && result->mode == futurehead::bootstrap_mode::lazy && !pull_a.head.is_zero () && result->lazy_processed_or_exists (pull_a.head))
+		{
+			result->pull_finished ();
+			result = nullptr;
+		}
+	}
+	if (result != nullptr && result->mode == futurehead::bootstrap_mode::legacy)
+	{
+		result->add_recent_pull (pull_a.head);
+	}
+	return result;
+}
+
+std::shared_ptr<futurehead::bootstrap_attempt> futurehead::bootstrap_connections::next_pipelined_pull (futurehead::pull_info & pull_a)
+{
+	auto result (next_pull (pull_a));
+	if (result != nullptr && result->mode != futurehead::bootstrap_mode::legacy)
+	{
+		// Lazy pulls stop reading their response early, which would leave the responses to the pulls behind them unreadable
+		pulls.push_front (pull_a);
+		result = nullptr;
+	}
+	return result;
+}
+
+void futurehead::bootstrap_connections::pipeline_pull (std::shared_ptr<futurehead::bulk_pull_client> const & head_a)
+{
+	futurehead::pull_info pull;
+	std::shared_ptr<futurehead::bootstrap_attempt> attempt_l;
+	{
+		futurehead::lock_guard<std::mutex> lock (mutex);
+		if (!stopped)
+		{
+			attempt_l = next_pipelined_pull (pull);
+		}
+	}
+	if (attempt_l != nullptr)
+	{
+		auto client (std::make_shared<futurehead::bulk_pull_client> (head_a->connection, attempt_l, pull));
+		futurehead::lock_guard<std::mutex> guard (head_a->connection->pipeline_mutex);
+		auto tail (head_a);
+		while (tail->next != nullptr)
+		{
+			tail = tail->next;
+		}
+		tail->next = client;
+		client->request (false);
+	}
+}
+
 void futurehead::bootstrap_connections::requeue_pull (futurehead::pull_info const & pull_a, bool network_error)
 {
 	auto pull (pull_a);
@@ -4,6 +4,8 @@
 #include <futurehead/node/socket.hpp>
 
 #include <atomic>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace futurehead
 {
@@ -15,6 +17,7 @@ namespace transport
 
 class bootstrap_attempt;
 class bootstrap_connections;
+class bulk_pull_client;
 class frontier_req_client;
 class pull_info;
 class bootstrap_client final : public std::enable_shared_from_this<bootstrap_client>
@@ -35,12 +38,42 @@ public:
 	std::atomic<uint64_t> block_count{ 0 };
 	std::atomic<bool> pending_stop{ false };
 	std::atomic<bool> hard_stop{ false };
+	/** Serializes sending pipelined bulk pull requests with linking their clients, so responses arrive in the order the clients are chained */
+	std::mutex pipeline_mutex;
 
 private:
 	mutable std::mutex start_time_mutex;
 	std::chrono::steady_clock::time_point start_time_m;
 };
 
+/**
+ * Sizes the bootstrap connection pool from measured throughput.
+ * While the block processor keeps up, the target grows as long as the aggregate block rate still improves with more connections, then holds
+ * at that level and probes again from time to time. Once the block processor queue fills up verification or disk is the binding resource,
+ * and the target shrinks multiplicatively so connections do not keep filling the queue.
+ * Not thread safe, access is serialized by the bootstrap_connections mutex
+ */
+class bootstrap_connection_controller final
+{
+public:
+	/** Adjusts the target from the aggregate block rate and the filled ratio of the block processor queue, clamped to [ \p floor_a, \p ceiling_a ] */
+	unsigned update (unsigned floor_a, unsigned ceiling_a, double rate_a, double backlog_a);
+	unsigned target () const;
+	/** Queue ratio above which connections are reduced */
+	static double constexpr backlog_high{ 0.5 };
+	/** Queue ratio below which connections may be added */
+	static double constexpr backlog_low{ 0.25 };
+	/** Relative improvement of the block rate for growth to continue */
+	static double constexpr improvement{ 1.05 };
+	/** Updates without improvement before the best rate is forgotten and growth is probed again */
+	static unsigned constexpr reprobe_updates{ 60 };
+
+private:
+	double target_m{ 0 };
+	double best_rate{ 0 };
+	unsigned stalled{ 0 };
+};
+
 class bootstrap_connections final : public std::enable_shared_from_this<bootstrap_connections>
 {
 public:
@@ -53,9 +86,17 @@ public:
 	void connect_client (futurehead::tcp_endpoint const & endpoint_a, bool push_front = false);
 	unsigned target_connections (size_t pulls_remaining, size_t attempts_count);
 	void populate_connections (bool repeat = true);
+	/** Previously measured peers not in \p exclude_a, fastest first, up to \p count_a */
+	std::vector<futurehead::tcp_endpoint> preferred_peers (std::unordered_set<futurehead::tcp_endpoint> const & exclude_a, size_t count_a);
 	void start_populate_connections ();
 	void add_pull (futurehead::pull_info const & pull_a);
 	void request_pull (futurehead::unique_lock<std::mutex> & lock_a);
+	/** Pops the first queued pull whose attempt is still running and returns that attempt, nullptr if no such pull is left. Requires the mutex */
+	std::shared_ptr<futurehead::bootstrap_attempt> next_pull (futurehead::pull_info &);
+	/** As next_pull, but only for legacy pulls. A lazy pull at the front is left queued and nullptr is returned. Requires the mutex */
+	std::shared_ptr<futurehead::bootstrap_attempt> next_pipelined_pull (futurehead::pull_info &);
+	/** Requests the next queued pull on the connection of \p head_a, behind the pulls already chained to it */
+	void pipeline_pull (std::shared_ptr<futurehead::bulk_pull_client> const & head_a);
 	void requeue_pull (futurehead::pull_info const & pull_a, bool network_error = false);
 	void clear_pulls (uint64_t);
 	void run ();
@@ -70,5 +111,8 @@ public:
 	std::atomic<bool> stopped{ false };
 	std::mutex mutex;
 	futurehead::condition_variable condition;
+	futurehead::bootstrap_connection_controller controller;
+	/** Smoothed block rate of peers measured by earlier connections, kept across bootstrap attempts */
+	std::unordered_map<futurehead::tcp_endpoint, double> peer_rates;
 };
 }
@@ -15,7 +15,7 @@ constexpr size_t futurehead::frontier_req_client::size_frontier;
 void futurehead::frontier_req_client::run ()
 {
 	futurehead::frontier_req request;
-	request.start.clear ();
+	request.start = start;
 	request.age = std::numeric_limits<decltype (request.age)>::max ();
 	request.count = std::numeric_limits<decltype (request.count)>::max ();
 	auto this_l (shared_from_this ());
@@ -36,10 +36,12 @@ void futurehead::frontier_req_client::run ()
 	futurehead::buffer_drop_policy::no_limiter_drop);
 }
 
-futurehead::frontier_req_client::frontier_req_client (std::shared_ptr<futurehead::bootstrap_client> connection_a, std::shared_ptr<futurehead::bootstrap_attempt> attempt_a) :
+futurehead::frontier_req_client::frontier_req_client (std::shared_ptr<futurehead::bootstrap_client> connection_a, std::shared_ptr<futurehead::bootstrap_attempt> attempt_a, futurehead::account const & start_a, futurehead::account const & end_a) :
 connection (connection_a),
 attempt (attempt_a),
-current (0),
+start (start_a),
+end (end_a),
+current (start_a.is_zero () ? 0 : start_a.number () - 1),
 count (0),
 bulk_push_cost (0)
 {
@@ -123,7 +125,8 @@ void futurehead::frontier_req_client::received_frontier (boost::system::error_co
 		{
 			connection->node->logger.always_log (boost::str (boost::format ("Received %1% frontiers from %2%") % std::to_string (count) % connection->channel->to_string ()));
 		}
-		if (!account.is_zero ())
+		// The peer keeps streaming past the end of the requested range, which finishes it the same way as the end of its accounts
+		if (!account.is_zero () && (end.is_zero () || account < end))
 		{
 			while (!current.is_zero () && current < account)
 			{
@@ -188,6 +191,11 @@ void futurehead::frontier_req_client::received_frontier (boost::system::error_co
 				catch (std::future_error &)
 				{
 				}
+				if (!account.is_zero ())
+				{
+					// The rest of the stream is not read, the connection cannot be reused
+					connection->stop (true);
+				}
 				connection->connections->pool_connection (connection);
 			}
 		}
@@ -226,6 +234,12 @@ void futurehead::frontier_req_client::next ()
 	current = account_pair.first;
 	frontier = account_pair.second;
 	accounts.pop_front ();
+	if (!end.is_zero () && !current.is_zero () && !(current < end))
+	{
+		current.clear ();
+		frontier.clear ();
+		accounts.clear ();
+	}
 }
 
 futurehead::frontier_req_server::frontier_req_server (std::shared_ptr<futurehead::bootstrap_server> const & connection_a, std::unique_ptr<futurehead::frontier_req> request_a) :
@@ -233,7 +247,9 @@ connection (connection_a),
 current (request_a->start.number () - 1),
 frontier (0),
 request (std::move (request_a)),
-count (0)
+count (0),
+batch_size (std::max<size_t> (connection_a->node->flags.frontier_req_batch_size, 1)),
+start_time (std::chrono::steady_clock::now ())
 {
 	next ();
 }
@@ -242,18 +258,25 @@ void futurehead::frontier_req_server::send_next ()
 {
 	if (!current.is_zero () && count < request->count)
 	{
+		// Pack as many frontier pairs as allowed into a single write, the client reads them as a byte stream
 		std::vector<uint8_t> send_buffer;
+		send_buffer.reserve (std::min<size_t> (batch_size, request->count - count) * futurehead::frontier_req_client::size_frontier);
 		{
 			futurehead::vectorstream stream (send_buffer);
-			write (stream, current.bytes);
-			write (stream, frontier.bytes);
+			size_t pairs (0);
+			do
+			{
+				write (stream, current.bytes);
+				write (stream, frontier.bytes);
+				if (connection->node->config.logging.bulk_pull_logging ())
+				{
+					connection->node->logger.try_log (boost::str (boost::format ("Sending frontier for %1% %2%") % current.to_account () % frontier.to_string ()));
+				}
+				++pairs;
+				next ();
+			} while (!current.is_zero () && pairs < batch_size && count + pairs < request->count);
 		}
 		auto this_l (shared_from_this ());
-		if (connection->node->config.logging.bulk_pull_logging ())
-		{
-			connection->node->logger.try_log (boost::str (boost::format ("Sending frontier for %1% %2%") % current.to_account () % frontier.to_string ()));
-		}
-		next ();
 		connection->socket->async_write (futurehead::shared_const_buffer (std::move (send_buffer)), [this_l](boost::system::error_code const & ec, size_t size_a) {
 			this_l->sent_action (ec, size_a);
 		});
@@ -276,7 +299,7 @@ void futurehead::frontier_req_server::send_finished ()
 	auto this_l (shared_from_this ());
 	if (connection->node->config.logging.network_logging ())
 	{
-		connection->node->logger.try_log ("Frontier sending finished");
+		connection->node->logger.try_log (boost::str (boost::format ("Frontier sending finished, sent %1% frontiers at %2% frontiers/sec") % count % static_cast<uint64_t> (frontiers_per_second ())));
 	}
 	connection->socket->async_write (futurehead::shared_const_buffer (std::move (send_buffer)), [this_l](boost::system::error_code const & ec, size_t size_a) {
 		this_l->no_block_sent (ec, size_a);
@@ -302,7 +325,9 @@ void futurehead::frontier_req_server::sent_action (boost::system::error_code con
 {
 	if (!ec)
 	{
-		count++;
+		auto sent (size_a / futurehead::frontier_req_client::size_frontier);
+		count += sent;
+		connection->node->stats.add (futurehead::stat::type::bootstrap, futurehead::stat::detail::frontier_sent, futurehead::stat::dir::out, sent);
 		send_next ();
 	}
 	else
@@ -321,7 +346,8 @@ void futurehead::frontier_req_server::next ()
 	{
 		auto now (futurehead::seconds_since_epoch ());
 		bool skip_old (request->age != std::numeric_limits<decltype (request->age)>::max ());
-		size_t max_size (128);
+		// A whole batch is read with a single cursor, the transaction is not held while waiting on the peer
+		size_t max_size (std::max<size_t> (batch_size, 128));
 		auto transaction (connection->node->store.tx_begin_read ());
 		for (auto i (connection->node->store.latest_begin (transaction, current.number () + 1)), n (connection->node->store.latest_end ()); i != n && accounts.size () != max_size; ++i)
 		{
@@ -345,3 +371,9 @@ void futurehead::frontier_req_server::next ()
 	frontier = account_pair.second;
 	accounts.pop_front ();
 }
+
+double futurehead::frontier_req_server::frontiers_per_second () const
+{
+	auto elapsed (std::chrono::duration_cast<std::chrono::duration<double>> (std::chrono::steady_clock::now () - start_time));
+	return elapsed.count () > 0 ? count / elapsed.count () : 0.;
+}
@@ -12,7 +12,8 @@ class bootstrap_client;
 class frontier_req_client final : public std::enable_shared_from_this<futurehead::frontier_req_client>
 {
 public:
-	explicit frontier_req_client (std::shared_ptr<futurehead::bootstrap_client>, std::shared_ptr<futurehead::bootstrap_attempt>);
+	/** Requests the frontiers of accounts in [start_a, end_a), a zero end_a is the end of the account space */
+	explicit frontier_req_client (std::shared_ptr<futurehead::bootstrap_client>, std::shared_ptr<futurehead::bootstrap_attempt>, futurehead::account const & start_a = futurehead::account (0), futurehead::account const & end_a = futurehead::account (0));
 	~frontier_req_client ();
 	void run ();
 	void receive_frontier ();
@@ -21,6 +22,8 @@ public:
 	void next ();
 	std::shared_ptr<futurehead::bootstrap_client> connection;
 	std::shared_ptr<futurehead::bootstrap_attempt> attempt;
+	futurehead::account const start;
+	futurehead::account const end;
 	futurehead::account current;
 	futurehead::block_hash frontier;
 	unsigned count;
@@ -44,11 +47,16 @@ public:
 	void send_finished ();
 	void no_block_sent (boost::system::error_code const &, size_t);
 	void next ();
+	/** Frontiers sent per second since the request started */
+	double frontiers_per_second () const;
 	std::shared_ptr<futurehead::bootstrap_server> connection;
 	futurehead::account current;
 	futurehead::block_hash frontier;
 	std::unique_ptr<futurehead::frontier_req> request;
 	size_t count;
 	std::deque<std::pair<futurehead::account, futurehead::block_hash>> accounts;
+	/** Frontiers packed into each write and read per transaction, see node_flags::frontier_req_batch_size */
+	size_t const batch_size;
+	std::chrono::steady_clock::time_point const start_time;
 };
 }
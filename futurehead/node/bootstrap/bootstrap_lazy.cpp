@@ -7,15 +7,18 @@
 #include <boost/format.hpp>
 
 #include <algorithm>
+#include <tuple>
 
 constexpr std::chrono::seconds futurehead::bootstrap_limits::lazy_flush_delay_sec;
 constexpr unsigned futurehead::bootstrap_limits::lazy_destinations_request_limit;
 constexpr uint64_t futurehead::bootstrap_limits::lazy_batch_pull_count_resize_blocks_limit;
 constexpr double futurehead::bootstrap_limits::lazy_batch_pull_count_resize_ratio;
 constexpr size_t futurehead::bootstrap_limits::lazy_blocks_restart_limit;
+constexpr size_t futurehead::bootstrap_limits::lazy_state_backlog_memory_max;
 
 futurehead::bootstrap_attempt_lazy::bootstrap_attempt_lazy (std::shared_ptr<futurehead::node> node_a, uint64_t incremental_id_a, std::string id_a) :
-futurehead::bootstrap_attempt (node_a, futurehead::bootstrap_mode::lazy, incremental_id_a, id_a)
+futurehead::bootstrap_attempt (node_a, futurehead::bootstrap_mode::lazy, incremental_id_a, id_a),
+lazy_state_backlog (futurehead::lazy_state_backlog::spill_path_unique (node_a->application_path), futurehead::bootstrap_limits::lazy_state_backlog_memory_max)
 {
 	node->bootstrap_initiator.notify_listeners (true);
 }
@@ -199,7 +202,7 @@ void futurehead::bootstrap_attempt_lazy::run ()
 			// Start backlog cleanup
 			if (iterations % 100 == 0)
 			{
-				lazy_backlog_cleanup ();
+				lazy_backlog_cleanup (lock);
 			}
 			// Destinations check
 			if (pulling == 0 && lazy_destinations_flushed)
@@ -213,7 +216,7 @@ void futurehead::bootstrap_attempt_lazy::run ()
 		// Check if some blocks required for backlog were processed. Start destinations check
 		if (pulling == 0)
 		{
-			lazy_backlog_cleanup ();
+			lazy_backlog_cleanup (lock, true);
 			lazy_destinations_flush ();
 			lazy_pull_flush (lock);
 		}
@@ -271,17 +274,17 @@ bool futurehead::bootstrap_attempt_lazy::process_block_lazy (std::shared_ptr<fut
 		// Adding lazy balances for first processed block in pull
 		if (pull_blocks == 0 && (block_a->type () == futurehead::block_type::state || block_a->type () == futurehead::block_type::send))
 		{
-			lazy_balances.emplace (hash, block_a->balance ().number ());
+			lazy_balances.insert (hash, block_a->balance ().number ());
 		}
 		// Clearing lazy balances for previous block
-		if (!block_a->previous ().is_zero () && lazy_balances.find (block_a->previous ()) != lazy_balances.end ())
+		if (!block_a->previous ().is_zero ())
 		{
 			lazy_balances.erase (block_a->previous ());
 		}
 		lazy_block_state_backlog_check (block_a, hash);
 		lock.unlock ();
 		futurehead::unchecked_info info (block_a, known_account_a, 0, futurehead::signature_verification::unknown, retry_limit == std::numeric_limits<unsigned>::max ());
-		node->block_processor.add (info);
+		node->block_processor.add_bootstrap (info);
 	}
 	// Force drop lazy bootstrap connection for long bulk_pull
 	if (pull_blocks > max_blocks)
@@ -324,9 +327,9 @@ void futurehead::bootstrap_attempt_lazy::lazy_block_state (std::shared_ptr<futur
 			else if (lazy_blocks_processed (previous))
 			{
 				auto previous_balance (lazy_balances.find (previous));
-				if (previous_balance != lazy_balances.end ())
+				if (previous_balance != nullptr)
 				{
-					if (previous_balance->second <= balance)
+					if (*previous_balance <= balance)
 					{
 						lazy_add (link, retry_limit);
 					}
@@ -334,13 +337,13 @@ void futurehead::bootstrap_attempt_lazy::lazy_block_state (std::shared_ptr<futur
 					{
 						lazy_destinations_increment (link);
 					}
-					lazy_balances.erase (previous_balance);
+					lazy_balances.erase (previous);
 				}
 			}
 			// Insert in backlog state blocks if previous wasn't already processed
 			else
 			{
-				lazy_state_backlog.emplace (previous, futurehead::lazy_state_backlog_item{ link, balance, retry_limit });
+				lazy_state_backlog.insert (previous, futurehead::lazy_state_backlog_item{ link, balance, retry_limit });
 			}
 		}
 	}
@@ -349,42 +352,43 @@ void futurehead::bootstrap_attempt_lazy::lazy_block_state (std::shared_ptr<futur
 void futurehead::bootstrap_attempt_lazy::lazy_block_state_backlog_check (std::shared_ptr<futurehead::block> block_a, futurehead::block_hash const & hash_a)
 {
 	// Search unknown state blocks balances
-	auto find_state (lazy_state_backlog.find (hash_a));
-	if (find_state != lazy_state_backlog.end ())
+	auto next_block (lazy_state_backlog.take (hash_a));
+	if (next_block)
 	{
-		auto next_block (find_state->second);
 		// Retrieve balance for previous state & send blocks
 		if (block_a->type () == futurehead::block_type::state || block_a->type () == futurehead::block_type::send)
 		{
-			if (block_a->balance ().number () <= next_block.balance) // balance
+			if (block_a->balance ().number () <= next_block->balance) // balance
 			{
-				lazy_add (next_block.link, next_block.retry_limit); // link
+				lazy_add (next_block->link, next_block->retry_limit); // link
 			}
 			else
 			{
-				lazy_destinations_increment (next_block.link);
+				lazy_destinations_increment (next_block->link);
 			}
 		}
 		// Assumption for other legacy block types
-		else if (lazy_undefined_links.find (next_block.link) == lazy_undefined_links.end ())
+		else if (lazy_undefined_links.insert (next_block->link.raw, true).second)
 		{
-			lazy_add (next_block.link, node->network_params.bootstrap.lazy_retry_limit); // Head is not confirmed. It can be account or hash or non-existing
-			lazy_undefined_links.insert (next_block.link);
+			lazy_add (next_block->link, node->network_params.bootstrap.lazy_retry_limit); // Head is not confirmed. It can be account or hash or non-existing
 		}
-		lazy_state_backlog.erase (find_state);
 	}
 }
 
-void futurehead::bootstrap_attempt_lazy::lazy_backlog_cleanup ()
+void futurehead::bootstrap_attempt_lazy::lazy_backlog_cleanup (futurehead::unique_lock<std::mutex> & lock_a, bool full_a)
 {
+	debug_assert (lock_a.owns_lock ());
 	uint64_t read_count (0);
 	auto transaction (node->store.tx_begin_read ());
-	for (auto it (lazy_state_backlog.begin ()), end (lazy_state_backlog.end ()); it != end && !stopped;)
-	{
-		if (node->store.block_exists (transaction, it->first))
+	lazy_state_backlog.cleanup ([this, &read_count, &transaction](futurehead::block_hash const & previous_a, futurehead::lazy_state_backlog_item const & next_block) {
+		auto resolved (false);
+		if (stopped)
 		{
-			auto next_block (it->second);
-			if (node->ledger.balance (transaction, it->first) <= next_block.balance) // balance
+			// Keep remaining entries untouched
+		}
+		else if (node->store.block_exists (transaction, previous_a))
+		{
+			if (node->ledger.balance (transaction, previous_a) <= next_block.balance) // balance
 			{
 				lazy_add (next_block.link, next_block.retry_limit); // link
 			}
@@ -392,12 +396,11 @@ void futurehead::bootstrap_attempt_lazy::lazy_backlog_cleanup ()
 			{
 				lazy_destinations_increment (next_block.link);
 			}
-			it = lazy_state_backlog.erase (it);
+			resolved = true;
 		}
 		else
 		{
-			lazy_add (it->first, it->second.retry_limit);
-			++it;
+			lazy_add (previous_a, next_block.retry_limit);
 		}
 		// We don't want to open read transactions for too long
 		++read_count;
@@ -405,6 +408,57 @@ void futurehead::bootstrap_attempt_lazy::lazy_backlog_cleanup ()
 		{
 			transaction.refresh ();
 		}
+		return resolved;
+	});
+	boost::filesystem::path spill_file;
+	if (lazy_state_backlog.spill_detach (full_a, spill_file))
+	{
+		boost::filesystem::ifstream input (spill_file, std::ios::in | std::ios::binary);
+		std::vector<std::tuple<futurehead::block_hash, futurehead::lazy_state_backlog_item, boost::optional<bool>>> entries;
+		auto more (true);
+		while (more && !stopped)
+		{
+			// The file and the ledger are read without the mutex, which is only taken to apply each batch
+			entries.clear ();
+			lock_a.unlock ();
+			futurehead::block_hash previous;
+			futurehead::lazy_state_backlog_item next_block;
+			while (entries.size () < batch_read_size && (more = futurehead::lazy_state_backlog::spill_read (input, previous, next_block)))
+			{
+				boost::optional<bool> is_source;
+				if (node->store.block_exists (transaction, previous))
+				{
+					is_source = node->ledger.balance (transaction, previous) <= next_block.balance;
+				}
+				entries.emplace_back (previous, next_block, is_source);
+			}
+			transaction.refresh ();
+			lock_a.lock ();
+			for (auto const & entry : entries)
+			{
+				auto const & next_block (std::get<1> (entry));
+				auto const & is_source (std::get<2> (entry));
+				if (!is_source)
+				{
+					// Only entries moved back in memory are requested again, the others wait for the next pass over the file
+					if (lazy_state_backlog.insert (std::get<0> (entry), next_block))
+					{
+						lazy_add (std::get<0> (entry), next_block.retry_limit);
+					}
+				}
+				else if (*is_source)
+				{
+					lazy_add (next_block.link, next_block.retry_limit);
+				}
+				else
+				{
+					lazy_destinations_increment (next_block.link);
+				}
+			}
+		}
+		input.close ();
+		boost::system::error_code ec;
+		boost::filesystem::remove (spill_file, ec);
 	}
 }
 
@@ -414,16 +468,10 @@ void futurehead::bootstrap_attempt_lazy::lazy_destinations_increment (futurehead
 	if (node->flags.disable_legacy_bootstrap)
 	{
 		// Update accounts counter for send blocks
-		auto existing (lazy_destinations.get<account_tag> ().find (destination_a));
-		if (existing != lazy_destinations.get<account_tag> ().end ())
-		{
-			lazy_destinations.get<account_tag> ().modify (existing, [](futurehead::lazy_destinations_item & item_a) {
-				++item_a.count;
-			});
-		}
-		else
+		auto inserted (lazy_destinations.insert (destination_a, futurehead::lazy_destinations_item{ destination_a, 1 }));
+		if (!inserted.second)
 		{
-			lazy_destinations.emplace (futurehead::lazy_destinations_item{ destination_a, 1 });
+			++inserted.first->count;
 		}
 	}
 }
@@ -432,19 +480,27 @@ void futurehead::bootstrap_attempt_lazy::lazy_destinations_flush ()
 {
 	debug_assert (!mutex.try_lock ());
 	lazy_destinations_flushed = true;
-	size_t count (0);
-	for (auto it (lazy_destinations.get<count_tag> ().begin ()), end (lazy_destinations.get<count_tag> ().end ()); it != end && count < futurehead::bootstrap_limits::lazy_destinations_request_limit && !stopped;)
+	// Most frequent destinations first, ties broken by account to keep the order deterministic
+	std::vector<futurehead::lazy_destinations_item> destinations;
+	destinations.reserve (lazy_destinations.size ());
+	lazy_destinations.for_each ([&destinations](futurehead::lazy_destinations_item const & item_a) {
+		destinations.push_back (item_a);
+	});
+	auto limit (std::min<size_t> (destinations.size (), futurehead::bootstrap_limits::lazy_destinations_request_limit));
+	std::partial_sort (destinations.begin (), destinations.begin () + limit, destinations.end (), [](futurehead::lazy_destinations_item const & lhs, futurehead::lazy_destinations_item const & rhs) {
+		return lhs.count > rhs.count || (lhs.count == rhs.count && lhs.account < rhs.account);
+	});
+	for (auto i (destinations.begin ()), n (destinations.begin () + limit); i != n && !stopped; ++i)
 	{
-		lazy_add (it->account, node->network_params.bootstrap.lazy_destinations_retry_limit);
-		it = lazy_destinations.get<count_tag> ().erase (it);
-		++count;
+		lazy_add (i->account, node->network_params.bootstrap.lazy_destinations_retry_limit);
+		lazy_destinations.erase (i->account);
 	}
 }
 
 void futurehead::bootstrap_attempt_lazy::lazy_blocks_insert (futurehead::block_hash const & hash_a)
 {
 	debug_assert (!mutex.try_lock ());
-	auto inserted (lazy_blocks.insert (std::hash<::futurehead::block_hash> () (hash_a)));
+	auto inserted (lazy_blocks.insert (hash_a, true));
 	if (inserted.second)
 	{
 		++lazy_blocks_count;
@@ -455,7 +511,7 @@ void futurehead::bootstrap_attempt_lazy::lazy_blocks_insert (futurehead::block_h
 void futurehead::bootstrap_attempt_lazy::lazy_blocks_erase (futurehead::block_hash const & hash_a)
 {
 	debug_assert (!mutex.try_lock ());
-	auto erased (lazy_blocks.erase (std::hash<::futurehead::block_hash> () (hash_a)));
+	auto erased (lazy_blocks.erase (hash_a));
 	if (erased)
 	{
 		--lazy_blocks_count;
@@ -465,7 +521,7 @@ void futurehead::bootstrap_attempt_lazy::lazy_blocks_erase (futurehead::block_ha
 
 bool futurehead::bootstrap_attempt_lazy::lazy_blocks_processed (futurehead::block_hash const & hash_a)
 {
-	return lazy_blocks.find (std::hash<::futurehead::block_hash> () (hash_a)) != lazy_blocks.end ();
+	return lazy_blocks.contains (hash_a);
 }
 
 bool futurehead::bootstrap_attempt_lazy::lazy_processed_or_exists (futurehead::block_hash const & hash_a)
@@ -492,6 +548,7 @@ void futurehead::bootstrap_attempt_lazy::get_information (boost::property_tree::
 	futurehead::lock_guard<std::mutex> lock (mutex);
 	tree_a.put ("lazy_blocks", std::to_string (lazy_blocks.size ()));
 	tree_a.put ("lazy_state_backlog", std::to_string (lazy_state_backlog.size ()));
+	tree_a.put ("lazy_state_backlog_spilled", std::to_string (lazy_state_backlog.spilled ()));
 	tree_a.put ("lazy_balances", std::to_string (lazy_balances.size ()));
 	tree_a.put ("lazy_destinations", std::to_string (lazy_destinations.size ()));
 	tree_a.put ("lazy_undefined_links", std::to_string (lazy_undefined_links.size ()));
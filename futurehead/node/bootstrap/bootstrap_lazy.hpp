@@ -2,28 +2,15 @@
 
 #include <futurehead/node/bootstrap/bootstrap_attempt.hpp>
 #include <futurehead/node/bootstrap/bootstrap_bulk_pull.hpp>
-
-#include <boost/multi_index/hashed_index.hpp>
-#include <boost/multi_index/member.hpp>
-#include <boost/multi_index/ordered_index.hpp>
-#include <boost/multi_index_container.hpp>
+#include <futurehead/node/bootstrap/bootstrap_lazy_tables.hpp>
 
 #include <atomic>
 #include <queue>
 #include <unordered_set>
 
-namespace mi = boost::multi_index;
-
 namespace futurehead
 {
 class node;
-class lazy_state_backlog_item final
-{
-public:
-	futurehead::link link{ 0 };
-	futurehead::uint128_t balance{ 0 };
-	unsigned retry_limit{ 0 };
-};
 class lazy_destinations_item final
 {
 public:
@@ -48,7 +35,8 @@ public:
 	bool process_block_lazy (std::shared_ptr<futurehead::block>, futurehead::account const &, uint64_t, futurehead::bulk_pull::count_t, unsigned);
 	void lazy_block_state (std::shared_ptr<futurehead::block>, unsigned);
 	void lazy_block_state_backlog_check (std::shared_ptr<futurehead::block>, futurehead::block_hash const &);
-	void lazy_backlog_cleanup ();
+	/** The spill file of the backlog is read with \p lock_a released */
+	void lazy_backlog_cleanup (futurehead::unique_lock<std::mutex> & lock_a, bool = false);
 	void lazy_destinations_increment (futurehead::account const &);
 	void lazy_destinations_flush ();
 	void lazy_blocks_insert (futurehead::block_hash const &);
@@ -56,29 +44,16 @@ public:
 	bool lazy_blocks_processed (futurehead::block_hash const &);
 	bool lazy_processed_or_exists (futurehead::block_hash const &) override;
 	void get_information (boost::property_tree::ptree &) override;
-	std::unordered_set<size_t> lazy_blocks;
-	std::unordered_map<futurehead::block_hash, futurehead::lazy_state_backlog_item> lazy_state_backlog;
-	std::unordered_set<futurehead::block_hash> lazy_undefined_links;
-	std::unordered_map<futurehead::block_hash, futurehead::uint128_t> lazy_balances;
+	/** Per block state is kept in flat tables and the backlog spills to disk, so lazy bootstrap can run over the whole ledger */
+	futurehead::lazy_hash_set lazy_blocks;
+	futurehead::lazy_state_backlog lazy_state_backlog;
+	futurehead::lazy_hash_set lazy_undefined_links;
+	futurehead::lazy_hash_table<futurehead::uint128_t> lazy_balances;
 	std::unordered_set<futurehead::block_hash> lazy_keys;
 	std::deque<std::pair<futurehead::hash_or_account, unsigned>> lazy_pulls;
 	std::chrono::steady_clock::time_point lazy_start_time;
-	class account_tag
-	{
-	};
-	class count_tag
-	{
-	};
-	// clang-format off
-	boost::multi_index_container<lazy_destinations_item,
-	mi::indexed_by<
-		mi::ordered_non_unique<mi::tag<count_tag>,
-			mi::member<lazy_destinations_item, uint64_t, &lazy_destinations_item::count>,
-			std::greater<uint64_t>>,
-		mi::hashed_unique<mi::tag<account_tag>,
-			mi::member<lazy_destinations_item, futurehead::account, &lazy_destinations_item::account>>>>
-	lazy_destinations;
-	// clang-format on
+	/** Send counts per destination, only the most frequent are pulled when flushed */
+	futurehead::lazy_hash_table<futurehead::lazy_destinations_item> lazy_destinations;
 	std::atomic<size_t> lazy_blocks_count{ 0 };
 	std::atomic<bool> lazy_destinations_flushed{ false };
 	/** The maximum number of records to be read in while iterating over long lazy containers */
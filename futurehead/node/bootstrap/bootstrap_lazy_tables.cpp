@@ -0,0 +1,197 @@
+#include <futurehead/node/bootstrap/bootstrap_lazy_tables.hpp>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <array>
+#include <cstring>
+
+constexpr size_t futurehead::lazy_state_backlog::filter_bits;
+
+namespace
+{
+/** previous, link, balance and retry limit */
+size_t constexpr spill_record_size{ 32 + 32 + 16 + sizeof (unsigned) };
+using spill_record = std::array<char, spill_record_size>;
+std::string const spill_prefix ("lazy_backlog_");
+}
+
+futurehead::lazy_state_backlog::lazy_state_backlog (boost::filesystem::path const & spill_path_a, size_t memory_max_a) :
+memory_max (memory_max_a),
+spill_path (spill_path_a),
+spill_next (spill_path_a)
+{
+	spill_next += ".next";
+}
+
+futurehead::lazy_state_backlog::~lazy_state_backlog ()
+{
+	if (spill_stream.is_open ())
+	{
+		spill_stream.close ();
+		boost::system::error_code ec;
+		boost::filesystem::remove (spill_path, ec);
+	}
+}
+
+bool futurehead::lazy_state_backlog::insert (futurehead::block_hash const & previous_a, futurehead::lazy_state_backlog_item const & item_a)
+{
+	auto result (memory.size () < memory_max || memory.contains (previous_a));
+	if (result)
+	{
+		memory.insert (previous_a, entry{ previous_a, item_a });
+	}
+	else
+	{
+		result = spill (entry{ previous_a, item_a });
+	}
+	return result;
+}
+
+boost::optional<futurehead::lazy_state_backlog_item> futurehead::lazy_state_backlog::take (futurehead::block_hash const & previous_a)
+{
+	boost::optional<futurehead::lazy_state_backlog_item> result;
+	auto existing (memory.find (previous_a));
+	if (existing != nullptr)
+	{
+		result = existing->item;
+		memory.erase (previous_a);
+	}
+	else if (spilled_count != 0 && filter_contains (previous_a))
+	{
+		spill_ready = true;
+	}
+	return result;
+}
+
+void futurehead::lazy_state_backlog::cleanup (std::function<bool(futurehead::block_hash const &, futurehead::lazy_state_backlog_item const &)> const & action_a)
+{
+	std::vector<futurehead::block_hash> resolved;
+	memory.for_each ([&action_a, &resolved](entry const & entry_a) {
+		if (action_a (entry_a.previous, entry_a.item))
+		{
+			resolved.push_back (entry_a.previous);
+		}
+	});
+	for (auto const & previous : resolved)
+	{
+		memory.erase (previous);
+	}
+}
+
+bool futurehead::lazy_state_backlog::spill_detach (bool full_a, boost::filesystem::path & file_a)
+{
+	auto result (spilled_count != 0 && (full_a || spill_ready));
+	if (result)
+	{
+		// Entries spilled meanwhile are written to the other file, which becomes the spill file
+		spill_stream.close ();
+		file_a = spill_path;
+		std::swap (spill_path, spill_next);
+		spilled_count = 0;
+		filter.assign (filter.size (), false);
+		spill_ready = false;
+	}
+	return result;
+}
+
+bool futurehead::lazy_state_backlog::spill_read (std::istream & input_a, futurehead::block_hash & previous_a, futurehead::lazy_state_backlog_item & item_a)
+{
+	spill_record record;
+	auto result (static_cast<bool> (input_a.read (record.data (), record.size ())));
+	if (result)
+	{
+		std::memcpy (previous_a.bytes.data (), record.data (), 32);
+		std::memcpy (item_a.link.bytes.data (), record.data () + 32, 32);
+		futurehead::amount balance;
+		std::memcpy (balance.bytes.data (), record.data () + 64, 16);
+		item_a.balance = balance.number ();
+		std::memcpy (&item_a.retry_limit, record.data () + 80, sizeof (unsigned));
+	}
+	return result;
+}
+
+boost::filesystem::path futurehead::lazy_state_backlog::spill_path_unique (boost::filesystem::path const & directory_a)
+{
+	return directory_a / boost::filesystem::unique_path (spill_prefix + "%%%%-%%%%-%%%%.tmp");
+}
+
+void futurehead::lazy_state_backlog::remove_stale (boost::filesystem::path const & directory_a)
+{
+	boost::system::error_code ec;
+	std::vector<boost::filesystem::path> stale;
+	for (boost::filesystem::directory_iterator i (directory_a, ec), n; !ec && i != n; i.increment (ec))
+	{
+		// Matches the spill file and the file it alternates with
+		auto name (i->path ().filename ().string ());
+		if (name.compare (0, spill_prefix.size (), spill_prefix) == 0 && name.find (".tmp") != std::string::npos)
+		{
+			stale.push_back (i->path ());
+		}
+	}
+	for (auto const & path : stale)
+	{
+		boost::filesystem::remove (path, ec);
+	}
+}
+
+size_t futurehead::lazy_state_backlog::size () const
+{
+	return memory.size () + spilled_count;
+}
+
+bool futurehead::lazy_state_backlog::empty () const
+{
+	return size () == 0;
+}
+
+size_t futurehead::lazy_state_backlog::spilled () const
+{
+	return spilled_count;
+}
+
+bool futurehead::lazy_state_backlog::spill (entry const & entry_a)
+{
+	auto result (false);
+	if (!spill_stream.is_open ())
+	{
+		spill_stream.open (spill_path, std::ios::out | std::ios::binary | std::ios::trunc);
+		filter.assign (filter_bits, false);
+	}
+	spill_record record;
+	std::memcpy (record.data (), entry_a.previous.bytes.data (), 32);
+	std::memcpy (record.data () + 32, entry_a.item.link.bytes.data (), 32);
+	futurehead::amount balance (entry_a.item.balance);
+	std::memcpy (record.data () + 64, balance.bytes.data (), 16);
+	std::memcpy (record.data () + 80, &entry_a.item.retry_limit, sizeof (unsigned));
+	if (spill_stream.write (record.data (), record.size ()))
+	{
+		++spilled_count;
+		filter_insert (entry_a.previous);
+	}
+	else
+	{
+		// Keep the entry in memory rather than losing it if the file cannot be written
+		memory.insert (entry_a.previous, entry_a);
+		result = true;
+	}
+	return result;
+}
+
+void futurehead::lazy_state_backlog::filter_insert (futurehead::block_hash const & previous_a)
+{
+	// Three probes taken from independent words of the hash
+	for (auto i (0); i < 3; ++i)
+	{
+		filter[previous_a.qwords[i] % filter_bits] = true;
+	}
+}
+
+bool futurehead::lazy_state_backlog::filter_contains (futurehead::block_hash const & previous_a) const
+{
+	auto result (true);
+	for (auto i (0); i < 3 && result; ++i)
+	{
+		result = filter[previous_a.qwords[i] % filter_bits];
+	}
+	return result;
+}
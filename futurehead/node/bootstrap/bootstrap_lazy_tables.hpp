@@ -0,0 +1,244 @@
+#pragma once
+
+#include <futurehead/lib/numbers.hpp>
+#include <futurehead/lib/utility.hpp>
+
+#include <boost/filesystem/fstream.hpp>
+#include <boost/filesystem/path.hpp>
+#include <boost/optional/optional.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <istream>
+#include <vector>
+
+namespace futurehead
+{
+class lazy_state_backlog_item final
+{
+public:
+	futurehead::link link{ 0 };
+	futurehead::uint128_t balance{ 0 };
+	unsigned retry_limit{ 0 };
+};
+
+/**
+ * Flat hash table for lazy bootstrap state which grows with every pulled block.
+ * Entries are stored in two arrays with linear probing, costing the 64 bit digest of the key and the value instead of a heap allocated node.
+ * Only the digest of a key is kept, two keys with the same digest are treated as the same entry.
+ * Not thread safe, access is serialized by the lazy attempt mutex
+ */
+template <typename Value>
+class lazy_hash_table final
+{
+public:
+	static uint64_t digest (futurehead::uint256_union const & key_a)
+	{
+		// Zero marks an empty slot
+		uint64_t result (std::hash<futurehead::uint256_union> () (key_a));
+		return result != 0 ? result : 1;
+	}
+	Value * find (futurehead::uint256_union const & key_a)
+	{
+		Value * result (nullptr);
+		if (count != 0)
+		{
+			auto digest_l (digest (key_a));
+			for (auto i (slot (digest_l)); digests[i] != 0; i = (i + 1) & mask ())
+			{
+				if (digests[i] == digest_l)
+				{
+					result = &values[i];
+					break;
+				}
+			}
+		}
+		return result;
+	}
+	bool contains (futurehead::uint256_union const & key_a)
+	{
+		return find (key_a) != nullptr;
+	}
+	/** Returns the existing value and false if the key is already present, which is left unchanged */
+	std::pair<Value *, bool> insert (futurehead::uint256_union const & key_a, Value const & value_a)
+	{
+		if ((count + 1) * 4 > digests.size () * 3)
+		{
+			grow ();
+		}
+		auto digest_l (digest (key_a));
+		auto i (slot (digest_l));
+		for (; digests[i] != 0; i = (i + 1) & mask ())
+		{
+			if (digests[i] == digest_l)
+			{
+				return { &values[i], false };
+			}
+		}
+		digests[i] = digest_l;
+		values[i] = value_a;
+		++count;
+		return { &values[i], true };
+	}
+	/** Returns true if the key was present */
+	bool erase (futurehead::uint256_union const & key_a)
+	{
+		auto result (false);
+		if (count != 0)
+		{
+			auto digest_l (digest (key_a));
+			for (auto i (slot (digest_l)); digests[i] != 0; i = (i + 1) & mask ())
+			{
+				if (digests[i] == digest_l)
+				{
+					erase_slot (i);
+					result = true;
+					break;
+				}
+			}
+		}
+		return result;
+	}
+	/** Calls \p action_a with every value, the table must not be modified meanwhile */
+	template <typename Action>
+	void for_each (Action const & action_a)
+	{
+		for (size_t i (0), n (digests.size ()); i < n; ++i)
+		{
+			if (digests[i] != 0)
+			{
+				action_a (values[i]);
+			}
+		}
+	}
+	size_t size () const
+	{
+		return count;
+	}
+	bool empty () const
+	{
+		return count == 0;
+	}
+	/** Removes every entry and releases the arrays */
+	void clear ()
+	{
+		std::vector<uint64_t> ().swap (digests);
+		std::vector<Value> ().swap (values);
+		count = 0;
+	}
+
+private:
+	size_t mask () const
+	{
+		return digests.size () - 1;
+	}
+	size_t slot (uint64_t digest_a) const
+	{
+		// Fibonacci hashing spreads digests which only differ in their high bits
+		return static_cast<size_t> ((digest_a * 0x9e3779b97f4a7c15ULL) >> 32) & mask ();
+	}
+	void grow ()
+	{
+		std::vector<uint64_t> digests_l (std::max<size_t> (16, digests.size () * 2), 0);
+		std::vector<Value> values_l (digests_l.size ());
+		digests_l.swap (digests);
+		values_l.swap (values);
+		for (size_t i (0), n (digests_l.size ()); i < n; ++i)
+		{
+			if (digests_l[i] != 0)
+			{
+				auto j (slot (digests_l[i]));
+				while (digests[j] != 0)
+				{
+					j = (j + 1) & mask ();
+				}
+				digests[j] = digests_l[i];
+				values[j] = std::move (values_l[i]);
+			}
+		}
+	}
+	/** Backward shift deletion, entries after the erased slot are moved back so probing never crosses an empty slot */
+	void erase_slot (size_t slot_a)
+	{
+		auto hole (slot_a);
+		for (auto i ((slot_a + 1) & mask ()); digests[i] != 0; i = (i + 1) & mask ())
+		{
+			auto home (slot (digests[i]));
+			// Move the entry into the hole if its home slot is not cyclically within (hole, i]
+			if (((i - home) & mask ()) >= ((i - hole) & mask ()))
+			{
+				digests[hole] = digests[i];
+				values[hole] = std::move (values[i]);
+				hole = i;
+			}
+		}
+		digests[hole] = 0;
+		values[hole] = Value ();
+		--count;
+	}
+	std::vector<uint64_t> digests;
+	std::vector<Value> values;
+	size_t count{ 0 };
+};
+
+/** Values are unused, uint8_t avoids the std::vector<bool> specialization */
+using lazy_hash_set = lazy_hash_table<uint8_t>;
+
+/**
+ * State blocks waiting for their previous block, whose balance tells whether the link is a source or a destination.
+ * Up to memory_max entries are held in memory, further entries are appended to a spill file and only read back by cleanup passes.
+ * A bloom filter over the previous hashes of spilled entries records when one of them may have been pulled,
+ * so periodic cleanups only read the file when it can make progress.
+ * Not thread safe, access is serialized by the lazy attempt mutex. A detached spill file is read without it
+ */
+class lazy_state_backlog final
+{
+public:
+	lazy_state_backlog (boost::filesystem::path const & spill_path_a, size_t memory_max_a);
+	~lazy_state_backlog ();
+	/** An existing entry for the same previous block is kept. Returns true if the entry is held in memory rather than spilled */
+	bool insert (futurehead::block_hash const & previous_a, futurehead::lazy_state_backlog_item const & item_a);
+	/** Removes the entry held in memory for \p previous_a, a spilled entry is left for the next cleanup pass */
+	boost::optional<futurehead::lazy_state_backlog_item> take (futurehead::block_hash const & previous_a);
+	/** Calls \p action_a for entries in memory and removes those it returns true for */
+	void cleanup (std::function<bool(futurehead::block_hash const &, futurehead::lazy_state_backlog_item const &)> const & action_a);
+	/**
+	 * Hands the spill file over in \p file_a if \p full_a is set or one of its entries may have been resolved, returns false if there is nothing to read.
+	 * Entries spilled from now on go to a new file. The caller reads the file with spill_read, inserts the entries it retains again and removes it
+	 */
+	bool spill_detach (bool full_a, boost::filesystem::path & file_a);
+	/** Reads the next entry of a detached spill file, returns false at its end */
+	static bool spill_read (std::istream &, futurehead::block_hash &, futurehead::lazy_state_backlog_item &);
+	/** A new spill file name in \p directory_a */
+	static boost::filesystem::path spill_path_unique (boost::filesystem::path const & directory_a);
+	/** Removes spill files left in \p directory_a by a node which did not shut down cleanly */
+	static void remove_stale (boost::filesystem::path const & directory_a);
+	size_t size () const;
+	bool empty () const;
+	/** Entries currently held in the spill file */
+	size_t spilled () const;
+	size_t const memory_max;
+	/** Bits in the bloom filter over spilled entries, about 3% false positives with 128k spilled entries */
+	static size_t constexpr filter_bits{ 1024 * 1024 };
+
+private:
+	class entry final
+	{
+	public:
+		futurehead::block_hash previous{ 0 };
+		futurehead::lazy_state_backlog_item item;
+	};
+	/** Returns true if the file could not be written and the entry is held in memory instead */
+	bool spill (entry const &);
+	void filter_insert (futurehead::block_hash const &);
+	bool filter_contains (futurehead::block_hash const &) const;
+	futurehead::lazy_hash_table<entry> memory;
+	boost::filesystem::path spill_path;
+	boost::filesystem::path spill_next;
+	boost::filesystem::ofstream spill_stream;
+	size_t spilled_count{ 0 };
+	std::vector<bool> filter;
+	/** A spilled entry's previous block was processed since the last pass over the spill file */
+	bool spill_ready{ false };
+};
+}
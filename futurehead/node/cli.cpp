@@ -4,6 +4,7 @@
 #include <futurehead/node/common.hpp>
 #include <futurehead/node/daemonconfig.hpp>
 #include <futurehead/node/node.hpp>
+#include <futurehead/secure/ledger_snapshot.hpp>
 
 #include <boost/format.hpp>
 
@@ -54,6 +55,9 @@ void futurehead::add_node_options (boost::program_options::options_description &
 	("peer_clear", "Clear online peers database dump")
 	("unchecked_clear", "Clear unchecked blocks")
 	("confirmation_height_clear", "Clear confirmation height")
+	("bootstrap_checkpoint_generate", "Write the cemented frontiers of every account to <file> as a bootstrap checkpoint and print its commitment")
+	("ledger_snapshot_export", "Write a checksummed snapshot of accounts, blocks, pending entries, confirmation heights and representative weights to <file>")
+	("ledger_snapshot_import", "Import a snapshot written by --ledger_snapshot_export from <file> into a ledger which only holds the genesis account")
 	("rebuild_database", "Rebuild LMDB database with vacuum for best compaction")
 	("diagnostics", "Run internal diagnostics")
     ("generate_config", boost::program_options::value<std::string> (), "Write configuration to stdout, populated with defaults suitable for this system. Pass the configuration type node, rpc or tls. See also use_defaults.")
@@ -98,13 +102,22 @@ void futurehead::add_node_flag_options (boost::program_options::options_descript
 		("disable_providing_telemetry_metrics", "Disable using any node information in the telemetry_ack messages.")
 		("disable_block_processor_unchecked_deletion", "Disable deletion of unchecked blocks after processing")
 		("allow_bootstrap_peers_duplicates", "Allow multiple connections to same peer in bootstrap attempts")
+		("disable_bootstrap_adaptive_connections", "Scale bootstrap connections from the number of queued pulls only, instead of growing them while throughput improves and shrinking them when the block processor falls behind")
+		("disable_bootstrap_compact_stream", "Request plain blocks in bulk pull responses instead of state blocks without the account and representative repeated from the previous block")
 		("fast_bootstrap", "Increase bootstrap speed for high end nodes with higher limits")
+		("enable_pruning", "Remove the contents of old cemented blocks from the ledger in the background, see node.max_pruning_age and node.max_pruning_depth")
+		("compact_ledger", "Write a compacted copy of the LMDB ledger in the background and keep it up to date, it replaces the ledger file when the node stops. Needs disk space for the copy")
 		("batch_size", boost::program_options::value<std::size_t>(), "(Deprecated) Increase sideband batch size, default 512. This change only affects nodes upgrading from v17 (or earlier) of the node.")
 		("block_processor_batch_size", boost::program_options::value<std::size_t>(), "Increase block processor transaction batch write size, default 0 (limited by config block_processor_batch_max_time), 256k for fast_bootstrap")
 		("block_processor_full_size", boost::program_options::value<std::size_t>(), "Increase block processor allowed blocks queue size before dropping live network packets and holding bootstrap download, default 65536, 1 million for fast_bootstrap")
 		("block_processor_verification_size", boost::program_options::value<std::size_t>(), "Increase batch signature verification size in block processor, default 0 (limited by config signature_checker_threads), unlimited for fast_bootstrap")
 		("inactive_votes_cache_size", boost::program_options::value<std::size_t>(), "Increase cached votes without active elections size, default 16384")
 		("vote_processor_capacity", boost::program_options::value<std::size_t>(), "Vote processor queue size before dropping votes, default 144k")
+		("frontier_req_batch_size", boost::program_options::value<std::size_t>(), "Frontiers sent to bootstrapping peers per write, default 4096, 1 sends each frontier separately")
+		("bootstrap_frontier_ranges", boost::program_options::value<unsigned>(), "Account ranges whose frontiers are requested concurrently from several peers during legacy bootstrap, default 1, 8 for fast_bootstrap")
+		("bootstrap_pull_pipeline", boost::program_options::value<unsigned>(), "Bulk pull requests sent ahead on each bootstrap connection without waiting for earlier responses, default 1, 4 for fast_bootstrap")
+		("bootstrap_checkpoint", boost::program_options::value<std::string>(), "Skip signature verification of bootstrapped blocks committed to by this checkpoint file, requires bootstrap_checkpoint_commitment")
+		("bootstrap_checkpoint_commitment", boost::program_options::value<std::string>(), "Expected commitment of the bootstrap_checkpoint file, as printed by --bootstrap_checkpoint_generate")
 		;
 	// clang-format on
 }
@@ -140,6 +153,10 @@ std::error_code futurehead::update_flags (futurehead::node_flags & flags_a, boos
 	flags_a.disable_unchecked_drop = (vm.count ("disable_unchecked_drop") > 0);
 	flags_a.disable_block_processor_unchecked_deletion = (vm.count ("disable_block_processor_unchecked_deletion") > 0);
 	flags_a.allow_bootstrap_peers_duplicates = (vm.count ("allow_bootstrap_peers_duplicates") > 0);
+	flags_a.disable_bootstrap_compact_stream = (vm.count ("disable_bootstrap_compact_stream") > 0);
+	flags_a.disable_bootstrap_adaptive_connections = (vm.count ("disable_bootstrap_adaptive_connections") > 0);
+	flags_a.enable_pruning = (vm.count ("enable_pruning") > 0);
+	flags_a.compact_ledger = (vm.count ("compact_ledger") > 0);
 	flags_a.fast_bootstrap = (vm.count ("fast_bootstrap") > 0);
 	if (flags_a.fast_bootstrap)
 	{
@@ -147,6 +164,8 @@ std::error_code futurehead::update_flags (futurehead::node_flags & flags_a, boos
 		flags_a.block_processor_batch_size = 256 * 1024;
 		flags_a.block_processor_full_size = 1024 * 1024;
 		flags_a.block_processor_verification_size = std::numeric_limits<size_t>::max ();
+		flags_a.bootstrap_frontier_ranges = 8;
+		flags_a.bootstrap_pull_pipeline = 4;
 	}
 	auto block_processor_batch_size_it = vm.find ("block_processor_batch_size");
 	if (block_processor_batch_size_it != vm.end ())
@@ -173,6 +192,34 @@ std::error_code futurehead::update_flags (futurehead::node_flags & flags_a, boos
 	{
 		flags_a.vote_processor_capacity = vote_processor_capacity_it->second.as<size_t> ();
 	}
+	auto frontier_req_batch_size_it = vm.find ("frontier_req_batch_size");
+	if (frontier_req_batch_size_it != vm.end ())
+	{
+		flags_a.frontier_req_batch_size = frontier_req_batch_size_it->second.as<size_t> ();
+	}
+	auto bootstrap_frontier_ranges_it = vm.find ("bootstrap_frontier_ranges");
+	if (bootstrap_frontier_ranges_it != vm.end ())
+	{
+		flags_a.bootstrap_frontier_ranges = bootstrap_frontier_ranges_it->second.as<unsigned> ();
+	}
+	auto bootstrap_pull_pipeline_it = vm.find ("bootstrap_pull_pipeline");
+	if (bootstrap_pull_pipeline_it != vm.end ())
+	{
+		flags_a.bootstrap_pull_pipeline = std::max (1u, bootstrap_pull_pipeline_it->second.as<unsigned> ());
+	}
+	auto bootstrap_checkpoint_it = vm.find ("bootstrap_checkpoint");
+	if (bootstrap_checkpoint_it != vm.end ())
+	{
+		auto bootstrap_checkpoint_commitment_it = vm.find ("bootstrap_checkpoint_commitment");
+		if (bootstrap_checkpoint_commitment_it != vm.end () && !flags_a.bootstrap_checkpoint_commitment.decode_hex (bootstrap_checkpoint_commitment_it->second.as<std::string> ()))
+		{
+			flags_a.bootstrap_checkpoint = bootstrap_checkpoint_it->second.as<std::string> ();
+		}
+		else
+		{
+			ec = futurehead::error_cli::invalid_arguments;
+		}
+	}
 	// Config overriding
 	auto config (vm.find ("config"));
 	if (config != vm.end ())
@@ -567,6 +614,91 @@ std::error_code futurehead::handle_node_options (boost::program_options::variabl
 			database_write_lock_error (ec);
 		}
 	}
+	else if (vm.count ("bootstrap_checkpoint_generate"))
+	{
+		if (vm.count ("file") == 1)
+		{
+			boost::filesystem::path data_path = vm.count ("data_path") ? boost::filesystem::path (vm["data_path"].as<std::string> ()) : futurehead::working_path ();
+			auto node_flags = futurehead::inactive_node_flag_defaults ();
+			futurehead::update_flags (node_flags, vm);
+			futurehead::inactive_node node (data_path, node_flags);
+			auto transaction (node.node->store.tx_begin_read ());
+			auto entries (futurehead::bootstrap_checkpoint::generate (node.node->store, transaction));
+			if (!futurehead::bootstrap_checkpoint::write (vm["file"].as<std::string> (), entries))
+			{
+				std::cout << boost::str (boost::format ("Wrote %1% account frontiers, commitment %2%") % entries.size () % futurehead::bootstrap_checkpoint::commitment (entries).to_string ()) << std::endl;
+			}
+			else
+			{
+				std::cerr << "Could not write the bootstrap checkpoint file\n";
+				ec = futurehead::error_cli::generic;
+			}
+		}
+		else
+		{
+			std::cerr << "bootstrap_checkpoint_generate requires one <file> option\n";
+			ec = futurehead::error_cli::invalid_arguments;
+		}
+	}
+	else if (vm.count ("ledger_snapshot_export"))
+	{
+		if (vm.count ("file") == 1)
+		{
+			boost::filesystem::path data_path = vm.count ("data_path") ? boost::filesystem::path (vm["data_path"].as<std::string> ()) : futurehead::working_path ();
+			auto node_flags = futurehead::inactive_node_flag_defaults ();
+			futurehead::update_flags (node_flags, vm);
+			futurehead::inactive_node node (data_path, node_flags);
+			futurehead::ledger_snapshot::counts counts;
+			auto transaction (node.node->store.tx_begin_read ());
+			if (!futurehead::ledger_snapshot::write (node.node->store, transaction, vm["file"].as<std::string> (), counts))
+			{
+				std::cout << boost::str (boost::format ("Exported %1% accounts, %2% blocks, %3% pending entries and %4% pruned blocks") % counts.accounts % counts.blocks % counts.pending % counts.pruned) << std::endl;
+			}
+			else
+			{
+				std::cerr << "Could not write the ledger snapshot file\n";
+				ec = futurehead::error_cli::generic;
+			}
+		}
+		else
+		{
+			std::cerr << "ledger_snapshot_export requires one <file> option\n";
+			ec = futurehead::error_cli::invalid_arguments;
+		}
+	}
+	else if (vm.count ("ledger_snapshot_import"))
+	{
+		if (vm.count ("file") == 1)
+		{
+			boost::filesystem::path data_path = vm.count ("data_path") ? boost::filesystem::path (vm["data_path"].as<std::string> ()) : futurehead::working_path ();
+			auto node_flags = futurehead::inactive_node_flag_defaults ();
+			node_flags.read_only = false;
+			futurehead::update_flags (node_flags, vm);
+			futurehead::inactive_node node (data_path, node_flags);
+			if (!node.node->init_error ())
+			{
+				futurehead::ledger_snapshot::counts counts;
+				if (!futurehead::ledger_snapshot::read (node.node->store, vm["file"].as<std::string> (), counts))
+				{
+					std::cout << boost::str (boost::format ("Imported %1% accounts, %2% blocks, %3% pending entries and %4% pruned blocks") % counts.accounts % counts.blocks % counts.pending % counts.pruned) << std::endl;
+				}
+				else
+				{
+					std::cerr << "Could not import the ledger snapshot, the file is invalid or was written for another network or database version, or the ledger is not empty\n";
+					ec = futurehead::error_cli::generic;
+				}
+			}
+			else
+			{
+				database_write_lock_error (ec);
+			}
+		}
+		else
+		{
+			std::cerr << "ledger_snapshot_import requires one <file> option\n";
+			ec = futurehead::error_cli::invalid_arguments;
+		}
+	}
 	else if (vm.count ("generate_config"))
 	{
 		auto type = vm["generate_config"].as<std::string> ();
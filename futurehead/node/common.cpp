@@ -1001,6 +1001,16 @@ void futurehead::bulk_pull::set_count_present (bool value_a)
 	header.extensions.set (count_present_flag, value_a);
 }
 
+bool futurehead::bulk_pull::is_compact () const
+{
+	return header.extensions.test (compact_flag);
+}
+
+void futurehead::bulk_pull::set_compact (bool value_a)
+{
+	header.extensions.set (compact_flag, value_a);
+}
+
 futurehead::bulk_pull_account::bulk_pull_account () :
 message (futurehead::message_type::bulk_pull_account)
 {
@@ -208,6 +208,7 @@ public:
 
 	void flag_set (uint8_t);
 	static uint8_t constexpr bulk_pull_count_present_flag = 0;
+	static uint8_t constexpr bulk_pull_compact_flag = 1;
 	bool bulk_pull_is_count_present () const;
 	static uint8_t constexpr node_id_handshake_query_flag = 0;
 	static uint8_t constexpr node_id_handshake_response_flag = 1;
@@ -418,6 +419,10 @@ public:
 	bool is_count_present () const;
 	void set_count_present (bool);
 	static size_t constexpr count_present_flag = futurehead::message_header::bulk_pull_count_present_flag;
+	/** The response may use the compact state block encoding, see bulk_pull_compact_codec. Ignored by peers without support for it */
+	bool is_compact () const;
+	void set_compact (bool);
+	static size_t constexpr compact_flag = futurehead::message_header::bulk_pull_compact_flag;
 	static size_t constexpr extended_parameters_size = 8;
 	static size_t constexpr size = sizeof (start) + sizeof (end);
 };
@@ -32,6 +32,7 @@ bool futurehead::confirmation_solicitor::broadcast (futurehead::election const &
 		auto const & hash (election_a.status.winner->hash ());
 		futurehead::publish winner (election_a.status.winner);
 		unsigned count = 0;
+		futurehead::lock_guard<std::mutex> guard (election_a.mutex);
 		// Directed broadcasting to principal representatives
 		for (auto i (representatives_broadcasts.begin ()), n (representatives_broadcasts.end ()); i != n && count < max_election_broadcasts; ++i)
 		{
@@ -55,6 +56,7 @@ bool futurehead::confirmation_solicitor::add (futurehead::election const & elect
 	auto const max_channel_requests (max_confirm_req_batches * futurehead::network::confirm_req_hashes_max);
 	unsigned count = 0;
 	auto const & hash (election_a.status.winner->hash ());
+	futurehead::lock_guard<std::mutex> guard (election_a.mutex);
 	for (auto i (representatives_requests.begin ()); i != representatives_requests.end () && count < max_election_requests;)
 	{
 		bool full_queue (false);
@@ -26,12 +26,14 @@ futurehead::election_vote_result::election_vote_result (bool replay_a, bool proc
 futurehead::election::election (futurehead::node & node_a, std::shared_ptr<futurehead::block> block_a, std::function<void(std::shared_ptr<futurehead::block>)> const & confirmation_action_a, bool prioritized_a) :
 confirmation_action (confirmation_action_a),
 prioritized_m (prioritized_a),
+tally_generation (node_a.ledger.cache.rep_weights.generation ()),
 node (node_a),
 status ({ block_a, 0, std::chrono::duration_cast<std::chrono::milliseconds> (std::chrono::system_clock::now ().time_since_epoch ()), std::chrono::duration_values<std::chrono::milliseconds>::zero (), 0, 1, 0, futurehead::election_status_type::ongoing }),
 height (block_a->sideband ().height)
 {
-	last_votes.emplace (node.network_params.random.not_an_account, futurehead::vote_info{ std::chrono::steady_clock::now (), 0, block_a->hash () });
 	blocks.emplace (block_a->hash (), block_a);
+	tally_block_add (block_a->hash ());
+	vote_put (node.network_params.random.not_an_account, futurehead::vote_info{ std::chrono::steady_clock::now (), 0, block_a->hash () });
 	update_dependent ();
 	if (prioritized_a)
 	{
@@ -40,8 +42,15 @@ height (block_a->sideband ().height)
 }
 
 void futurehead::election::confirm_once (futurehead::election_status_type type_a)
+{
+	futurehead::lock_guard<std::mutex> guard (mutex);
+	confirm_once_impl (type_a);
+}
+
+void futurehead::election::confirm_once_impl (futurehead::election_status_type type_a)
 {
 	debug_assert (!node.active.mutex.try_lock ());
+	debug_assert (!mutex.try_lock ());
 	// This must be kept above the setting of election state, as dependent confirmed elections require up to date changes to election_winner_details
 	futurehead::unique_lock<std::mutex> election_winners_lk (node.active.election_winner_details_mutex);
 	if (state_m.exchange (futurehead::election::state_t::confirmed) != futurehead::election::state_t::confirmed && (node.active.election_winner_details.count (status.winner->hash ()) == 0))
@@ -280,40 +289,47 @@ bool futurehead::election::transition_time (futurehead::confirmation_solicitor &
 		result = true;
 		state_change (state_m.load (), futurehead::election::state_t::expired_unconfirmed);
 		status.type = futurehead::election_status_type::stopped;
-		log_votes (tally ());
+		futurehead::lock_guard<std::mutex> guard (mutex);
+		log_votes (tally_impl ());
 	}
 	return result;
 }
 
 bool futurehead::election::have_quorum (futurehead::tally_t const & tally_a, futurehead::uint128_t tally_sum) const
+{
+	auto i (tally_a.begin ());
+	++i;
+	auto second (i != tally_a.end () ? i->first : 0);
+	return have_quorum (tally_a.begin ()->first, second, tally_sum);
+}
+
+bool futurehead::election::have_quorum (futurehead::uint128_t const & first_a, futurehead::uint128_t const & second_a, futurehead::uint128_t const & tally_sum_a) const
 {
 	bool result = false;
-	if (tally_sum >= node.config.online_weight_minimum.number ())
+	if (tally_sum_a >= node.config.online_weight_minimum.number ())
 	{
-		auto i (tally_a.begin ());
-		++i;
-		auto second (i != tally_a.end () ? i->first : 0);
 		auto delta_l (node.delta ());
-		result = tally_a.begin ()->first > (second + delta_l);
+		result = first_a > (second_a + delta_l);
 	}
 	return result;
 }
 
 futurehead::tally_t futurehead::election::tally ()
 {
-	std::unordered_map<futurehead::block_hash, futurehead::uint128_t> block_weights;
-	for (auto vote_info : last_votes)
-	{
-		block_weights[vote_info.second.hash] += node.ledger.weight (vote_info.first);
-	}
-	last_tally = block_weights;
+	futurehead::lock_guard<std::mutex> guard (mutex);
+	return tally_impl ();
+}
+
+futurehead::tally_t futurehead::election::tally_impl ()
+{
+	tally_refresh ();
 	futurehead::tally_t result;
-	for (auto item : block_weights)
+	for (auto const & block : blocks)
 	{
-		auto block (blocks.find (item.first));
-		if (block != blocks.end ())
+		auto existing (last_tally.find (block.first));
+		if (existing != last_tally.end ())
 		{
-			result.emplace (item.second, block->second);
+			result.emplace (existing->second, block.second);
 		}
 	}
 	return result;
@@ -321,18 +337,22 @@ futurehead::tally_t futurehead::election::tally ()
 
 void futurehead::election::confirm_if_quorum ()
 {
-	auto tally_l (tally ());
-	debug_assert (!tally_l.empty ());
-	auto winner (tally_l.begin ());
-	auto block_l (winner->second);
-	auto winner_hash_l (block_l->hash ());
-	status.tally = winner->first;
+	futurehead::lock_guard<std::mutex> guard (mutex);
+	confirm_if_quorum_impl ();
+}
+
+void futurehead::election::confirm_if_quorum_impl ()
+{
+	debug_assert (!node.active.mutex.try_lock ());
+	tally_refresh ();
+	debug_assert (!tally_top[0].is_zero ());
+	auto winner_hash_l (tally_top[0]);
+	auto block_l (blocks[winner_hash_l]);
+	auto winner_tally (tally_weight (winner_hash_l));
+	auto second_tally (tally_weight (tally_top[1]));
+	status.tally = winner_tally;
 	auto status_winner_hash_l (status.winner->hash ());
-	futurehead::uint128_t sum (0);
-	for (auto & i : tally_l)
-	{
-		sum += i.first;
-	}
+	auto sum (tally_sum);
 	if (sum >= node.config.online_weight_minimum.number () && winner_hash_l != status_winner_hash_l)
 	{
 		status.winner = block_l;
@@ -341,13 +361,13 @@ void futurehead::election::confirm_if_quorum ()
 		update_dependent ();
 		node.active.add_adjust_difficulty (winner_hash_l);
 	}
-	if (have_quorum (tally_l, sum))
+	if (have_quorum (winner_tally, second_tally, sum))
 	{
 		if (node.config.logging.vote_logging () || blocks.size () > 1)
 		{
-			log_votes (tally_l);
+			log_votes (tally_impl ());
 		}
-		confirm_once (futurehead::election_status_type::active_confirmed_quorum);
+		confirm_once_impl (futurehead::election_status_type::active_confirmed_quorum);
 	}
 }
 
@@ -372,10 +392,30 @@ void futurehead::election::log_votes (futurehead::tally_t const & tally_a) const
 
 futurehead::election_vote_result futurehead::election::vote (futurehead::account rep, uint64_t sequence, futurehead::block_hash block_hash)
 {
+	auto weight (node.ledger.weight (rep));
+	auto online_stake (node.online_reps.online_stake ());
+	futurehead::lock_guard<std::mutex> guard (mutex);
+	auto result (vote_impl (rep, sequence, block_hash, weight, online_stake));
+	if (result.processed && !confirmed ())
+	{
+		confirm_if_quorum_impl ();
+	}
+	return result;
+}
+
+futurehead::election_vote_result futurehead::election::vote (futurehead::account rep, uint64_t sequence, futurehead::block_hash block_hash, futurehead::uint128_t const & weight, futurehead::uint128_t const & online_stake, bool & quorum_check_a)
+{
+	futurehead::lock_guard<std::mutex> guard (mutex);
+	auto result (vote_impl (rep, sequence, block_hash, weight, online_stake));
+	quorum_check_a = result.processed && !confirmed () && quorum_check_required ();
+	return result;
+}
+
+futurehead::election_vote_result futurehead::election::vote_impl (futurehead::account const & rep, uint64_t sequence, futurehead::block_hash const & block_hash, futurehead::uint128_t const & weight, futurehead::uint128_t const & online_stake)
+{
+	debug_assert (!mutex.try_lock ());
 	// see republish_vote documentation for an explanation of these rules
 	auto replay (false);
-	auto online_stake (node.online_reps.online_stake ());
-	auto weight (node.ledger.weight (rep));
 	auto should_process (false);
 	if (node.network_params.network.is_test_network () || weight > node.minimum_principal_weight (online_stake))
 	{
@@ -415,18 +455,23 @@ futurehead::election_vote_result futurehead::election::vote (futurehead::account
 		if (should_process)
 		{
 			node.stats.inc (futurehead::stat::type::election, futurehead::stat::detail::vote_new);
-			last_votes[rep] = { std::chrono::steady_clock::now (), sequence, block_hash };
-			if (!confirmed ())
-			{
-				confirm_if_quorum ();
-			}
+			vote_put (rep, { std::chrono::steady_clock::now (), sequence, block_hash, weight });
 		}
 	}
 	return futurehead::election_vote_result (replay, should_process);
 }
 
+bool futurehead::election::quorum_check_required ()
+{
+	tally_refresh ();
+	auto winner_tally (tally_weight (tally_top[0]));
+	auto sum (tally_sum);
+	return (sum >= node.config.online_weight_minimum.number () && tally_top[0] != status.winner->hash ()) || have_quorum (winner_tally, tally_weight (tally_top[1]), sum);
+}
+
 bool futurehead::election::publish (std::shared_ptr<futurehead::block> block_a)
 {
+	futurehead::lock_guard<std::mutex> guard (mutex);
 	// Do not insert new blocks if already confirmed
 	auto result (confirmed ());
 	if (!result && blocks.size () >= 10)
@@ -442,10 +487,11 @@ bool futurehead::election::publish (std::shared_ptr<futurehead::block> block_a)
 		if (existing == blocks.end ())
 		{
 			blocks.emplace (std::make_pair (block_a->hash (), block_a));
-			if (!insert_inactive_votes_cache (block_a->hash ()))
+			tally_block_add (block_a->hash ());
+			if (!insert_inactive_votes_cache_impl (block_a->hash ()))
 			{
 				// Even if no votes were in cache, they could be in the election
-				confirm_if_quorum ();
+				confirm_if_quorum_impl ();
 			}
 			node.network.flood_block (block_a, futurehead::buffer_drop_policy::no_limiter_drop);
 		}
@@ -464,7 +510,7 @@ bool futurehead::election::publish (std::shared_ptr<futurehead::block> block_a)
 
 size_t futurehead::election::last_votes_size ()
 {
-	futurehead::lock_guard<std::mutex> lock (node.active.mutex);
+	futurehead::lock_guard<std::mutex> guard (mutex);
 	return last_votes.size ();
 }
 
@@ -531,8 +577,14 @@ void futurehead::election::cleanup ()
 	{
 		node.active.recently_dropped.add (winner_root);
 
+		// Votes still being applied to the election read the blocks
+		decltype (blocks) blocks_l;
+		{
+			futurehead::lock_guard<std::mutex> guard (mutex);
+			blocks_l.swap (blocks);
+		}
 		// Clear network filter in another thread
-		node.worker.push_task ([node_l = node.shared (), blocks_l = std::move (blocks)]() {
+		node.worker.push_task ([node_l = node.shared (), blocks_l = std::move (blocks_l)]() {
 			for (auto const & block : blocks_l)
 			{
 				node_l->network.publish_filter.clear (block.second);
@@ -542,13 +594,19 @@ void futurehead::election::cleanup ()
 }
 
 size_t futurehead::election::insert_inactive_votes_cache (futurehead::block_hash const & hash_a)
+{
+	futurehead::lock_guard<std::mutex> guard (mutex);
+	return insert_inactive_votes_cache_impl (hash_a);
+}
+
+size_t futurehead::election::insert_inactive_votes_cache_impl (futurehead::block_hash const & hash_a)
 {
 	auto cache (node.active.find_inactive_votes_cache (hash_a));
 	for (auto const & rep : cache.voters)
 	{
-		auto inserted (last_votes.emplace (rep, futurehead::vote_info{ std::chrono::steady_clock::time_point::min (), 0, hash_a }));
-		if (inserted.second)
+		if (last_votes.find (rep) == last_votes.end ())
 		{
+			vote_put (rep, futurehead::vote_info{ std::chrono::steady_clock::time_point::min (), 0, hash_a, node.ledger.weight (rep) });
 			node.stats.inc (futurehead::stat::type::election, futurehead::stat::detail::vote_cached);
 		}
 	}
@@ -560,7 +618,7 @@ size_t futurehead::election::insert_inactive_votes_cache (futurehead::block_hash
 			node.stats.inc (futurehead::stat::type::election, futurehead::stat::detail::late_block);
 			node.stats.add (futurehead::stat::type::election, futurehead::stat::detail::late_block_seconds, futurehead::stat::dir::in, delay.count (), true);
 		}
-		confirm_if_quorum ();
+		confirm_if_quorum_impl ();
 	}
 	return cache.voters.size ();
 }
@@ -604,9 +662,123 @@ void futurehead::election::remove_votes (futurehead::block_hash const & hash_a)
 		auto list_generated_votes (node.votes_cache.find (hash_a));
 		for (auto const & vote : list_generated_votes)
 		{
-			last_votes.erase (vote->account);
+			vote_erase (vote->account);
 		}
 		// Clear votes cache
 		node.votes_cache.remove (hash_a);
 	}
 }
+
+void futurehead::election::vote_put (futurehead::account const & rep_a, futurehead::vote_info const & vote_a)
+{
+	auto existing (last_votes.find (rep_a));
+	if (existing != last_votes.end ())
+	{
+		tally_subtract (existing->second.hash, existing->second.weight);
+		existing->second = vote_a;
+	}
+	else
+	{
+		last_votes.emplace (rep_a, vote_a);
+	}
+	tally_add (vote_a.hash, vote_a.weight);
+}
+
+void futurehead::election::vote_erase (futurehead::account const & rep_a)
+{
+	auto existing (last_votes.find (rep_a));
+	if (existing != last_votes.end ())
+	{
+		tally_subtract (existing->second.hash, existing->second.weight);
+		last_votes.erase (existing);
+	}
+}
+
+void futurehead::election::tally_add (futurehead::block_hash const & hash_a, futurehead::uint128_t const & weight_a)
+{
+	last_tally[hash_a] += weight_a;
+	if (blocks.find (hash_a) != blocks.end ())
+	{
+		tally_sum += weight_a;
+		tally_top_update (hash_a);
+	}
+}
+
+void futurehead::election::tally_subtract (futurehead::block_hash const & hash_a, futurehead::uint128_t const & weight_a)
+{
+	auto existing (last_tally.find (hash_a));
+	debug_assert (existing != last_tally.end () && existing->second >= weight_a);
+	existing->second -= weight_a;
+	if (blocks.find (hash_a) != blocks.end ())
+	{
+		tally_sum -= weight_a;
+		if (hash_a == tally_top[0] || hash_a == tally_top[1])
+		{
+			tally_top_rescan ();
+		}
+	}
+}
+
+void futurehead::election::tally_block_add (futurehead::block_hash const & hash_a)
+{
+	tally_sum += tally_weight (hash_a);
+	tally_top_update (hash_a);
+}
+
+void futurehead::election::tally_refresh ()
+{
+	auto generation_l (node.ledger.cache.rep_weights.generation ());
+	if (generation_l != tally_generation)
+	{
+		tally_generation = generation_l;
+		last_tally.clear ();
+		tally_sum = 0;
+		for (auto & vote : last_votes)
+		{
+			vote.second.weight = node.ledger.weight (vote.first);
+			last_tally[vote.second.hash] += vote.second.weight;
+		}
+		for (auto const & block : blocks)
+		{
+			tally_sum += tally_weight (block.first);
+		}
+		tally_top_rescan ();
+	}
+}
+
+void futurehead::election::tally_top_update (futurehead::block_hash const & hash_a)
+{
+	if (hash_a != tally_top[0])
+	{
+		auto weight_l (tally_weight (hash_a));
+		if (tally_top[0].is_zero () || weight_l > tally_weight (tally_top[0]))
+		{
+			tally_top[1] = tally_top[0];
+			tally_top[0] = hash_a;
+		}
+		else if (hash_a != tally_top[1] && (tally_top[1].is_zero () || weight_l > tally_weight (tally_top[1])))
+		{
+			tally_top[1] = hash_a;
+		}
+	}
+}
+
+void futurehead::election::tally_top_rescan ()
+{
+	tally_top = { { 0, 0 } };
+	for (auto const & block : blocks)
+	{
+		tally_top_update (block.first);
+	}
+}
+
+futurehead::uint128_t futurehead::election::tally_weight (futurehead::block_hash const & hash_a) const
+{
+	futurehead::uint128_t result (0);
+	auto existing (last_tally.find (hash_a));
+	if (existing != last_tally.end ())
+	{
+		result = existing->second;
+	}
+	return result;
+}
@@ -4,6 +4,7 @@
 #include <futurehead/secure/common.hpp>
 #include <futurehead/secure/ledger.hpp>
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <memory>
@@ -21,6 +22,8 @@ public:
 	std::chrono::steady_clock::time_point time;
 	uint64_t sequence;
 	futurehead::block_hash hash;
+	// Weight of the representative counted in the tally of the election
+	futurehead::uint128_t weight{ 0 };
 };
 class election_vote_result final
 {
@@ -65,14 +68,43 @@ private: // State management
 	void broadcast_block (futurehead::confirmation_solicitor &);
 	void send_confirm_req (futurehead::confirmation_solicitor &);
 	void activate_dependencies ();
+	void confirm_once_impl (futurehead::election_status_type);
+	void confirm_if_quorum_impl ();
 	// Calculate votes for local representatives
 	void generate_votes (futurehead::block_hash const &);
 	void remove_votes (futurehead::block_hash const &);
 	std::atomic<bool> prioritized_m = { false };
 
+private: // Vote tally, updated as votes are added, replaced and removed. Requires the election mutex
+	futurehead::election_vote_result vote_impl (futurehead::account const &, uint64_t, futurehead::block_hash const &, futurehead::uint128_t const &, futurehead::uint128_t const &);
+	// Whether confirm_if_quorum could change the winner or confirm the election
+	bool quorum_check_required ();
+	futurehead::tally_t tally_impl ();
+	size_t insert_inactive_votes_cache_impl (futurehead::block_hash const &);
+	void vote_put (futurehead::account const &, futurehead::vote_info const &);
+	void vote_erase (futurehead::account const &);
+	void tally_add (futurehead::block_hash const &, futurehead::uint128_t const &);
+	void tally_subtract (futurehead::block_hash const &, futurehead::uint128_t const &);
+	// Starts counting the votes for a newly published block
+	void tally_block_add (futurehead::block_hash const &);
+	// Weighs all votes again if representative weights changed since they were counted
+	void tally_refresh ();
+	void tally_top_update (futurehead::block_hash const &);
+	void tally_top_rescan ();
+	futurehead::uint128_t tally_weight (futurehead::block_hash const &) const;
+	bool have_quorum (futurehead::uint128_t const &, futurehead::uint128_t const &, futurehead::uint128_t const &) const;
+	// Sum of the tallies of all blocks in the election
+	futurehead::uint128_t tally_sum{ 0 };
+	// Blocks with the highest and second highest tally, zero if there is no such block
+	std::array<futurehead::block_hash, 2> tally_top{ { 0, 0 } };
+	uint64_t tally_generation;
+
 public:
 	election (futurehead::node &, std::shared_ptr<futurehead::block>, std::function<void(std::shared_ptr<futurehead::block>)> const &, bool);
 	futurehead::election_vote_result vote (futurehead::account, uint64_t, futurehead::block_hash);
+	// Applies a vote without the active mutex, with the representative weight and online stake read by the caller.
+	// Sets \p quorum_check_a if the winner may change or quorum may be reached, the caller then calls confirm_if_quorum holding the active mutex
+	futurehead::election_vote_result vote (futurehead::account, uint64_t, futurehead::block_hash, futurehead::uint128_t const &, futurehead::uint128_t const &, bool & quorum_check_a);
 	futurehead::tally_t tally ();
 	// Check if we have vote quorum
 	bool have_quorum (futurehead::tally_t const &, futurehead::uint128_t) const;
@@ -104,6 +136,8 @@ private:
 public:
 	bool idle () const;
 	bool confirmed () const;
+	// Protects the votes and the tally, which votes update without the active mutex, and the blocks and winner they read. Taken after the active mutex
+	mutable std::mutex mutex;
 	futurehead::node & node;
 	std::unordered_map<futurehead::account, futurehead::vote_info> last_votes;
 	std::unordered_map<futurehead::block_hash, std::shared_ptr<futurehead::block>> blocks;
@@ -2,6 +2,7 @@
 #include <futurehead/lib/errors.hpp>
 #include <futurehead/lib/numbers.hpp>
 #include <futurehead/node/ipc/action_handler.hpp>
+#include <futurehead/node/ipc/flatbuffers_util.hpp>
 #include <futurehead/node/ipc/ipc_server.hpp>
 #include <futurehead/node/node.hpp>
 
@@ -27,6 +28,15 @@ futurehead::account parse_account (std::string const & account, bool & out_is_de
 
 	return result;
 }
+futurehead::block_hash parse_hash (std::string const & hash)
+{
+	futurehead::block_hash result (0);
+	if (result.decode_hex (hash))
+	{
+		throw futurehead::error (futurehead::error_blocks::bad_hash_number);
+	}
+	return result;
+}
 /** Returns the message as a Flatbuffers ObjectAPI type, managed by a unique_ptr */
 template <typename T>
 auto get_message (futureheadapi::Envelope const & envelope)
@@ -51,6 +61,11 @@ auto futurehead::ipc::action_handler::handler_map () -> std::unordered_map<futur
 		handlers.emplace (futureheadapi::Message::Message_ServiceRegister, &futurehead::ipc::action_handler::on_service_register);
 		handlers.emplace (futureheadapi::Message::Message_ServiceStop, &futurehead::ipc::action_handler::on_service_stop);
 		handlers.emplace (futureheadapi::Message::Message_TopicServiceStop, &futurehead::ipc::action_handler::on_topic_service_stop);
+		handlers.emplace (futureheadapi::Message::Message_AccountInfo, &futurehead::ipc::action_handler::on_account_info);
+		handlers.emplace (futureheadapi::Message::Message_AccountsBalances, &futurehead::ipc::action_handler::on_accounts_balances);
+		handlers.emplace (futureheadapi::Message::Message_BlocksInfo, &futurehead::ipc::action_handler::on_blocks_info);
+		handlers.emplace (futureheadapi::Message::Message_Pending, &futurehead::ipc::action_handler::on_pending);
+		handlers.emplace (futureheadapi::Message::Message_BlockCount, &futurehead::ipc::action_handler::on_block_count);
 	}
 	return handlers;
 }
@@ -116,6 +131,161 @@ void futurehead::ipc::action_handler::on_account_weight (futureheadapi::Envelope
 	create_response (response);
 }
 
+void futurehead::ipc::action_handler::on_account_info (futureheadapi::Envelope const & envelope_a)
+{
+	require_oneof (envelope_a, { futurehead::ipc::access_permission::api_account_info, futurehead::ipc::access_permission::account_query });
+	bool is_deprecated_format{ false };
+	auto query (get_message<futureheadapi::AccountInfo> (envelope_a));
+	auto account (parse_account (query->account, is_deprecated_format));
+	auto transaction (node.store.tx_begin_read ());
+	futurehead::account_info info;
+	futurehead::confirmation_height_info confirmation_height_info;
+	if (node.store.account_get (transaction, account, info) || node.store.confirmation_height_get (transaction, account, confirmation_height_info))
+	{
+		throw futurehead::error (futurehead::error_common::account_not_found);
+	}
+
+	futureheadapi::AccountInfoResponseT response;
+	response.frontier = info.head.to_string ();
+	response.open_block = info.open_block.to_string ();
+	response.representative_block = node.ledger.representative (transaction, info.head).to_string ();
+	response.balance = info.balance.to_string_dec ();
+	response.modified_timestamp = info.modified;
+	response.block_count = info.block_count;
+	response.account_version = static_cast<uint8_t> (futurehead::normalized_epoch (info.epoch ()));
+	response.confirmation_height = confirmation_height_info.height;
+	response.confirmation_height_frontier = confirmation_height_info.frontier.to_string ();
+	if (query->include_representative)
+	{
+		response.representative = info.representative.to_account ();
+	}
+	if (query->include_voting_weight)
+	{
+		response.voting_weight = node.ledger.weight (account).convert_to<std::string> ();
+	}
+	if (query->include_pending)
+	{
+		response.pending = node.ledger.account_pending (transaction, account).convert_to<std::string> ();
+	}
+	create_response (response);
+}
+
+void futurehead::ipc::action_handler::on_accounts_balances (futureheadapi::Envelope const & envelope_a)
+{
+	require_oneof (envelope_a, { futurehead::ipc::access_permission::api_accounts_balances, futurehead::ipc::access_permission::account_query });
+	bool is_deprecated_format{ false };
+	auto query (get_message<futureheadapi::AccountsBalances> (envelope_a));
+	futureheadapi::AccountsBalancesResponseT response;
+	response.balances.reserve (query->accounts.size ());
+	auto transaction (node.store.tx_begin_read ());
+	for (auto const & account_text : query->accounts)
+	{
+		auto account (parse_account (account_text, is_deprecated_format));
+		auto entry (std::make_unique<futureheadapi::AccountBalanceT> ());
+		entry->account = account_text;
+		entry->balance = node.ledger.account_balance (transaction, account).convert_to<std::string> ();
+		entry->pending = node.ledger.account_pending (transaction, account).convert_to<std::string> ();
+		response.balances.push_back (std::move (entry));
+	}
+	create_response (response);
+}
+
+void futurehead::ipc::action_handler::on_blocks_info (futureheadapi::Envelope const & envelope_a)
+{
+	require (envelope_a, futurehead::ipc::access_permission::api_blocks_info);
+	auto query (get_message<futureheadapi::BlocksInfo> (envelope_a));
+	futureheadapi::BlocksInfoResponseT response;
+	response.blocks.reserve (query->hashes.size ());
+	auto transaction (node.store.tx_begin_read ());
+	for (auto const & hash_text : query->hashes)
+	{
+		auto hash (parse_hash (hash_text));
+		auto block (node.store.block_get (transaction, hash));
+		if (block != nullptr)
+		{
+			auto entry (std::make_unique<futureheadapi::BlocksInfoEntryT> ());
+			entry->hash = hash_text;
+			entry->block_account = (block->account ().is_zero () ? block->sideband ().account : block->account ()).to_account ();
+			bool error_or_pruned (false);
+			auto amount (node.ledger.amount_safe (transaction, hash, error_or_pruned));
+			if (!error_or_pruned)
+			{
+				entry->amount = amount.convert_to<std::string> ();
+			}
+			entry->balance = node.ledger.balance (transaction, hash).convert_to<std::string> ();
+			entry->height = block->sideband ().height;
+			entry->local_timestamp = block->sideband ().timestamp;
+			entry->confirmed = node.ledger.block_confirmed (transaction, hash);
+			entry->block = futurehead::ipc::flatbuffers_builder::block_to_union (*block, amount, block->sideband ().details.is_send);
+			response.blocks.push_back (std::move (entry));
+		}
+		else if (query->include_not_found)
+		{
+			response.blocks_not_found.push_back (hash_text);
+		}
+		else
+		{
+			throw futurehead::error (futurehead::error_blocks::not_found);
+		}
+	}
+	create_response (response);
+}
+
+void futurehead::ipc::action_handler::on_pending (futureheadapi::Envelope const & envelope_a)
+{
+	require_oneof (envelope_a, { futurehead::ipc::access_permission::api_pending, futurehead::ipc::access_permission::account_query });
+	bool is_deprecated_format{ false };
+	auto query (get_message<futureheadapi::Pending> (envelope_a));
+	auto account (parse_account (query->account, is_deprecated_format));
+	futurehead::amount threshold (0);
+	if (!query->threshold.empty () && threshold.decode_dec (query->threshold))
+	{
+		throw futurehead::error (futurehead::error_common::invalid_amount);
+	}
+	auto count (query->count != 0 ? query->count : std::numeric_limits<uint64_t>::max ());
+	futureheadapi::PendingResponseT response;
+	auto transaction (node.store.tx_begin_read ());
+	for (auto i (node.store.pending_begin (transaction, futurehead::pending_key (account, 0))), n (node.store.pending_end ()); i != n && futurehead::pending_key (i->first).account == account && response.blocks.size () < count; ++i)
+	{
+		futurehead::pending_key const & key (i->first);
+		futurehead::pending_info const & info (i->second);
+		if (info.amount.number () >= threshold.number ())
+		{
+			auto confirmed (query->include_active && !query->include_only_confirmed);
+			if (!confirmed)
+			{
+				confirmed = node.ledger.block_confirmed (transaction, key.hash);
+			}
+			if (!confirmed && !query->include_only_confirmed)
+			{
+				// As in the JSON RPC, blocks which are not in an active election are included unless include_only_confirmed is set
+				auto block (node.store.block_get (transaction, key.hash));
+				confirmed = block != nullptr && !node.active.active (*block);
+			}
+			if (confirmed)
+			{
+				auto entry (std::make_unique<futureheadapi::PendingBlockT> ());
+				entry->hash = key.hash.to_string ();
+				entry->amount = info.amount.to_string_dec ();
+				entry->source = info.source.to_account ();
+				entry->min_version = static_cast<uint8_t> (futurehead::normalized_epoch (info.epoch));
+				response.blocks.push_back (std::move (entry));
+			}
+		}
+	}
+	create_response (response);
+}
+
+void futurehead::ipc::action_handler::on_block_count (futureheadapi::Envelope const & envelope_a)
+{
+	require (envelope_a, futurehead::ipc::access_permission::api_block_count);
+	futureheadapi::BlockCountResponseT response;
+	response.count = node.ledger.cache.block_count;
+	response.unchecked = node.ledger.cache.unchecked_count;
+	response.cemented = node.ledger.cache.cemented_count;
+	create_response (response);
+}
+
 void futurehead::ipc::action_handler::on_is_alive (futureheadapi::Envelope const & envelope)
 {
 	futureheadapi::IsAliveT alive;
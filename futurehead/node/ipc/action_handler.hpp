@@ -40,6 +40,11 @@ namespace ipc
 		action_handler (futurehead::node & node, futurehead::ipc::ipc_server & server, std::weak_ptr<futurehead::ipc::subscriber> const & subscriber, std::shared_ptr<flatbuffers::FlatBufferBuilder> const & builder);
 
 		void on_account_weight (futureheadapi::Envelope const & envelope);
+		void on_account_info (futureheadapi::Envelope const & envelope);
+		void on_accounts_balances (futureheadapi::Envelope const & envelope);
+		void on_blocks_info (futureheadapi::Envelope const & envelope);
+		void on_pending (futureheadapi::Envelope const & envelope);
+		void on_block_count (futureheadapi::Envelope const & envelope);
 		void on_is_alive (futureheadapi::Envelope const & envelope);
 		void on_topic_confirmation (futureheadapi::Envelope const & envelope);
 
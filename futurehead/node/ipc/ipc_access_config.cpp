@@ -12,6 +12,16 @@ futurehead::ipc::access_permission from_string (std::string permission)
 		return futurehead::ipc::access_permission::unrestricted;
 	if (permission == "api_account_weight")
 		return futurehead::ipc::access_permission::api_account_weight;
+	if (permission == "api_account_info")
+		return futurehead::ipc::access_permission::api_account_info;
+	if (permission == "api_accounts_balances")
+		return futurehead::ipc::access_permission::api_accounts_balances;
+	if (permission == "api_blocks_info")
+		return futurehead::ipc::access_permission::api_blocks_info;
+	if (permission == "api_pending")
+		return futurehead::ipc::access_permission::api_pending;
+	if (permission == "api_block_count")
+		return futurehead::ipc::access_permission::api_block_count;
 	if (permission == "api_service_register")
 		return futurehead::ipc::access_permission::api_service_register;
 	if (permission == "api_service_stop")
@@ -88,6 +98,11 @@ void futurehead::ipc::access::clear ()
 	// The default set of permissions. A new insert should be made as new safe
 	// api's or resource permissions are made.
 	default_user.permissions.insert (futurehead::ipc::access_permission::api_account_weight);
+	default_user.permissions.insert (futurehead::ipc::access_permission::api_account_info);
+	default_user.permissions.insert (futurehead::ipc::access_permission::api_accounts_balances);
+	default_user.permissions.insert (futurehead::ipc::access_permission::api_blocks_info);
+	default_user.permissions.insert (futurehead::ipc::access_permission::api_pending);
+	default_user.permissions.insert (futurehead::ipc::access_permission::api_block_count);
 }
 
 futurehead::error futurehead::ipc::access::deserialize_toml (futurehead::tomlconfig & toml)
@@ -50,6 +50,11 @@ namespace ipc
 		/** Unrestricted access to the node, suitable for debugging and development */
 		unrestricted,
 		api_account_weight,
+		api_account_info,
+		api_accounts_balances,
+		api_blocks_info,
+		api_pending,
+		api_block_count,
 		api_service_register,
 		api_service_stop,
 		api_topic_service_stop,
@@ -1,5 +1,6 @@
 #include <futurehead/boost/asio/bind_executor.hpp>
 #include <futurehead/boost/asio/local/stream_protocol.hpp>
+#include <futurehead/boost/asio/post.hpp>
 #include <futurehead/boost/asio/read.hpp>
 #include <futurehead/boost/asio/strand.hpp>
 #include <futurehead/lib/config.hpp>
@@ -248,8 +249,16 @@ public:
 		}));
 	}
 
-	/** Handler for payload_encoding::json_legacy */
-	void handle_json_query (bool allow_unsafe)
+	/** Appends \p body_a to \p buffer_a with a big endian length prefix */
+	static void append_length_prefixed (std::vector<uint8_t> & buffer_a, std::string const & body_a)
+	{
+		auto big = boost::endian::native_to_big (static_cast<uint32_t> (body_a.size ()));
+		buffer_a.insert (buffer_a.end (), reinterpret_cast<std::uint8_t *> (&big), reinterpret_cast<std::uint8_t *> (&big) + sizeof (std::uint32_t));
+		buffer_a.insert (buffer_a.end (), body_a.begin (), body_a.end ());
+	}
+
+	/** Handler for payload_encoding::json_v1, json_v1_unsafe and json_v1_chunked */
+	void handle_json_query (bool allow_unsafe, bool chunked)
 	{
 		session_timer.restart ();
 		auto request_id_l (std::to_string (server.id_dispenser.fetch_add (1)));
@@ -257,11 +266,25 @@ public:
 		// This is called when futurehead::rpc_handler#process_request is done. We convert to
 		// json and write the response to the ipc socket with a length prefix.
 		auto this_l (this->shared_from_this ());
-		auto response_handler_l ([this_l, request_id_l](std::string const & body) {
-			auto big = boost::endian::native_to_big (static_cast<uint32_t> (body.size ()));
+		auto response_handler_l ([this_l, request_id_l, chunked](std::string const & body) {
+			if (chunked && this_l->chunks_abandoned ())
+			{
+				// Closing without the terminating chunk tells the client the response is incomplete
+				boost::asio::post (this_l->strand, [this_l]() {
+					this_l->close ();
+				});
+				return;
+			}
 			auto buffer (std::make_shared<std::vector<uint8_t>> ());
-			buffer->insert (buffer->end (), reinterpret_cast<std::uint8_t *> (&big), reinterpret_cast<std::uint8_t *> (&big) + sizeof (std::uint32_t));
-			buffer->insert (buffer->end (), body.begin (), body.end ());
+			if (!chunked || !body.empty ())
+			{
+				append_length_prefixed (*buffer, body);
+			}
+			if (chunked)
+			{
+				// Terminating empty chunk
+				append_length_prefixed (*buffer, std::string ());
+			}
 			if (this_l->node.config.logging.log_ipc ())
 			{
 				this_l->node.logger.always_log (boost::str (boost::format ("IPC/RPC request %1% completed in: %2% %3%") % request_id_l % this_l->session_timer.stop ().count () % this_l->session_timer.unit ()));
@@ -294,7 +317,76 @@ public:
 			});
 		}));
 		// For unsafe actions to be allowed, the unsafe encoding must be used AND the transport config must allow it
-		handler->process_request (allow_unsafe && config_transport.allow_unsafe);
+		auto allow_unsafe_l (allow_unsafe && config_transport.allow_unsafe);
+		if (chunked)
+		{
+			// Chunks are written as they are produced, the next request is only read once the final response is written
+			{
+				futurehead::lock_guard<std::mutex> guard (chunks_mutex);
+				chunks_pending = 0;
+				chunks_abandoned_m = false;
+			}
+			handler->response_chunk = [this_l](std::string const & chunk_a) {
+				this_l->write_chunk (chunk_a);
+			};
+			// The handler waits for chunks to be written, so it must not run on a thread completing the writes
+			node.rpc_workers.push_task ([handler, allow_unsafe_l]() {
+				handler->process_request (allow_unsafe_l);
+			});
+		}
+		else
+		{
+			handler->process_request (allow_unsafe_l);
+		}
+	}
+
+	/**
+	 * Queues a chunk of a json_v1_chunked response. Waits while more than chunks_pending_max bytes are queued, if the
+	 * client does not read them within the IO timeout the remaining chunks are dropped and the response is abandoned
+	 */
+	void write_chunk (std::string const & chunk_a)
+	{
+		futurehead::unique_lock<std::mutex> lock (chunks_mutex);
+		auto room (chunks_condition.wait_for (lock, std::chrono::seconds (config_transport.io_timeout), [this]() {
+			return chunks_abandoned_m || chunks_pending < chunks_pending_max;
+		}));
+		if (!room)
+		{
+			chunks_abandoned_m = true;
+			if (node.config.logging.log_ipc ())
+			{
+				node.logger.always_log ("IPC: Client is not reading the response, abandoning it");
+			}
+		}
+		if (!chunks_abandoned_m)
+		{
+			auto buffer (std::make_shared<std::vector<uint8_t>> ());
+			append_length_prefixed (*buffer, chunk_a);
+			chunks_pending += buffer->size ();
+			lock.unlock ();
+			auto this_l (this->shared_from_this ());
+			queued_write (boost::asio::buffer (buffer->data (), buffer->size ()), [this_l, buffer](boost::system::error_code const & error_a, size_t size_a) {
+				{
+					futurehead::lock_guard<std::mutex> guard (this_l->chunks_mutex);
+					this_l->chunks_pending -= buffer->size ();
+					if (error_a)
+					{
+						this_l->chunks_abandoned_m = true;
+					}
+				}
+				this_l->chunks_condition.notify_all ();
+				if (error_a && this_l->node.config.logging.log_ipc ())
+				{
+					this_l->node.logger.always_log ("IPC: Write failed: ", error_a.message ());
+				}
+			});
+		}
+	}
+
+	bool chunks_abandoned ()
+	{
+		futurehead::lock_guard<std::mutex> guard (chunks_mutex);
+		return chunks_abandoned_m;
 	}
 
 	/** Async request reader */
@@ -314,16 +406,17 @@ public:
 					this_l->node.logger.always_log ("IPC: Invalid preamble");
 				}
 			}
-			else if (encoding == static_cast<uint8_t> (futurehead::ipc::payload_encoding::json_v1) || encoding == static_cast<uint8_t> (futurehead::ipc::payload_encoding::json_v1_unsafe))
+			else if (encoding == static_cast<uint8_t> (futurehead::ipc::payload_encoding::json_v1) || encoding == static_cast<uint8_t> (futurehead::ipc::payload_encoding::json_v1_unsafe) || encoding == static_cast<uint8_t> (futurehead::ipc::payload_encoding::json_v1_chunked))
 			{
 				auto allow_unsafe (encoding == static_cast<uint8_t> (futurehead::ipc::payload_encoding::json_v1_unsafe));
+				auto chunked (encoding == static_cast<uint8_t> (futurehead::ipc::payload_encoding::json_v1_chunked));
 				// Length of payload
-				this_l->async_read_exactly (&this_l->buffer_size, sizeof (this_l->buffer_size), [this_l, allow_unsafe]() {
+				this_l->async_read_exactly (&this_l->buffer_size, sizeof (this_l->buffer_size), [this_l, allow_unsafe, chunked]() {
 					boost::endian::big_to_native_inplace (this_l->buffer_size);
 					this_l->buffer.resize (this_l->buffer_size);
 					// Payload (ptree compliant JSON string)
-					this_l->async_read_exactly (this_l->buffer.data (), this_l->buffer_size, [this_l, allow_unsafe]() {
-						this_l->handle_json_query (allow_unsafe);
+					this_l->async_read_exactly (this_l->buffer.data (), this_l->buffer_size, [this_l, allow_unsafe, chunked]() {
+						this_l->handle_json_query (allow_unsafe, chunked);
 					});
 				});
 			}
@@ -422,6 +515,14 @@ private:
 		std::function<void(boost::system::error_code const &, size_t)> callback;
 	};
 	size_t const queue_size_max = 64 * 1024;
+	/** Bytes of a chunked response which may be queued for writing before the handler producing it has to wait */
+	size_t const chunks_pending_max = 1024 * 1024;
+	/** Bytes of the current chunked response queued but not written yet */
+	size_t chunks_pending{ 0 };
+	/** Set if the current chunked response could not be written and its remaining chunks are dropped */
+	bool chunks_abandoned_m{ false };
+	std::mutex chunks_mutex;
+	futurehead::condition_variable chunks_condition;
 
 	futurehead::ipc::ipc_server & server;
 	futurehead::node & node;
@@ -1,5 +1,6 @@
 #include <futurehead/lib/config.hpp>
 #include <futurehead/lib/json_error_response.hpp>
+#include <futurehead/lib/json_writer.hpp>
 #include <futurehead/lib/timer.hpp>
 #include <futurehead/node/bootstrap/bootstrap_lazy.hpp>
 #include <futurehead/node/common.hpp>
@@ -15,6 +16,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <unordered_set>
 
 namespace
 {
@@ -22,8 +24,22 @@ void construct_json (futurehead::container_info_component * component, boost::pr
 using ipc_json_handler_no_arg_func_map = std::unordered_map<std::string, std::function<void(futurehead::json_handler *)>>;
 ipc_json_handler_no_arg_func_map create_ipc_json_handler_no_arg_func_map ();
 auto ipc_json_handler_no_arg_funcs = create_ipc_json_handler_no_arg_func_map ();
-bool block_confirmed (futurehead::node & node, futurehead::transaction & transaction, futurehead::block_hash const & hash, bool include_active, bool include_only_confirmed);
+bool block_confirmed (futurehead::node & node, futurehead::transaction const & transaction, futurehead::block_hash const & hash, bool include_active, bool include_only_confirmed);
 const char * epoch_as_string (futurehead::epoch);
+std::unordered_set<std::string> create_batch_concurrent_actions ();
+auto batch_concurrent_actions = create_batch_concurrent_actions ();
+
+class batch_requests final
+{
+public:
+	std::vector<std::string> requests;
+	std::vector<std::string> responses;
+	std::atomic<size_t> remaining{ 0 };
+	/** Requests run one after the other unless all of them only read */
+	bool concurrent{ true };
+};
+void batch_run (std::shared_ptr<futurehead::json_handler> const &, std::shared_ptr<batch_requests> const &, size_t);
+void batch_respond (std::shared_ptr<futurehead::json_handler> const &, std::shared_ptr<batch_requests> const &);
 }
 
 futurehead::json_handler::json_handler (futurehead::node & node_a, futurehead::node_rpc_config const & node_rpc_config_a, std::string const & body_a, std::function<void(std::string const &)> const & response_a, std::function<void()> stop_callback_a) :
@@ -55,6 +71,7 @@ std::function<void()> futurehead::json_handler::create_worker_task (std::functio
 
 void futurehead::json_handler::process_request (bool unsafe_a)
 {
+	unsafe = unsafe_a;
 	try
 	{
 		std::stringstream istream (body);
@@ -159,6 +176,27 @@ void futurehead::json_handler::response_errors ()
 	}
 }
 
+void futurehead::json_handler::response_stream (std::function<void(futurehead::json_writer &)> const & action_a)
+{
+	if (!ec)
+	{
+		futurehead::json_writer writer (response_chunk, response_chunk_size);
+		writer.begin_object ();
+		for (auto const & child : response_l)
+		{
+			writer.key (child.first);
+			writer.tree (child.second);
+		}
+		action_a (writer);
+		writer.end_object ();
+		response (writer.str ());
+	}
+	else
+	{
+		response_errors ();
+	}
+}
+
 std::shared_ptr<futurehead::wallet> futurehead::json_handler::wallet_impl ()
 {
 	if (!ec)
@@ -321,6 +359,16 @@ futurehead::block_hash futurehead::json_handler::hash_impl (std::string search_t
 	return result;
 }
 
+std::error_code futurehead::json_handler::block_not_found_error (futurehead::transaction const & transaction_a, futurehead::block_hash const & hash_a)
+{
+	std::error_code result (futurehead::error_blocks::not_found);
+	if (node.ledger.pruning && node.store.pruned_exists (transaction_a, hash_a))
+	{
+		result = futurehead::error_blocks::pruned;
+	}
+	return result;
+}
+
 futurehead::amount futurehead::json_handler::threshold_optional_impl ()
 {
 	futurehead::amount result (0);
@@ -437,6 +485,15 @@ futurehead::work_version futurehead::json_handler::work_version_optional_impl (f
 	return result;
 }
 
+futurehead::read_transaction const & futurehead::json_handler::tx_begin_read ()
+{
+	if (read_transaction_m == nullptr)
+	{
+		read_transaction_m = std::make_shared<futurehead::read_transaction> (node.store.tx_begin_read ());
+	}
+	return *read_transaction_m;
+}
+
 namespace
 {
 bool decode_unsigned (std::string const & text, uint64_t & number)
@@ -459,6 +516,32 @@ bool decode_unsigned (std::string const & text, uint64_t & number)
 	result = result || end != text.size ();
 	return result;
 }
+
+/*
+ * Cursors let clients resume a ledger scan where the previous page ended. They are opaque to clients and hold
+ * the fields of the store key to continue from, concatenated in hex
+ */
+template <typename... Fields>
+std::string cursor_encode (Fields const &... fields_a)
+{
+	std::string result;
+	(result.append (fields_a.to_string ()), ...);
+	return result;
+}
+
+template <typename... Fields>
+bool cursor_decode (std::string const & text_a, Fields &... fields_a)
+{
+	size_t position (0);
+	auto error (false);
+	auto decode ([&text_a, &position, &error](auto & field_a) {
+		auto size (sizeof (field_a.bytes) * 2);
+		error = error || text_a.size () < position + size || field_a.decode_hex (text_a.substr (position, size));
+		position += size;
+	});
+	(decode (fields_a), ...);
+	return error || position != text_a.size ();
+}
 }
 
 uint64_t futurehead::json_handler::count_impl ()
@@ -518,7 +601,7 @@ void futurehead::json_handler::account_block_count ()
 	auto account (account_impl ());
 	if (!ec)
 	{
-		auto transaction (node.store.tx_begin_read ());
+		auto const & transaction (tx_begin_read ());
 		auto info (account_info_impl (transaction, account));
 		if (!ec)
 		{
@@ -593,7 +676,7 @@ void futurehead::json_handler::account_info ()
 		const bool representative = request.get<bool> ("representative", false);
 		const bool weight = request.get<bool> ("weight", false);
 		const bool pending = request.get<bool> ("pending", false);
-		auto transaction (node.store.tx_begin_read ());
+		auto const & transaction (tx_begin_read ());
 		auto info (account_info_impl (transaction, account));
 		futurehead::confirmation_height_info confirmation_height_info;
 		if (node.store.confirmation_height_get (transaction, account, confirmation_height_info))
@@ -724,7 +807,7 @@ void futurehead::json_handler::account_representative ()
 	auto account (account_impl ());
 	if (!ec)
 	{
-		auto transaction (node.store.tx_begin_read ());
+		auto const & transaction (tx_begin_read ());
 		auto info (account_info_impl (transaction, account));
 		if (!ec)
 		{
@@ -858,7 +941,7 @@ void futurehead::json_handler::accounts_create ()
 void futurehead::json_handler::accounts_frontiers ()
 {
 	boost::property_tree::ptree frontiers;
-	auto transaction (node.store.tx_begin_read ());
+	auto const & transaction (tx_begin_read ());
 	for (auto & accounts : request.get_child ("accounts"))
 	{
 		auto account (account_impl (accounts.second.data ()));
@@ -885,7 +968,7 @@ void futurehead::json_handler::accounts_pending ()
 	const bool sorting = request.get<bool> ("sorting", false);
 	auto simple (threshold.is_zero () && !source && !sorting); // if simple, response is a list of hashes for each account
 	boost::property_tree::ptree pending;
-	auto transaction (node.store.tx_begin_read ());
+	auto const & transaction (tx_begin_read ());
 	for (auto & accounts : request.get_child ("accounts"))
 	{
 		auto account (account_impl (accounts.second.data ()));
@@ -979,19 +1062,81 @@ void futurehead::json_handler::available_supply ()
 	response_errors ();
 }
 
+/*
+ * Runs the list of "requests" and responds with their "responses" in the same order
+ */
+void futurehead::json_handler::batch ()
+{
+	auto batch_l (std::make_shared<batch_requests> ());
+	if (in_batch)
+	{
+		ec = futurehead::error_rpc::batch_nested;
+	}
+	if (!ec)
+	{
+		auto const & requests_node (request.get_child ("requests"));
+		if (requests_node.size () <= batch_size_max)
+		{
+			for (auto const & entry : requests_node)
+			{
+				batch_l->concurrent = batch_l->concurrent && batch_concurrent_actions.count (entry.second.get<std::string> ("action", "")) > 0;
+				std::stringstream ostream;
+				boost::property_tree::write_json (ostream, entry.second);
+				batch_l->requests.push_back (ostream.str ());
+			}
+		}
+		else
+		{
+			ec = futurehead::error_rpc::batch_size_exceeded;
+		}
+	}
+	if (!ec)
+	{
+		batch_l->responses.resize (batch_l->requests.size ());
+		batch_l->remaining = batch_l->requests.size ();
+		auto this_l (shared_from_this ());
+		if (batch_l->requests.empty ())
+		{
+			batch_respond (this_l, batch_l);
+		}
+		else if (batch_l->concurrent)
+		{
+			// Run in parallel on the RPC workers, each request with its own read transaction, so ledger reads do not hold up the io threads or the worker
+			for (size_t i (0), n (batch_l->requests.size ()); i < n; ++i)
+			{
+				node.rpc_workers.push_task ([this_l, batch_l, i]() {
+					batch_run (this_l, batch_l, i);
+				});
+			}
+		}
+		else
+		{
+			batch_run (this_l, batch_l, 0);
+		}
+	}
+	else
+	{
+		response_errors ();
+	}
+}
+
 void futurehead::json_handler::block_info ()
 {
 	auto hash (hash_impl ());
 	if (!ec)
 	{
-		auto transaction (node.store.tx_begin_read ());
+		auto const & transaction (tx_begin_read ());
 		auto block (node.store.block_get (transaction, hash));
 		if (block != nullptr)
 		{
 			futurehead::account account (block->account ().is_zero () ? block->sideband ().account : block->account ());
 			response_l.put ("block_account", account.to_account ());
-			auto amount (node.ledger.amount (transaction, hash));
-			response_l.put ("amount", amount.convert_to<std::string> ());
+			bool error_or_pruned (false);
+			auto amount (node.ledger.amount_safe (transaction, hash, error_or_pruned));
+			if (!error_or_pruned)
+			{
+				response_l.put ("amount", amount.convert_to<std::string> ());
+			}
 			auto balance (node.ledger.balance (transaction, hash));
 			response_l.put ("balance", balance.convert_to<std::string> ());
 			response_l.put ("height", std::to_string (block->sideband ().height));
@@ -1020,7 +1165,7 @@ void futurehead::json_handler::block_info ()
 		}
 		else
 		{
-			ec = futurehead::error_blocks::not_found;
+			ec = block_not_found_error (transaction, hash);
 		}
 	}
 	response_errors ();
@@ -1054,7 +1199,8 @@ void futurehead::json_handler::block_confirm ()
 				// Trigger callback for confirmed block
 				node.block_arrival.add (hash);
 				auto account (node.ledger.account (transaction, hash));
-				auto amount (node.ledger.amount (transaction, hash));
+				bool error_or_pruned (false);
+				auto amount (node.ledger.amount_safe (transaction, hash, error_or_pruned));
 				bool is_state_send (false);
 				if (auto state = dynamic_cast<futurehead::state_block *> (block_l.get ()))
 				{
@@ -1066,7 +1212,7 @@ void futurehead::json_handler::block_confirm ()
 		}
 		else
 		{
-			ec = futurehead::error_blocks::not_found;
+			ec = block_not_found_error (transaction, hash);
 		}
 	}
 	response_errors ();
@@ -1076,7 +1222,7 @@ void futurehead::json_handler::blocks ()
 {
 	const bool json_block_l = request.get<bool> ("json_block", false);
 	boost::property_tree::ptree blocks;
-	auto transaction (node.store.tx_begin_read ());
+	auto const & transaction (tx_begin_read ());
 	for (boost::property_tree::ptree::value_type & hashes : request.get_child ("hashes"))
 	{
 		if (!ec)
@@ -1125,7 +1271,7 @@ void futurehead::json_handler::blocks_info ()
 
 	boost::property_tree::ptree blocks;
 	boost::property_tree::ptree blocks_not_found;
-	auto transaction (node.store.tx_begin_read ());
+	auto const & transaction (tx_begin_read ());
 	for (boost::property_tree::ptree::value_type & hashes : request.get_child ("hashes"))
 	{
 		if (!ec)
@@ -1140,8 +1286,12 @@ void futurehead::json_handler::blocks_info ()
 					boost::property_tree::ptree entry;
 					futurehead::account account (block->account ().is_zero () ? block->sideband ().account : block->account ());
 					entry.put ("block_account", account.to_account ());
-					auto amount (node.ledger.amount (transaction, hash));
-					entry.put ("amount", amount.convert_to<std::string> ());
+					bool error_or_pruned (false);
+					auto amount (node.ledger.amount_safe (transaction, hash, error_or_pruned));
+					if (!error_or_pruned)
+					{
+						entry.put ("amount", amount.convert_to<std::string> ());
+					}
 					auto balance (node.ledger.balance (transaction, hash));
 					entry.put ("balance", balance.convert_to<std::string> ());
 					entry.put ("height", std::to_string (block->sideband ().height));
@@ -1200,7 +1350,7 @@ void futurehead::json_handler::blocks_info ()
 				}
 				else
 				{
-					ec = futurehead::error_blocks::not_found;
+					ec = block_not_found_error (transaction, hash);
 				}
 			}
 			else
@@ -1225,7 +1375,7 @@ void futurehead::json_handler::block_account ()
 	auto hash (hash_impl ());
 	if (!ec)
 	{
-		auto transaction (node.store.tx_begin_read ());
+		auto const & transaction (tx_begin_read ());
 		if (node.store.block_exists (transaction, hash))
 		{
 			auto account (node.ledger.account (transaction, hash));
@@ -1244,6 +1394,11 @@ void futurehead::json_handler::block_count ()
 	response_l.put ("count", std::to_string (node.ledger.cache.block_count));
 	response_l.put ("unchecked", std::to_string (node.ledger.cache.unchecked_count));
 	response_l.put ("cemented", std::to_string (node.ledger.cache.cemented_count));
+	if (node.ledger.pruning)
+	{
+		response_l.put ("full", std::to_string (node.ledger.cache.block_count - node.ledger.cache.pruned_count));
+		response_l.put ("pruned", std::to_string (node.ledger.cache.pruned_count));
+	}
 	response_errors ();
 }
 
@@ -1735,7 +1890,7 @@ void futurehead::json_handler::chain (bool successors)
 	if (!ec)
 	{
 		boost::property_tree::ptree blocks;
-		auto transaction (node.store.tx_begin_read ());
+		auto const & transaction (tx_begin_read ());
 		while (!hash.is_zero () && blocks.size () < count)
 		{
 			auto block_l (node.store.block_get (transaction, hash));
@@ -1866,11 +2021,12 @@ void futurehead::json_handler::confirmation_info ()
 		futurehead::lock_guard<std::mutex> guard (node.active.mutex);
 		if (election != nullptr && !election->confirmed ())
 		{
+			auto tally_l (election->tally ());
+			futurehead::lock_guard<std::mutex> election_guard (election->mutex);
 			response_l.put ("announcements", std::to_string (election->confirmation_request_count));
 			response_l.put ("voters", std::to_string (election->last_votes.size ()));
 			response_l.put ("last_winner", election->status.winner->hash ().to_string ());
 			futurehead::uint128_t total (0);
-			auto tally_l (election->tally ());
 			boost::property_tree::ptree blocks;
 			for (auto i (tally_l.begin ()), n (tally_l.end ()); i != n; ++i)
 			{
@@ -2001,22 +2157,43 @@ void futurehead::json_handler::database_txn_tracker ()
 void futurehead::json_handler::delegators ()
 {
 	auto account (account_impl ());
+	auto count (count_optional_impl ());
+	// Paging continues after the last delegator of the previous response
+	futurehead::account start (0);
+	boost::optional<std::string> start_text (request.get_optional<std::string> ("start"));
+	if (!ec && start_text.is_initialized ())
+	{
+		start = account_impl (start_text.get ()).number () + 1;
+	}
+	boost::optional<std::string> cursor_text (request.get_optional<std::string> ("cursor"));
+	if (!ec && cursor_text.is_initialized ())
+	{
+		if (cursor_decode (cursor_text.get (), start))
+		{
+			ec = futurehead::error_rpc::invalid_cursor;
+		}
+	}
 	if (!ec)
 	{
 		boost::property_tree::ptree delegators;
 		auto transaction (node.store.tx_begin_read ());
-		for (auto i (node.store.latest_begin (transaction)), n (node.store.latest_end ()); i != n; ++i)
+		auto i (node.store.delegators_begin (transaction, account, start));
+		for (auto n (node.store.delegators_end ()); i != n && i->first.representative == account && delegators.size () < count; ++i)
 		{
-			futurehead::account_info const & info (i->second);
-			if (info.representative == account)
+			futurehead::account const & delegator (i->first.account);
+			futurehead::account_info info;
+			if (!node.store.account_get (transaction, delegator, info))
 			{
 				std::string balance;
 				futurehead::uint128_union (info.balance).encode_dec (balance);
-				futurehead::account const & account (i->first);
-				delegators.put (account.to_account (), balance);
+				delegators.put (delegator.to_account (), balance);
 			}
 		}
 		response_l.add_child ("delegators", delegators);
+		if (i != node.store.delegators_end () && i->first.representative == account)
+		{
+			response_l.put ("cursor", cursor_encode (i->first.account));
+		}
 	}
 	response_errors ();
 }
@@ -2027,14 +2204,10 @@ void futurehead::json_handler::delegators_count ()
 	if (!ec)
 	{
 		uint64_t count (0);
-		auto transaction (node.store.tx_begin_read ());
-		for (auto i (node.store.latest_begin (transaction)), n (node.store.latest_end ()); i != n; ++i)
+		auto const & transaction (tx_begin_read ());
+		for (auto i (node.store.delegators_begin (transaction, account)), n (node.store.delegators_end ()); i != n && i->first.representative == account; ++i)
 		{
-			futurehead::account_info const & info (i->second);
-			if (info.representative == account)
-			{
-				++count;
-			}
+			++count;
 		}
 		response_l.put ("count", std::to_string (count));
 	}
@@ -2133,19 +2306,38 @@ void futurehead::json_handler::epoch_upgrade ()
 
 void futurehead::json_handler::frontiers ()
 {
-	auto start (account_impl ());
-	auto count (count_impl ());
-	if (!ec)
+	futurehead::account start (0);
+	boost::optional<std::string> cursor_text (request.get_optional<std::string> ("cursor"));
+	if (cursor_text.is_initialized ())
 	{
-		boost::property_tree::ptree frontiers;
-		auto transaction (node.store.tx_begin_read ());
-		for (auto i (node.store.latest_begin (transaction, start)), n (node.store.latest_end ()); i != n && frontiers.size () < count; ++i)
+		if (cursor_decode (cursor_text.get (), start))
 		{
-			frontiers.put (i->first.to_account (), i->second.head.to_string ());
+			ec = futurehead::error_rpc::invalid_cursor;
 		}
-		response_l.add_child ("frontiers", frontiers);
 	}
-	response_errors ();
+	else
+	{
+		start = account_impl ();
+	}
+	auto count (count_impl ());
+	response_stream ([this, &start, count](futurehead::json_writer & writer_a) {
+		writer_a.key ("frontiers");
+		writer_a.begin_object ();
+		uint64_t written (0);
+		auto const & transaction (tx_begin_read ());
+		auto i (node.store.latest_begin (transaction, start));
+		for (auto n (node.store.latest_end ()); i != n && written < count; ++i, ++written)
+		{
+			writer_a.key (i->first.to_account ());
+			writer_a.value (i->second.head);
+		}
+		writer_a.end_object ();
+		if (i != node.store.latest_end ())
+		{
+			writer_a.key ("cursor");
+			writer_a.value (cursor_encode (i->first));
+		}
+	});
 }
 
 void futurehead::json_handler::account_count ()
@@ -2179,8 +2371,12 @@ public:
 		tree.put ("type", "send");
 		auto account (block_a.hashables.destination.to_account ());
 		tree.put ("account", account);
-		auto amount (handler.node.ledger.amount (transaction, hash).convert_to<std::string> ());
-		tree.put ("amount", amount);
+		bool error_or_pruned (false);
+		auto amount (handler.node.ledger.amount_safe (transaction, hash, error_or_pruned).convert_to<std::string> ());
+		if (!error_or_pruned)
+		{
+			tree.put ("amount", amount);
+		}
 		if (raw)
 		{
 			tree.put ("destination", account);
@@ -2191,10 +2387,19 @@ public:
 	void receive_block (futurehead::receive_block const & block_a)
 	{
 		tree.put ("type", "receive");
-		auto account (handler.node.ledger.account (transaction, block_a.hashables.source).to_account ());
-		tree.put ("account", account);
-		auto amount (handler.node.ledger.amount (transaction, hash).convert_to<std::string> ());
-		tree.put ("amount", amount);
+		// The account and amount are unknown once the source or the previous block was pruned and are left out
+		bool error_or_pruned (false);
+		auto account (handler.node.ledger.account_safe (transaction, block_a.hashables.source, error_or_pruned));
+		if (!error_or_pruned)
+		{
+			tree.put ("account", account.to_account ());
+		}
+		error_or_pruned = false;
+		auto amount (handler.node.ledger.amount_safe (transaction, hash, error_or_pruned));
+		if (!error_or_pruned)
+		{
+			tree.put ("amount", amount.convert_to<std::string> ());
+		}
 		if (raw)
 		{
 			tree.put ("source", block_a.hashables.source.to_string ());
@@ -2217,8 +2422,18 @@ public:
 		}
 		if (block_a.hashables.source != network_params.ledger.genesis_account)
 		{
-			tree.put ("account", handler.node.ledger.account (transaction, block_a.hashables.source).to_account ());
-			tree.put ("amount", handler.node.ledger.amount (transaction, hash).convert_to<std::string> ());
+			bool error_or_pruned (false);
+			auto account (handler.node.ledger.account_safe (transaction, block_a.hashables.source, error_or_pruned));
+			if (!error_or_pruned)
+			{
+				tree.put ("account", account.to_account ());
+			}
+			error_or_pruned = false;
+			auto amount (handler.node.ledger.amount_safe (transaction, hash, error_or_pruned));
+			if (!error_or_pruned)
+			{
+				tree.put ("amount", amount.convert_to<std::string> ());
+			}
 		}
 		else
 		{
@@ -2246,8 +2461,26 @@ public:
 			tree.put ("previous", block_a.hashables.previous.to_string ());
 		}
 		auto balance (block_a.hashables.balance.number ());
-		auto previous_balance (handler.node.ledger.balance (transaction, block_a.hashables.previous));
-		if (balance < previous_balance)
+		bool error_or_pruned (false);
+		auto previous_balance (handler.node.ledger.balance_safe (transaction, block_a.hashables.previous, error_or_pruned));
+		if (error_or_pruned)
+		{
+			// Without the previous balance the direction and amount of the block cannot be told
+			if (!accounts_filter.empty ())
+			{
+				tree.clear ();
+				return;
+			}
+			if (raw)
+			{
+				tree.put ("subtype", "unknown");
+			}
+			else
+			{
+				tree.put ("type", "unknown");
+			}
+		}
+		else if (balance < previous_balance)
 		{
 			if (should_ignore_account (block_a.hashables.link))
 			{
@@ -2284,7 +2517,7 @@ public:
 			}
 			else
 			{
-				auto account (handler.node.ledger.account (transaction, block_a.hashables.link));
+				auto account (handler.node.ledger.account_safe (transaction, block_a.hashables.link, error_or_pruned));
 				if (should_ignore_account (account))
 				{
 					tree.clear ();
@@ -2298,7 +2531,10 @@ public:
 				{
 					tree.put ("type", "receive");
 				}
-				tree.put ("account", account.to_account ());
+				if (!error_or_pruned)
+				{
+					tree.put ("account", account.to_account ());
+				}
 				tree.put ("amount", (balance - previous_balance).convert_to<std::string> ());
 			}
 		}
@@ -2482,15 +2718,36 @@ void futurehead::json_handler::ledger ()
 {
 	auto count (count_optional_impl ());
 	auto threshold (threshold_optional_impl ());
+	futurehead::account start (0);
+	uint64_t modified_since (0);
+	const bool sorting = request.get<bool> ("sorting", false);
+	// Sorted pages continue below the balance and account of the last entry of the previous page
+	boost::optional<std::pair<futurehead::uint128_union, futurehead::account>> last;
 	if (!ec)
 	{
-		futurehead::account start (0);
 		boost::optional<std::string> account_text (request.get_optional<std::string> ("account"));
 		if (account_text.is_initialized ())
 		{
 			start = account_impl (account_text.get ());
 		}
-		uint64_t modified_since (0);
+		boost::optional<std::string> cursor_text (request.get_optional<std::string> ("cursor"));
+		if (!ec && cursor_text.is_initialized ())
+		{
+			auto error (false);
+			if (sorting)
+			{
+				last = std::make_pair (futurehead::uint128_union (0), futurehead::account (0));
+				error = cursor_decode (cursor_text.get (), last->first, last->second);
+			}
+			else
+			{
+				error = cursor_decode (cursor_text.get (), start);
+			}
+			if (error)
+			{
+				ec = futurehead::error_rpc::invalid_cursor;
+			}
+		}
 		boost::optional<std::string> modified_since_text (request.get_optional<std::string> ("modified_since"));
 		if (modified_since_text.is_initialized ())
 		{
@@ -2499,106 +2756,132 @@ void futurehead::json_handler::ledger ()
 				ec = futurehead::error_rpc::invalid_timestamp;
 			}
 		}
-		const bool sorting = request.get<bool> ("sorting", false);
-		const bool representative = request.get<bool> ("representative", false);
-		const bool weight = request.get<bool> ("weight", false);
-		const bool pending = request.get<bool> ("pending", false);
-		boost::property_tree::ptree accounts;
+	}
+	const bool representative = request.get<bool> ("representative", false);
+	const bool weight = request.get<bool> ("weight", false);
+	const bool pending = request.get<bool> ("pending", false);
+	response_stream ([this, &start, &threshold, &last, count, modified_since, sorting, representative, weight, pending](futurehead::json_writer & writer_a) {
+		writer_a.key ("accounts");
+		writer_a.begin_object ();
+		uint64_t written (0);
 		auto transaction (node.store.tx_begin_read ());
-		if (!ec && !sorting) // Simple
-		{
-			for (auto i (node.store.latest_begin (transaction, start)), n (node.store.latest_end ()); i != n && accounts.size () < count; ++i)
+		auto write_account = [this, &transaction, &writer_a, &threshold, &written, representative, weight, pending](futurehead::account const & account, futurehead::account_info const & info) {
+			futurehead::uint128_t account_pending (0);
+			if (pending)
 			{
-				futurehead::account_info const & info (i->second);
-				if (info.modified >= modified_since && (pending || info.balance.number () >= threshold.number ()))
+				account_pending = node.ledger.account_pending (transaction, account);
+				if (info.balance.number () + account_pending < threshold.number ())
 				{
-					futurehead::account const & account (i->first);
-					boost::property_tree::ptree response_a;
-					if (pending)
-					{
-						auto account_pending (node.ledger.account_pending (transaction, account));
-						if (info.balance.number () + account_pending < threshold.number ())
-						{
-							continue;
-						}
-						response_a.put ("pending", account_pending.convert_to<std::string> ());
-					}
-					response_a.put ("frontier", info.head.to_string ());
-					response_a.put ("open_block", info.open_block.to_string ());
-					response_a.put ("representative_block", node.ledger.representative (transaction, info.head).to_string ());
-					std::string balance;
-					futurehead::uint128_union (info.balance).encode_dec (balance);
-					response_a.put ("balance", balance);
-					response_a.put ("modified_timestamp", std::to_string (info.modified));
-					response_a.put ("block_count", std::to_string (info.block_count));
-					if (representative)
-					{
-						response_a.put ("representative", info.representative.to_account ());
-					}
-					if (weight)
-					{
-						auto account_weight (node.ledger.weight (account));
-						response_a.put ("weight", account_weight.convert_to<std::string> ());
-					}
-					accounts.push_back (std::make_pair (account.to_account (), response_a));
+					return;
 				}
 			}
-		}
-		else if (!ec) // Sorting
+			writer_a.key (account.to_account ());
+			writer_a.begin_object ();
+			if (pending)
+			{
+				writer_a.key ("pending");
+				writer_a.value (account_pending);
+			}
+			writer_a.key ("frontier");
+			writer_a.value (info.head);
+			writer_a.key ("open_block");
+			writer_a.value (info.open_block);
+			writer_a.key ("representative_block");
+			writer_a.value (node.ledger.representative (transaction, info.head));
+			writer_a.key ("balance");
+			writer_a.value (info.balance.number ());
+			writer_a.key ("modified_timestamp");
+			writer_a.value (info.modified);
+			writer_a.key ("block_count");
+			writer_a.value (info.block_count);
+			if (representative)
+			{
+				writer_a.key ("representative");
+				writer_a.account (info.representative);
+			}
+			if (weight)
+			{
+				writer_a.key ("weight");
+				writer_a.value (node.ledger.weight (account));
+			}
+			writer_a.end_object ();
+			++written;
+		};
+		std::string cursor;
+		if (!sorting) // Simple
 		{
-			std::vector<std::pair<futurehead::uint128_union, futurehead::account>> ledger_l;
-			for (auto i (node.store.latest_begin (transaction, start)), n (node.store.latest_end ()); i != n; ++i)
+			auto i (node.store.latest_begin (transaction, start));
+			for (auto n (node.store.latest_end ()); i != n && written < count; ++i)
 			{
 				futurehead::account_info const & info (i->second);
-				futurehead::uint128_union balance (info.balance);
-				if (info.modified >= modified_since)
+				if (info.modified >= modified_since && (pending || info.balance.number () >= threshold.number ()))
 				{
-					ledger_l.emplace_back (balance, i->first);
+					write_account (i->first, info);
 				}
 			}
-			std::sort (ledger_l.begin (), ledger_l.end ());
-			std::reverse (ledger_l.begin (), ledger_l.end ());
-			futurehead::account_info info;
-			for (auto i (ledger_l.begin ()), n (ledger_l.end ()); i != n && accounts.size () < count; ++i)
+			if (i != node.store.latest_end ())
 			{
-				node.store.account_get (transaction, i->second, info);
-				if (pending || info.balance.number () >= threshold.number ())
+				cursor = cursor_encode (i->first);
+			}
+		}
+		else // Sorting
+		{
+			// Only the highest balances up to the remaining count are kept while scanning. If the pending filter drops some,
+			// another round selects twice as many
+			using entry = std::pair<futurehead::uint128_union, futurehead::account>;
+			auto more (true);
+			uint64_t page_size (0);
+			while (more && written < count)
+			{
+				std::vector<entry> page;
+				page_size = std::max (count - written, page_size * 2);
+				for (auto i (node.store.latest_begin (transaction, start)), n (node.store.latest_end ()); i != n; ++i)
 				{
-					futurehead::account const & account (i->second);
-					boost::property_tree::ptree response_a;
-					if (pending)
+					futurehead::account_info const & info (i->second);
+					if (info.modified >= modified_since && (pending || info.balance.number () >= threshold.number ()))
 					{
-						auto account_pending (node.ledger.account_pending (transaction, account));
-						if (info.balance.number () + account_pending < threshold.number ())
+						entry entry_l (info.balance, i->first);
+						if (!last.is_initialized () || entry_l < *last)
 						{
-							continue;
+							if (page.size () < page_size)
+							{
+								page.push_back (entry_l);
+								std::push_heap (page.begin (), page.end (), std::greater<entry> ());
+							}
+							else if (page.front () < entry_l)
+							{
+								std::pop_heap (page.begin (), page.end (), std::greater<entry> ());
+								page.back () = entry_l;
+								std::push_heap (page.begin (), page.end (), std::greater<entry> ());
+							}
 						}
-						response_a.put ("pending", account_pending.convert_to<std::string> ());
-					}
-					response_a.put ("frontier", info.head.to_string ());
-					response_a.put ("open_block", info.open_block.to_string ());
-					response_a.put ("representative_block", node.ledger.representative (transaction, info.head).to_string ());
-					std::string balance;
-					(i->first).encode_dec (balance);
-					response_a.put ("balance", balance);
-					response_a.put ("modified_timestamp", std::to_string (info.modified));
-					response_a.put ("block_count", std::to_string (info.block_count));
-					if (representative)
-					{
-						response_a.put ("representative", info.representative.to_account ());
 					}
-					if (weight)
+				}
+				more = page.size () == page_size;
+				std::sort_heap (page.begin (), page.end (), std::greater<entry> ());
+				futurehead::account_info info;
+				for (auto i (page.begin ()), n (page.end ()); i != n && written < count; ++i)
+				{
+					last = *i;
+					node.store.account_get (transaction, i->second, info);
+					if (pending || info.balance.number () >= threshold.number ())
 					{
-						auto account_weight (node.ledger.weight (account));
-						response_a.put ("weight", account_weight.convert_to<std::string> ());
+						write_account (i->second, info);
 					}
-					accounts.push_back (std::make_pair (account.to_account (), response_a));
 				}
 			}
+			if (written == count && last.is_initialized ())
+			{
+				cursor = cursor_encode (last->first, last->second);
+			}
 		}
-		response_l.add_child ("accounts", accounts);
-	}
-	response_errors ();
+		writer_a.end_object ();
+		if (!cursor.empty ())
+		{
+			writer_a.key ("cursor");
+			writer_a.value (cursor);
+		}
+	});
 }
 
 void futurehead::json_handler::mfuturehead_from_raw (futurehead::uint128_t ratio)
@@ -2763,7 +3046,7 @@ void futurehead::json_handler::pending ()
 	if (!ec)
 	{
 		boost::property_tree::ptree peers_l;
-		auto transaction (node.store.tx_begin_read ());
+		auto const & transaction (tx_begin_read ());
 		for (auto i (node.store.pending_begin (transaction, futurehead::pending_key (account, 0))), n (node.store.pending_end ()); i != n && futurehead::pending_key (i->first).account == account && peers_l.size () < count; ++i)
 		{
 			futurehead::pending_key const & key (i->first);
@@ -2829,7 +3112,7 @@ void futurehead::json_handler::pending_exists ()
 	const bool include_only_confirmed = request.get<bool> ("include_only_confirmed", false);
 	if (!ec)
 	{
-		auto transaction (node.store.tx_begin_read ());
+		auto const & transaction (tx_begin_read ());
 		auto block (node.store.block_get (transaction, hash));
 		if (block != nullptr)
 		{
@@ -3903,29 +4186,51 @@ void futurehead::json_handler::unchecked ()
 {
 	const bool json_block_l = request.get<bool> ("json_block", false);
 	auto count (count_optional_impl ());
-	if (!ec)
+	futurehead::unchecked_key start;
+	boost::optional<std::string> cursor_text (request.get_optional<std::string> ("cursor"));
+	if (!ec && cursor_text.is_initialized ())
 	{
-		boost::property_tree::ptree unchecked;
+		if (cursor_decode (cursor_text.get (), start.previous, start.hash))
+		{
+			ec = futurehead::error_rpc::invalid_cursor;
+		}
+	}
+	response_stream ([this, &start, json_block_l, count](futurehead::json_writer & writer_a) {
+		writer_a.key ("blocks");
+		writer_a.begin_object ();
+		// A block waiting for several dependencies is stored once for each, it is written once and counted once
+		std::unordered_set<futurehead::block_hash> written;
 		auto transaction (node.store.tx_begin_read ());
-		for (auto i (node.store.unchecked_begin (transaction)), n (node.store.unchecked_end ()); i != n && unchecked.size () < count; ++i)
+		auto i (node.store.unchecked_begin (transaction, start));
+		for (auto n (node.store.unchecked_end ()); i != n && written.size () < count; ++i)
 		{
 			futurehead::unchecked_info const & info (i->second);
+			auto hash (info.block->hash ());
+			if (!written.insert (hash).second)
+			{
+				continue;
+			}
+			writer_a.key (hash.to_string ());
 			if (json_block_l)
 			{
 				boost::property_tree::ptree block_node_l;
 				info.block->serialize_json (block_node_l);
-				unchecked.add_child (info.block->hash ().to_string (), block_node_l);
+				writer_a.tree (block_node_l);
 			}
 			else
 			{
 				std::string contents;
 				info.block->serialize_json (contents);
-				unchecked.put (info.block->hash ().to_string (), contents);
+				writer_a.value (contents);
 			}
 		}
-		response_l.add_child ("blocks", unchecked);
-	}
-	response_errors ();
+		writer_a.end_object ();
+		if (i != node.store.unchecked_end ())
+		{
+			writer_a.key ("cursor");
+			writer_a.value (cursor_encode (i->first.previous, i->first.hash));
+		}
+	});
 }
 
 void futurehead::json_handler::unchecked_clear ()
@@ -4030,6 +4335,14 @@ void futurehead::json_handler::unopened ()
 	{
 		start = account_impl (account_text.get ());
 	}
+	boost::optional<std::string> cursor_text (request.get_optional<std::string> ("cursor"));
+	if (!ec && cursor_text.is_initialized ())
+	{
+		if (cursor_decode (cursor_text.get (), start))
+		{
+			ec = futurehead::error_rpc::invalid_cursor;
+		}
+	}
 	if (!ec)
 	{
 		auto transaction (node.store.tx_begin_read ());
@@ -4070,12 +4383,23 @@ void futurehead::json_handler::unopened ()
 				++iterator;
 			}
 		}
+		// The current account is not written yet if the page filled up while summing it
+		auto current_account_pending (current_account_sum > 0);
 		// last one after iterator reaches end
-		if (accounts.size () < count && current_account_sum > 0 && current_account_sum >= threshold.number ())
+		if (accounts.size () < count && current_account_pending)
 		{
-			accounts.put (current_account.to_account (), current_account_sum.convert_to<std::string> ());
+			if (current_account_sum >= threshold.number ())
+			{
+				accounts.put (current_account.to_account (), current_account_sum.convert_to<std::string> ());
+			}
+			current_account_pending = false;
 		}
 		response_l.add_child ("accounts", accounts);
+		if (current_account_pending)
+		{
+			// The current account may be incomplete even if the iterator reached the end. The next page starts over with it
+			response_l.put ("cursor", cursor_encode (current_account));
+		}
 	}
 	response_errors ();
 }
@@ -4411,8 +4735,9 @@ void futurehead::json_handler::wallet_history ()
 				auto hash (info.head);
 				while (timestamp >= modified_since && !hash.is_zero ())
 				{
+					// The walk ends at a pruned previous block
 					auto block (node.store.block_get (block_transaction, hash));
-					timestamp = block->sideband ().timestamp;
+					timestamp = block != nullptr ? block->sideband ().timestamp : 0;
 					if (block != nullptr && timestamp >= modified_since)
 					{
 						boost::property_tree::ptree entry;
@@ -4469,12 +4794,25 @@ void futurehead::json_handler::wallet_ledger ()
 		modified_since = strtoul (modified_since_text.get ().c_str (), NULL, 10);
 	}
 	auto wallet (wallet_impl ());
-	if (!ec)
+	auto count (count_optional_impl ());
+	boost::optional<futurehead::account> start;
+	boost::optional<std::string> cursor_text (request.get_optional<std::string> ("cursor"));
+	if (!ec && cursor_text.is_initialized ())
 	{
-		boost::property_tree::ptree accounts;
+		start = futurehead::account (0);
+		if (cursor_decode (cursor_text.get (), *start))
+		{
+			ec = futurehead::error_rpc::invalid_cursor;
+		}
+	}
+	response_stream ([this, &wallet, &start, count, modified_since, representative, weight, pending](futurehead::json_writer & writer_a) {
+		writer_a.key ("accounts");
+		writer_a.begin_object ();
+		uint64_t written (0);
 		auto transaction (node.wallets.tx_begin_read ());
 		auto block_transaction (node.store.tx_begin_read ());
-		for (auto i (wallet->store.begin (transaction)), n (wallet->store.end ()); i != n; ++i)
+		auto i (start.is_initialized () ? wallet->store.begin (transaction, *start) : wallet->store.begin (transaction));
+		for (auto n (wallet->store.end ()); i != n && written < count; ++i)
 		{
 			futurehead::account const & account (i->first);
 			futurehead::account_info info;
@@ -4482,36 +4820,47 @@ void futurehead::json_handler::wallet_ledger ()
 			{
 				if (info.modified >= modified_since)
 				{
-					boost::property_tree::ptree entry;
-					entry.put ("frontier", info.head.to_string ());
-					entry.put ("open_block", info.open_block.to_string ());
-					entry.put ("representative_block", node.ledger.representative (block_transaction, info.head).to_string ());
-					std::string balance;
-					futurehead::uint128_union (info.balance).encode_dec (balance);
-					entry.put ("balance", balance);
-					entry.put ("modified_timestamp", std::to_string (info.modified));
-					entry.put ("block_count", std::to_string (info.block_count));
+					writer_a.key (account.to_account ());
+					writer_a.begin_object ();
+					writer_a.key ("frontier");
+					writer_a.value (info.head);
+					writer_a.key ("open_block");
+					writer_a.value (info.open_block);
+					writer_a.key ("representative_block");
+					writer_a.value (node.ledger.representative (block_transaction, info.head));
+					writer_a.key ("balance");
+					writer_a.value (info.balance.number ());
+					writer_a.key ("modified_timestamp");
+					writer_a.value (info.modified);
+					writer_a.key ("block_count");
+					writer_a.value (info.block_count);
 					if (representative)
 					{
-						entry.put ("representative", info.representative.to_account ());
+						writer_a.key ("representative");
+						writer_a.account (info.representative);
 					}
 					if (weight)
 					{
-						auto account_weight (node.ledger.weight (account));
-						entry.put ("weight", account_weight.convert_to<std::string> ());
+						writer_a.key ("weight");
+						writer_a.value (node.ledger.weight (account));
 					}
 					if (pending)
 					{
-						auto account_pending (node.ledger.account_pending (block_transaction, account));
-						entry.put ("pending", account_pending.convert_to<std::string> ());
+						writer_a.key ("pending");
+						writer_a.value (node.ledger.account_pending (block_transaction, account));
 					}
-					accounts.push_back (std::make_pair (account.to_account (), entry));
+					writer_a.end_object ();
+					++written;
 				}
 			}
 		}
-		response_l.add_child ("accounts", accounts);
-	}
-	response_errors ();
+		writer_a.end_object ();
+		if (i != wallet->store.end ())
+		{
+			writer_a.key ("cursor");
+			writer_a.value (cursor_encode (i->first));
+		}
+	});
 }
 
 void futurehead::json_handler::wallet_lock ()
@@ -4983,6 +5332,16 @@ void futurehead::inprocess_rpc_handler::process_request (std::string const &, st
 	handler->process_request ();
 }
 
+void futurehead::inprocess_rpc_handler::process_request_chunked (std::string const &, std::string const & body_a, std::function<void(std::string const &)> response_chunk_a, std::function<void(std::string const &)> response_a)
+{
+	auto handler (std::make_shared<futurehead::json_handler> (node, node_rpc_config, body_a, response_a, [this]() {
+		this->stop_callback ();
+		this->stop ();
+	}));
+	handler->response_chunk = response_chunk_a;
+	handler->process_request ();
+}
+
 void futurehead::inprocess_rpc_handler::process_request_v2 (rpc_handler_request_params const & params_a, std::string const & body_a, std::function<void(std::shared_ptr<std::string>)> response_a)
 {
 	std::string body_l = params_a.json_envelope (body_a);
@@ -5041,6 +5400,7 @@ ipc_json_handler_no_arg_func_map create_ipc_json_handler_no_arg_func_map ()
 	no_arg_funcs.emplace ("accounts_pending", &futurehead::json_handler::accounts_pending);
 	no_arg_funcs.emplace ("active_difficulty", &futurehead::json_handler::active_difficulty);
 	no_arg_funcs.emplace ("available_supply", &futurehead::json_handler::available_supply);
+	no_arg_funcs.emplace ("batch", &futurehead::json_handler::batch);
 	no_arg_funcs.emplace ("block_info", &futurehead::json_handler::block_info);
 	no_arg_funcs.emplace ("block", &futurehead::json_handler::block_info);
 	no_arg_funcs.emplace ("block_confirm", &futurehead::json_handler::block_confirm);
@@ -5138,7 +5498,7 @@ ipc_json_handler_no_arg_func_map create_ipc_json_handler_no_arg_func_map ()
 }
 
 /** Due to the asynchronous nature of updating confirmation heights, it can also be necessary to check active roots */
-bool block_confirmed (futurehead::node & node, futurehead::transaction & transaction, futurehead::block_hash const & hash, bool include_active, bool include_only_confirmed)
+bool block_confirmed (futurehead::node & node, futurehead::transaction const & transaction, futurehead::block_hash const & hash, bool include_active, bool include_only_confirmed)
 {
 	bool is_confirmed = false;
 	if (include_active && !include_only_confirmed)
@@ -5172,4 +5532,71 @@ const char * epoch_as_string (futurehead::epoch epoch)
 			return "0";
 	}
 }
+
+std::unordered_set<std::string> create_batch_concurrent_actions ()
+{
+	std::unordered_set<std::string> set;
+	set.emplace ("account_balance");
+	set.emplace ("account_block_count");
+	set.emplace ("account_info");
+	set.emplace ("account_key");
+	set.emplace ("account_representative");
+	set.emplace ("account_weight");
+	set.emplace ("accounts_balances");
+	set.emplace ("accounts_frontiers");
+	set.emplace ("accounts_pending");
+	set.emplace ("block");
+	set.emplace ("block_account");
+	set.emplace ("block_count");
+	set.emplace ("block_info");
+	set.emplace ("blocks");
+	set.emplace ("blocks_info");
+	set.emplace ("chain");
+	set.emplace ("delegators_count");
+	set.emplace ("frontier_count");
+	set.emplace ("frontiers");
+	set.emplace ("pending");
+	set.emplace ("pending_exists");
+	set.emplace ("successors");
+	set.emplace ("validate_account_number");
+	set.emplace ("version");
+	return set;
+}
+
+void batch_run (std::shared_ptr<futurehead::json_handler> const & handler_a, std::shared_ptr<batch_requests> const & batch_a, size_t index_a)
+{
+	auto request_handler (std::make_shared<futurehead::json_handler> (handler_a->node, handler_a->node_rpc_config, batch_a->requests[index_a], [handler_a, batch_a, index_a](std::string const & response_a) {
+		batch_a->responses[index_a] = response_a;
+		if (--batch_a->remaining == 0)
+		{
+			batch_respond (handler_a, batch_a);
+		}
+		else if (!batch_a->concurrent)
+		{
+			// Posted rather than called, so requests answered synchronously do not nest
+			handler_a->node.io_ctx.post ([handler_a, batch_a, index_a]() {
+				batch_run (handler_a, batch_a, index_a + 1);
+			});
+		}
+	},
+	handler_a->stop_callback));
+	request_handler->in_batch = true;
+	request_handler->process_request (handler_a->unsafe);
+}
+
+void batch_respond (std::shared_ptr<futurehead::json_handler> const & handler_a, std::shared_ptr<batch_requests> const & batch_a)
+{
+	handler_a->response_stream ([&batch_a](futurehead::json_writer & writer_a) {
+		writer_a.key ("responses");
+		writer_a.begin_array ();
+		for (auto const & response : batch_a->responses)
+		{
+			boost::property_tree::ptree response_l;
+			std::stringstream istream (response);
+			boost::property_tree::read_json (istream, response_l);
+			writer_a.tree (response_l);
+		}
+		writer_a.end_array ();
+	});
+}
 }
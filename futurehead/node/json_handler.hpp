@@ -12,6 +12,7 @@
 
 namespace futurehead
 {
+class json_writer;
 namespace ipc
 {
 	class ipc_server;
@@ -45,6 +46,7 @@ public:
 	void accounts_pending ();
 	void active_difficulty ();
 	void available_supply ();
+	void batch ();
 	void block_info ();
 	void block_confirm ();
 	void blocks ();
@@ -143,7 +145,15 @@ public:
 	futurehead::node & node;
 	boost::property_tree::ptree request;
 	std::function<void(std::string const &)> response;
+	/**
+	 * If set, streamed responses are passed here in chunks of about response_chunk_size bytes as they are produced.
+	 * The remainder is then passed to response, which is still called exactly once to complete every response
+	 */
+	std::function<void(std::string const &)> response_chunk;
+	size_t response_chunk_size{ 64 * 1024 };
 	void response_errors ();
+	/** Responds with the fields already in response_l followed by those written by \p action_a, without building a property tree for them */
+	void response_stream (std::function<void(futurehead::json_writer &)> const & action_a);
 	std::error_code ec;
 	std::string action;
 	boost::property_tree::ptree response_l;
@@ -155,6 +165,7 @@ public:
 	futurehead::amount amount_impl ();
 	std::shared_ptr<futurehead::block> block_impl (bool = true);
 	futurehead::block_hash hash_impl (std::string = "hash");
+	std::error_code block_not_found_error (futurehead::transaction const &, futurehead::block_hash const &);
 	futurehead::amount threshold_optional_impl ();
 	uint64_t work_optional_impl ();
 	uint64_t count_impl ();
@@ -164,7 +175,15 @@ public:
 	uint64_t difficulty_ledger (futurehead::block const &);
 	double multiplier_optional_impl (futurehead::work_version const, uint64_t &);
 	futurehead::work_version work_version_optional_impl (futurehead::work_version const default_a);
+	futurehead::read_transaction const & tx_begin_read ();
 	bool enable_sign_hash{ false };
+	/** Whether unsafe actions are allowed, as passed to process_request */
+	bool unsafe{ false };
+	/** Set for the requests of a batch, which cannot contain another batch */
+	bool in_batch{ false };
+	static size_t constexpr batch_size_max{ 1024 };
+	/** Started by the first read only action and kept for the rest of the request */
+	std::shared_ptr<futurehead::read_transaction> read_transaction_m;
 	std::function<void()> stop_callback;
 	futurehead::node_rpc_config const & node_rpc_config;
 	std::function<void()> create_worker_task (std::function<void(std::shared_ptr<futurehead::json_handler> const &)> const &);
@@ -183,6 +202,7 @@ public:
 	}
 
 	void process_request (std::string const &, std::string const & body_a, std::function<void(std::string const &)> response_a) override;
+	void process_request_chunked (std::string const &, std::string const & body_a, std::function<void(std::string const &)> response_chunk_a, std::function<void(std::string const &)> response_a) override;
 	void process_request_v2 (rpc_handler_request_params const & params_a, std::string const & body_a, std::function<void(std::shared_ptr<std::string>)> response_a) override;
 
 	void stop () override
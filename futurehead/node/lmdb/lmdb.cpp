@@ -12,6 +12,7 @@
 #include <boost/polymorphic_cast.hpp>
 
 #include <queue>
+#include <thread>
 
 namespace futurehead
 {
@@ -40,9 +41,11 @@ void mdb_val::convert_buffer_to_value ()
 }
 }
 
-futurehead::mdb_store::mdb_store (futurehead::logger_mt & logger_a, boost::filesystem::path const & path_a, futurehead::txn_tracking_config const & txn_tracking_config_a, std::chrono::milliseconds block_processor_batch_max_time_a, futurehead::lmdb_config const & lmdb_config_a, size_t const batch_size_a, bool backup_before_upgrade_a) :
+futurehead::mdb_store::mdb_store (futurehead::logger_mt & logger_a, boost::filesystem::path const & path_a, futurehead::txn_tracking_config const & txn_tracking_config_a, std::chrono::milliseconds block_processor_batch_max_time_a, futurehead::lmdb_config const & lmdb_config_a, size_t const batch_size_a, bool backup_before_upgrade_a, size_t account_cache_size_a, size_t block_cache_size_a) :
+block_store_partial (account_cache_size_a, block_cache_size_a),
 logger (logger_a),
 env (error, path_a, futurehead::mdb_env::options::make ().set_config (lmdb_config_a).set_use_no_mem_init (true)),
+compaction (std::make_unique<futurehead::mdb_compaction> (*this, path_a, lmdb_config_a, logger_a)),
 mdb_txn_tracker (logger_a, txn_tracking_config_a, block_processor_batch_max_time_a),
 txn_tracking_enabled (txn_tracking_config_a.enable)
 {
@@ -94,6 +97,8 @@ txn_tracking_enabled (txn_tracking_config_a.enable)
 				auto vacuum_success = vacuum_after_upgrade (path_a, lmdb_config_a);
 				logger.always_log (vacuum_success ? "Vacuum succeeded." : "Failed to vacuum. (Optional) Ensure enough disk space is available for a copy of the database and try to vacuum after shutting down the node");
 			}
+			// Upgrades write tables directly, discard anything cached from before they ran
+			cache.clear ();
 		}
 		else
 		{
@@ -103,6 +108,14 @@ txn_tracking_enabled (txn_tracking_config_a.enable)
 	}
 }
 
+futurehead::mdb_store::~mdb_store ()
+{
+	if (compaction->copied ())
+	{
+		compaction->finish ();
+	}
+}
+
 bool futurehead::mdb_store::vacuum_after_upgrade (boost::filesystem::path const & path_a, futurehead::lmdb_config const & lmdb_config_a)
 {
 	// Vacuum the database. This is not a required step and may actually fail if there isn't enough storage space.
@@ -145,12 +158,61 @@ void futurehead::mdb_store::serialize_mdb_tracker (boost::property_tree::ptree &
 
 futurehead::write_transaction futurehead::mdb_store::tx_begin_write (std::vector<futurehead::tables> const &, std::vector<futurehead::tables> const &)
 {
-	return env.tx_begin_write (create_txn_callbacks ());
+	return env.tx_begin_write (create_txn_callbacks (true));
 }
 
 futurehead::read_transaction futurehead::mdb_store::tx_begin_read ()
 {
-	return env.tx_begin_read (create_txn_callbacks ());
+	return env.tx_begin_read (create_txn_callbacks (false));
+}
+
+bool futurehead::mdb_store::transaction_acquire ()
+{
+	auto result (transactions_counted.load ());
+	if (result)
+	{
+		futurehead::unique_lock<std::mutex> lock (transactions_mutex);
+		transactions_condition.wait (lock, [this]() { return !transactions_held; });
+		++transactions_live;
+	}
+	return result;
+}
+
+void futurehead::mdb_store::transaction_release ()
+{
+	futurehead::lock_guard<std::mutex> guard (transactions_mutex);
+	debug_assert (transactions_live > 0);
+	if (--transactions_live == 0 && transactions_held)
+	{
+		transactions_condition.notify_all ();
+	}
+}
+
+bool futurehead::mdb_store::reopen (boost::filesystem::path const & path_a, futurehead::lmdb_config const & config_a, std::chrono::milliseconds timeout_a, std::function<void()> const & action_a)
+{
+	futurehead::unique_lock<std::mutex> lock (transactions_mutex);
+	transactions_held = true;
+	// A thread opening a transaction while it holds another one waits here as well, so the wait is bounded rather than retried until it succeeds
+	auto result (!transactions_condition.wait_for (lock, timeout_a, [this]() { return transactions_live == 0; }));
+	if (!result)
+	{
+		mdb_env_sync (env.environment, true);
+		mdb_env_close (env.environment);
+		env.environment = nullptr;
+		action_a ();
+		auto error_l (false);
+		env.init (error_l, path_a, futurehead::mdb_env::options::make ().set_config (config_a).set_use_no_mem_init (true));
+		if (!error_l)
+		{
+			auto transaction (env.tx_begin_read ());
+			open_databases (error_l, transaction, 0);
+		}
+		release_assert (!error_l);
+	}
+	transactions_held = false;
+	lock.unlock ();
+	transactions_condition.notify_all ();
+	return result;
 }
 
 std::string futurehead::mdb_store::vendor_get () const
@@ -158,18 +220,36 @@ std::string futurehead::mdb_store::vendor_get () const
 	return boost::str (boost::format ("LMDB %1%.%2%.%3%") % MDB_VERSION_MAJOR % MDB_VERSION_MINOR % MDB_VERSION_PATCH);
 }
 
-futurehead::mdb_txn_callbacks futurehead::mdb_store::create_txn_callbacks ()
+futurehead::mdb_txn_callbacks futurehead::mdb_store::create_txn_callbacks (bool is_write_a)
 {
 	futurehead::mdb_txn_callbacks mdb_txn_callbacks;
-	if (txn_tracking_enabled)
-	{
-		mdb_txn_callbacks.txn_start = ([& mdb_txn_tracker = mdb_txn_tracker](const futurehead::transaction_impl * transaction_impl) {
+	// Read snapshots are taken after this point, so they contain at least the current generation. This is refreshed whenever the transaction is reset.
+	auto generation (std::make_shared<uint64_t> (cache.generation ()));
+	mdb_txn_callbacks.txn_start = ([this, is_write_a, generation](const futurehead::transaction_impl * transaction_impl) {
+		// Write transactions hold the write lock, so every commit released so far is part of their snapshot
+		cache.txn_start (transaction_impl->get_handle (), is_write_a ? cache.generation () : *generation);
+		if (txn_tracking_enabled)
+		{
 			mdb_txn_tracker.add (transaction_impl);
-		});
-		mdb_txn_callbacks.txn_end = ([& mdb_txn_tracker = mdb_txn_tracker](const futurehead::transaction_impl * transaction_impl) {
+		}
+	});
+	mdb_txn_callbacks.txn_commit = ([this](const futurehead::transaction_impl * transaction_impl) {
+		cache.txn_commit (transaction_impl->get_handle ());
+	});
+	mdb_txn_callbacks.txn_end = ([this, is_write_a, generation](const futurehead::transaction_impl * transaction_impl) {
+		cache.txn_end (transaction_impl->get_handle (), is_write_a);
+		*generation = cache.generation ();
+		if (txn_tracking_enabled)
+		{
 			mdb_txn_tracker.erase (transaction_impl);
-		});
-	}
+		}
+	});
+	mdb_txn_callbacks.txn_acquire = ([this]() {
+		return transaction_acquire ();
+	});
+	mdb_txn_callbacks.txn_release = ([this]() {
+		transaction_release ();
+	});
 	return mdb_txn_callbacks;
 }
 
@@ -196,6 +276,24 @@ void futurehead::mdb_store::open_databases (bool & error_a, futurehead::transact
 	error_a |= mdb_dbi_open (env.tx (transaction_a), "pending", flags, &pending_v0) != 0;
 	pending = pending_v0;
 
+	if (version_get (transaction_a) >= 19)
+	{
+		// The pruned database is created during the v18 to v19 upgrade
+		error_a |= mdb_dbi_open (env.tx (transaction_a), "pruned", flags, &pruned) != 0;
+	}
+
+	if (version_get (transaction_a) >= 20)
+	{
+		// The delegators database is created during the v19 to v20 upgrade
+		error_a |= mdb_dbi_open (env.tx (transaction_a), "delegators", flags, &delegators) != 0;
+	}
+
+	if (version_get (transaction_a) >= 21)
+	{
+		// The pending_totals database is created during the v20 to v21 upgrade
+		error_a |= mdb_dbi_open (env.tx (transaction_a), "pending_totals", flags, &pending_totals) != 0;
+	}
+
 	if (version_get (transaction_a) < 16)
 	{
 		// The representation database is no longer used, but needs opening so that it can be deleted during an upgrade
@@ -261,6 +359,12 @@ bool futurehead::mdb_store::do_upgrades (futurehead::write_transaction & transac
 			upgrade_v17_to_v18 (transaction_a);
 			needs_vacuuming = true;
 		case 18:
+			upgrade_v18_to_v19 (transaction_a);
+		case 19:
+			upgrade_v19_to_v20 (transaction_a);
+		case 20:
+			upgrade_v20_to_v21 (transaction_a);
+		case 21:
 			break;
 		default:
 			logger.always_log (boost::str (boost::format ("The version of the ledger (%1%) is too high for this node") % version_l));
@@ -707,97 +811,72 @@ void futurehead::mdb_store::upgrade_v15_to_v16 (futurehead::write_transaction co
 	version_put (transaction_a, 16);
 }
 
-void futurehead::mdb_store::upgrade_v16_to_v17 (futurehead::write_transaction const & transaction_a)
+void futurehead::mdb_store::upgrade_v16_to_v17 (futurehead::write_transaction & transaction_a)
 {
 	logger.always_log ("Preparing v16 to v17 database upgrade...");
 
-	auto account_info_i = latest_begin (transaction_a);
-	auto account_info_n = latest_end ();
-
 	// Set the confirmed frontier for each account in the confirmation height table
-	std::vector<std::pair<futurehead::account, futurehead::confirmation_height_info>> confirmation_height_infos;
-	auto num = 0u;
-	for (futurehead::mdb_iterator<futurehead::account, uint64_t> i (transaction_a, confirmation_height), n (futurehead::mdb_iterator<futurehead::account, uint64_t>{}); i != n; ++i, ++account_info_i, ++num)
-	{
-		futurehead::account account (i->first);
-		uint64_t confirmation_height (i->second);
-
-		// Check account hashes matches both the accounts table and confirmation height table
-		debug_assert (account == account_info_i->first);
-
-		auto const & account_info = account_info_i->second;
-
-		if (confirmation_height == 0)
+	upgrade_table<futurehead::account, uint64_t, futurehead::confirmation_height_info> (
+	transaction_a, confirmation_height, "Confirmation height frontier", [this](futurehead::transaction const & transaction_a, futurehead::account const & account_a, uint64_t const & confirmation_height_a) {
+		futurehead::confirmation_height_info result{ 0, futurehead::block_hash (0) };
+		if (confirmation_height_a != 0)
 		{
-			confirmation_height_infos.emplace_back (account, confirmation_height_info{ 0, futurehead::block_hash (0) });
-		}
-		else
-		{
-			if (account_info_i->second.block_count / 2 >= confirmation_height)
+			futurehead::account_info account_info;
+			auto error (account_get (transaction_a, account_a, account_info));
+			(void)error;
+			debug_assert (!error);
+			if (account_info.block_count / 2 >= confirmation_height_a)
 			{
 				// The confirmation height of the account is closer to the bottom of the chain, so start there and work up
 				auto block = block_get (transaction_a, account_info.open_block);
 				debug_assert (block);
-				auto height = 1;
+				uint64_t height = 1;
 
-				while (height != confirmation_height)
+				while (height != confirmation_height_a)
 				{
 					block = block_get (transaction_a, block->sideband ().successor);
 					debug_assert (block);
 					++height;
 				}
 
-				debug_assert (block->sideband ().height == confirmation_height);
-				confirmation_height_infos.emplace_back (account, confirmation_height_info{ confirmation_height, block->hash () });
+				debug_assert (block->sideband ().height == confirmation_height_a);
+				result = futurehead::confirmation_height_info{ confirmation_height_a, block->hash () };
 			}
 			else
 			{
 				// The confirmation height of the account is closer to the top of the chain so start there and work down
 				auto block = block_get (transaction_a, account_info.head);
 				auto height = block->sideband ().height;
-				while (height != confirmation_height)
+				while (height != confirmation_height_a)
 				{
 					block = block_get (transaction_a, block->previous ());
 					debug_assert (block);
 					--height;
 				}
-				confirmation_height_infos.emplace_back (account, confirmation_height_info{ confirmation_height, block->hash () });
+				result = futurehead::confirmation_height_info{ confirmation_height_a, block->hash () };
 			}
 		}
-
-		// Every so often output to the log to indicate progress (every 200k accounts)
-		constexpr auto output_cutoff = 200000;
-		if (num % output_cutoff == 0 && num != 0)
-		{
-			logger.always_log (boost::str (boost::format ("Confirmation height frontier set for %1%00k accounts") % ((num / output_cutoff) * 2)));
-		}
-	}
-
-	// Clear it then append
-	auto status (mdb_drop (env.tx (transaction_a), confirmation_height, 0));
-	release_assert (status == MDB_SUCCESS);
-
-	for (auto const & confirmation_height_info_pair : confirmation_height_infos)
-	{
-		mdb_put (env.tx (transaction_a), confirmation_height, futurehead::mdb_val (confirmation_height_info_pair.first), futurehead::mdb_val (confirmation_height_info_pair.second), MDB_APPEND);
-	}
+		return result;
+	},
+	[this](futurehead::write_transaction const & transaction_a, futurehead::account const & account_a, futurehead::confirmation_height_info const & confirmation_height_info_a) {
+		auto status (mdb_put (env.tx (transaction_a), confirmation_height, futurehead::mdb_val (account_a), futurehead::mdb_val (confirmation_height_info_a), 0));
+		release_assert (status == MDB_SUCCESS);
+	});
 
 	version_put (transaction_a, 17);
 	logger.always_log ("Finished upgrading confirmation height frontiers");
 }
 
-void futurehead::mdb_store::upgrade_v17_to_v18 (futurehead::write_transaction const & transaction_a)
+void futurehead::mdb_store::upgrade_v17_to_v18 (futurehead::write_transaction & transaction_a)
 {
 	logger.always_log ("Preparing v17 to v18 database upgrade...");
 
 	auto count_pre (count (transaction_a, state_blocks));
 
-	auto num = 0u;
-	for (futurehead::mdb_iterator<futurehead::block_hash, futurehead::state_block_w_sideband> state_i (transaction_a, state_blocks), state_n{}; state_i != state_n; ++state_i, ++num)
-	{
-		futurehead::state_block_w_sideband block_sideband (state_i->second);
-		auto & block (block_sideband.state_block);
-		auto & sideband (block_sideband.sideband);
+	upgrade_table<futurehead::block_hash, futurehead::state_block_w_sideband, std::vector<uint8_t>> (
+	transaction_a, state_blocks, "Sideband", [this](futurehead::transaction const & transaction_a, futurehead::block_hash const &, futurehead::state_block_w_sideband const & block_sideband_a) {
+		auto & block (block_sideband_a.state_block);
+		auto & sideband (block_sideband_a.sideband);
 
 		bool is_send{ false };
 		bool is_receive{ false };
@@ -822,24 +901,21 @@ void futurehead::mdb_store::upgrade_v17_to_v18 (futurehead::write_transaction co
 		}
 
 		futurehead::block_sideband new_sideband (sideband.account, sideband.successor, sideband.balance, sideband.height, sideband.timestamp, sideband.details.epoch, is_send, is_receive, is_epoch);
-		// Write these out
 		std::vector<uint8_t> data;
 		{
 			futurehead::vectorstream stream (data);
 			block->serialize (stream);
 			new_sideband.serialize (stream, block->type ());
 		}
-		futurehead::mdb_val value{ data.size (), (void *)data.data () };
-		auto s = mdb_cursor_put (state_i.cursor, state_i->first, value, MDB_CURRENT);
+		return data;
+	},
+	[this](futurehead::write_transaction const & transaction_a, futurehead::block_hash const & hash_a, std::vector<uint8_t> const & data_a) {
+		futurehead::mdb_val value{ data_a.size (), (void *)data_a.data () };
+		auto s = mdb_put (env.tx (transaction_a), state_blocks, futurehead::mdb_val (hash_a), value, 0);
 		release_assert (success (s));
-
-		// Every so often output to the log to indicate progress
-		constexpr auto output_cutoff = 1000000;
-		if (num > 0 && num % output_cutoff == 0)
-		{
-			logger.always_log (boost::str (boost::format ("Database sideband upgrade %1% million state blocks upgraded (out of %2%)") % (num / output_cutoff) % count_pre));
-		}
-	}
+		// The workers may have cached the block with its previous sideband
+		cache.invalidate (cache.blocks, transaction_a.get_handle (), hash_a);
+	});
 
 	auto count_post (count (transaction_a, state_blocks));
 	release_assert (count_pre == count_post);
@@ -848,6 +924,52 @@ void futurehead::mdb_store::upgrade_v17_to_v18 (futurehead::write_transaction co
 	logger.always_log ("Finished upgrading the sideband");
 }
 
+void futurehead::mdb_store::upgrade_v18_to_v19 (futurehead::write_transaction const & transaction_a)
+{
+	logger.always_log ("Preparing v18 to v19 database upgrade...");
+	mdb_dbi_open (env.tx (transaction_a), "pruned", MDB_CREATE, &pruned);
+	version_put (transaction_a, 19);
+	logger.always_log ("Finished adding the pruned table");
+}
+
+void futurehead::mdb_store::upgrade_v19_to_v20 (futurehead::write_transaction & transaction_a)
+{
+	logger.always_log ("Preparing v19 to v20 database upgrade...");
+	mdb_dbi_open (env.tx (transaction_a), "delegators", MDB_CREATE, &delegators);
+	upgrade_table<futurehead::account, futurehead::account_info, futurehead::account> (
+	transaction_a, accounts, "Delegators", [](futurehead::transaction const &, futurehead::account const &, futurehead::account_info const & info_a) {
+		return info_a.representative;
+	},
+	[this](futurehead::write_transaction const & transaction_a, futurehead::account const & account_a, futurehead::account const & representative_a) {
+		delegator_put (transaction_a, representative_a, account_a);
+	});
+	version_put (transaction_a, 20);
+	logger.always_log ("Finished indexing delegators");
+}
+
+void futurehead::mdb_store::upgrade_v20_to_v21 (futurehead::write_transaction const & transaction_a)
+{
+	logger.always_log ("Preparing v20 to v21 database upgrade...");
+	mdb_dbi_open (env.tx (transaction_a), "pending_totals", MDB_CREATE, &pending_totals);
+	// Pending entries are ordered by account, so the totals of an account are complete once the next account is reached
+	futurehead::account account (0);
+	futurehead::pending_totals totals;
+	for (auto i (pending_begin (transaction_a)), n (pending_end ()); i != n; ++i)
+	{
+		if (i->first.account != account)
+		{
+			pending_totals_put (transaction_a, account, totals);
+			account = i->first.account;
+			totals = futurehead::pending_totals{};
+		}
+		totals.amount = totals.amount.number () + i->second.amount.number ();
+		++totals.count;
+	}
+	pending_totals_put (transaction_a, account, totals);
+	version_put (transaction_a, 21);
+	logger.always_log ("Finished adding pending totals");
+}
+
 /** Takes a filepath, appends '_backup_<timestamp>' to the end (but before any extension) and saves that file in the same directory */
 void futurehead::mdb_store::create_backup_file (futurehead::mdb_env & env_a, boost::filesystem::path const & filepath_a, futurehead::logger_mt & logger_a)
 {
@@ -898,6 +1020,105 @@ void futurehead::mdb_store::version_put (futurehead::write_transaction const & t
 	}
 }
 
+namespace
+{
+/** Meta key of the last key upgraded by an interrupted table upgrade */
+futurehead::uint256_union const upgrade_progress_key (4);
+}
+
+bool futurehead::mdb_store::upgrade_progress_get (futurehead::transaction const & transaction_a, futurehead::uint256_union & key_a) const
+{
+	futurehead::mdb_val value;
+	auto status (mdb_get (env.tx (transaction_a), meta, futurehead::mdb_val (upgrade_progress_key), value));
+	release_assert (success (status) || not_found (status));
+	auto result (not_found (status));
+	if (!result)
+	{
+		key_a = futurehead::uint256_union (value);
+	}
+	return result;
+}
+
+void futurehead::mdb_store::upgrade_progress_put (futurehead::write_transaction const & transaction_a, futurehead::uint256_union const & key_a)
+{
+	auto status (mdb_put (env.tx (transaction_a), meta, futurehead::mdb_val (upgrade_progress_key), futurehead::mdb_val (key_a), 0));
+	release_assert (status == 0);
+}
+
+void futurehead::mdb_store::upgrade_progress_del (futurehead::write_transaction const & transaction_a)
+{
+	auto status (mdb_del (env.tx (transaction_a), meta, futurehead::mdb_val (upgrade_progress_key), nullptr));
+	release_assert (success (status) || not_found (status));
+}
+
+template <typename Key, typename Value, typename Result>
+void futurehead::mdb_store::upgrade_table (futurehead::write_transaction & transaction_a, MDB_dbi table_a, std::string const & name_a, std::function<Result (futurehead::transaction const &, Key const &, Value const &)> const & upgrade_a, std::function<void(futurehead::write_transaction const &, Key const &, Result const &)> const & write_a)
+{
+	// Everything written so far has to be visible to the read transactions of the workers
+	transaction_a.commit ();
+	transaction_a.renew ();
+	Key start (0);
+	auto done (false);
+	futurehead::uint256_union progress;
+	if (!upgrade_progress_get (transaction_a, progress))
+	{
+		logger.always_log (boost::str (boost::format ("%1% upgrade resuming after %2%") % name_a % progress.to_string ()));
+		done = progress.number () == std::numeric_limits<futurehead::uint256_t>::max ();
+		start = progress.number () + 1;
+	}
+	auto const total (count (transaction_a, table_a));
+	auto const thread_count (std::max (1u, std::thread::hardware_concurrency ()));
+	auto const begin (std::chrono::steady_clock::now ());
+	uint64_t upgraded (0);
+	std::vector<std::pair<Key, Value>> batch;
+	std::vector<Result> results;
+	while (!done)
+	{
+		batch.clear ();
+		for (futurehead::mdb_iterator<Key, Value> i (transaction_a, table_a, futurehead::mdb_val (start)), n{}; i != n && batch.size () < upgrade_batch_size; ++i)
+		{
+			batch.emplace_back (i->first, i->second);
+		}
+		done = batch.size () < upgrade_batch_size;
+		if (!batch.empty ())
+		{
+			results.assign (batch.size (), Result{});
+			// Entries are independent, each worker upgrades an interleaved share of the batch
+			std::vector<std::thread> workers;
+			for (unsigned worker (0); worker < thread_count; ++worker)
+			{
+				workers.emplace_back ([this, worker, thread_count, &batch, &results, &upgrade_a]() {
+					auto transaction (tx_begin_read ());
+					for (auto i (static_cast<size_t> (worker)); i < batch.size (); i += thread_count)
+					{
+						results[i] = upgrade_a (transaction, batch[i].first, batch[i].second);
+					}
+				});
+			}
+			for (auto & worker : workers)
+			{
+				worker.join ();
+			}
+			for (size_t i (0), n (batch.size ()); i < n; ++i)
+			{
+				write_a (transaction_a, batch[i].first, results[i]);
+			}
+			auto const & last (batch.back ().first);
+			upgrade_progress_put (transaction_a, last);
+			transaction_a.commit ();
+			std::this_thread::yield ();
+			transaction_a.renew ();
+			upgraded += batch.size ();
+			auto elapsed (std::chrono::duration_cast<std::chrono::milliseconds> (std::chrono::steady_clock::now () - begin).count ());
+			logger.always_log (boost::str (boost::format ("%1% upgrade: %2% of %3% entries (%4% per second)") % name_a % upgraded % total % (upgraded * 1000 / std::max<decltype (elapsed)> (elapsed, 1))));
+			done = done || last.number () == std::numeric_limits<futurehead::uint256_t>::max ();
+			start = last.number () + 1;
+		}
+	}
+	// Removed in the same transaction as the version is raised
+	upgrade_progress_del (transaction_a);
+}
+
 bool futurehead::mdb_store::block_info_get (futurehead::transaction const & transaction_a, futurehead::block_hash const & hash_a, futurehead::block_info & block_info_a) const
 {
 	debug_assert (!full_sideband (transaction_a));
@@ -935,16 +1156,19 @@ int futurehead::mdb_store::get (futurehead::transaction const & transaction_a, t
 
 int futurehead::mdb_store::put (futurehead::write_transaction const & transaction_a, tables table_a, futurehead::mdb_val const & key_a, const futurehead::mdb_val & value_a) const
 {
+	compaction->put (table_a, key_a.value, value_a.value);
 	return (mdb_put (env.tx (transaction_a), table_to_dbi (table_a), key_a, value_a, 0));
 }
 
 int futurehead::mdb_store::del (futurehead::write_transaction const & transaction_a, tables table_a, futurehead::mdb_val const & key_a) const
 {
+	compaction->del (table_a, key_a.value);
 	return (mdb_del (env.tx (transaction_a), table_to_dbi (table_a), key_a, nullptr));
 }
 
 int futurehead::mdb_store::drop (futurehead::write_transaction const & transaction_a, tables table_a)
 {
+	compaction->drop (table_a);
 	return clear (transaction_a, table_to_dbi (table_a));
 }
 
@@ -1000,6 +1224,12 @@ MDB_dbi futurehead::mdb_store::table_to_dbi (tables table_a) const
 			return peers;
 		case tables::confirmation_height:
 			return confirmation_height;
+		case tables::pruned:
+			return pruned;
+		case tables::delegators:
+			return delegators;
+		case tables::pending_totals:
+			return pending_totals;
 		default:
 			release_assert (false);
 			return peers;
@@ -1026,10 +1256,17 @@ bool futurehead::mdb_store::copy_db (boost::filesystem::path const & destination
 	return !mdb_env_copy2 (env.environment, destination_file.string ().c_str (), MDB_CP_COMPACT);
 }
 
+bool futurehead::mdb_store::compact_online ()
+{
+	// Handles acquired from here on are counted, so the compacted copy can replace the ledger file once none is held
+	transactions_counted = true;
+	return compaction->start ();
+}
+
 void futurehead::mdb_store::rebuild_db (futurehead::write_transaction const & transaction_a)
 {
 	// Tables with uint256_union key
-	std::vector<MDB_dbi> tables = { accounts, send_blocks, receive_blocks, open_blocks, change_blocks, state_blocks, vote, confirmation_height };
+	std::vector<MDB_dbi> tables = { accounts, send_blocks, receive_blocks, open_blocks, change_blocks, state_blocks, vote, confirmation_height, pruned, pending_totals };
 	for (auto const & table : tables)
 	{
 		MDB_dbi temp;
@@ -1074,6 +1311,27 @@ void futurehead::mdb_store::rebuild_db (futurehead::write_transaction const & tr
 		release_assert (count (transaction_a, pending) == count (transaction_a, temp));
 		mdb_drop (env.tx (transaction_a), temp, 1);
 	}
+	// Delegators table
+	{
+		MDB_dbi temp;
+		mdb_dbi_open (env.tx (transaction_a), "temp_table", MDB_CREATE, &temp);
+		// Copy all values to temporary table
+		for (auto i (futurehead::store_iterator<futurehead::delegator_key, futurehead::mdb_val> (std::make_unique<futurehead::mdb_iterator<futurehead::delegator_key, futurehead::mdb_val>> (transaction_a, delegators))), n (futurehead::store_iterator<futurehead::delegator_key, futurehead::mdb_val> (nullptr)); i != n; ++i)
+		{
+			auto s = mdb_put (env.tx (transaction_a), temp, futurehead::mdb_val (i->first), i->second, MDB_APPEND);
+			release_assert (success (s));
+		}
+		release_assert (count (transaction_a, delegators) == count (transaction_a, temp));
+		mdb_drop (env.tx (transaction_a), delegators, 0);
+		// Put values from copy
+		for (auto i (futurehead::store_iterator<futurehead::delegator_key, futurehead::mdb_val> (std::make_unique<futurehead::mdb_iterator<futurehead::delegator_key, futurehead::mdb_val>> (transaction_a, temp))), n (futurehead::store_iterator<futurehead::delegator_key, futurehead::mdb_val> (nullptr)); i != n; ++i)
+		{
+			auto s = mdb_put (env.tx (transaction_a), delegators, futurehead::mdb_val (i->first), i->second, MDB_APPEND);
+			release_assert (success (s));
+		}
+		release_assert (count (transaction_a, delegators) == count (transaction_a, temp));
+		mdb_drop (env.tx (transaction_a), temp, 1);
+	}
 }
 
 bool futurehead::mdb_store::init_error () const
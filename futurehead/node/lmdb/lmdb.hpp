@@ -4,6 +4,7 @@
 #include <futurehead/lib/lmdbconfig.hpp>
 #include <futurehead/lib/logger_mt.hpp>
 #include <futurehead/lib/numbers.hpp>
+#include <futurehead/node/lmdb/lmdb_compaction.hpp>
 #include <futurehead/node/lmdb/lmdb_env.hpp>
 #include <futurehead/node/lmdb/lmdb_iterator.hpp>
 #include <futurehead/node/lmdb/lmdb_txn.hpp>
@@ -37,9 +38,16 @@ public:
 	using block_store_partial::block_exists;
 	using block_store_partial::unchecked_put;
 
-	mdb_store (futurehead::logger_mt &, boost::filesystem::path const &, futurehead::txn_tracking_config const & txn_tracking_config_a = futurehead::txn_tracking_config{}, std::chrono::milliseconds block_processor_batch_max_time_a = std::chrono::milliseconds (5000), futurehead::lmdb_config const & lmdb_config_a = futurehead::lmdb_config{}, size_t batch_size = 512, bool backup_before_upgrade = false);
+	mdb_store (futurehead::logger_mt &, boost::filesystem::path const &, futurehead::txn_tracking_config const & txn_tracking_config_a = futurehead::txn_tracking_config{}, std::chrono::milliseconds block_processor_batch_max_time_a = std::chrono::milliseconds (5000), futurehead::lmdb_config const & lmdb_config_a = futurehead::lmdb_config{}, size_t batch_size = 512, bool backup_before_upgrade = false, size_t account_cache_size = 64 * 1024, size_t block_cache_size = 16 * 1024);
 	futurehead::write_transaction tx_begin_write (std::vector<futurehead::tables> const & tables_requiring_lock = {}, std::vector<futurehead::tables> const & tables_no_lock = {}) override;
 	futurehead::read_transaction tx_begin_read () override;
+	/**
+	 * Holds back new transactions until every counted handle has been given up, waiting at most \p timeout_a.
+	 * The environment is then closed, \p action_a is called and the environment at \p path_a is opened again. Returns true if transactions stayed open, nothing is done then
+	 */
+	bool reopen (boost::filesystem::path const & path_a, futurehead::lmdb_config const & config_a, std::chrono::milliseconds timeout_a, std::function<void()> const & action_a);
+	/** Replaces the ledger file with the result of a completed online compaction */
+	~mdb_store ();
 
 	std::string vendor_get () const override;
 
@@ -47,6 +55,10 @@ public:
 
 	void version_put (futurehead::write_transaction const &, int) override;
 
+	/** Last key upgraded by an interrupted table upgrade of the current version, returns true if no upgrade is in progress */
+	bool upgrade_progress_get (futurehead::transaction const &, futurehead::uint256_union &) const;
+	void upgrade_progress_put (futurehead::write_transaction const &, futurehead::uint256_union const &);
+
 	void serialize_mdb_tracker (boost::property_tree::ptree &, std::chrono::milliseconds, std::chrono::milliseconds) override;
 
 	static void create_backup_file (futurehead::mdb_env &, boost::filesystem::path const &, futurehead::logger_mt &);
@@ -57,6 +69,7 @@ private:
 
 public:
 	futurehead::mdb_env env;
+	std::unique_ptr<futurehead::mdb_compaction> const compaction;
 
 	/**
 	 * Maps head block to owning account
@@ -190,6 +203,24 @@ public:
 	 */
 	MDB_dbi confirmation_height{ 0 };
 
+	/*
+	 * Hashes of blocks whose contents were removed by ledger pruning
+	 * futurehead::block_hash -> no_value
+	 */
+	MDB_dbi pruned{ 0 };
+
+	/*
+	 * Accounts grouped by their current representative
+	 * futurehead::account, futurehead::account -> no_value
+	 */
+	MDB_dbi delegators{ 0 };
+
+	/*
+	 * Sum and number of the pending entries of every account with pending entries
+	 * futurehead::account -> futurehead::amount, uint64_t
+	 */
+	MDB_dbi pending_totals{ 0 };
+
 	bool exists (futurehead::transaction const & transaction_a, tables table_a, futurehead::mdb_val const & key_a) const;
 
 	int get (futurehead::transaction const & transaction_a, tables table_a, futurehead::mdb_val const & key_a, futurehead::mdb_val & value_a) const;
@@ -198,6 +229,7 @@ public:
 
 	bool copy_db (boost::filesystem::path const & destination_file) override;
 	void rebuild_db (futurehead::write_transaction const & transaction_a) override;
+	bool compact_online () override;
 
 	template <typename Key, typename Value>
 	futurehead::store_iterator<Key, Value> make_iterator (futurehead::transaction const & transaction_a, tables table_a) const
@@ -242,8 +274,20 @@ private:
 	void upgrade_v13_to_v14 (futurehead::write_transaction const &);
 	void upgrade_v14_to_v15 (futurehead::write_transaction &);
 	void upgrade_v15_to_v16 (futurehead::write_transaction const &);
-	void upgrade_v16_to_v17 (futurehead::write_transaction const &);
-	void upgrade_v17_to_v18 (futurehead::write_transaction const &);
+	void upgrade_v16_to_v17 (futurehead::write_transaction &);
+	void upgrade_v17_to_v18 (futurehead::write_transaction &);
+	void upgrade_v18_to_v19 (futurehead::write_transaction const &);
+	void upgrade_v19_to_v20 (futurehead::write_transaction &);
+	/**
+	 * Upgrades every entry of \p table_a in key order, upgrade_batch_size entries per write transaction.
+	 * The results for a batch are computed by \p upgrade_a on several threads, each reading through its own read transaction, and then written by \p write_a.
+	 * Each batch is committed along with its last key, so an interrupted upgrade resumes after the last committed batch
+	 */
+	template <typename Key, typename Value, typename Result>
+	void upgrade_table (futurehead::write_transaction &, MDB_dbi table_a, std::string const & name_a, std::function<Result (futurehead::transaction const &, Key const &, Value const &)> const & upgrade_a, std::function<void(futurehead::write_transaction const &, Key const &, Result const &)> const & write_a);
+	void upgrade_progress_del (futurehead::write_transaction const &);
+	static size_t constexpr upgrade_batch_size{ 64 * 1024 };
+	void upgrade_v20_to_v21 (futurehead::write_transaction const &);
 
 	void open_databases (bool &, futurehead::transaction const &, unsigned);
 
@@ -257,8 +301,18 @@ private:
 	MDB_dbi table_to_dbi (tables table_a) const;
 
 	futurehead::mdb_txn_tracker mdb_txn_tracker;
-	futurehead::mdb_txn_callbacks create_txn_callbacks ();
+	futurehead::mdb_txn_callbacks create_txn_callbacks (bool is_write_a);
 	bool txn_tracking_enabled;
+	/** Waits while reopen holds back transactions and counts the handle about to be acquired, returns false without locking while counting is off */
+	bool transaction_acquire ();
+	void transaction_release ();
+	/** Set by compact_online, handles acquired before are not counted. It is called while the node starts, before handles are kept across the swap */
+	std::atomic<bool> transactions_counted{ false };
+	/** Counted handles on env which have not been given up yet, a reset read transaction gives up its handle */
+	size_t transactions_live{ 0 };
+	bool transactions_held{ false };
+	std::mutex transactions_mutex;
+	futurehead::condition_variable transactions_condition;
 
 	size_t count (futurehead::transaction const & transaction_a, tables table_a) const override;
 
@@ -0,0 +1,322 @@
+#include <futurehead/lib/logger_mt.hpp>
+#include <futurehead/lib/threading.hpp>
+#include <futurehead/node/lmdb/lmdb.hpp>
+#include <futurehead/node/lmdb/lmdb_compaction.hpp>
+
+#include <boost/filesystem/operations.hpp>
+#include <boost/format.hpp>
+
+constexpr size_t futurehead::mdb_compaction::journal_bytes_max;
+constexpr std::chrono::milliseconds futurehead::mdb_compaction::swap_wait;
+
+namespace
+{
+/** Tables written while a node runs, by their database name */
+std::vector<std::pair<futurehead::tables, char const *>> const compacted_tables{
+	{ futurehead::tables::frontiers, "frontiers" },
+	{ futurehead::tables::accounts, "accounts" },
+	{ futurehead::tables::send_blocks, "send" },
+	{ futurehead::tables::receive_blocks, "receive" },
+	{ futurehead::tables::open_blocks, "open" },
+	{ futurehead::tables::change_blocks, "change" },
+	{ futurehead::tables::state_blocks, "state_blocks" },
+	{ futurehead::tables::pending, "pending" },
+	{ futurehead::tables::unchecked, "unchecked" },
+	{ futurehead::tables::vote, "vote" },
+	{ futurehead::tables::online_weight, "online_weight" },
+	{ futurehead::tables::meta, "meta" },
+	{ futurehead::tables::peers, "peers" },
+	{ futurehead::tables::confirmation_height, "confirmation_height" },
+	{ futurehead::tables::pruned, "pruned" },
+	{ futurehead::tables::delegators, "delegators" },
+	{ futurehead::tables::pending_totals, "pending_totals" }
+};
+}
+
+futurehead::mdb_compaction::mdb_compaction (futurehead::mdb_store & store_a, boost::filesystem::path const & path_a, futurehead::lmdb_config const & config_a, futurehead::logger_mt & logger_a) :
+store (store_a),
+path (path_a),
+copy_path (path_a.parent_path () / "compacted.ldb"),
+config (config_a),
+logger (logger_a)
+{
+}
+
+futurehead::mdb_compaction::~mdb_compaction ()
+{
+	{
+		futurehead::lock_guard<std::mutex> guard (mutex);
+		stopped = true;
+	}
+	condition.notify_all ();
+	if (thread.joinable ())
+	{
+		thread.join ();
+	}
+	if (copy != nullptr)
+	{
+		// Not finished, the copy is missing writes
+		remove_copy ();
+	}
+}
+
+bool futurehead::mdb_compaction::start ()
+{
+	futurehead::lock_guard<std::mutex> guard (mutex);
+	auto result (started);
+	if (!started)
+	{
+		started = true;
+		thread = std::thread ([this]() {
+			futurehead::thread_role::set (futurehead::thread_role::name::ledger_compaction);
+			run ();
+		});
+	}
+	return result;
+}
+
+void futurehead::mdb_compaction::put (futurehead::tables table_a, MDB_val const & key_a, MDB_val const & value_a)
+{
+	if (journaling)
+	{
+		journal_add (operation::put, table_a, &key_a, &value_a);
+	}
+}
+
+void futurehead::mdb_compaction::del (futurehead::tables table_a, MDB_val const & key_a)
+{
+	if (journaling)
+	{
+		journal_add (operation::del, table_a, &key_a, nullptr);
+	}
+}
+
+void futurehead::mdb_compaction::drop (futurehead::tables table_a)
+{
+	if (journaling)
+	{
+		journal_add (operation::drop, table_a, nullptr, nullptr);
+	}
+}
+
+void futurehead::mdb_compaction::journal_add (futurehead::mdb_compaction::operation operation_a, futurehead::tables table_a, MDB_val const * key_a, MDB_val const * value_a)
+{
+	write write_l{ operation_a, table_a, {}, {} };
+	if (key_a != nullptr)
+	{
+		auto data (static_cast<uint8_t const *> (key_a->mv_data));
+		write_l.key.assign (data, data + key_a->mv_size);
+	}
+	if (value_a != nullptr)
+	{
+		auto data (static_cast<uint8_t const *> (value_a->mv_data));
+		write_l.value.assign (data, data + value_a->mv_size);
+	}
+	futurehead::lock_guard<std::mutex> guard (mutex);
+	journal_bytes += write_l.key.size () + write_l.value.size ();
+	if (journal_bytes <= journal_bytes_max)
+	{
+		journal.push_back (std::move (write_l));
+	}
+	else
+	{
+		// The copy fell too far behind, it can no longer be made current
+		journaling = false;
+		journal_overflow = true;
+		std::vector<write> ().swap (journal);
+		journal_bytes = 0;
+	}
+}
+
+bool futurehead::mdb_compaction::copied () const
+{
+	return copied_m;
+}
+
+bool futurehead::mdb_compaction::swapped () const
+{
+	return swapped_m;
+}
+
+size_t futurehead::mdb_compaction::journal_size ()
+{
+	futurehead::lock_guard<std::mutex> guard (mutex);
+	return journal.size ();
+}
+
+void futurehead::mdb_compaction::run ()
+{
+	{
+		// No other write transaction can be open, so every write is either part of the snapshot copied below or journaled
+		auto transaction (store.tx_begin_write ());
+		journaling = true;
+	}
+	logger.always_log (boost::str (boost::format ("Online compaction: copying %1% to %2%") % path.filename () % copy_path.filename ()));
+	auto begin (std::chrono::steady_clock::now ());
+	// Replaying a write already part of the snapshot is harmless, the journal may start before it
+	auto error (mdb_env_copy2 (store.env.environment, copy_path.string ().c_str (), MDB_CP_COMPACT) != 0);
+	if (!error)
+	{
+		copy = std::make_unique<futurehead::mdb_env> (error, copy_path, futurehead::mdb_env::options::make ().set_config (config).set_use_no_mem_init (true));
+	}
+	if (!error)
+	{
+		auto transaction (copy->tx_begin_write ());
+		for (auto const & table : compacted_tables)
+		{
+			MDB_dbi dbi;
+			error = error || mdb_dbi_open (copy->tx (transaction), table.second, MDB_CREATE, &dbi) != 0;
+			copy_tables[table.first] = dbi;
+		}
+	}
+	if (!error)
+	{
+		boost::system::error_code ec;
+		auto size_before (boost::filesystem::file_size (path, ec));
+		auto size_after (boost::filesystem::file_size (copy_path, ec));
+		logger.always_log (boost::str (boost::format ("Online compaction: copy written in %1% seconds, %2% MB down from %3% MB, replaying %4% writes made meanwhile") % std::chrono::duration_cast<std::chrono::seconds> (std::chrono::steady_clock::now () - begin).count () % (size_after / (1024 * 1024)) % (size_before / (1024 * 1024)) % journal_size ()));
+		copied_m = true;
+	}
+	futurehead::unique_lock<std::mutex> lock (mutex);
+	while (!stopped && !error && !swapped_m)
+	{
+		if (journal_overflow)
+		{
+			logger.always_log (boost::str (boost::format ("Online compaction: more than %1% MB written while copying, the copy cannot catch up") % (journal_bytes_max / (1024 * 1024))));
+			error = true;
+		}
+		else if (!journal.empty ())
+		{
+			std::vector<write> writes;
+			writes.swap (journal);
+			journal_bytes = 0;
+			lock.unlock ();
+			error = replay (writes);
+			lock.lock ();
+		}
+		else
+		{
+			// Caught up, the few writes made from here on are replayed while the ledger environment is closed
+			lock.unlock ();
+			auto busy (store.reopen (path, config, swap_wait, [this, &error]() {
+				error = swap ();
+			}));
+			lock.lock ();
+			if (busy && !stopped)
+			{
+				condition.wait_for (lock, std::chrono::seconds (1));
+			}
+		}
+	}
+	if (error)
+	{
+		journaling = false;
+		copied_m = false;
+		journal.clear ();
+		journal_bytes = 0;
+		lock.unlock ();
+		remove_copy ();
+		logger.always_log ("Online compaction failed. (Optional) Ensure enough disk space is available for a copy of the database");
+	}
+}
+
+bool futurehead::mdb_compaction::swap ()
+{
+	journaling = false;
+	std::vector<write> writes;
+	auto error (false);
+	{
+		futurehead::lock_guard<std::mutex> guard (mutex);
+		error = journal_overflow;
+		writes.swap (journal);
+		journal_bytes = 0;
+	}
+	error = error || replay (writes);
+	if (!error)
+	{
+		copy.reset ();
+		copy_tables.clear ();
+		boost::system::error_code ec;
+		boost::filesystem::rename (copy_path, path, ec);
+		error = static_cast<bool> (ec);
+		boost::filesystem::remove (copy_path.string () + "-lock", ec);
+	}
+	if (!error)
+	{
+		copied_m = false;
+		swapped_m = true;
+		logger.always_log ("Online compaction: ledger file replaced with the compacted copy");
+	}
+	return error;
+}
+
+bool futurehead::mdb_compaction::replay (std::vector<write> const & writes_a)
+{
+	auto error (false);
+	auto transaction (copy->tx_begin_write ());
+	for (auto i (writes_a.begin ()), n (writes_a.end ()); i != n && !error; ++i)
+	{
+		auto existing (copy_tables.find (i->table));
+		error = existing == copy_tables.end ();
+		if (!error)
+		{
+			MDB_val key{ i->key.size (), const_cast<uint8_t *> (i->key.data ()) };
+			MDB_val value{ i->value.size (), const_cast<uint8_t *> (i->value.data ()) };
+			switch (i->operation)
+			{
+				case operation::put:
+					error = mdb_put (copy->tx (transaction), existing->second, &key, &value, 0) != 0;
+					break;
+				case operation::del:
+				{
+					auto status (mdb_del (copy->tx (transaction), existing->second, &key, nullptr));
+					error = status != 0 && status != MDB_NOTFOUND;
+					break;
+				}
+				case operation::drop:
+					error = mdb_drop (copy->tx (transaction), existing->second, 0) != 0;
+					break;
+			}
+		}
+	}
+	return error;
+}
+
+bool futurehead::mdb_compaction::finish ()
+{
+	{
+		futurehead::lock_guard<std::mutex> guard (mutex);
+		stopped = true;
+	}
+	condition.notify_all ();
+	if (thread.joinable ())
+	{
+		thread.join ();
+	}
+	auto error (!copied_m);
+	if (!error)
+	{
+		mdb_env_sync (store.env.environment, true);
+		mdb_env_close (store.env.environment);
+		store.env.environment = nullptr;
+		error = swap ();
+		if (error)
+		{
+			logger.always_log ("Online compaction: could not replace the ledger file");
+		}
+	}
+	if (error && copy != nullptr)
+	{
+		remove_copy ();
+	}
+	return error;
+}
+
+void futurehead::mdb_compaction::remove_copy ()
+{
+	copy.reset ();
+	copy_tables.clear ();
+	boost::system::error_code ec;
+	boost::filesystem::remove (copy_path, ec);
+	boost::filesystem::remove (copy_path.string () + "-lock", ec);
+}
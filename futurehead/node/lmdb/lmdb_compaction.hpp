@@ -0,0 +1,92 @@
+#pragma once
+
+#include <futurehead/lib/lmdbconfig.hpp>
+#include <futurehead/lib/locks.hpp>
+#include <futurehead/node/lmdb/lmdb_env.hpp>
+#include <futurehead/secure/blockstore.hpp>
+
+#include <boost/filesystem/path.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace futurehead
+{
+class logger_mt;
+class mdb_store;
+
+/**
+ * Compacts an LMDB ledger while it stays in use.
+ * Writes are journaled from the moment the compaction starts, then a compacted copy is written from a read snapshot and kept current by replaying the journal into it.
+ * Once the copy has caught up it replaces the ledger file at the first moment no transaction holds a handle on the ledger environment, or when the store is closed. Reset read transactions give up their handles while a compaction runs.
+ * The compaction is abandoned if the journal outgrows journal_bytes_max, so writes which outpace the copy cannot exhaust memory
+ */
+class mdb_compaction final
+{
+public:
+	mdb_compaction (futurehead::mdb_store &, boost::filesystem::path const &, futurehead::lmdb_config const &, futurehead::logger_mt &);
+	~mdb_compaction ();
+	/** Starts compacting on a background thread, returns true if a compaction was already started */
+	bool start ();
+	/** Journals a write, called by the store while holding the write transaction making it */
+	void put (futurehead::tables, MDB_val const &, MDB_val const &);
+	void del (futurehead::tables, MDB_val const &);
+	void drop (futurehead::tables);
+	/** Replays the rest of the journal and replaces the ledger file with the copy. Every transaction on the ledger environment must have ended. Returns true if no complete copy was made */
+	bool finish ();
+	/** The copy is complete and being kept current */
+	bool copied () const;
+	/** The copy replaced the ledger file while the store was in use */
+	bool swapped () const;
+	size_t journal_size ();
+	static size_t constexpr journal_bytes_max{ 256 * 1024 * 1024 };
+	/** Longest time new transactions are held back while waiting for open ones to end before a swap */
+	static std::chrono::milliseconds constexpr swap_wait{ 50 };
+
+private:
+	enum class operation : uint8_t
+	{
+		put,
+		del,
+		drop
+	};
+	class write final
+	{
+	public:
+		futurehead::mdb_compaction::operation operation;
+		futurehead::tables table;
+		std::vector<uint8_t> key;
+		std::vector<uint8_t> value;
+	};
+	void run ();
+	void journal_add (futurehead::mdb_compaction::operation, futurehead::tables, MDB_val const *, MDB_val const *);
+	/** Applies journaled writes to the copy in one write transaction, returns true on error */
+	bool replay (std::vector<write> const &);
+	/** Replays the rest of the journal and moves the copy over the ledger file, the ledger environment must be closed. Returns true on error */
+	bool swap ();
+	void remove_copy ();
+	futurehead::mdb_store & store;
+	boost::filesystem::path const path;
+	boost::filesystem::path const copy_path;
+	futurehead::lmdb_config const config;
+	futurehead::logger_mt & logger;
+	std::unique_ptr<futurehead::mdb_env> copy;
+	std::unordered_map<futurehead::tables, MDB_dbi> copy_tables;
+	std::atomic<bool> journaling{ false };
+	std::atomic<bool> copied_m{ false };
+	std::atomic<bool> swapped_m{ false };
+	bool started{ false };
+	bool stopped{ false };
+	std::vector<write> journal;
+	size_t journal_bytes{ 0 };
+	/** The journal reached journal_bytes_max and was discarded */
+	bool journal_overflow{ false };
+	std::mutex mutex;
+	futurehead::condition_variable condition;
+	std::thread thread;
+};
+}
@@ -50,30 +50,56 @@ private:
 }
 
 futurehead::read_mdb_txn::read_mdb_txn (futurehead::mdb_env const & environment_a, futurehead::mdb_txn_callbacks txn_callbacks_a) :
-txn_callbacks (txn_callbacks_a)
+handle (nullptr),
+env (environment_a),
+txn_callbacks (txn_callbacks_a),
+counted (false)
 {
-	auto status (mdb_txn_begin (environment_a, nullptr, MDB_RDONLY, &handle));
-	release_assert (status == 0);
-	txn_callbacks.txn_start (this);
+	renew ();
 }
 
 futurehead::read_mdb_txn::~read_mdb_txn ()
 {
-	// This uses commit rather than abort, as it is needed when opening databases with a read only transaction
-	auto status (mdb_txn_commit (handle));
-	release_assert (status == MDB_SUCCESS);
-	txn_callbacks.txn_end (this);
+	if (handle != nullptr)
+	{
+		// This uses commit rather than abort, as it is needed when opening databases with a read only transaction
+		auto status (mdb_txn_commit (handle));
+		release_assert (status == MDB_SUCCESS);
+		txn_callbacks.txn_end (this);
+		if (counted)
+		{
+			txn_callbacks.txn_release ();
+		}
+	}
 }
 
 void futurehead::read_mdb_txn::reset ()
 {
-	mdb_txn_reset (handle);
-	txn_callbacks.txn_end (this);
+	if (counted)
+	{
+		// A reset transaction can be kept for as long as its owner runs, so a counted handle is given up rather than held until renewed
+		txn_callbacks.txn_end (this);
+		mdb_txn_abort (handle);
+		handle = nullptr;
+		txn_callbacks.txn_release ();
+	}
+	else
+	{
+		mdb_txn_reset (handle);
+		txn_callbacks.txn_end (this);
+	}
 }
 
 void futurehead::read_mdb_txn::renew ()
 {
-	auto status (mdb_txn_renew (handle));
+	counted = txn_callbacks.txn_acquire ();
+	if (handle != nullptr && counted)
+	{
+		// Reset before counting started, acquire a counted handle instead
+		mdb_txn_abort (handle);
+		handle = nullptr;
+	}
+	auto status (handle == nullptr ? mdb_txn_begin (env, nullptr, MDB_RDONLY, &handle) : mdb_txn_renew (handle));
 	release_assert (status == 0);
 	txn_callbacks.txn_start (this);
 }
@@ -85,7 +111,8 @@ void * futurehead::read_mdb_txn::get_handle () const
 
 futurehead::write_mdb_txn::write_mdb_txn (futurehead::mdb_env const & environment_a, futurehead::mdb_txn_callbacks txn_callbacks_a) :
 env (environment_a),
-txn_callbacks (txn_callbacks_a)
+txn_callbacks (txn_callbacks_a),
+counted (false)
 {
 	renew ();
 }
@@ -97,13 +124,19 @@ futurehead::write_mdb_txn::~write_mdb_txn ()
 
 void futurehead::write_mdb_txn::commit () const
 {
+	txn_callbacks.txn_commit (this);
 	auto status (mdb_txn_commit (handle));
 	release_assert (status == MDB_SUCCESS);
 	txn_callbacks.txn_end (this);
+	if (counted)
+	{
+		txn_callbacks.txn_release ();
+	}
 }
 
 void futurehead::write_mdb_txn::renew ()
 {
+	counted = txn_callbacks.txn_acquire ();
 	auto status (mdb_txn_begin (env, nullptr, 0, &handle));
 	release_assert (status == MDB_SUCCESS);
 	txn_callbacks.txn_start (this);
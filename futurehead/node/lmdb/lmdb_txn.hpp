@@ -21,7 +21,13 @@ class mdb_txn_callbacks
 {
 public:
 	std::function<void(const futurehead::transaction_impl *)> txn_start{ [](const futurehead::transaction_impl *) {} };
+	/** Called by write transactions immediately before committing */
+	std::function<void(const futurehead::transaction_impl *)> txn_commit{ [](const futurehead::transaction_impl *) {} };
 	std::function<void(const futurehead::transaction_impl *)> txn_end{ [](const futurehead::transaction_impl *) {} };
+	/** Called before a handle is acquired and may wait. Returns true if the handle is counted, it is then given up when a read transaction is reset */
+	std::function<bool()> txn_acquire{ []() { return false; } };
+	/** Called once a counted handle has been given up */
+	std::function<void()> txn_release{ []() {} };
 };
 
 class read_mdb_txn final : public read_transaction_impl
@@ -33,7 +39,9 @@ public:
 	void renew () override;
 	void * get_handle () const override;
 	MDB_txn * handle;
+	futurehead::mdb_env const & env;
 	mdb_txn_callbacks txn_callbacks;
+	bool counted;
 };
 
 class write_mdb_txn final : public write_transaction_impl
@@ -48,6 +56,7 @@ public:
 	MDB_txn * handle;
 	futurehead::mdb_env const & env;
 	mdb_txn_callbacks txn_callbacks;
+	bool counted;
 };
 
 class mdb_txn_stats
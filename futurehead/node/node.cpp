@@ -89,6 +89,7 @@ node (io_ctx_a, application_path_a, alarm_a, futurehead::node_config (peering_po
 }
 
 futurehead::node::node (boost::asio::io_context & io_ctx_a, boost::filesystem::path const & application_path_a, futurehead::alarm & alarm_a, futurehead::node_config const & config_a, futurehead::work_pool & work_a, futurehead::node_flags flags_a, unsigned seq) :
+rpc_workers (std::max (2u, std::thread::hardware_concurrency ()), futurehead::thread_role::name::rpc_handling),
 io_ctx (io_ctx_a),
 node_initialized_latch (1),
 config (config_a),
@@ -98,7 +99,7 @@ alarm (alarm_a),
 work (work_a),
 distributed_work (*this),
 logger (config_a.logging.min_time_between_log_output),
-store_impl (futurehead::make_store (logger, application_path_a, flags.read_only, true, config_a.rocksdb_config, config_a.diagnostics_config.txn_tracking, config_a.block_processor_batch_max_time, config_a.lmdb_config, flags.sideband_batch_size, config_a.backup_before_upgrade, config_a.rocksdb_config.enable)),
+store_impl (futurehead::make_store (logger, application_path_a, flags.read_only, true, config_a.rocksdb_config, config_a.diagnostics_config.txn_tracking, config_a.block_processor_batch_max_time, config_a.lmdb_config, flags.sideband_batch_size, config_a.backup_before_upgrade, config_a.rocksdb_config.enable, config_a.account_cache_size, config_a.block_cache_size)),
 store (*store_impl),
 wallets_store_impl (std::make_unique<futurehead::mdb_wallets_store> (application_path_a / "wallets.ldb", config_a.lmdb_config)),
 wallets_store (*wallets_store_impl),
@@ -366,7 +367,7 @@ node_seq (seq)
 		if (!is_initialized)
 		{
 			release_assert (!flags.read_only);
-			auto transaction (store.tx_begin_write ({ tables::accounts, tables::cached_counts, tables::confirmation_height, tables::frontiers, tables::open_blocks }));
+			auto transaction (store.tx_begin_write ({ tables::accounts, tables::cached_counts, tables::confirmation_height, tables::delegators, tables::frontiers, tables::open_blocks }));
 			// Store was empty meaning we just created it, add the genesis block
 			store.initialize (transaction, genesis, ledger.cache);
 		}
@@ -405,6 +406,39 @@ node_seq (seq)
 		node_id = futurehead::keypair ();
 		logger.always_log ("Node ID: ", node_id.pub.to_node_id ());
 
+		// A ledger which was pruned before keeps treating pruned hashes as cemented blocks
+		ledger.pruning = flags.enable_pruning || ledger.cache.pruned_count > 0;
+		if (ledger.pruning && !flags.enable_pruning)
+		{
+			logger.always_log (boost::str (boost::format ("Ledger contains %1% pruned blocks, start the node with --enable_pruning to continue pruning") % ledger.cache.pruned_count));
+		}
+
+		if (flags.compact_ledger && !flags.read_only)
+		{
+			if (!store.compact_online ())
+			{
+				logger.always_log ("Compacting the ledger in the background");
+			}
+			else
+			{
+				logger.always_log ("Online compaction is only available for LMDB ledgers");
+			}
+		}
+
+		if (!flags.bootstrap_checkpoint.empty ())
+		{
+			std::vector<futurehead::bootstrap_checkpoint::entry> entries;
+			if (!futurehead::bootstrap_checkpoint::read (flags.bootstrap_checkpoint, flags.bootstrap_checkpoint_commitment, entries))
+			{
+				bootstrap_checkpoint.trust (entries);
+				logger.always_log (boost::str (boost::format ("Using bootstrap checkpoint %1% with %2% account frontiers") % flags.bootstrap_checkpoint % entries.size ()));
+			}
+			else
+			{
+				logger.always_log (boost::str (boost::format ("Bootstrap checkpoint %1% could not be read or does not match commitment %2%, every block signature will be verified") % flags.bootstrap_checkpoint % flags.bootstrap_checkpoint_commitment.to_string ()));
+			}
+		}
+
 		if ((network_params.network.is_live_network () || network_params.network.is_beta_network ()) && !flags.inactive_node)
 		{
 			auto bootstrap_weights = get_bootstrap_weights ();
@@ -577,6 +611,7 @@ std::unique_ptr<futurehead::container_info_component> futurehead::collect_contai
 	composite->add_component (collect_container_info (node.vote_processor, "vote_processor"));
 	composite->add_component (collect_container_info (node.rep_crawler, "rep_crawler"));
 	composite->add_component (collect_container_info (node.block_processor, "block_processor"));
+	composite->add_component (collect_container_info (node.bootstrap_checkpoint, "bootstrap_checkpoint"));
 	composite->add_component (collect_container_info (node.block_arrival, "block_arrival"));
 	composite->add_component (collect_container_info (node.online_reps, "online_reps"));
 	composite->add_component (collect_container_info (node.votes_cache, "votes_cache"));
@@ -584,8 +619,13 @@ std::unique_ptr<futurehead::container_info_component> futurehead::collect_contai
 	composite->add_component (collect_container_info (node.vote_uniquer, "vote_uniquer"));
 	composite->add_component (collect_container_info (node.confirmation_height_processor, "confirmation_height_processor"));
 	composite->add_component (collect_container_info (node.worker, "worker"));
+	composite->add_component (collect_container_info (node.rpc_workers, "rpc_workers"));
 	composite->add_component (collect_container_info (node.distributed_work, "distributed_work"));
 	composite->add_component (collect_container_info (node.aggregator, "request_aggregator"));
+	if (node.websocket_server)
+	{
+		composite->add_component (collect_container_info (*node.websocket_server, "websocket"));
+	}
 	return composite;
 }
 
@@ -597,7 +637,7 @@ void futurehead::node::process_active (std::shared_ptr<futurehead::block> incomi
 
 futurehead::process_return futurehead::node::process (futurehead::block & block_a)
 {
-	auto transaction (store.tx_begin_write ({ tables::accounts, tables::cached_counts, tables::change_blocks, tables::frontiers, tables::open_blocks, tables::pending, tables::receive_blocks, tables::representation, tables::send_blocks, tables::state_blocks }, { tables::confirmation_height }));
+	auto transaction (store.tx_begin_write ({ tables::accounts, tables::cached_counts, tables::change_blocks, tables::delegators, tables::frontiers, tables::open_blocks, tables::pending, tables::pending_totals, tables::receive_blocks, tables::representation, tables::send_blocks, tables::state_blocks }, { tables::confirmation_height }));
 	auto result (ledger.process (transaction, block_a));
 	return result;
 }
@@ -612,7 +652,7 @@ futurehead::process_return futurehead::node::process_local (std::shared_ptr<futu
 	block_processor.wait_write ();
 	// Process block
 	block_post_events events;
-	auto transaction (store.tx_begin_write ({ tables::accounts, tables::cached_counts, tables::change_blocks, tables::frontiers, tables::open_blocks, tables::pending, tables::receive_blocks, tables::representation, tables::send_blocks, tables::state_blocks }, { tables::confirmation_height }));
+	auto transaction (store.tx_begin_write ({ tables::accounts, tables::cached_counts, tables::change_blocks, tables::delegators, tables::frontiers, tables::open_blocks, tables::pending, tables::pending_totals, tables::receive_blocks, tables::representation, tables::send_blocks, tables::state_blocks }, { tables::confirmation_height }));
 	return block_processor.process_one (transaction, events, info, work_watcher_a, futurehead::block_origin::local);
 }
 
@@ -637,9 +677,15 @@ void futurehead::node::start ()
 	{
 		rep_crawler.start ();
 	}
-	ongoing_rep_calculation ();
 	ongoing_peer_store ();
 	ongoing_online_weight_calculation_queue ();
+	if (flags.enable_pruning)
+	{
+		auto this_l (shared ());
+		worker.push_task ([this_l]() {
+			this_l->ongoing_ledger_pruning ();
+		});
+	}
 	bool tcp_enabled (false);
 	if (config.tcp_incoming_connections_max > 0 && !(flags.disable_bootstrap_listener && flags.disable_tcp_realtime))
 	{
@@ -700,6 +746,7 @@ void futurehead::node::stop ()
 		wallets.stop ();
 		stats.stop ();
 		worker.stop ();
+		rpc_workers.stop ();
 		auto epoch_upgrade = epoch_upgrading.lock ();
 		if (epoch_upgrade->valid ())
 		{
@@ -796,19 +843,6 @@ void futurehead::node::long_inactivity_cleanup ()
 	}
 }
 
-void futurehead::node::ongoing_rep_calculation ()
-{
-	auto now (std::chrono::steady_clock::now ());
-	vote_processor.calculate_weights ();
-	std::weak_ptr<futurehead::node> node_w (shared_from_this ());
-	alarm.add (now + std::chrono::minutes (10), [node_w]() {
-		if (auto node_l = node_w.lock ())
-		{
-			node_l->ongoing_rep_calculation ();
-		}
-	});
-}
-
 void futurehead::node::ongoing_bootstrap ()
 {
 	auto next_wakeup (300);
@@ -977,6 +1011,111 @@ void futurehead::node::ongoing_unchecked_cleanup ()
 	});
 }
 
+/**
+ * Collects the first block to prune of every account, starting at \p last_account_a, until roughly \p batch_read_size_a blocks were read.
+ * Blocks are kept if they are within \p max_depth_a of the confirmed frontier and newer than \p cutoff_time_a, the confirmed frontier itself is always kept.
+ * Returns true once all accounts were visited, otherwise \p last_account_a is set to the account to continue from.
+ */
+bool futurehead::node::collect_ledger_pruning_targets (std::deque<futurehead::block_hash> & pruning_targets_a, futurehead::account & last_account_a, uint64_t const batch_read_size_a, uint64_t const max_depth_a, uint64_t const cutoff_time_a)
+{
+	uint64_t read_operations (0);
+	bool finish_transaction (false);
+	auto transaction (store.tx_begin_read ());
+	for (auto i (store.confirmation_height_begin (transaction, last_account_a)), n (store.confirmation_height_end ()); i != n && !finish_transaction;)
+	{
+		++read_operations;
+		auto const & account (i->first);
+		futurehead::block_hash hash (i->second.frontier);
+		uint64_t depth (0);
+		while (!hash.is_zero () && depth < max_depth_a)
+		{
+			auto block (store.block_get (transaction, hash));
+			if (block != nullptr)
+			{
+				if (block->sideband ().timestamp > cutoff_time_a || depth == 0)
+				{
+					hash = block->previous ();
+				}
+				else
+				{
+					break;
+				}
+			}
+			else
+			{
+				// Reached blocks which were pruned before
+				release_assert (depth != 0);
+				hash.clear ();
+			}
+			++depth;
+		}
+		if (!hash.is_zero ())
+		{
+			pruning_targets_a.push_back (hash);
+		}
+		read_operations += depth;
+		if (read_operations >= batch_read_size_a)
+		{
+			last_account_a = account.number () + 1;
+			finish_transaction = true;
+		}
+		else
+		{
+			++i;
+		}
+	}
+	return !finish_transaction || last_account_a.is_zero ();
+}
+
+void futurehead::node::ledger_pruning (uint64_t const batch_size_a, bool bootstrap_weight_reached_a)
+{
+	uint64_t const max_depth (config.max_pruning_depth != 0 ? config.max_pruning_depth : std::numeric_limits<uint64_t>::max ());
+	// Until the initial bootstrap completes nothing is old enough, blocks are pruned only by depth
+	uint64_t const cutoff_time (bootstrap_weight_reached_a ? futurehead::seconds_since_epoch () - config.max_pruning_age.count () : std::numeric_limits<uint64_t>::max ());
+	uint64_t pruned_count (0);
+	uint64_t transaction_write_count (0);
+	futurehead::account last_account (1); // The burn account is never opened, so it marks the end of the iteration
+	std::deque<futurehead::block_hash> pruning_targets;
+	bool target_finished (false);
+	while ((transaction_write_count != 0 || !target_finished) && !stopped)
+	{
+		while (pruning_targets.size () < batch_size_a && !target_finished && !stopped)
+		{
+			target_finished = collect_ledger_pruning_targets (pruning_targets, last_account, batch_size_a * 2, max_depth, cutoff_time);
+		}
+		transaction_write_count = 0;
+		if (!pruning_targets.empty () && !stopped)
+		{
+			auto scoped_write_guard = write_database_queue.wait (futurehead::writer::pruning);
+			auto transaction (store.tx_begin_write ({ tables::cached_counts, tables::change_blocks, tables::open_blocks, tables::pruned, tables::receive_blocks, tables::send_blocks, tables::state_blocks }));
+			while (!pruning_targets.empty () && transaction_write_count < batch_size_a && !stopped)
+			{
+				transaction_write_count += ledger.pruning_action (transaction, pruning_targets.front (), batch_size_a);
+				pruning_targets.pop_front ();
+			}
+			pruned_count += transaction_write_count;
+		}
+	}
+	if (pruned_count > 0)
+	{
+		stats.add (futurehead::stat::type::ledger, futurehead::stat::detail::pruned, futurehead::stat::dir::out, pruned_count);
+		logger.always_log (boost::str (boost::format ("Pruned %1% blocks, %2% pruned in total") % pruned_count % ledger.cache.pruned_count));
+	}
+}
+
+void futurehead::node::ongoing_ledger_pruning ()
+{
+	auto bootstrap_weight_reached (ledger.cache.block_count >= ledger.bootstrap_weight_max_blocks);
+	ledger_pruning (flags.block_processor_batch_size != 0 ? flags.block_processor_batch_size : 2 * 1024, bootstrap_weight_reached);
+	auto ledger_pruning_interval (bootstrap_weight_reached ? config.max_pruning_age : std::min (config.max_pruning_age, std::chrono::seconds (15 * 60)));
+	auto this_l (shared ());
+	alarm.add (std::chrono::steady_clock::now () + ledger_pruning_interval, [this_l]() {
+		this_l->worker.push_task ([this_l]() {
+			this_l->ongoing_ledger_pruning ();
+		});
+	});
+}
+
 int futurehead::node::price (futurehead::uint128_t const & balance_a, int amount_a)
 {
 	debug_assert (balance_a >= amount_a * futurehead::Gxrb_ratio);
@@ -1235,11 +1374,13 @@ void futurehead::node::process_confirmed_data (futurehead::transaction const & t
 	}
 	// Faster amount calculation
 	auto previous (block_a->previous ());
-	auto previous_balance (ledger.balance (transaction_a, previous));
+	bool error_or_pruned (false);
+	auto previous_balance (ledger.balance_safe (transaction_a, previous, error_or_pruned));
 	auto block_balance (store.block_balance_calculated (block_a));
 	if (hash_a != ledger.network_params.ledger.genesis_account)
 	{
-		amount_a = block_balance > previous_balance ? block_balance - previous_balance : previous_balance - block_balance;
+		// The amount is unknown if the previous block was pruned in the meantime
+		amount_a = error_or_pruned ? 0 : block_balance > previous_balance ? block_balance - previous_balance : previous_balance - block_balance;
 	}
 	else
 	{
@@ -1247,7 +1388,7 @@ void futurehead::node::process_confirmed_data (futurehead::transaction const & t
 	}
 	if (auto state = dynamic_cast<futurehead::state_block *> (block_a.get ()))
 	{
-		if (state->hashables.balance < previous_balance)
+		if (error_or_pruned ? state->sideband ().details.is_send : state->hashables.balance < previous_balance)
 		{
 			is_state_send_a = true;
 		}
@@ -1694,7 +1835,7 @@ futurehead::node_flags const & futurehead::inactive_node_flag_defaults ()
 	return node_flags;
 }
 
-std::unique_ptr<futurehead::block_store> futurehead::make_store (futurehead::logger_mt & logger, boost::filesystem::path const & path, bool read_only, bool add_db_postfix, futurehead::rocksdb_config const & rocksdb_config, futurehead::txn_tracking_config const & txn_tracking_config_a, std::chrono::milliseconds block_processor_batch_max_time_a, futurehead::lmdb_config const & lmdb_config_a, size_t batch_size, bool backup_before_upgrade, bool use_rocksdb_backend)
+std::unique_ptr<futurehead::block_store> futurehead::make_store (futurehead::logger_mt & logger, boost::filesystem::path const & path, bool read_only, bool add_db_postfix, futurehead::rocksdb_config const & rocksdb_config, futurehead::txn_tracking_config const & txn_tracking_config_a, std::chrono::milliseconds block_processor_batch_max_time_a, futurehead::lmdb_config const & lmdb_config_a, size_t batch_size, bool backup_before_upgrade, bool use_rocksdb_backend, size_t account_cache_size, size_t block_cache_size)
 {
 #if FUTUREHEAD_ROCKSDB
 	auto make_rocksdb = [&logger, add_db_postfix, &path, &rocksdb_config, read_only]() {
@@ -1725,5 +1866,5 @@ std::unique_ptr<futurehead::block_store> futurehead::make_store (futurehead::log
 #endif
 	}
 
-	return std::make_unique<futurehead::mdb_store> (logger, add_db_postfix ? path / "data.ldb" : path, txn_tracking_config_a, block_processor_batch_max_time_a, lmdb_config_a, batch_size, backup_before_upgrade);
+	return std::make_unique<futurehead::mdb_store> (logger, add_db_postfix ? path / "data.ldb" : path, txn_tracking_config_a, block_processor_batch_max_time_a, lmdb_config_a, batch_size, backup_before_upgrade, account_cache_size, block_cache_size);
 }
@@ -8,6 +8,7 @@
 #include <futurehead/node/blockprocessor.hpp>
 #include <futurehead/node/bootstrap/bootstrap.hpp>
 #include <futurehead/node/bootstrap/bootstrap_attempt.hpp>
+#include <futurehead/node/bootstrap/bootstrap_checkpoint.hpp>
 #include <futurehead/node/bootstrap/bootstrap_server.hpp>
 #include <futurehead/node/confirmation_height_processor.hpp>
 #include <futurehead/node/distributed_work_factory.hpp>
@@ -116,15 +117,17 @@ public:
 	futurehead::block_hash rep_block (futurehead::account const &);
 	futurehead::uint128_t minimum_principal_weight ();
 	futurehead::uint128_t minimum_principal_weight (futurehead::uint128_t const &);
-	void ongoing_rep_calculation ();
 	void ongoing_bootstrap ();
 	void ongoing_store_flush ();
 	void ongoing_peer_store ();
 	void ongoing_unchecked_cleanup ();
+	void ongoing_ledger_pruning ();
 	void backup_wallet ();
 	void search_pending ();
 	void bootstrap_wallet ();
 	void unchecked_cleanup ();
+	bool collect_ledger_pruning_targets (std::deque<futurehead::block_hash> &, futurehead::account &, uint64_t const, uint64_t const, uint64_t const);
+	void ledger_pruning (uint64_t const, bool);
 	int price (futurehead::uint128_t const &, int);
 	// The default difficulty updates to base only when the first epoch_2 block is processed
 	uint64_t default_difficulty (futurehead::work_version const) const;
@@ -149,6 +152,8 @@ public:
 	bool epoch_upgrader (futurehead::private_key const &, futurehead::epoch, uint64_t, uint64_t);
 	std::pair<uint64_t, decltype (futurehead::ledger::bootstrap_weights)> get_bootstrap_weights () const;
 	futurehead::worker worker;
+	/** Runs RPC requests which wait for a client or for each other, so they never occupy IO threads or the worker */
+	futurehead::worker rpc_workers;
 	futurehead::write_database_queue write_database_queue;
 	boost::asio::io_context & io_ctx;
 	boost::latch node_initialized_latch;
@@ -178,6 +183,7 @@ public:
 	futurehead::vote_processor vote_processor;
 	futurehead::rep_crawler rep_crawler;
 	unsigned warmed_up;
+	futurehead::bootstrap_checkpoint bootstrap_checkpoint;
 	futurehead::block_processor block_processor;
 	std::thread block_processor_thread;
 	futurehead::block_arrival block_arrival;
@@ -72,6 +72,7 @@ futurehead::error futurehead::node_config::serialize_toml (futurehead::tomlconfi
 	toml.put ("network_threads", network_threads, "Number of threads dedicated to processing network messages. Defaults to the number of CPU threads, and at least 4.\ntype:uint64");
 	toml.put ("work_threads", work_threads, "Number of threads dedicated to CPU generated work. Defaults to all available CPU threads.\ntype:uint64");
 	toml.put ("signature_checker_threads", signature_checker_threads, "Number of additional threads dedicated to signature verification. Defaults to number of CPU threads / 2.\ntype:uint64");
+	toml.put ("vote_processor_threads", vote_processor_threads, "Number of threads applying verified votes to elections. Votes for different blocks are applied in parallel, 1 applies all votes on the vote processing thread.\ntype:uint64");
 	toml.put ("enable_voting", enable_voting, "Enable or disable voting. Enabling this option requires additional system resources, namely increased CPU, bandwidth and disk usage.\ntype:bool");
 	toml.put ("bootstrap_connections", bootstrap_connections, "Number of outbound bootstrap connections. Must be a power of 2. Defaults to 4.\nWarning: a larger amount of connections may use substantially more system memory.\ntype:uint64");
 	toml.put ("bootstrap_connections_max", bootstrap_connections_max, "Maximum number of inbound bootstrap connections. Defaults to 64.\nWarning: a larger amount of connections may use additional system memory.\ntype:uint64");
@@ -99,6 +100,10 @@ futurehead::error futurehead::node_config::serialize_toml (futurehead::tomlconfi
 	toml.put ("max_work_generate_multiplier", max_work_generate_multiplier, "Maximum allowed difficulty multiplier for work generation.\ntype:double,[1..]");
 	toml.put ("frontiers_confirmation", serialize_frontiers_confirmation (frontiers_confirmation), "Mode controlling frontier confirmation rate.\ntype:string,{auto,always,disabled}");
 	toml.put ("max_queued_requests", max_queued_requests, "Limit for number of queued confirmation requests for one channel, after which new requests are dropped until the queue drops below this value.\ntype:uint32");
+	toml.put ("account_cache_size", account_cache_size, "Number of account and confirmation height entries kept in memory by the ledger store, for each table. Set to 0 to disable caching.\ntype:uint64");
+	toml.put ("max_pruning_age", max_pruning_age.count (), "Time before cemented blocks are eligible for pruning, only used if the node is started with --enable_pruning.\ntype:seconds");
+	toml.put ("max_pruning_depth", max_pruning_depth, "Number of cemented blocks kept below each account's confirmed frontier regardless of their age, only used if the node is started with --enable_pruning. 0 keeps all blocks younger than max_pruning_age.\ntype:uint64");
+	toml.put ("block_cache_size", block_cache_size, "Number of recently processed or read blocks kept in memory by the ledger store. Set to 0 to disable caching.\ntype:uint64");
 
 	auto work_peers_l (toml.create_array ("work_peers", "A list of \"address:port\" entries to identify work peers."));
 	for (auto i (work_peers.begin ()), n (work_peers.end ()); i != n; ++i)
@@ -307,6 +312,7 @@ futurehead::error futurehead::node_config::deserialize_toml (futurehead::tomlcon
 		toml.get<bool> ("enable_voting", enable_voting);
 		toml.get<bool> ("allow_local_peers", allow_local_peers);
 		toml.get<unsigned> (signature_checker_threads_key, signature_checker_threads);
+		toml.get<unsigned> ("vote_processor_threads", vote_processor_threads);
 
 		auto lmdb_max_dbs_default = deprecated_lmdb_max_dbs;
 		toml.get<int> ("lmdb_max_dbs", deprecated_lmdb_max_dbs);
@@ -359,6 +365,13 @@ futurehead::error futurehead::node_config::deserialize_toml (futurehead::tomlcon
 		toml.get<double> ("max_work_generate_multiplier", max_work_generate_multiplier);
 
 		toml.get<uint32_t> ("max_queued_requests", max_queued_requests);
+		toml.get<size_t> ("account_cache_size", account_cache_size);
+		toml.get<size_t> ("block_cache_size", block_cache_size);
+
+		auto max_pruning_age_l = max_pruning_age.count ();
+		toml.get ("max_pruning_age", max_pruning_age_l);
+		max_pruning_age = std::chrono::seconds (max_pruning_age_l);
+		toml.get<uint64_t> ("max_pruning_depth", max_pruning_depth);
 
 		if (toml.has_key ("frontiers_confirmation"))
 		{
@@ -62,6 +62,8 @@ public:
 	unsigned work_threads{ std::max<unsigned> (4, std::thread::hardware_concurrency ()) };
 	/* Use half available threads on the system for signature checking. The calling thread does checks as well, so these are extra worker threads */
 	unsigned signature_checker_threads{ std::thread::hardware_concurrency () / 2 };
+	/** Threads applying verified votes to elections, votes for the same block are always applied by the same thread. 1 applies them on the vote processing thread */
+	unsigned vote_processor_threads{ 1 };
 	bool enable_voting{ false };
 	unsigned bootstrap_connections{ 4 };
 	unsigned bootstrap_connections_max{ 64 };
@@ -99,6 +101,14 @@ public:
 	std::chrono::seconds work_watcher_period{ std::chrono::seconds (5) };
 	double max_work_generate_multiplier{ 64. };
 	uint32_t max_queued_requests{ 512 };
+	/** Number of account_info and confirmation_height entries cached in memory by the ledger store */
+	size_t account_cache_size{ 64 * 1024 };
+	/** Number of recently used blocks, including sideband, cached in memory by the ledger store */
+	size_t block_cache_size{ 16 * 1024 };
+	/** Minimum age of cemented blocks whose contents are removed when ledger pruning is enabled */
+	std::chrono::seconds max_pruning_age{ !network_params.network.is_live_network () ? std::chrono::seconds (5 * 60) : std::chrono::seconds (24 * 60 * 60) };
+	/** Cemented blocks deeper than this below the confirmed frontier are pruned regardless of their age, 0 disables the limit */
+	uint64_t max_pruning_depth{ 0 };
 	futurehead::rocksdb_config rocksdb_config;
 	futurehead::lmdb_config lmdb_config;
 	futurehead::frontiers_confirmation_mode frontiers_confirmation{ futurehead::frontiers_confirmation_mode::automatic };
@@ -124,6 +134,10 @@ public:
 	bool disable_bootstrap_listener{ false };
 	bool disable_bootstrap_bulk_pull_server{ false };
 	bool disable_bootstrap_bulk_push_client{ false };
+	/** Do not ask bootstrap peers for the compact state block encoding in bulk pull responses */
+	bool disable_bootstrap_compact_stream{ false };
+	/** Scale bootstrap connections from queued pulls only, instead of from measured throughput and block processor backlog */
+	bool disable_bootstrap_adaptive_connections{ false };
 	bool disable_rep_crawler{ false };
 	bool disable_request_loop{ false };
 	bool disable_tcp_realtime{ false };
@@ -139,6 +153,9 @@ public:
 	bool disable_max_peers_per_ip{ false }; // For testing only
 	bool fast_bootstrap{ false };
 	bool read_only{ false };
+	bool enable_pruning{ false };
+	/** Compact the LMDB ledger in the background, the compacted copy replaces the ledger file when the node stops */
+	bool compact_ledger{ false };
 	futurehead::confirmation_height_mode confirmation_height_processor_mode{ futurehead::confirmation_height_mode::automatic };
 	futurehead::generate_cache generate_cache;
 	bool inactive_node{ false };
@@ -148,5 +165,14 @@ public:
 	size_t block_processor_verification_size{ 0 };
 	size_t inactive_votes_cache_size{ 16 * 1024 };
 	size_t vote_processor_capacity{ 144 * 1024 };
+	/** Frontier pairs sent to a bootstrapping peer per write, 1 writes each pair separately */
+	size_t frontier_req_batch_size{ 4 * 1024 };
+	/** Account ranges whose frontiers are requested concurrently from different connections by legacy bootstrap, 1 requests all frontiers from a single peer */
+	unsigned bootstrap_frontier_ranges{ 1 };
+	/** Bulk pull requests outstanding per bootstrap connection, responses are read in request order */
+	unsigned bootstrap_pull_pipeline{ 1 };
+	/** Path of a bootstrap_checkpoint file, signatures of the blocks it commits to are not verified */
+	std::string bootstrap_checkpoint;
+	futurehead::block_hash bootstrap_checkpoint_commitment{ 0 };
 };
 }
@@ -0,0 +1,158 @@
+#include <futurehead/lib/utility.hpp>
+#include <futurehead/node/prioritized_roots.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+futurehead::prioritized_roots::prioritized_roots ()
+{
+	sorted.fill (true);
+}
+
+futurehead::prioritized_roots::iterator futurehead::prioritized_roots::begin () const
+{
+	return iterator (entries.begin ());
+}
+
+futurehead::prioritized_roots::iterator futurehead::prioritized_roots::end () const
+{
+	return iterator (entries.end ());
+}
+
+futurehead::prioritized_roots::iterator futurehead::prioritized_roots::find (futurehead::qualified_root const & root_a) const
+{
+	return iterator (entries.find (root_a));
+}
+
+bool futurehead::prioritized_roots::empty () const
+{
+	return entries.empty ();
+}
+
+size_t futurehead::prioritized_roots::size () const
+{
+	return entries.size ();
+}
+
+void futurehead::prioritized_roots::clear ()
+{
+	entries.clear ();
+	for (auto & bucket_l : buckets)
+	{
+		bucket_l.clear ();
+	}
+	sorted.fill (true);
+}
+
+std::pair<futurehead::prioritized_roots::iterator, bool> futurehead::prioritized_roots::insert (futurehead::conflict_info const & info_a)
+{
+	auto inserted (entries.emplace (info_a.root, entry{ info_a, 0, 0, next_sequence }));
+	if (inserted.second)
+	{
+		++next_sequence;
+		bucket_insert (inserted.first->second);
+	}
+	return { iterator (inserted.first), inserted.second };
+}
+
+futurehead::prioritized_roots::iterator futurehead::prioritized_roots::erase (iterator const & iterator_a)
+{
+	auto existing (entries.find (iterator_a->root));
+	debug_assert (existing != entries.end ());
+	bucket_erase (existing->second);
+	return iterator (entries.erase (existing));
+}
+
+void futurehead::prioritized_roots::multiplier_set (iterator const & iterator_a, double multiplier_a)
+{
+	auto existing (entries.find (iterator_a->root));
+	debug_assert (existing != entries.end ());
+	existing->second.info.multiplier = multiplier_a;
+}
+
+void futurehead::prioritized_roots::adjusted_multiplier_set (iterator const & iterator_a, double adjusted_multiplier_a)
+{
+	auto existing (entries.find (iterator_a->root));
+	debug_assert (existing != entries.end ());
+	auto & entry_l (existing->second);
+	if (bucket (adjusted_multiplier_a) == entry_l.bucket)
+	{
+		entry_l.info.adjusted_multiplier = adjusted_multiplier_a;
+		buckets[entry_l.bucket][entry_l.index].adjusted_multiplier = adjusted_multiplier_a;
+		sorted[entry_l.bucket] = false;
+	}
+	else
+	{
+		bucket_erase (entry_l);
+		entry_l.info.adjusted_multiplier = adjusted_multiplier_a;
+		bucket_insert (entry_l);
+	}
+}
+
+std::vector<futurehead::conflict_info const *> futurehead::prioritized_roots::top (size_t count_a)
+{
+	std::vector<futurehead::conflict_info const *> result;
+	result.reserve (std::min (count_a, entries.size ()));
+	if (count_a > 0)
+	{
+		ordered ([&result, count_a](futurehead::conflict_info const & info_a) {
+			result.push_back (&info_a);
+			return result.size () < count_a;
+		});
+	}
+	return result;
+}
+
+size_t futurehead::prioritized_roots::bucket (double multiplier_a)
+{
+	size_t result (0);
+	if (multiplier_a > 1.)
+	{
+		result = std::min<size_t> (static_cast<size_t> (std::log2 (multiplier_a) * 8.), bucket_count - 1);
+	}
+	return result;
+}
+
+void futurehead::prioritized_roots::bucket_insert (entry & entry_a)
+{
+	entry_a.bucket = bucket (entry_a.info.adjusted_multiplier);
+	auto & bucket_l (buckets[entry_a.bucket]);
+	slot slot_l{ entry_a.info.adjusted_multiplier, entry_a.sequence, &entry_a };
+	// Appending keeps the bucket sorted if the new entry has the lowest priority
+	if (!bucket_l.empty () && (bucket_l.back ().adjusted_multiplier < slot_l.adjusted_multiplier || (bucket_l.back ().adjusted_multiplier == slot_l.adjusted_multiplier && bucket_l.back ().sequence > slot_l.sequence)))
+	{
+		sorted[entry_a.bucket] = false;
+	}
+	entry_a.index = bucket_l.size ();
+	bucket_l.push_back (slot_l);
+}
+
+void futurehead::prioritized_roots::bucket_erase (entry & entry_a)
+{
+	auto & bucket_l (buckets[entry_a.bucket]);
+	debug_assert (entry_a.index < bucket_l.size () && bucket_l[entry_a.index].entry == &entry_a);
+	if (entry_a.index + 1 != bucket_l.size ())
+	{
+		// Fill the gap with the last entry of the bucket
+		bucket_l[entry_a.index] = bucket_l.back ();
+		bucket_l[entry_a.index].entry->index = entry_a.index;
+		sorted[entry_a.bucket] = false;
+	}
+	bucket_l.pop_back ();
+}
+
+void futurehead::prioritized_roots::bucket_sort (size_t bucket_a)
+{
+	if (!sorted[bucket_a])
+	{
+		auto & bucket_l (buckets[bucket_a]);
+		std::sort (bucket_l.begin (), bucket_l.end (), [](slot const & lhs, slot const & rhs) {
+			return lhs.adjusted_multiplier > rhs.adjusted_multiplier || (lhs.adjusted_multiplier == rhs.adjusted_multiplier && lhs.sequence < rhs.sequence);
+		});
+		for (size_t i (0), n (bucket_l.size ()); i < n; ++i)
+		{
+			bucket_l[i].entry->index = i;
+		}
+		sorted[bucket_a] = true;
+	}
+}
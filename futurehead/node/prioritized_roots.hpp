@@ -0,0 +1,111 @@
+#pragma once
+
+#include <futurehead/lib/epoch.hpp>
+#include <futurehead/lib/numbers.hpp>
+#include <futurehead/secure/common.hpp>
+
+#include <boost/iterator/transform_iterator.hpp>
+
+#include <array>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace futurehead
+{
+class election;
+
+class conflict_info final
+{
+public:
+	futurehead::qualified_root root;
+	double multiplier;
+	double adjusted_multiplier;
+	std::shared_ptr<futurehead::election> election;
+	futurehead::epoch epoch;
+	futurehead::uint128_t previous_balance;
+};
+
+/**
+ * Active election roots, indexed by root and prioritized by adjusted multiplier.
+ * Entries are kept in flat vectors, one per multiplier bucket, which are only sorted when iterated in priority order.
+ * Inserting, erasing and changing the multiplier of an entry is constant time, and iterating the top entries only sorts the buckets reached.
+ * Not thread safe, access is serialized by the active_transactions mutex
+ */
+class prioritized_roots final
+{
+	class entry final
+	{
+	public:
+		futurehead::conflict_info info;
+		size_t bucket;
+		size_t index;
+		/** Insertion order, entries with the same multiplier are prioritized first come first served */
+		uint64_t sequence;
+	};
+	class slot final
+	{
+	public:
+		double adjusted_multiplier;
+		uint64_t sequence;
+		futurehead::prioritized_roots::entry * entry;
+	};
+	using container = std::unordered_map<futurehead::qualified_root, entry>;
+	class entry_info final
+	{
+	public:
+		futurehead::conflict_info const & operator() (container::value_type const & item_a) const
+		{
+			return item_a.second.info;
+		}
+	};
+
+public:
+	using iterator = boost::transform_iterator<entry_info, container::const_iterator>;
+	/** Multipliers are bucketed in 1/8th of a doubling, the highest bucket holds every multiplier above 2^16 */
+	static size_t constexpr bucket_count{ 128 };
+
+	prioritized_roots ();
+	iterator begin () const;
+	iterator end () const;
+	iterator find (futurehead::qualified_root const &) const;
+	bool empty () const;
+	size_t size () const;
+	void clear ();
+	/** Returns an iterator to the existing entry for the same root, and false, if one already exists */
+	std::pair<iterator, bool> insert (futurehead::conflict_info const &);
+	iterator erase (iterator const &);
+	void multiplier_set (iterator const &, double);
+	void adjusted_multiplier_set (iterator const &, double);
+	/** Up to \p count_a entries in descending order of adjusted multiplier, invalidated by erasing the referenced entry */
+	std::vector<futurehead::conflict_info const *> top (size_t count_a = std::numeric_limits<size_t>::max ());
+	/** Calls \p action_a with entries in descending order of adjusted multiplier until it returns false. Entries must not be inserted or erased meanwhile */
+	template <typename Action>
+	void ordered (Action const & action_a)
+	{
+		auto more (true);
+		for (auto i (bucket_count); i > 0 && more; --i)
+		{
+			bucket_sort (i - 1);
+			auto const & bucket_l (buckets[i - 1]);
+			for (auto j (bucket_l.begin ()), n (bucket_l.end ()); j != n && more; ++j)
+			{
+				more = action_a (j->entry->info);
+			}
+		}
+	}
+	static size_t bucket (double);
+
+private:
+	void bucket_insert (entry &);
+	void bucket_erase (entry &);
+	void bucket_sort (size_t);
+	container entries;
+	std::array<std::vector<slot>, bucket_count> buckets;
+	/** Buckets currently in priority order */
+	std::array<bool, bucket_count> sorted;
+	uint64_t next_sequence{ 0 };
+};
+}
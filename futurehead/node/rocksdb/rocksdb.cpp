@@ -74,7 +74,7 @@ futurehead::rocksdb_store::~rocksdb_store ()
 
 void futurehead::rocksdb_store::open (bool & error_a, boost::filesystem::path const & path_a, bool open_read_only_a)
 {
-	std::initializer_list<const char *> names{ rocksdb::kDefaultColumnFamilyName.c_str (), "frontiers", "accounts", "send", "receive", "open", "change", "state_blocks", "pending", "representation", "unchecked", "vote", "online_weight", "meta", "peers", "cached_counts", "confirmation_height" };
+	std::initializer_list<const char *> names{ rocksdb::kDefaultColumnFamilyName.c_str (), "frontiers", "accounts", "send", "receive", "open", "change", "state_blocks", "pending", "representation", "unchecked", "vote", "online_weight", "meta", "peers", "cached_counts", "confirmation_height", "pruned", "delegators", "pending_totals" };
 	std::vector<rocksdb::ColumnFamilyDescriptor> column_families;
 	for (const auto & cf_name : names)
 	{
@@ -189,6 +189,12 @@ rocksdb::ColumnFamilyHandle * futurehead::rocksdb_store::table_to_column_family
 			return get_handle ("cached_counts");
 		case tables::confirmation_height:
 			return get_handle ("confirmation_height");
+		case tables::pruned:
+			return get_handle ("pruned");
+		case tables::delegators:
+			return get_handle ("delegators");
+		case tables::pending_totals:
+			return get_handle ("pending_totals");
 		default:
 			release_assert (false);
 			return get_handle ("peers");
@@ -283,6 +289,7 @@ bool futurehead::rocksdb_store::is_caching_counts (futurehead::tables table_a) c
 		case tables::open_blocks:
 		case tables::change_blocks:
 		case tables::state_blocks:
+		case tables::pruned:
 			return true;
 		default:
 			return false;
@@ -548,7 +555,7 @@ rocksdb::ColumnFamilyOptions futurehead::rocksdb_store::get_cf_options () const
 
 std::vector<futurehead::tables> futurehead::rocksdb_store::all_tables () const
 {
-	return std::vector<futurehead::tables>{ tables::accounts, tables::cached_counts, tables::change_blocks, tables::confirmation_height, tables::frontiers, tables::meta, tables::online_weight, tables::open_blocks, tables::peers, tables::pending, tables::receive_blocks, tables::representation, tables::send_blocks, tables::state_blocks, tables::unchecked, tables::vote };
+	return std::vector<futurehead::tables>{ tables::accounts, tables::cached_counts, tables::change_blocks, tables::confirmation_height, tables::delegators, tables::frontiers, tables::meta, tables::online_weight, tables::open_blocks, tables::peers, tables::pending, tables::pending_totals, tables::pruned, tables::receive_blocks, tables::representation, tables::send_blocks, tables::state_blocks, tables::unchecked, tables::vote };
 }
 
 bool futurehead::rocksdb_store::copy_db (boost::filesystem::path const & destination_path)
@@ -624,6 +631,12 @@ void futurehead::rocksdb_store::rebuild_db (futurehead::write_transaction const
 	release_assert (false && "Not available for RocksDB");
 }
 
+bool futurehead::rocksdb_store::compact_online ()
+{
+	// RocksDB compacts in the background by itself
+	return true;
+}
+
 bool futurehead::rocksdb_store::init_error () const
 {
 	return error;
@@ -56,6 +56,7 @@ public:
 
 	bool copy_db (boost::filesystem::path const & destination) override;
 	void rebuild_db (futurehead::write_transaction const & transaction_a) override;
+	bool compact_online () override;
 
 	template <typename Key, typename Value>
 	futurehead::store_iterator<Key, Value> make_iterator (futurehead::transaction const & transaction_a, tables table_a) const
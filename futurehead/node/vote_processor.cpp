@@ -1,3 +1,4 @@
+#include <futurehead/crypto/blake2/blake2.h>
 #include <futurehead/lib/logger_mt.hpp>
 #include <futurehead/lib/stats.hpp>
 #include <futurehead/lib/threading.hpp>
@@ -15,6 +16,17 @@
 
 #include <boost/format.hpp>
 
+#include <algorithm>
+
+namespace
+{
+futurehead::stat::detail bucket_detail (size_t bucket_a)
+{
+	static std::array<futurehead::stat::detail, futurehead::vote_processor::bucket_count> const details{ { futurehead::stat::detail::bucket_0, futurehead::stat::detail::bucket_1, futurehead::stat::detail::bucket_2, futurehead::stat::detail::bucket_3 } };
+	return details[bucket_a];
+}
+}
+
 futurehead::vote_processor::vote_processor (futurehead::signature_checker & checker_a, futurehead::active_transactions & active_a, futurehead::node_observers & observers_a, futurehead::stat & stats_a, futurehead::node_config & config_a, futurehead::node_flags & flags_a, futurehead::logger_mt & logger_a, futurehead::online_reps & online_reps_a, futurehead::ledger & ledger_a, futurehead::network_params & network_params_a) :
 checker (checker_a),
 active (active_a),
@@ -29,11 +41,20 @@ max_votes (flags_a.vote_processor_capacity),
 started (false),
 stopped (false),
 is_active (false),
+apply_queues (config_a.vote_processor_threads > 1 ? config_a.vote_processor_threads : 0),
+apply_queue_max (std::max<size_t> (1, max_votes / std::max<size_t> (1, apply_queues.size ()))),
 thread ([this]() {
 	futurehead::thread_role::set (futurehead::thread_role::name::vote_processing);
 	process_loop ();
 })
 {
+	for (size_t i (0); i < apply_queues.size (); ++i)
+	{
+		apply_threads.emplace_back ([this, i]() {
+			futurehead::thread_role::set (futurehead::thread_role::name::vote_applying);
+			apply_loop (i);
+		});
+	}
 	futurehead::unique_lock<std::mutex> lock (mutex);
 	condition.wait (lock, [& started = started] { return started; });
 }
@@ -52,10 +73,9 @@ void futurehead::vote_processor::process_loop ()
 
 	while (!stopped)
 	{
-		if (!votes.empty ())
+		if (votes_size > 0)
 		{
-			decltype (votes) votes_l;
-			votes_l.swap (votes);
+			auto votes_l (dequeue_batch ());
 
 			log_this_iteration = false;
 			if (config.logging.network_logging () && votes_l.size () > 50)
@@ -89,48 +109,169 @@ void futurehead::vote_processor::process_loop ()
 	}
 }
 
+void futurehead::vote_processor::apply_loop (size_t index_a)
+{
+	futurehead::unique_lock<std::mutex> lock (apply_mutex);
+	while (!apply_stopped)
+	{
+		auto & queue (apply_queues[index_a]);
+		if (!queue.empty ())
+		{
+			std::deque<std::pair<std::shared_ptr<futurehead::vote>, std::shared_ptr<futurehead::transport::channel>>> votes_l;
+			votes_l.swap (queue);
+			++applying;
+			lock.unlock ();
+			for (auto const & vote : votes_l)
+			{
+				vote_blocking (vote.first, vote.second, true);
+			}
+			lock.lock ();
+			--applying;
+			apply_condition.notify_all ();
+		}
+		else
+		{
+			apply_condition.wait (lock);
+		}
+	}
+}
+
+size_t futurehead::vote_processor::shard (futurehead::vote const & vote_a) const
+{
+	debug_assert (!apply_queues.empty ());
+	uint64_t result (0);
+	for (auto const & hash : vote_a)
+	{
+		result ^= hash.qwords[0];
+	}
+	return result % apply_queues.size ();
+}
+
 bool futurehead::vote_processor::vote (std::shared_ptr<futurehead::vote> vote_a, std::shared_ptr<futurehead::transport::channel> channel_a)
 {
 	bool process (false);
+	bool duplicate (false);
+	bool replaced (false);
+	auto bucket_l (bucket (vote_a->account));
+	auto key (queue_key (*vote_a));
 	futurehead::unique_lock<std::mutex> lock (mutex);
 	if (!stopped)
 	{
-		// Level 0 (< 0.1%)
-		if (votes.size () < 6.0 / 9.0 * max_votes)
+		auto existing (queued.find (key));
+		if (existing != queued.end ())
 		{
+			// The representative already has a vote for these blocks queued, only the newest one is verified and processed
 			process = true;
+			if (vote_a->sequence > existing->second->vote->sequence)
+			{
+				existing->second->vote = vote_a;
+				existing->second->channel = channel_a;
+				replaced = true;
+			}
+			else
+			{
+				duplicate = true;
+			}
 		}
-		// Level 1 (0.1-1%)
-		else if (votes.size () < 7.0 / 9.0 * max_votes)
-		{
-			process = (representatives_1.find (vote_a->account) != representatives_1.end ());
-		}
-		// Level 2 (1-5%)
-		else if (votes.size () < 8.0 / 9.0 * max_votes)
+		// Votes from lower weight buckets make room when the queue is full
+		else if (votes_size < max_votes || evict_below (bucket_l))
 		{
-			process = (representatives_2.find (vote_a->account) != representatives_2.end ());
+			buckets[bucket_l].push_back ({ vote_a, channel_a, key, std::chrono::steady_clock::now () });
+			queued.emplace (key, &buckets[bucket_l].back ());
+			++votes_size;
+			process = true;
 		}
-		// Level 3 (> 5%)
-		else if (votes.size () < max_votes)
+	}
+	lock.unlock ();
+	if (duplicate)
+	{
+		stats.inc (futurehead::stat::type::vote, futurehead::stat::detail::vote_duplicate);
+	}
+	else if (replaced)
+	{
+		stats.inc (futurehead::stat::type::vote, futurehead::stat::detail::vote_replaced);
+	}
+	else if (process)
+	{
+		condition.notify_all ();
+	}
+	else
+	{
+		stats.inc (futurehead::stat::type::vote, futurehead::stat::detail::vote_overflow);
+		stats.inc (futurehead::stat::type::vote_queue_drop, bucket_detail (bucket_l));
+	}
+	return !process;
+}
+
+futurehead::block_hash futurehead::vote_processor::queue_key (futurehead::vote const & vote_a)
+{
+	futurehead::block_hash result;
+	blake2b_state state;
+	blake2b_init (&state, sizeof (result.bytes));
+	blake2b_update (&state, vote_a.account.bytes.data (), sizeof (vote_a.account.bytes));
+	for (auto const & hash : vote_a)
+	{
+		blake2b_update (&state, hash.bytes.data (), sizeof (hash.bytes));
+	}
+	blake2b_final (&state, result.bytes.data (), sizeof (result.bytes));
+	return result;
+}
+
+bool futurehead::vote_processor::evict_below (size_t bucket_a)
+{
+	auto result (false);
+	for (size_t i (0); i < bucket_a && !result; ++i)
+	{
+		auto & bucket_l (buckets[i]);
+		if (!bucket_l.empty ())
 		{
-			process = (representatives_3.find (vote_a->account) != representatives_3.end ());
+			queued.erase (bucket_l.front ().key);
+			bucket_l.pop_front ();
+			--votes_size;
+			stats.inc (futurehead::stat::type::vote, futurehead::stat::detail::vote_overflow);
+			stats.inc (futurehead::stat::type::vote_queue_drop, bucket_detail (i));
+			result = true;
 		}
-		if (process)
+	}
+	return result;
+}
+
+std::deque<std::pair<std::shared_ptr<futurehead::vote>, std::shared_ptr<futurehead::transport::channel>>> futurehead::vote_processor::dequeue_batch ()
+{
+	std::deque<std::pair<std::shared_ptr<futurehead::vote>, std::shared_ptr<futurehead::transport::channel>>> result;
+	std::array<uint64_t, bucket_count> counts{};
+	std::array<uint64_t, bucket_count> latencies{};
+	auto now (std::chrono::steady_clock::now ());
+	while (votes_size > 0 && result.size () < batch_max)
+	{
+		for (size_t i (bucket_count); i > 0 && result.size () < batch_max; --i)
 		{
-			votes.emplace_back (vote_a, channel_a);
-			lock.unlock ();
-			condition.notify_all ();
-			// Lock no longer required
+			auto & bucket_l (buckets[i - 1]);
+			if (!bucket_l.empty ())
+			{
+				auto & front (bucket_l.front ());
+				++counts[i - 1];
+				latencies[i - 1] += std::chrono::duration_cast<std::chrono::milliseconds> (now - front.arrival).count ();
+				queued.erase (front.key);
+				result.emplace_back (front.vote, front.channel);
+				bucket_l.pop_front ();
+				--votes_size;
+			}
 		}
-		else
+	}
+	for (size_t i (0); i < bucket_count; ++i)
+	{
+		if (counts[i] > 0)
 		{
-			stats.inc (futurehead::stat::type::vote, futurehead::stat::detail::vote_overflow);
+			// Average time spent in the queue is vote_queue_latency / vote_queue, in milliseconds
+			stats.add (futurehead::stat::type::vote_queue, bucket_detail (i), futurehead::stat::dir::in, counts[i]);
+			stats.add (futurehead::stat::type::vote_queue_latency, bucket_detail (i), futurehead::stat::dir::in, latencies[i]);
 		}
 	}
-	return !process;
+	return result;
 }
 
-void futurehead::vote_processor::verify_votes (decltype (votes) const & votes_a)
+void futurehead::vote_processor::verify_votes (std::deque<std::pair<std::shared_ptr<futurehead::vote>, std::shared_ptr<futurehead::transport::channel>>> const & votes_a)
 {
 	auto size (votes_a.size ());
 	std::vector<unsigned char const *> messages;
@@ -153,15 +294,40 @@ void futurehead::vote_processor::verify_votes (decltype (votes) const & votes_a)
 	}
 	futurehead::signature_check_set check = { size, messages.data (), lengths.data (), pub_keys.data (), signatures.data (), verifications.data () };
 	checker.verify (check);
-	auto i (0);
-	for (auto const & vote : votes_a)
+	if (apply_queues.empty ())
+	{
+		auto i (0);
+		for (auto const & vote : votes_a)
+		{
+			debug_assert (verifications[i] == 1 || verifications[i] == 0);
+			if (verifications[i] == 1)
+			{
+				vote_blocking (vote.first, vote.second, true);
+			}
+			++i;
+		}
+	}
+	else
 	{
-		debug_assert (verifications[i] == 1 || verifications[i] == 0);
-		if (verifications[i] == 1)
+		futurehead::unique_lock<std::mutex> lock (apply_mutex);
+		auto i (0);
+		for (auto const & vote : votes_a)
 		{
-			vote_blocking (vote.first, vote.second, true);
+			debug_assert (verifications[i] == 1 || verifications[i] == 0);
+			if (verifications[i++] == 1)
+			{
+				// Votes on the same blocks are applied in order by the same thread
+				auto & queue (apply_queues[shard (*vote.first)]);
+				if (queue.size () >= apply_queue_max)
+				{
+					apply_condition.notify_all ();
+					apply_condition.wait (lock, [this, &queue] { return queue.size () < apply_queue_max || apply_stopped; });
+				}
+				queue.push_back (vote);
+			}
 		}
-		++i;
+		lock.unlock ();
+		apply_condition.notify_all ();
 	}
 }
 
@@ -211,78 +377,85 @@ void futurehead::vote_processor::stop ()
 	{
 		thread.join ();
 	}
+	{
+		futurehead::lock_guard<std::mutex> lock (apply_mutex);
+		apply_stopped = true;
+	}
+	apply_condition.notify_all ();
+	for (auto & apply_thread : apply_threads)
+	{
+		if (apply_thread.joinable ())
+		{
+			apply_thread.join ();
+		}
+	}
 }
 
 void futurehead::vote_processor::flush ()
 {
 	futurehead::unique_lock<std::mutex> lock (mutex);
-	while (is_active || !votes.empty ())
+	while (is_active || votes_size > 0)
 	{
 		condition.wait (lock);
 	}
+	lock.unlock ();
+	futurehead::unique_lock<std::mutex> apply_lock (apply_mutex);
+	while (applying > 0 || std::any_of (apply_queues.begin (), apply_queues.end (), [](auto const & queue_a) { return !queue_a.empty (); }))
+	{
+		apply_condition.wait (apply_lock);
+	}
 }
 
 size_t futurehead::vote_processor::size ()
 {
 	futurehead::lock_guard<std::mutex> guard (mutex);
-	return votes.size ();
+	return votes_size;
 }
 
 bool futurehead::vote_processor::empty ()
 {
 	futurehead::lock_guard<std::mutex> guard (mutex);
-	return votes.empty ();
+	return votes_size == 0;
 }
 
-void futurehead::vote_processor::calculate_weights ()
+size_t futurehead::vote_processor::bucket (futurehead::account const & representative_a)
 {
-	futurehead::unique_lock<std::mutex> lock (mutex);
-	if (!stopped)
+	size_t result (0);
+	auto weight (ledger.weight (representative_a));
+	auto supply (online_reps.online_stake ());
+	if (weight > supply / 20) // 5% or above
 	{
-		representatives_1.clear ();
-		representatives_2.clear ();
-		representatives_3.clear ();
-		auto supply (online_reps.online_stake ());
-		auto rep_amounts = ledger.cache.rep_weights.get_rep_amounts ();
-		for (auto const & rep_amount : rep_amounts)
-		{
-			futurehead::account const & representative (rep_amount.first);
-			auto weight (ledger.weight (representative));
-			if (weight > supply / 1000) // 0.1% or above (level 1)
-			{
-				representatives_1.insert (representative);
-				if (weight > supply / 100) // 1% or above (level 2)
-				{
-					representatives_2.insert (representative);
-					if (weight > supply / 20) // 5% or above (level 3)
-					{
-						representatives_3.insert (representative);
-					}
-				}
-			}
-		}
+		result = 3;
+	}
+	else if (weight > supply / 100) // 1% or above
+	{
+		result = 2;
+	}
+	else if (weight > supply / 1000) // 0.1% or above
+	{
+		result = 1;
 	}
+	return result;
 }
 
 std::unique_ptr<futurehead::container_info_component> futurehead::collect_container_info (vote_processor & vote_processor, const std::string & name)
 {
-	size_t votes_count;
-	size_t representatives_1_count;
-	size_t representatives_2_count;
-	size_t representatives_3_count;
-
+	std::array<size_t, futurehead::vote_processor::bucket_count> bucket_counts;
+	size_t queued_count;
 	{
 		futurehead::lock_guard<std::mutex> guard (vote_processor.mutex);
-		votes_count = vote_processor.votes.size ();
-		representatives_1_count = vote_processor.representatives_1.size ();
-		representatives_2_count = vote_processor.representatives_2.size ();
-		representatives_3_count = vote_processor.representatives_3.size ();
+		for (size_t i (0); i < bucket_counts.size (); ++i)
+		{
+			bucket_counts[i] = vote_processor.buckets[i].size ();
+		}
+		queued_count = vote_processor.queued.size ();
 	}
 
 	auto composite = std::make_unique<container_info_composite> (name);
-	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "votes", votes_count, sizeof (decltype (vote_processor.votes)::value_type) }));
-	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "representatives_1", representatives_1_count, sizeof (decltype (vote_processor.representatives_1)::value_type) }));
-	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "representatives_2", representatives_2_count, sizeof (decltype (vote_processor.representatives_2)::value_type) }));
-	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "representatives_3", representatives_3_count, sizeof (decltype (vote_processor.representatives_3)::value_type) }));
+	for (size_t i (0); i < bucket_counts.size (); ++i)
+	{
+		composite->add_component (std::make_unique<container_info_leaf> (container_info{ "bucket_" + std::to_string (i), bucket_counts[i], sizeof (futurehead::vote_processor::queued_vote) }));
+	}
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "queued", queued_count, sizeof (decltype (vote_processor.queued)::value_type) }));
 	return composite;
 }
@@ -4,11 +4,14 @@
 #include <futurehead/lib/utility.hpp>
 #include <futurehead/secure/common.hpp>
 
+#include <array>
+#include <chrono>
 #include <deque>
 #include <memory>
 #include <mutex>
 #include <thread>
-#include <unordered_set>
+#include <unordered_map>
+#include <vector>
 
 namespace futurehead
 {
@@ -41,11 +44,33 @@ public:
 	void flush ();
 	size_t size ();
 	bool empty ();
-	void calculate_weights ();
+	/** Queue bucket of votes from \p representative_a, higher buckets belong to representatives with a larger share of the online stake */
+	size_t bucket (futurehead::account const & representative_a);
 	void stop ();
+	/** Number of weight buckets, votes are dequeued round-robin from all non-empty buckets */
+	static size_t constexpr bucket_count{ 4 };
+	/** Maximum number of votes verified in a single signature check batch */
+	static size_t constexpr batch_max{ 1024 };
 
 private:
+	class queued_vote final
+	{
+	public:
+		std::shared_ptr<futurehead::vote> vote;
+		std::shared_ptr<futurehead::transport::channel> channel;
+		futurehead::block_hash key;
+		std::chrono::steady_clock::time_point arrival;
+	};
 	void process_loop ();
+	/** Takes up to batch_max votes, one from each non-empty bucket in turn starting with the highest weight */
+	std::deque<std::pair<std::shared_ptr<futurehead::vote>, std::shared_ptr<futurehead::transport::channel>>> dequeue_batch ();
+	void apply_loop (size_t);
+	/** Index of the apply thread for votes on the same blocks as \p vote_a */
+	size_t shard (futurehead::vote const & vote_a) const;
+	/** Identifies votes from the same representative for the same blocks, regardless of their sequence */
+	static futurehead::block_hash queue_key (futurehead::vote const &);
+	/** Drops the oldest vote of the lowest non-empty bucket below \p bucket_a, returns false if there is none */
+	bool evict_below (size_t bucket_a);
 
 	futurehead::signature_checker & checker;
 	futurehead::active_transactions & active;
@@ -59,20 +84,30 @@ private:
 
 	size_t max_votes;
 
-	std::deque<std::pair<std::shared_ptr<futurehead::vote>, std::shared_ptr<futurehead::transport::channel>>> votes;
-	/** Representatives levels for random early detection */
-	std::unordered_set<futurehead::account> representatives_1;
-	std::unordered_set<futurehead::account> representatives_2;
-	std::unordered_set<futurehead::account> representatives_3;
+	std::array<std::deque<queued_vote>, bucket_count> buckets;
+	/** Total number of votes in all buckets */
+	size_t votes_size{ 0 };
+	/** Queued votes by queue_key, a representative voting again on the same blocks before its vote was processed replaces the queued vote */
+	std::unordered_map<futurehead::block_hash, queued_vote *> queued;
 	futurehead::condition_variable condition;
 	std::mutex mutex;
 	bool started;
 	bool stopped;
 	bool is_active;
+	/** Verified votes waiting to be applied, one queue per apply thread holding up to apply_queue_max votes. Empty if votes are applied by the vote processing thread */
+	std::vector<std::deque<std::pair<std::shared_ptr<futurehead::vote>, std::shared_ptr<futurehead::transport::channel>>>> apply_queues;
+	/** The vote processing thread waits for room in full apply queues, so votes beyond the capacity are dropped by the weight buckets */
+	size_t const apply_queue_max;
+	/** Number of apply threads currently applying votes */
+	size_t applying{ 0 };
+	bool apply_stopped{ false };
+	futurehead::condition_variable apply_condition;
+	std::mutex apply_mutex;
+	std::vector<std::thread> apply_threads;
 	std::thread thread;
 
 	friend std::unique_ptr<container_info_component> collect_container_info (vote_processor & vote_processor, const std::string & name);
-	friend class vote_processor_weights_Test;
+	friend class vote_processor_bucket_eviction_Test;
 };
 
 std::unique_ptr<container_info_component> collect_container_info (vote_processor & vote_processor, const std::string & name);
@@ -12,6 +12,7 @@
 #include <boost/property_tree/json_parser.hpp>
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 
 futurehead::websocket::confirmation_options::confirmation_options (futurehead::wallets & wallets_a) :
@@ -189,6 +190,24 @@ void futurehead::websocket::confirmation_options::check_filter_empty () const
 	}
 }
 
+futurehead::websocket::confirmation_subscriber::confirmation_subscriber (std::weak_ptr<futurehead::websocket::session> const & weak_session_a, futurehead::websocket::confirmation_options const & options_a) :
+weak_session (weak_session_a),
+confirmation_types (options_a.get_confirmation_types ()),
+include_block (options_a.get_include_block ()),
+include_election_info (options_a.get_include_election_info ()),
+has_account_filtering_options (options_a.get_has_account_filtering_options ()),
+all_local_accounts (options_a.get_all_local_accounts ())
+{
+	for (auto const & account_text_l : options_a.get_accounts ())
+	{
+		futurehead::account account_l (0);
+		auto error_l (account_l.decode_account (account_text_l));
+		(void)error_l;
+		debug_assert (!error_l);
+		accounts.insert (account_l);
+	}
+}
+
 futurehead::websocket::vote_options::vote_options (boost::property_tree::ptree const & options_a, futurehead::logger_mt & logger_a)
 {
 	include_replays = options_a.get<bool> ("include_replays", false);
@@ -257,6 +276,7 @@ futurehead::websocket::session::~session ()
 			ws_listener.decrease_subscriber_count (subscription.first);
 		}
 	}
+	ws_listener.index_confirmation_subscriber (this, boost::none);
 }
 
 void futurehead::websocket::session::handshake ()
@@ -290,36 +310,62 @@ void futurehead::websocket::session::close ()
 	});
 }
 
-void futurehead::websocket::session::write (futurehead::websocket::message message_a)
+void futurehead::websocket::session::write (futurehead::websocket::message const & message_a)
+{
+	boost::optional<futurehead::shared_const_buffer> buffer_l;
+	write (message_a, buffer_l);
+}
+
+void futurehead::websocket::session::write (futurehead::websocket::message const & message_a, boost::optional<futurehead::shared_const_buffer> & buffer_a)
 {
 	futurehead::unique_lock<std::mutex> lk (subscriptions_mutex);
 	auto subscription (subscriptions.find (message_a.topic));
 	if (message_a.topic == futurehead::websocket::topic::ack || (subscription != subscriptions.end () && !subscription->second->should_filter (message_a)))
 	{
 		lk.unlock ();
-		auto this_l (shared_from_this ());
-		boost::asio::post (ws.get_strand (),
-		[message_a, this_l]() {
-			bool write_in_progress = !this_l->send_queue.empty ();
-			this_l->send_queue.emplace_back (message_a);
-			if (!write_in_progress)
-			{
-				this_l->write_queued_messages ();
-			}
-		});
+		if (!buffer_a)
+		{
+			buffer_a = futurehead::shared_const_buffer (message_a.to_string ());
+		}
+		enqueue (buffer_a.get ());
 	}
 }
 
+void futurehead::websocket::session::enqueue (futurehead::shared_const_buffer const & buffer_a)
+{
+	auto this_l (shared_from_this ());
+	boost::asio::post (ws.get_strand (),
+	[buffer_a, this_l]() {
+		bool write_in_progress = !this_l->send_queue.empty ();
+		this_l->send_queue.emplace_back (buffer_a);
+		auto queued_l (this_l->send_queue.size ());
+		this_l->queued = queued_l;
+		if (queued_l > this_l->queued_peak)
+		{
+			this_l->queued_peak = queued_l;
+		}
+		if (!write_in_progress)
+		{
+			this_l->write_queued_messages ();
+		}
+		else
+		{
+			++this_l->delayed;
+		}
+	});
+}
+
 void futurehead::websocket::session::write_queued_messages ()
 {
-	auto msg (send_queue.front ().to_string ());
 	auto this_l (shared_from_this ());
 
-	ws.async_write (futurehead::shared_const_buffer (msg),
+	ws.async_write (send_queue.front (),
 	[this_l](boost::system::error_code ec, std::size_t bytes_transferred) {
 		this_l->send_queue.pop_front ();
+		this_l->queued = this_l->send_queue.size ();
 		if (!ec)
 		{
+			++this_l->sent;
 			if (!this_l->send_queue.empty ())
 			{
 				this_l->write_queued_messages ();
@@ -328,6 +374,16 @@ void futurehead::websocket::session::write_queued_messages ()
 	});
 }
 
+futurehead::websocket::session_counters futurehead::websocket::session::counters () const
+{
+	futurehead::websocket::session_counters counters_l;
+	counters_l.sent = sent;
+	counters_l.delayed = delayed;
+	counters_l.queued = queued;
+	counters_l.queued_peak = queued_peak;
+	return counters_l;
+}
+
 void futurehead::websocket::session::read ()
 {
 	auto this_l (shared_from_this ());
@@ -534,12 +590,37 @@ void futurehead::websocket::session::handle_message (boost::property_tree::ptree
 		ack_l = "true";
 		action = "pong";
 	}
+	if (topic_l == futurehead::websocket::topic::confirmation && action_succeeded)
+	{
+		index_confirmation_subscription ();
+	}
 	if (ack_l && action_succeeded)
 	{
 		send_ack (action, id_l);
 	}
 }
 
+void futurehead::websocket::session::index_confirmation_subscription ()
+{
+	boost::optional<futurehead::websocket::confirmation_subscriber> subscriber_l;
+	{
+		futurehead::lock_guard<std::mutex> lk (subscriptions_mutex);
+		auto subscription (subscriptions.find (futurehead::websocket::topic::confirmation));
+		if (subscription != subscriptions.end ())
+		{
+			futurehead::websocket::confirmation_options default_options (ws_listener.get_wallets ());
+			auto conf_options (dynamic_cast<futurehead::websocket::confirmation_options *> (subscription->second.get ()));
+			if (conf_options == nullptr)
+			{
+				conf_options = &default_options;
+			}
+			subscriber_l = futurehead::websocket::confirmation_subscriber (shared_from_this (), *conf_options);
+		}
+	}
+	// The listener index is locked before subscriptions_mutex when broadcasting, it must not be updated while holding it
+	ws_listener.index_confirmation_subscriber (this, subscriber_l);
+}
+
 void futurehead::websocket::listener::stop ()
 {
 	stopped = true;
@@ -631,59 +712,140 @@ void futurehead::websocket::listener::on_accept (boost::system::error_code ec)
 
 void futurehead::websocket::listener::broadcast_confirmation (std::shared_ptr<futurehead::block> block_a, futurehead::account const & account_a, futurehead::amount const & amount_a, std::string subtype, futurehead::election_status const & election_status_a)
 {
-	futurehead::websocket::message_builder builder;
+	uint8_t confirmation_type_l (0);
+	switch (election_status_a.type)
+	{
+		case futurehead::election_status_type::active_confirmed_quorum:
+			confirmation_type_l = futurehead::websocket::confirmation_options::type_active_quorum;
+			break;
+		case futurehead::election_status_type::active_confirmation_height:
+			confirmation_type_l = futurehead::websocket::confirmation_options::type_active_confirmation_height;
+			break;
+		case futurehead::election_status_type::inactive_confirmation_height:
+			confirmation_type_l = futurehead::websocket::confirmation_options::type_inactive;
+			break;
+		default:
+			break;
+	};
+	// Account filtering requires a destination, legacy blocks are always filtered
+	boost::optional<futurehead::account> destination_l;
+	if (block_a->type () == futurehead::block_type::state)
+	{
+		destination_l = block_a->link ().account;
+	}
+	// Checked at most once per confirmation, for the sessions filtering on local wallet accounts
+	boost::optional<bool> local_l;
+	auto is_local = [this, &account_a, &destination_l, &local_l]() {
+		if (!local_l)
+		{
+			auto transaction_l (wallets.tx_begin_read ());
+			local_l = wallets.exists (transaction_l, account_a) || wallets.exists (transaction_l, destination_l.get ());
+		}
+		return local_l.get ();
+	};
 
-	futurehead::lock_guard<std::mutex> lk (sessions_mutex);
-	boost::optional<futurehead::websocket::message> msg_with_block;
-	boost::optional<futurehead::websocket::message> msg_without_block;
-	for (auto & weak_session : sessions)
+	futurehead::websocket::message_builder builder;
+	// One serialized message per combination of include_block and include_election_info, shared by all sessions
+	std::array<boost::optional<futurehead::shared_const_buffer>, 4> buffers;
+
+	// Sessions to notify with the index of their buffer, the last owner of a session must not release it under confirmation_mutex which its destructor takes
+	std::vector<std::pair<std::shared_ptr<futurehead::websocket::session>, size_t>> sessions_l;
+	futurehead::unique_lock<std::mutex> lk (confirmation_mutex);
+	std::vector<futurehead::websocket::session *> candidates (confirmation_unindexed.begin (), confirmation_unindexed.end ());
+	if (destination_l)
 	{
-		auto session_ptr (weak_session.lock ());
-		if (session_ptr)
+		for (auto const & account_l : { account_a, destination_l.get () })
 		{
-			auto subscription (session_ptr->subscriptions.find (futurehead::websocket::topic::confirmation));
-			if (subscription != session_ptr->subscriptions.end ())
+			auto existing (confirmation_accounts.find (account_l));
+			if (existing != confirmation_accounts.end ())
 			{
-				futurehead::websocket::confirmation_options default_options (wallets);
-				auto conf_options (dynamic_cast<futurehead::websocket::confirmation_options *> (subscription->second.get ()));
-				if (conf_options == nullptr)
-				{
-					conf_options = &default_options;
-				}
-				auto include_block (conf_options == nullptr ? true : conf_options->get_include_block ());
-
-				if (include_block && !msg_with_block)
-				{
-					msg_with_block = builder.block_confirmed (block_a, account_a, amount_a, subtype, include_block, election_status_a, *conf_options);
-				}
-				else if (!include_block && !msg_without_block)
-				{
-					msg_without_block = builder.block_confirmed (block_a, account_a, amount_a, subtype, include_block, election_status_a, *conf_options);
-				}
-				else
-				{
-					debug_assert (false);
-				}
-
-				session_ptr->write (include_block ? msg_with_block.get () : msg_without_block.get ());
+				candidates.insert (candidates.end (), existing->second.begin (), existing->second.end ());
+			}
+		}
+		// Sessions can be found through both accounts
+		std::sort (candidates.begin (), candidates.end ());
+		candidates.erase (std::unique (candidates.begin (), candidates.end ()), candidates.end ());
+	}
+	for (auto session_l : candidates)
+	{
+		auto const & subscriber (confirmation_subscribers.at (session_l));
+		auto should_filter (!(subscriber.confirmation_types & confirmation_type_l));
+		if (!should_filter && subscriber.has_account_filtering_options)
+		{
+			should_filter = !subscriber.include_block || !destination_l || (subscriber.accounts.count (account_a) == 0 && subscriber.accounts.count (destination_l.get ()) == 0 && !(subscriber.all_local_accounts && is_local ()));
+		}
+		if (!should_filter)
+		{
+			auto session_ptr (subscriber.weak_session.lock ());
+			if (session_ptr)
+			{
+				sessions_l.emplace_back (std::move (session_ptr), (subscriber.include_block ? 2 : 0) + (subscriber.include_election_info ? 1 : 0));
 			}
 		}
 	}
+	lk.unlock ();
+	for (auto const & session_l : sessions_l)
+	{
+		auto & buffer (buffers[session_l.second]);
+		if (!buffer)
+		{
+			buffer = futurehead::shared_const_buffer (builder.block_confirmed (block_a, account_a, amount_a, subtype, (session_l.second & 2) != 0, election_status_a, (session_l.second & 1) != 0).to_string ());
+		}
+		session_l.first->enqueue (buffer.get ());
+	}
 }
 
 void futurehead::websocket::listener::broadcast (futurehead::websocket::message message_a)
 {
+	boost::optional<futurehead::shared_const_buffer> buffer_l;
 	futurehead::lock_guard<std::mutex> lk (sessions_mutex);
 	for (auto & weak_session : sessions)
 	{
 		auto session_ptr (weak_session.lock ());
 		if (session_ptr)
 		{
-			session_ptr->write (message_a);
+			session_ptr->write (message_a, buffer_l);
 		}
 	}
 }
 
+void futurehead::websocket::listener::index_confirmation_subscriber (futurehead::websocket::session * session_a, boost::optional<futurehead::websocket::confirmation_subscriber> const & subscriber_a)
+{
+	futurehead::lock_guard<std::mutex> lk (confirmation_mutex);
+	auto existing (confirmation_subscribers.find (session_a));
+	if (existing != confirmation_subscribers.end ())
+	{
+		for (auto const & account_l : existing->second.accounts)
+		{
+			auto sessions_l (confirmation_accounts.find (account_l));
+			debug_assert (sessions_l != confirmation_accounts.end ());
+			sessions_l->second.erase (session_a);
+			if (sessions_l->second.empty ())
+			{
+				confirmation_accounts.erase (sessions_l);
+			}
+		}
+		confirmation_unindexed.erase (session_a);
+		confirmation_subscribers.erase (existing);
+	}
+	if (subscriber_a)
+	{
+		auto const & subscriber (subscriber_a.get ());
+		if (!subscriber.has_account_filtering_options || subscriber.all_local_accounts)
+		{
+			confirmation_unindexed.insert (session_a);
+		}
+		if (subscriber.has_account_filtering_options)
+		{
+			for (auto const & account_l : subscriber.accounts)
+			{
+				confirmation_accounts[account_l].insert (session_a);
+			}
+		}
+		confirmation_subscribers.emplace (session_a, subscriber);
+	}
+}
+
 void futurehead::websocket::listener::increase_subscriber_count (futurehead::websocket::topic const & topic_a)
 {
 	topic_subscriber_count[static_cast<std::size_t> (topic_a)] += 1;
@@ -708,7 +870,7 @@ futurehead::websocket::message futurehead::websocket::message_builder::stopped_e
 	return message_l;
 }
 
-futurehead::websocket::message futurehead::websocket::message_builder::block_confirmed (std::shared_ptr<futurehead::block> block_a, futurehead::account const & account_a, futurehead::amount const & amount_a, std::string subtype, bool include_block_a, futurehead::election_status const & election_status_a, futurehead::websocket::confirmation_options const & options_a)
+futurehead::websocket::message futurehead::websocket::message_builder::block_confirmed (std::shared_ptr<futurehead::block> block_a, futurehead::account const & account_a, futurehead::amount const & amount_a, std::string subtype, bool include_block_a, futurehead::election_status const & election_status_a, bool include_election_info_a)
 {
 	futurehead::websocket::message message_l (futurehead::websocket::topic::confirmation);
 	set_common_fields (message_l);
@@ -736,7 +898,7 @@ futurehead::websocket::message futurehead::websocket::message_builder::block_con
 	};
 	message_node_l.add ("confirmation_type", confirmation_type);
 
-	if (options_a.get_include_election_info ())
+	if (include_election_info_a)
 	{
 		boost::property_tree::ptree election_node_l;
 		election_node_l.add ("duration", election_status_a.election_duration.count ());
@@ -943,3 +1105,34 @@ std::string futurehead::websocket::message::to_string () const
 	ostream.flush ();
 	return ostream.str ();
 }
+
+std::unique_ptr<futurehead::container_info_component> futurehead::websocket::collect_container_info (listener & listener, const std::string & name)
+{
+	size_t sessions_count (0);
+	size_t send_queue_count (0);
+	{
+		futurehead::lock_guard<std::mutex> guard (listener.sessions_mutex);
+		for (auto & weak_session : listener.sessions)
+		{
+			auto session_ptr (weak_session.lock ());
+			if (session_ptr)
+			{
+				++sessions_count;
+				send_queue_count += session_ptr->counters ().queued;
+			}
+		}
+	}
+	size_t confirmation_subscribers_count;
+	size_t confirmation_accounts_count;
+	{
+		futurehead::lock_guard<std::mutex> guard (listener.confirmation_mutex);
+		confirmation_subscribers_count = listener.confirmation_subscribers.size ();
+		confirmation_accounts_count = listener.confirmation_accounts.size ();
+	}
+	auto composite = std::make_unique<container_info_composite> (name);
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "sessions", sessions_count, sizeof (decltype (listener.sessions)::value_type) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "send_queue", send_queue_count, sizeof (futurehead::shared_const_buffer) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "confirmation_subscribers", confirmation_subscribers_count, sizeof (decltype (listener.confirmation_subscribers)::value_type) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "confirmation_accounts", confirmation_accounts_count, sizeof (decltype (listener.confirmation_accounts)::value_type) }));
+	return composite;
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <futurehead/lib/asio.hpp>
 #include <futurehead/lib/blocks.hpp>
 #include <futurehead/lib/numbers.hpp>
 #include <futurehead/lib/work.hpp>
@@ -9,6 +10,7 @@
 
 #include <boost/property_tree/json_parser.hpp>
 
+#include <atomic>
 #include <deque>
 #include <memory>
 #include <mutex>
@@ -81,7 +83,7 @@ namespace websocket
 	class message_builder final
 	{
 	public:
-		message block_confirmed (std::shared_ptr<futurehead::block> block_a, futurehead::account const & account_a, futurehead::amount const & amount_a, std::string subtype, bool include_block, futurehead::election_status const & election_status_a, futurehead::websocket::confirmation_options const & options_a);
+		message block_confirmed (std::shared_ptr<futurehead::block> block_a, futurehead::account const & account_a, futurehead::amount const & amount_a, std::string subtype, bool include_block, futurehead::election_status const & election_status_a, bool include_election_info_a);
 		message stopped_election (futurehead::block_hash const & hash_a);
 		message vote_received (std::shared_ptr<futurehead::vote> vote_a, futurehead::vote_code code_a);
 		message difficulty_changed (uint64_t publish_threshold_a, uint64_t difficulty_active_a);
@@ -170,6 +172,30 @@ namespace websocket
 			return include_election_info;
 		}
 
+		/** Returns the set of confirmation types which are not filtered */
+		uint8_t get_confirmation_types () const
+		{
+			return confirmation_types;
+		}
+
+		/** Returns whether or not confirmations are filtered by source/destination account */
+		bool get_has_account_filtering_options () const
+		{
+			return has_account_filtering_options;
+		}
+
+		/** Returns whether or not blocks with local wallet accounts as source/destination are not filtered */
+		bool get_all_local_accounts () const
+		{
+			return all_local_accounts;
+		}
+
+		/** Returns the encoded accounts for which blocks are not filtered */
+		std::unordered_set<std::string> const & get_accounts () const
+		{
+			return accounts;
+		}
+
 		static constexpr const uint8_t type_active_quorum = 1;
 		static constexpr const uint8_t type_active_confirmation_height = 2;
 		static constexpr const uint8_t type_inactive = 4;
@@ -212,6 +238,38 @@ namespace websocket
 		bool include_indeterminate{ false };
 	};
 
+	/**
+	 * Snapshot of the confirmation subscription of a session. The listener indexes these by account so that
+	 * each confirmation only visits the sessions it may be sent to, instead of filtering in every session.
+	 */
+	class confirmation_subscriber final
+	{
+	public:
+		confirmation_subscriber (std::weak_ptr<futurehead::websocket::session> const & weak_session_a, futurehead::websocket::confirmation_options const & options_a);
+
+		std::weak_ptr<futurehead::websocket::session> weak_session;
+		uint8_t confirmation_types;
+		bool include_block;
+		bool include_election_info;
+		bool has_account_filtering_options;
+		bool all_local_accounts;
+		std::unordered_set<futurehead::account> accounts;
+	};
+
+	/** Backpressure counters of a session. Messages queued behind a pending write indicate a slow client */
+	class session_counters final
+	{
+	public:
+		/** Messages written to the websocket */
+		uint64_t sent{ 0 };
+		/** Messages which were queued while a previous write was in progress */
+		uint64_t delayed{ 0 };
+		/** Messages currently waiting in the send queue */
+		size_t queued{ 0 };
+		/** Highest number of messages waiting in the send queue */
+		size_t queued_peak{ 0 };
+	};
+
 	/** A websocket session managing its own lifetime */
 	class session final : public std::enable_shared_from_this<session>
 	{
@@ -236,7 +294,16 @@ namespace websocket
 		void read ();
 
 		/** Enqueue \p message_a for writing to the websockets */
-		void write (futurehead::websocket::message message_a);
+		void write (futurehead::websocket::message const & message_a);
+
+		/**
+		 * Enqueue \p message_a for writing to the websockets, unless filtered by the subscription options.
+		 * The message is serialized into \p buffer_a if it is not already set, so that it can be shared with other sessions
+		 */
+		void write (futurehead::websocket::message const & message_a, boost::optional<futurehead::shared_const_buffer> & buffer_a);
+
+		/** Backpressure counters of the send queue */
+		futurehead::websocket::session_counters counters () const;
 
 	private:
 		/** The owning listener */
@@ -245,8 +312,13 @@ namespace websocket
 		futurehead::websocket::stream ws;
 		/** Buffer for received messages */
 		boost::beast::multi_buffer read_buffer;
-		/** Outgoing messages. The send queue is protected by accessing it only through the strand */
-		std::deque<message> send_queue;
+		/** Outgoing serialized messages, possibly shared with other sessions. The send queue is protected by accessing it only through the strand */
+		std::deque<futurehead::shared_const_buffer> send_queue;
+		/** Backpressure counters, written from the strand */
+		std::atomic<uint64_t> sent{ 0 };
+		std::atomic<uint64_t> delayed{ 0 };
+		std::atomic<size_t> queued{ 0 };
+		std::atomic<size_t> queued_peak{ 0 };
 
 		/** Hash functor for topic enums */
 		struct topic_hash
@@ -267,6 +339,10 @@ namespace websocket
 		void send_ack (std::string action_a, std::string id_a);
 		/** Send all queued messages. This must be called from the write strand. */
 		void write_queued_messages ();
+		/** Queue an already serialized message */
+		void enqueue (futurehead::shared_const_buffer const & buffer_a);
+		/** Update the confirmation subscription indexed by the listener after subscribing, updating or unsubscribing */
+		void index_confirmation_subscription ();
 	};
 
 	/** Creates a new session for each incoming connection */
@@ -321,6 +397,8 @@ namespace websocket
 		void increase_subscriber_count (futurehead::websocket::topic const & topic_a);
 		/** Removes from subscription count of a specific topic*/
 		void decrease_subscriber_count (futurehead::websocket::topic const & topic_a);
+		/** Replaces the indexed confirmation subscription of \p session_a, or removes it if \p subscriber_a is not set */
+		void index_confirmation_subscriber (futurehead::websocket::session * session_a, boost::optional<futurehead::websocket::confirmation_subscriber> const & subscriber_a);
 
 		std::shared_ptr<futurehead::tls_config> tls_config;
 		futurehead::logger_mt & logger;
@@ -331,6 +409,17 @@ namespace websocket
 		std::vector<std::weak_ptr<session>> sessions;
 		std::array<std::atomic<std::size_t>, number_topics> topic_subscriber_count{};
 		std::atomic<bool> stopped{ false };
+		/** Protects the confirmation subscription index */
+		std::mutex confirmation_mutex;
+		std::unordered_map<futurehead::websocket::session *, futurehead::websocket::confirmation_subscriber> confirmation_subscribers;
+		/** Sessions filtering confirmations by these source/destination accounts */
+		std::unordered_map<futurehead::account, std::unordered_set<futurehead::websocket::session *>> confirmation_accounts;
+		/** Sessions which must be visited for every confirmation, either unfiltered or filtering on local wallet accounts */
+		std::unordered_set<futurehead::websocket::session *> confirmation_unindexed;
+
+		friend std::unique_ptr<futurehead::container_info_component> collect_container_info (listener & listener, const std::string & name);
 	};
+
+	std::unique_ptr<futurehead::container_info_component> collect_container_info (listener & listener, const std::string & name);
 }
 }
@@ -1,4 +1,5 @@
 #include <futurehead/boost/asio/bind_executor.hpp>
+#include <futurehead/boost/asio/post.hpp>
 #include <futurehead/lib/json_error_response.hpp>
 #include <futurehead/lib/logger_mt.hpp>
 #include <futurehead/lib/rpc_handler_interface.hpp>
@@ -117,11 +118,22 @@ void futurehead::rpc_connection::parse_request (STREAM_TYPE & stream, std::share
 				ss << std::hex << std::showbase << reinterpret_cast<uintptr_t> (this_l.get ());
 				auto request_id = ss.str ();
 				auto response_handler ([this_l, version, start, request_id, &stream](std::string const & tree_a) {
-					auto body = tree_a;
-					this_l->write_result (body, version);
-					boost::beast::http::async_write (stream, this_l->res, boost::asio::bind_executor (this_l->strand, [this_l](boost::system::error_code const & ec, size_t bytes_transferred) {
-						this_l->write_completion_handler (this_l);
-					}));
+					if (this_l->chunked)
+					{
+						if (!tree_a.empty ())
+						{
+							this_l->write_chunk (stream, std::make_shared<std::string> (tree_a));
+						}
+						this_l->write_chunk (stream, std::shared_ptr<std::string> ());
+					}
+					else
+					{
+						auto body = tree_a;
+						this_l->write_result (body, version);
+						boost::beast::http::async_write (stream, this_l->res, boost::asio::bind_executor (this_l->strand, [this_l](boost::system::error_code const & ec, size_t bytes_transferred) {
+							this_l->write_completion_handler (this_l);
+						}));
+					}
 
 					std::stringstream ss;
 					if (this_l->rpc_config.rpc_logging.log_rpc)
@@ -134,12 +146,45 @@ void futurehead::rpc_connection::parse_request (STREAM_TYPE & stream, std::share
 				std::string api_path_l = "/api/v2";
 				int rpc_version_l = boost::starts_with (path_l, api_path_l) ? 2 : 1;
 
+				// Responses larger than a chunk are streamed as they are produced, which needs HTTP/1.1
+				std::function<void(std::string const &)> response_chunk;
+				if (version == 11)
+				{
+					response_chunk = [this_l, version, &stream](std::string const & chunk_a) {
+						if (chunk_a.empty ())
+						{
+							// The response failed midway, closing the connection without the last chunk tells the client it is incomplete
+							boost::asio::post (this_l->strand, [this_l]() {
+								boost::system::error_code ec;
+								this_l->socket.shutdown (boost::asio::ip::tcp::socket::shutdown_both, ec);
+								this_l->socket.close (ec);
+							});
+						}
+						else if (!this_l->chunked.exchange (true))
+						{
+							if (!this_l->responded.test_and_set ())
+							{
+								this_l->prepare_head (version);
+								this_l->res.chunked (true);
+							}
+							else
+							{
+								debug_assert (false && "RPC already responded and should only respond once");
+							}
+						}
+						if (!chunk_a.empty ())
+						{
+							this_l->write_chunk (stream, std::make_shared<std::string> (chunk_a));
+						}
+					};
+				}
+
 				auto method = req.method ();
 				switch (method)
 				{
 					case boost::beast::http::verb::post:
 					{
-						auto handler (std::make_shared<futurehead::rpc_handler> (this_l->rpc_config, req.body (), request_id, response_handler, this_l->rpc_handler_interface, this_l->logger));
+						auto handler (std::make_shared<futurehead::rpc_handler> (this_l->rpc_config, req.body (), request_id, response_handler, this_l->rpc_handler_interface, this_l->logger, response_chunk));
 						futurehead::rpc_handler_request_params request_params;
 						request_params.rpc_version = rpc_version_l;
 						request_params.credentials = header_field_credentials_l.to_string ();
@@ -173,6 +218,61 @@ void futurehead::rpc_connection::parse_request (STREAM_TYPE & stream, std::share
 	}));
 }
 
+template <typename STREAM_TYPE>
+void futurehead::rpc_connection::write_chunk (STREAM_TYPE & stream, std::shared_ptr<std::string> const & chunk_a)
+{
+	auto this_l (shared_from_this ());
+	boost::asio::post (strand, [this_l, &stream, chunk_a]() {
+		auto write_in_progress (!this_l->chunks.empty ());
+		this_l->chunks.push_back (chunk_a);
+		if (!write_in_progress)
+		{
+			this_l->write_chunks (stream);
+		}
+	});
+}
+
+template <typename STREAM_TYPE>
+void futurehead::rpc_connection::write_chunks (STREAM_TYPE & stream)
+{
+	auto this_l (shared_from_this ());
+	if (chunked_serializer == nullptr)
+	{
+		// The header goes first, the chunks follow it
+		chunked_serializer = std::make_unique<boost::beast::http::response_serializer<boost::beast::http::string_body>> (res);
+		boost::beast::http::async_write_header (stream, *chunked_serializer, boost::asio::bind_executor (strand, [this_l, &stream](boost::system::error_code const & ec, size_t bytes_transferred) {
+			if (ec)
+			{
+				this_l->logger.always_log ("RPC write error: ", ec.message ());
+			}
+			this_l->write_chunks (stream);
+		}));
+	}
+	else
+	{
+		auto chunk_l (chunks.front ());
+		auto handler (boost::asio::bind_executor (strand, [this_l, &stream, chunk_l](boost::system::error_code const & ec, size_t bytes_transferred) {
+			this_l->chunks.pop_front ();
+			if (chunk_l == nullptr)
+			{
+				this_l->write_completion_handler (this_l);
+			}
+			else if (!this_l->chunks.empty ())
+			{
+				this_l->write_chunks (stream);
+			}
+		}));
+		if (chunk_l != nullptr)
+		{
+			boost::asio::async_write (stream, boost::beast::http::make_chunk (boost::asio::buffer (*chunk_l)), handler);
+		}
+		else
+		{
+			boost::asio::async_write (stream, boost::beast::http::make_chunk_last (), handler);
+		}
+	}
+}
+
 template void futurehead::rpc_connection::read (socket_type &);
 template void futurehead::rpc_connection::parse_request (socket_type &, std::shared_ptr<boost::beast::http::request_parser<boost::beast::http::empty_body>>);
 #ifdef FUTUREHEAD_SECURE_RPC
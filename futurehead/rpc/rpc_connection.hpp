@@ -8,6 +8,8 @@
 #include <boost/algorithm/string/predicate.hpp>
 
 #include <atomic>
+#include <deque>
+#include <memory>
 
 /* Boost v1.70 introduced breaking changes; the conditional compilation allows 1.6x to be supported as well. */
 #if BOOST_VERSION < 107000
@@ -41,6 +43,8 @@ public:
 	futurehead::logger_mt & logger;
 	futurehead::rpc_config const & rpc_config;
 	futurehead::rpc_handler_interface & rpc_handler_interface;
+	/** Set once the response has started with chunked transfer encoding */
+	std::atomic<bool> chunked{ false };
 
 protected:
 	template <typename STREAM_TYPE>
@@ -48,5 +52,16 @@ protected:
 
 	template <typename STREAM_TYPE>
 	void parse_request (STREAM_TYPE & stream, std::shared_ptr<boost::beast::http::request_parser<boost::beast::http::empty_body>> header_parser);
+
+	/** Queues a chunk of the response body, a null chunk ends the response */
+	template <typename STREAM_TYPE>
+	void write_chunk (STREAM_TYPE & stream, std::shared_ptr<std::string> const & chunk_a);
+
+	template <typename STREAM_TYPE>
+	void write_chunks (STREAM_TYPE & stream);
+
+	/** Chunks waiting to be written, the front one is being written. Only accessed on the strand */
+	std::deque<std::shared_ptr<std::string>> chunks;
+	std::unique_ptr<boost::beast::http::response_serializer<boost::beast::http::string_body>> chunked_serializer;
 };
 }
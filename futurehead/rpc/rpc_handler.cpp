@@ -13,13 +13,16 @@ namespace
 {
 std::unordered_set<std::string> create_rpc_control_impls ();
 std::unordered_set<std::string> rpc_control_impl_set = create_rpc_control_impls ();
+bool requires_control (boost::property_tree::ptree const & request_a);
 std::string filter_request (boost::property_tree::ptree tree_a);
+void filter_secrets (boost::property_tree::ptree & tree_a);
 }
 
-futurehead::rpc_handler::rpc_handler (futurehead::rpc_config const & rpc_config, std::string const & body_a, std::string const & request_id_a, std::function<void(std::string const &)> const & response_a, futurehead::rpc_handler_interface & rpc_handler_interface_a, futurehead::logger_mt & logger) :
+futurehead::rpc_handler::rpc_handler (futurehead::rpc_config const & rpc_config, std::string const & body_a, std::string const & request_id_a, std::function<void(std::string const &)> const & response_a, futurehead::rpc_handler_interface & rpc_handler_interface_a, futurehead::logger_mt & logger, std::function<void(std::string const &)> const & response_chunk_a) :
 body (body_a),
 request_id (request_id_a),
 response (response_a),
+response_chunk (response_chunk_a),
 rpc_config (rpc_config),
 rpc_handler_interface (rpc_handler_interface_a),
 logger (logger)
@@ -72,39 +75,23 @@ void futurehead::rpc_handler::process_request (futurehead::rpc_handler_request_p
 				std::error_code rpc_control_disabled_ec = futurehead::error_rpc::rpc_control_disabled;
 
 				bool error = false;
-				auto found = rpc_control_impl_set.find (action);
-				if (found != rpc_control_impl_set.cend () && !rpc_config.enable_control)
+				if (!rpc_config.enable_control && requires_control (request))
 				{
 					json_error_response (response, rpc_control_disabled_ec.message ());
 					error = true;
 				}
-				else
+
+				if (!error)
 				{
-					// Special case with stats, type -> objects
-					if (action == "stats" && !rpc_config.enable_control)
+					if (response_chunk)
 					{
-						if (request.get<std::string> ("type") == "objects")
-						{
-							json_error_response (response, rpc_control_disabled_ec.message ());
-							error = true;
-						}
+						rpc_handler_interface.process_request_chunked (action, body, response_chunk, this->response);
 					}
-					else if (action == "process")
+					else
 					{
-						auto force = request.get_optional<bool> ("force").value_or (false);
-						auto watch_work = request.get_optional<bool> ("watch_work").value_or (true);
-						if ((force || watch_work) && !rpc_config.enable_control)
-						{
-							json_error_response (response, rpc_control_disabled_ec.message ());
-							error = true;
-						}
+						rpc_handler_interface.process_request (action, body, this->response);
 					}
 				}
-
-				if (!error)
-				{
-					rpc_handler_interface.process_request (action, body, this->response);
-				}
 			}
 			else if (request_params.rpc_version == 2)
 			{
@@ -178,7 +165,60 @@ std::unordered_set<std::string> create_rpc_control_impls ()
 	return set;
 }
 
+bool requires_control (boost::property_tree::ptree const & request_a)
+{
+	auto result (false);
+	auto action (request_a.get<std::string> ("action"));
+	if (rpc_control_impl_set.find (action) != rpc_control_impl_set.cend ())
+	{
+		result = true;
+	}
+	else if (action == "stats")
+	{
+		// Special case with stats, type -> objects
+		result = request_a.get<std::string> ("type") == "objects";
+	}
+	else if (action == "process")
+	{
+		auto force = request_a.get_optional<bool> ("force").value_or (false);
+		auto watch_work = request_a.get_optional<bool> ("watch_work").value_or (true);
+		result = force || watch_work;
+	}
+	else if (action == "batch")
+	{
+		// A batch requires control if any of its requests do
+		for (auto const & entry : request_a.get_child ("requests"))
+		{
+			result = result || requires_control (entry.second);
+		}
+	}
+	return result;
+}
+
 std::string filter_request (boost::property_tree::ptree tree_a)
+{
+	filter_secrets (tree_a);
+	auto requests (tree_a.get_child_optional ("requests"));
+	if (requests.is_initialized ())
+	{
+		for (auto & entry : *requests)
+		{
+			filter_secrets (entry.second);
+		}
+	}
+	std::string result;
+	std::stringstream stream;
+	boost::property_tree::write_json (stream, tree_a, false);
+	result = stream.str ();
+	// removing std::endl
+	if (result.length () > 1)
+	{
+		result.pop_back ();
+	}
+	return result;
+}
+
+void filter_secrets (boost::property_tree::ptree & tree_a)
 {
 	// Replace password
 	boost::optional<std::string> password_text (tree_a.get_optional<std::string> ("password"));
@@ -202,15 +242,5 @@ std::string filter_request (boost::property_tree::ptree tree_a)
 	{
 		tree_a.put ("seed", seed_text.get ().replace (seed_text.get ().begin () + 2, seed_text.get ().end (), seed_text.get ().length () - 2, 'X'));
 	}
-	std::string result;
-	std::stringstream stream;
-	boost::property_tree::write_json (stream, tree_a, false);
-	result = stream.str ();
-	// removing std::endl
-	if (result.length () > 1)
-	{
-		result.pop_back ();
-	}
-	return result;
 }
 }
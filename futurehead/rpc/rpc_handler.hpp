@@ -15,7 +15,8 @@ class rpc_handler_request_params;
 class rpc_handler : public std::enable_shared_from_this<futurehead::rpc_handler>
 {
 public:
-	rpc_handler (futurehead::rpc_config const & rpc_config, std::string const & body_a, std::string const & request_id_a, std::function<void(std::string const &)> const & response_a, futurehead::rpc_handler_interface & rpc_handler_interface_a, futurehead::logger_mt & logger);
+	/** If \p response_chunk_a is set, large RPC 1.0 responses are passed to it in parts as they are produced, before \p response_a completes them */
+	rpc_handler (futurehead::rpc_config const & rpc_config, std::string const & body_a, std::string const & request_id_a, std::function<void(std::string const &)> const & response_a, futurehead::rpc_handler_interface & rpc_handler_interface_a, futurehead::logger_mt & logger, std::function<void(std::string const &)> const & response_chunk_a = nullptr);
 	void process_request (futurehead::rpc_handler_request_params const & request_params);
 
 private:
@@ -23,6 +24,7 @@ private:
 	std::string request_id;
 	boost::property_tree::ptree request;
 	std::function<void(std::string const &)> response;
+	std::function<void(std::string const &)> response_chunk;
 	futurehead::rpc_config const & rpc_config;
 	futurehead::rpc_handler_interface & rpc_handler_interface;
 	futurehead::logger_mt & logger;
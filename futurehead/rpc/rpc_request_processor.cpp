@@ -55,6 +55,18 @@ void futurehead::rpc_request_processor::add (std::shared_ptr<rpc_request> reques
 }
 
 void futurehead::rpc_request_processor::read_payload (std::shared_ptr<futurehead::ipc_connection> connection, std::shared_ptr<std::vector<uint8_t>> res, std::shared_ptr<futurehead::rpc_request> rpc_request)
+{
+	if (rpc_request->response_chunk)
+	{
+		read_chunk (connection, res, rpc_request);
+	}
+	else
+	{
+		read_whole_payload (connection, res, rpc_request);
+	}
+}
+
+void futurehead::rpc_request_processor::read_whole_payload (std::shared_ptr<futurehead::ipc_connection> connection, std::shared_ptr<std::vector<uint8_t>> res, std::shared_ptr<futurehead::rpc_request> rpc_request)
 {
 	uint32_t payload_size_l = boost::endian::big_to_native (*reinterpret_cast<uint32_t *> (res->data ()));
 	res->resize (payload_size_l);
@@ -78,6 +90,65 @@ void futurehead::rpc_request_processor::read_payload (std::shared_ptr<futurehead
 	});
 }
 
+void futurehead::rpc_request_processor::read_chunk (std::shared_ptr<futurehead::ipc_connection> connection, std::shared_ptr<std::vector<uint8_t>> res, std::shared_ptr<futurehead::rpc_request> rpc_request)
+{
+	uint32_t chunk_size_l = boost::endian::big_to_native (*reinterpret_cast<uint32_t *> (res->data ()));
+	if (chunk_size_l == 0)
+	{
+		// An empty chunk ends the response, the last chunk read completes it
+		make_available (*connection);
+		rpc_request->response (rpc_request->pending_chunk);
+		if (rpc_request->action == "stop")
+		{
+			this->stop_callback ();
+		}
+	}
+	else
+	{
+		res->resize (chunk_size_l);
+		connection->client.async_read (res, chunk_size_l, [this, connection, res, rpc_request](futurehead::error err_read_a, size_t size_read_a) {
+			if (!err_read_a && size_read_a != 0)
+			{
+				if (!rpc_request->pending_chunk.empty ())
+				{
+					rpc_request->chunks_forwarded = true;
+					rpc_request->response_chunk (rpc_request->pending_chunk);
+				}
+				rpc_request->pending_chunk.assign (res->begin (), res->end ());
+				// Length of the next chunk
+				connection->client.async_read (res, sizeof (uint32_t), [this, connection, res, rpc_request](futurehead::error err_read_a, size_t size_read_a) {
+					if (!err_read_a && size_read_a != 0)
+					{
+						this->read_chunk (connection, res, rpc_request);
+					}
+					else
+					{
+						this->read_chunk_failed (connection, rpc_request);
+					}
+				});
+			}
+			else
+			{
+				this->read_chunk_failed (connection, rpc_request);
+			}
+		});
+	}
+}
+
+void futurehead::rpc_request_processor::read_chunk_failed (std::shared_ptr<futurehead::ipc_connection> connection, std::shared_ptr<futurehead::rpc_request> rpc_request)
+{
+	make_available (*connection);
+	if (rpc_request->chunks_forwarded)
+	{
+		// Appending an error to the JSON already sent would produce an invalid body, the client connection is dropped instead
+		rpc_request->response_chunk (std::string ());
+	}
+	else
+	{
+		json_error_response (rpc_request->response, "Failed to read payload");
+	}
+}
+
 void futurehead::rpc_request_processor::make_available (futurehead::ipc_connection & connection)
 {
 	futurehead::lock_guard<std::mutex> lk (connections_mutex);
@@ -146,7 +217,7 @@ void futurehead::rpc_request_processor::run ()
 				auto connection = *it;
 				connection->is_available = false; // Make sure no one else can take it
 				conditions_lk.unlock ();
-				auto encoding (rpc_request->rpc_api_version == 1 ? futurehead::ipc::payload_encoding::json_v1 : futurehead::ipc::payload_encoding::flatbuffers_json);
+				auto encoding (rpc_request->rpc_api_version == 1 ? (rpc_request->response_chunk ? futurehead::ipc::payload_encoding::json_v1_chunked : futurehead::ipc::payload_encoding::json_v1) : futurehead::ipc::payload_encoding::flatbuffers_json);
 				auto req (futurehead::ipc::prepare_request (encoding, rpc_request->body));
 				auto res (std::make_shared<std::vector<uint8_t>> ());
 
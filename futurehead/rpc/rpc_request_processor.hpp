@@ -41,6 +41,12 @@ struct rpc_request
 	std::string action;
 	std::string body;
 	std::function<void(std::string const &)> response;
+	/** If set, the response is requested with payload_encoding::json_v1_chunked and passed on in chunks as they are read */
+	std::function<void(std::string const &)> response_chunk;
+	/** Last chunk read, only passed on once the next one arrives so a response made of a single chunk is completed by response */
+	std::string pending_chunk;
+	/** Set once a chunk was passed to response_chunk */
+	bool chunks_forwarded{ false };
 };
 
 class rpc_request_processor
@@ -55,6 +61,9 @@ public:
 private:
 	void run ();
 	void read_payload (std::shared_ptr<futurehead::ipc_connection> connection, std::shared_ptr<std::vector<uint8_t>> res, std::shared_ptr<futurehead::rpc_request> rpc_request);
+	void read_whole_payload (std::shared_ptr<futurehead::ipc_connection> connection, std::shared_ptr<std::vector<uint8_t>> res, std::shared_ptr<futurehead::rpc_request> rpc_request);
+	void read_chunk (std::shared_ptr<futurehead::ipc_connection> connection, std::shared_ptr<std::vector<uint8_t>> res, std::shared_ptr<futurehead::rpc_request> rpc_request);
+	void read_chunk_failed (std::shared_ptr<futurehead::ipc_connection> connection, std::shared_ptr<futurehead::rpc_request> rpc_request);
 	void try_reconnect_and_execute_request (std::shared_ptr<futurehead::ipc_connection> connection, futurehead::shared_const_buffer const & req, std::shared_ptr<std::vector<uint8_t>> res, std::shared_ptr<futurehead::rpc_request> rpc_request);
 	void make_available (futurehead::ipc_connection & connection);
 
@@ -82,6 +91,13 @@ public:
 		rpc_request_processor.add (std::make_shared<futurehead::rpc_request> (action_a, body_a, response_a));
 	}
 
+	void process_request_chunked (std::string const & action_a, std::string const & body_a, std::function<void(std::string const &)> response_chunk_a, std::function<void(std::string const &)> response_a) override
+	{
+		auto request (std::make_shared<futurehead::rpc_request> (action_a, body_a, response_a));
+		request->response_chunk = response_chunk_a;
+		rpc_request_processor.add (request);
+	}
+
 	void process_request_v2 (rpc_handler_request_params const & params_a, std::string const & body_a, std::function<void(std::shared_ptr<std::string>)> response_a) override
 	{
 		std::string body_l = params_a.json_envelope (body_a);
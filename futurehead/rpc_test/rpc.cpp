@@ -16,6 +16,7 @@
 #include <boost/property_tree/json_parser.hpp>
 
 #include <algorithm>
+#include <set>
 
 using namespace std::chrono_literals;
 
@@ -177,6 +178,171 @@ TEST (rpc, wrapped_task)
 	ASSERT_TIMELY (5s, response == true);
 }
 
+TEST (rpc, response_chunked)
+{
+	futurehead::system system;
+	auto & node = *add_ipc_enabled_node (system);
+	futurehead::keypair key;
+	system.wallet (0)->insert_adhoc (futurehead::test_genesis_key.prv);
+	system.wallet (0)->insert_adhoc (key.prv);
+	ASSERT_NE (nullptr, system.wallet (0)->send_action (futurehead::test_genesis_key.pub, key.pub, node.config.receive_minimum.number ()));
+	// The destination is opened by the wallet, giving a second frontier
+	ASSERT_TIMELY (10s, !node.latest (key.pub).is_zero ());
+	futurehead::node_rpc_config node_rpc_config;
+	std::string body ("{\"action\": \"frontiers\", \"account\": \"" + futurehead::account (0).to_account () + "\", \"count\": \"100\"}");
+	std::atomic<bool> done (false);
+	std::string expected;
+	auto whole_l (std::make_shared<futurehead::json_handler> (node, node_rpc_config, body, [&done, &expected](std::string const & response_a) {
+		expected = response_a;
+		done = true;
+	}));
+	whole_l->process_request ();
+	ASSERT_TIMELY (5s, done);
+	done = false;
+	std::vector<std::string> chunks;
+	std::string response;
+	auto chunked_l (std::make_shared<futurehead::json_handler> (node, node_rpc_config, body, [&done, &response](std::string const & response_a) {
+		response = response_a;
+		done = true;
+	}));
+	chunked_l->response_chunk = [&chunks](std::string const & chunk_a) {
+		chunks.push_back (chunk_a);
+	};
+	chunked_l->response_chunk_size = 16;
+	chunked_l->process_request ();
+	ASSERT_TIMELY (5s, done);
+	ASSERT_LT (1, chunks.size ());
+	for (auto const & chunk : chunks)
+	{
+		ASSERT_LE (16, chunk.size ());
+	}
+	std::string joined;
+	for (auto const & chunk : chunks)
+	{
+		joined += chunk;
+	}
+	ASSERT_EQ (expected, joined + response);
+	std::stringstream istream (expected);
+	boost::property_tree::ptree json_l;
+	ASSERT_NO_THROW (boost::property_tree::read_json (istream, json_l));
+	ASSERT_EQ (2, json_l.get_child ("frontiers").size ());
+}
+
+TEST (rpc, response_unchunked_over_ipc)
+{
+	futurehead::system system;
+	auto node = add_ipc_enabled_node (system);
+	scoped_io_thread_name_change scoped_thread_name_io;
+	futurehead::node_rpc_config node_rpc_config;
+	futurehead::ipc::ipc_server ipc_server (*node, node_rpc_config);
+	futurehead::rpc_config rpc_config (futurehead::get_available_port (), true);
+	rpc_config.rpc_process.ipc_port = node->config.ipc_config.transport_tcp.port;
+	futurehead::ipc_rpc_processor ipc_rpc_processor (system.io_ctx, rpc_config);
+	futurehead::rpc rpc (system.io_ctx, rpc_config, ipc_rpc_processor);
+	rpc.start ();
+	boost::property_tree::ptree request;
+	request.put ("action", "frontiers");
+	request.put ("account", futurehead::account (0).to_account ());
+	request.put ("count", "100");
+	test_response response (request, rpc.config.port, system.io_ctx);
+	ASSERT_TIMELY (5s, response.status != 0);
+	ASSERT_EQ (200, response.status);
+	// A streamed response which fits in a single chunk is sent with a content length
+	ASSERT_FALSE (response.resp.chunked ());
+	ASSERT_EQ (1, response.json.get_child ("frontiers").size ());
+}
+
+TEST (rpc, batch)
+{
+	futurehead::system system;
+	auto & node = *add_ipc_enabled_node (system);
+	futurehead::node_rpc_config node_rpc_config;
+	std::atomic<bool> done (false);
+	boost::property_tree::ptree response;
+	auto process ([&node, &node_rpc_config, &done, &response](boost::property_tree::ptree const & request_a) {
+		done = false;
+		std::stringstream ostream;
+		boost::property_tree::write_json (ostream, request_a);
+		auto handler (std::make_shared<futurehead::json_handler> (node, node_rpc_config, ostream.str (), [&done, &response](std::string const & response_a) {
+			std::stringstream istream (response_a);
+			boost::property_tree::read_json (istream, response);
+			done = true;
+		}));
+		handler->process_request ();
+	});
+	boost::property_tree::ptree requests;
+	boost::property_tree::ptree balance;
+	balance.put ("action", "account_balance");
+	balance.put ("account", futurehead::test_genesis_key.pub.to_account ());
+	requests.push_back (std::make_pair ("", balance));
+	boost::property_tree::ptree count;
+	count.put ("action", "block_count");
+	requests.push_back (std::make_pair ("", count));
+	boost::property_tree::ptree request;
+	request.put ("action", "batch");
+	request.add_child ("requests", requests);
+	process (request);
+	ASSERT_TIMELY (5s, done);
+	{
+		auto & responses (response.get_child ("responses"));
+		ASSERT_EQ (2, responses.size ());
+		auto i (responses.begin ());
+		ASSERT_EQ (futurehead::genesis_amount.convert_to<std::string> (), i->second.get<std::string> ("balance"));
+		++i;
+		ASSERT_EQ ("1", i->second.get<std::string> ("count"));
+	}
+	// Errors are returned in place of the failed request
+	boost::property_tree::ptree unknown;
+	unknown.put ("action", "unknown_action");
+	requests.push_back (std::make_pair ("", unknown));
+	requests.push_back (std::make_pair ("", request));
+	request.put_child ("requests", requests);
+	process (request);
+	ASSERT_TIMELY (5s, done);
+	{
+		auto & responses (response.get_child ("responses"));
+		ASSERT_EQ (4, responses.size ());
+		auto i (responses.begin ());
+		ASSERT_EQ (futurehead::genesis_amount.convert_to<std::string> (), i->second.get<std::string> ("balance"));
+		++i;
+		ASSERT_EQ ("1", i->second.get<std::string> ("count"));
+		++i;
+		ASSERT_EQ ("Unknown command", i->second.get<std::string> ("error"));
+		++i;
+		ASSERT_EQ (std::error_code (futurehead::error_rpc::batch_nested).message (), i->second.get<std::string> ("error"));
+	}
+}
+
+TEST (rpc, batch_control)
+{
+	futurehead::system system;
+	auto node = add_ipc_enabled_node (system);
+	scoped_io_thread_name_change scoped_thread_name_io;
+	futurehead::node_rpc_config node_rpc_config;
+	futurehead::ipc::ipc_server ipc_server (*node, node_rpc_config);
+	futurehead::rpc_config rpc_config (futurehead::get_available_port (), false);
+	rpc_config.rpc_process.ipc_port = node->config.ipc_config.transport_tcp.port;
+	futurehead::ipc_rpc_processor ipc_rpc_processor (system.io_ctx, rpc_config);
+	futurehead::rpc rpc (system.io_ctx, rpc_config, ipc_rpc_processor);
+	rpc.start ();
+	boost::property_tree::ptree requests;
+	boost::property_tree::ptree count;
+	count.put ("action", "block_count");
+	requests.push_back (std::make_pair ("", count));
+	boost::property_tree::ptree create;
+	create.put ("action", "account_create");
+	create.put ("wallet", node->wallets.items.begin ()->first.to_string ());
+	requests.push_back (std::make_pair ("", create));
+	boost::property_tree::ptree request;
+	request.put ("action", "batch");
+	request.add_child ("requests", requests);
+	test_response response (request, rpc.config.port, system.io_ctx);
+	ASSERT_TIMELY (5s, response.status != 0);
+	ASSERT_EQ (200, response.status);
+	std::error_code ec (futurehead::error_rpc::rpc_control_disabled);
+	ASSERT_EQ (ec.message (), response.json.get<std::string> ("error"));
+}
+
 TEST (rpc, account_balance)
 {
 	futurehead::system system;
@@ -5431,6 +5597,70 @@ TEST (rpc, delegators_count)
 	ASSERT_EQ ("2", count);
 }
 
+TEST (rpc, delegators_paging)
+{
+	futurehead::system system;
+	auto & node1 = *add_ipc_enabled_node (system);
+	futurehead::keypair key;
+	system.wallet (0)->insert_adhoc (futurehead::test_genesis_key.prv);
+	system.wallet (0)->insert_adhoc (key.prv);
+	auto latest (node1.latest (futurehead::test_genesis_key.pub));
+	futurehead::send_block send (latest, key.pub, 100, futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub, *node1.work_generate_blocking (latest));
+	node1.process (send);
+	futurehead::open_block open (send.hash (), futurehead::test_genesis_key.pub, key.pub, key.prv, key.pub, *node1.work_generate_blocking (key.pub));
+	ASSERT_EQ (futurehead::process_result::progress, node1.process (open).code);
+	scoped_io_thread_name_change scoped_thread_name_io;
+	futurehead::node_rpc_config node_rpc_config;
+	futurehead::ipc::ipc_server ipc_server (node1, node_rpc_config);
+	futurehead::rpc_config rpc_config (futurehead::get_available_port (), true);
+	rpc_config.rpc_process.ipc_port = node1.config.ipc_config.transport_tcp.port;
+	futurehead::ipc_rpc_processor ipc_rpc_processor (system.io_ctx, rpc_config);
+	futurehead::rpc rpc (system.io_ctx, rpc_config, ipc_rpc_processor);
+	rpc.start ();
+	auto first (std::min (futurehead::test_genesis_key.pub, key.pub));
+	auto second (std::max (futurehead::test_genesis_key.pub, key.pub));
+	boost::property_tree::ptree request;
+	request.put ("action", "delegators");
+	request.put ("account", futurehead::test_genesis_key.pub.to_account ());
+	request.put ("count", 1);
+	{
+		test_response response (request, rpc.config.port, system.io_ctx);
+		system.deadline_set (5s);
+		while (response.status == 0)
+		{
+			ASSERT_NO_ERROR (system.poll ());
+		}
+		ASSERT_EQ (200, response.status);
+		auto & delegators_node (response.json.get_child ("delegators"));
+		ASSERT_EQ (1, delegators_node.size ());
+		ASSERT_EQ (first.to_account (), delegators_node.begin ()->first);
+	}
+	request.put ("start", first.to_account ());
+	{
+		test_response response (request, rpc.config.port, system.io_ctx);
+		system.deadline_set (5s);
+		while (response.status == 0)
+		{
+			ASSERT_NO_ERROR (system.poll ());
+		}
+		ASSERT_EQ (200, response.status);
+		auto & delegators_node (response.json.get_child ("delegators"));
+		ASSERT_EQ (1, delegators_node.size ());
+		ASSERT_EQ (second.to_account (), delegators_node.begin ()->first);
+	}
+	request.put ("start", second.to_account ());
+	{
+		test_response response (request, rpc.config.port, system.io_ctx);
+		system.deadline_set (5s);
+		while (response.status == 0)
+		{
+			ASSERT_NO_ERROR (system.poll ());
+		}
+		ASSERT_EQ (200, response.status);
+		ASSERT_EQ (0, response.json.get_child ("delegators").size ());
+	}
+}
+
 TEST (rpc, account_info)
 {
 	futurehead::system system;
@@ -5992,6 +6222,71 @@ TEST (rpc, ledger)
 	}
 }
 
+TEST (rpc, ledger_cursor)
+{
+	futurehead::system system;
+	auto & node = *add_ipc_enabled_node (system);
+	auto latest (node.latest (futurehead::test_genesis_key.pub));
+	futurehead::uint128_t balance (futurehead::genesis_amount);
+	// Sorted by balance, the genesis account first and then the largest sends
+	std::vector<futurehead::account> expected{ futurehead::test_genesis_key.pub };
+	for (auto i (1); i <= 5; ++i)
+	{
+		futurehead::keypair key;
+		balance -= i * 100;
+		futurehead::send_block send (latest, key.pub, balance, futurehead::test_genesis_key.prv, futurehead::test_genesis_key.pub, *node.work_generate_blocking (latest));
+		ASSERT_EQ (futurehead::process_result::progress, node.process (send).code);
+		futurehead::open_block open (send.hash (), futurehead::test_genesis_key.pub, key.pub, key.prv, key.pub, *node.work_generate_blocking (key.pub));
+		ASSERT_EQ (futurehead::process_result::progress, node.process (open).code);
+		latest = send.hash ();
+		expected.insert (expected.begin () + 1, key.pub);
+	}
+	futurehead::node_rpc_config node_rpc_config;
+	auto process ([&node, &node_rpc_config](boost::property_tree::ptree const & request_a) {
+		std::stringstream ostream;
+		boost::property_tree::write_json (ostream, request_a);
+		boost::property_tree::ptree response;
+		auto handler (std::make_shared<futurehead::json_handler> (node, node_rpc_config, ostream.str (), [&response](std::string const & response_a) {
+			std::stringstream istream (response_a);
+			boost::property_tree::read_json (istream, response);
+		}));
+		handler->process_request ();
+		return response;
+	});
+	// Walks every page, returning the accounts in order
+	auto walk ([&process](boost::property_tree::ptree request_a) {
+		std::vector<futurehead::account> result;
+		for (auto page (0); page < 10; ++page)
+		{
+			auto response (process (request_a));
+			for (auto & account : response.get_child ("accounts"))
+			{
+				futurehead::account account_l;
+				EXPECT_FALSE (account_l.decode_account (account.first));
+				result.push_back (account_l);
+			}
+			auto cursor (response.get_optional<std::string> ("cursor"));
+			if (!cursor.is_initialized ())
+			{
+				break;
+			}
+			request_a.put ("cursor", *cursor);
+		}
+		return result;
+	});
+	boost::property_tree::ptree request;
+	request.put ("action", "ledger");
+	request.put ("count", "2");
+	auto unsorted (walk (request));
+	ASSERT_EQ (expected.size (), unsorted.size ());
+	ASSERT_TRUE (std::is_sorted (unsorted.begin (), unsorted.end ()));
+	ASSERT_EQ (std::set<futurehead::account> (expected.begin (), expected.end ()), std::set<futurehead::account> (unsorted.begin (), unsorted.end ()));
+	request.put ("sorting", "true");
+	ASSERT_EQ (expected, walk (request));
+	request.put ("cursor", futurehead::account (0).to_string ());
+	ASSERT_EQ (std::error_code (futurehead::error_rpc::invalid_cursor).message (), process (request).get<std::string> ("error"));
+}
+
 TEST (rpc, accounts_create)
 {
 	futurehead::system system;
@@ -7228,6 +7523,44 @@ TEST (rpc, unchecked)
 	}
 }
 
+TEST (rpc, unchecked_duplicate)
+{
+	futurehead::system system;
+	auto & node = *add_ipc_enabled_node (system);
+	futurehead::keypair key;
+	futurehead::node_rpc_config node_rpc_config;
+	futurehead::ipc::ipc_server ipc_server (node, node_rpc_config);
+	futurehead::rpc_config rpc_config (futurehead::get_available_port (), true);
+	rpc_config.rpc_process.ipc_port = node.config.ipc_config.transport_tcp.port;
+	futurehead::ipc_rpc_processor ipc_rpc_processor (system.io_ctx, rpc_config);
+	futurehead::rpc rpc (system.io_ctx, rpc_config, ipc_rpc_processor);
+	rpc.start ();
+	auto open (std::make_shared<futurehead::state_block> (key.pub, 0, key.pub, 1, key.pub, key.prv, key.pub, *system.work.generate (key.pub)));
+	auto open2 (std::make_shared<futurehead::state_block> (key.pub, 0, key.pub, 2, key.pub, key.prv, key.pub, *system.work.generate (key.pub)));
+	{
+		// The first block waits for two dependencies
+		auto transaction (node.store.tx_begin_write ());
+		node.store.unchecked_put (transaction, futurehead::block_hash (1), open);
+		node.store.unchecked_put (transaction, futurehead::block_hash (2), open);
+		node.store.unchecked_put (transaction, futurehead::block_hash (3), open2);
+	}
+	boost::property_tree::ptree request;
+	request.put ("action", "unchecked");
+	request.put ("count", 2);
+	test_response response (request, rpc.config.port, system.io_ctx);
+	system.deadline_set (5s);
+	while (response.status == 0)
+	{
+		ASSERT_NO_ERROR (system.poll ());
+	}
+	ASSERT_EQ (200, response.status);
+	// Each block is listed once and counted once
+	auto & blocks (response.json.get_child ("blocks"));
+	ASSERT_EQ (2, blocks.size ());
+	ASSERT_EQ (1, blocks.count (open->hash ().to_string ()));
+	ASSERT_EQ (1, blocks.count (open2->hash ().to_string ()));
+}
+
 TEST (rpc, unchecked_get)
 {
 	futurehead::system system;
@@ -7473,6 +7806,70 @@ TEST (rpc, unopened_no_accounts)
 	ASSERT_EQ (0, accounts.size ());
 }
 
+TEST (rpc, unopened_cursor)
+{
+	futurehead::system system;
+	auto & node = *add_ipc_enabled_node (system);
+	system.wallet (0)->insert_adhoc (futurehead::test_genesis_key.prv);
+	futurehead::account account1 (1), account2 (account1.number () + 1);
+	ASSERT_NE (nullptr, system.wallet (0)->send_action (futurehead::test_genesis_key.pub, account1, 1));
+	ASSERT_NE (nullptr, system.wallet (0)->send_action (futurehead::test_genesis_key.pub, account1, 2));
+	ASSERT_NE (nullptr, system.wallet (0)->send_action (futurehead::test_genesis_key.pub, account2, 10));
+	futurehead::node_rpc_config node_rpc_config;
+	auto process ([&node, &node_rpc_config](boost::property_tree::ptree const & request_a) {
+		std::stringstream ostream;
+		boost::property_tree::write_json (ostream, request_a);
+		boost::property_tree::ptree response;
+		auto handler (std::make_shared<futurehead::json_handler> (node, node_rpc_config, ostream.str (), [&response](std::string const & response_a) {
+			std::stringstream istream (response_a);
+			boost::property_tree::read_json (istream, response);
+		}));
+		handler->process_request ();
+		return response;
+	});
+	boost::property_tree::ptree request;
+	request.put ("action", "unopened");
+	request.put ("count", "1");
+	// The page fills up while the pending entries of the last account are summed
+	auto response1 (process (request));
+	ASSERT_EQ (1, response1.get_child ("accounts").size ());
+	ASSERT_EQ ("3", response1.get_child ("accounts").get<std::string> (account1.to_account ()));
+	auto cursor (response1.get_optional<std::string> ("cursor"));
+	ASSERT_TRUE (cursor.is_initialized ());
+	request.put ("cursor", *cursor);
+	auto response2 (process (request));
+	ASSERT_EQ (1, response2.get_child ("accounts").size ());
+	ASSERT_EQ ("10", response2.get_child ("accounts").get<std::string> (account2.to_account ()));
+	ASSERT_FALSE (response2.get_optional<std::string> ("cursor").is_initialized ());
+}
+
+TEST (rpc, unopened_cursor_last)
+{
+	futurehead::system system;
+	auto & node = *add_ipc_enabled_node (system);
+	system.wallet (0)->insert_adhoc (futurehead::test_genesis_key.prv);
+	futurehead::account account1 (1), account2 (account1.number () + 1);
+	ASSERT_NE (nullptr, system.wallet (0)->send_action (futurehead::test_genesis_key.pub, account1, 1));
+	ASSERT_NE (nullptr, system.wallet (0)->send_action (futurehead::test_genesis_key.pub, account2, 10));
+	futurehead::node_rpc_config node_rpc_config;
+	boost::property_tree::ptree request;
+	request.put ("action", "unopened");
+	request.put ("count", "2");
+	std::stringstream ostream;
+	boost::property_tree::write_json (ostream, request);
+	boost::property_tree::ptree response;
+	auto handler (std::make_shared<futurehead::json_handler> (node, node_rpc_config, ostream.str (), [&response](std::string const & response_a) {
+		std::stringstream istream (response_a);
+		boost::property_tree::read_json (istream, response);
+	}));
+	handler->process_request ();
+	// The last account fills the page once the iterator reached the end, there is no further page
+	ASSERT_EQ (2, response.get_child ("accounts").size ());
+	ASSERT_EQ ("1", response.get_child ("accounts").get<std::string> (account1.to_account ()));
+	ASSERT_EQ ("10", response.get_child ("accounts").get<std::string> (account2.to_account ()));
+	ASSERT_FALSE (response.get_optional<std::string> ("cursor").is_initialized ());
+}
+
 TEST (rpc, uptime)
 {
 	futurehead::system system;
@@ -85,6 +85,12 @@ public:
 		static_assert (std::is_standard_layout<futurehead::pending_key>::value, "Standard layout is required");
 	}
 
+	db_val (futurehead::delegator_key const & val_a) :
+	db_val (sizeof (val_a), const_cast<futurehead::delegator_key *> (&val_a))
+	{
+		static_assert (std::is_standard_layout<futurehead::delegator_key>::value, "Standard layout is required");
+	}
+
 	db_val (futurehead::unchecked_info const & val_a) :
 	buffer (std::make_shared<std::vector<uint8_t>> ())
 	{
@@ -111,6 +117,16 @@ public:
 		convert_buffer_to_value ();
 	}
 
+	db_val (futurehead::pending_totals const & val_a) :
+	buffer (std::make_shared<std::vector<uint8_t>> ())
+	{
+		{
+			futurehead::vectorstream stream (*buffer);
+			val_a.serialize (stream);
+		}
+		convert_buffer_to_value ();
+	}
+
 	db_val (futurehead::block_info const & val_a) :
 	db_val (sizeof (val_a), const_cast<futurehead::block_info *> (&val_a))
 	{
@@ -202,6 +218,15 @@ public:
 		return result;
 	}
 
+	explicit operator futurehead::delegator_key () const
+	{
+		futurehead::delegator_key result;
+		debug_assert (size () == sizeof (result));
+		static_assert (sizeof (futurehead::delegator_key::representative) + sizeof (futurehead::delegator_key::account) == sizeof (result), "Packed class");
+		std::copy (reinterpret_cast<uint8_t const *> (data ()), reinterpret_cast<uint8_t const *> (data ()) + sizeof (result), reinterpret_cast<uint8_t *> (&result));
+		return result;
+	}
+
 	explicit operator futurehead::confirmation_height_info () const
 	{
 		futurehead::bufferstream stream (reinterpret_cast<uint8_t const *> (data ()), size ());
@@ -212,6 +237,16 @@ public:
 		return result;
 	}
 
+	explicit operator futurehead::pending_totals () const
+	{
+		futurehead::bufferstream stream (reinterpret_cast<uint8_t const *> (data ()), size ());
+		futurehead::pending_totals result;
+		bool error (result.deserialize (stream));
+		(void)error;
+		debug_assert (!error);
+		return result;
+	}
+
 	explicit operator futurehead::unchecked_info () const
 	{
 		futurehead::bufferstream stream (reinterpret_cast<uint8_t const *> (data ()), size ());
@@ -402,6 +437,7 @@ private:
 
 class transaction;
 class block_store;
+class store_cache;
 
 /**
  * Summation visitor for blocks, supporting amount and balance computations. These
@@ -576,12 +612,15 @@ enum class tables
 	cached_counts, // RocksDB only
 	change_blocks,
 	confirmation_height,
+	delegators,
 	frontiers,
 	meta,
 	online_weight,
 	open_blocks,
 	peers,
 	pending,
+	pending_totals,
+	pruned,
 	receive_blocks,
 	representation,
 	send_blocks,
@@ -664,6 +703,10 @@ public:
 	virtual ~block_store () = default;
 	virtual void initialize (futurehead::write_transaction const &, futurehead::genesis const &, futurehead::ledger_cache &) = 0;
 	virtual void block_put (futurehead::write_transaction const &, futurehead::block_hash const &, futurehead::block const &) = 0;
+	/** Stores a block with a complete sideband as is, without updating its predecessor. Used when importing whole chains */
+	virtual void block_import (futurehead::write_transaction const &, futurehead::block const &) = 0;
+	/** Shares an already stored block, including its sideband, with later readers instead of deserializing it again */
+	virtual void block_cache_put (futurehead::write_transaction const &, std::shared_ptr<futurehead::block> const &) = 0;
 	virtual futurehead::block_hash block_successor (futurehead::transaction const &, futurehead::block_hash const &) const = 0;
 	virtual void block_successor_clear (futurehead::write_transaction const &, futurehead::block_hash const &) = 0;
 	virtual std::shared_ptr<futurehead::block> block_get (futurehead::transaction const &, futurehead::block_hash const &) const = 0;
@@ -702,6 +745,10 @@ public:
 	virtual futurehead::store_iterator<futurehead::pending_key, futurehead::pending_info> pending_begin (futurehead::transaction const &, futurehead::pending_key const &) = 0;
 	virtual futurehead::store_iterator<futurehead::pending_key, futurehead::pending_info> pending_begin (futurehead::transaction const &) = 0;
 	virtual futurehead::store_iterator<futurehead::pending_key, futurehead::pending_info> pending_end () = 0;
+	virtual bool pending_totals_get (futurehead::transaction const &, futurehead::account const &, futurehead::pending_totals &) = 0;
+	virtual futurehead::store_iterator<futurehead::account, futurehead::pending_totals> pending_totals_begin (futurehead::transaction const &, futurehead::account const &) = 0;
+	virtual futurehead::store_iterator<futurehead::account, futurehead::pending_totals> pending_totals_begin (futurehead::transaction const &) = 0;
+	virtual futurehead::store_iterator<futurehead::account, futurehead::pending_totals> pending_totals_end () = 0;
 
 	virtual bool block_info_get (futurehead::transaction const &, futurehead::block_hash const &, futurehead::block_info &) const = 0;
 	virtual futurehead::uint128_t block_balance (futurehead::transaction const &, futurehead::block_hash const &) = 0;
@@ -750,6 +797,21 @@ public:
 	virtual futurehead::store_iterator<futurehead::endpoint_key, futurehead::no_value> peers_begin (futurehead::transaction const & transaction_a) const = 0;
 	virtual futurehead::store_iterator<futurehead::endpoint_key, futurehead::no_value> peers_end () const = 0;
 
+	virtual void pruned_put (futurehead::write_transaction const & transaction_a, futurehead::block_hash const & hash_a) = 0;
+	virtual void pruned_del (futurehead::write_transaction const & transaction_a, futurehead::block_hash const & hash_a) = 0;
+	virtual bool pruned_exists (futurehead::transaction const & transaction_a, futurehead::block_hash const & hash_a) const = 0;
+	virtual size_t pruned_count (futurehead::transaction const & transaction_a) const = 0;
+	virtual void pruned_clear (futurehead::write_transaction const & transaction_a) = 0;
+	virtual futurehead::store_iterator<futurehead::block_hash, futurehead::no_value> pruned_begin (futurehead::transaction const & transaction_a) const = 0;
+	virtual futurehead::store_iterator<futurehead::block_hash, futurehead::no_value> pruned_end () const = 0;
+
+	virtual void delegator_put (futurehead::write_transaction const & transaction_a, futurehead::account const & representative_a, futurehead::account const & account_a) = 0;
+	virtual void delegator_del (futurehead::write_transaction const & transaction_a, futurehead::account const & representative_a, futurehead::account const & account_a) = 0;
+	virtual bool delegator_exists (futurehead::transaction const & transaction_a, futurehead::account const & representative_a, futurehead::account const & account_a) const = 0;
+	virtual void delegators_clear (futurehead::write_transaction const & transaction_a) = 0;
+	virtual futurehead::store_iterator<futurehead::delegator_key, futurehead::no_value> delegators_begin (futurehead::transaction const & transaction_a, futurehead::account const & representative_a, futurehead::account const & start_a = futurehead::account (0)) const = 0;
+	virtual futurehead::store_iterator<futurehead::delegator_key, futurehead::no_value> delegators_end () const = 0;
+
 	virtual void confirmation_height_put (futurehead::write_transaction const & transaction_a, futurehead::account const & account_a, futurehead::confirmation_height_info const & confirmation_height_info_a) = 0;
 	virtual bool confirmation_height_get (futurehead::transaction const & transaction_a, futurehead::account const & account_a, futurehead::confirmation_height_info & confirmation_height_info_a) = 0;
 	virtual bool confirmation_height_exists (futurehead::transaction const & transaction_a, futurehead::account const & account_a) const = 0;
@@ -761,9 +823,12 @@ public:
 
 	virtual uint64_t block_account_height (futurehead::transaction const & transaction_a, futurehead::block_hash const & hash_a) const = 0;
 	virtual std::mutex & get_cache_mutex () = 0;
+	virtual futurehead::store_cache & get_store_cache () = 0;
 
 	virtual bool copy_db (boost::filesystem::path const & destination) = 0;
 	virtual void rebuild_db (futurehead::write_transaction const & transaction_a) = 0;
+	/** Starts compacting the database in the background while it stays in use, returns true if this is not supported or a compaction was already started */
+	virtual bool compact_online () = 0;
 
 	/** Not applicable to all sub-classes */
 	virtual void serialize_mdb_tracker (boost::property_tree::ptree &, std::chrono::milliseconds, std::chrono::milliseconds) = 0;
@@ -779,7 +844,7 @@ public:
 	virtual std::string vendor_get () const = 0;
 };
 
-std::unique_ptr<futurehead::block_store> make_store (futurehead::logger_mt & logger, boost::filesystem::path const & path, bool open_read_only = false, bool add_db_postfix = false, futurehead::rocksdb_config const & rocksdb_config = futurehead::rocksdb_config{}, futurehead::txn_tracking_config const & txn_tracking_config_a = futurehead::txn_tracking_config{}, std::chrono::milliseconds block_processor_batch_max_time_a = std::chrono::milliseconds (5000), futurehead::lmdb_config const & lmdb_config_a = futurehead::lmdb_config{}, size_t batch_size = 512, bool backup_before_upgrade = false, bool rocksdb_backend = false);
+std::unique_ptr<futurehead::block_store> make_store (futurehead::logger_mt & logger, boost::filesystem::path const & path, bool open_read_only = false, bool add_db_postfix = false, futurehead::rocksdb_config const & rocksdb_config = futurehead::rocksdb_config{}, futurehead::txn_tracking_config const & txn_tracking_config_a = futurehead::txn_tracking_config{}, std::chrono::milliseconds block_processor_batch_max_time_a = std::chrono::milliseconds (5000), futurehead::lmdb_config const & lmdb_config_a = futurehead::lmdb_config{}, size_t batch_size = 512, bool backup_before_upgrade = false, bool rocksdb_backend = false, size_t account_cache_size = 64 * 1024, size_t block_cache_size = 16 * 1024);
 }
 
 namespace std
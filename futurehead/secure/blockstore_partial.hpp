@@ -3,6 +3,7 @@
 #include <futurehead/lib/rep_weights.hpp>
 #include <futurehead/secure/blockstore.hpp>
 #include <futurehead/secure/buffer.hpp>
+#include <futurehead/secure/store_cache.hpp>
 
 #include <crypto/cryptopp/words.h>
 
@@ -23,6 +24,11 @@ public:
 
 	std::mutex cache_mutex;
 
+	explicit block_store_partial (size_t account_cache_size_a = 0, size_t block_cache_size_a = 0) :
+	cache (account_cache_size_a, block_cache_size_a)
+	{
+	}
+
 	/**
 	 * If using a different store version than the latest then you may need
 	 * to modify some of the objects in the store to be appropriate for the version before an upgrade.
@@ -38,6 +44,7 @@ public:
 		++ledger_cache_a.cemented_count;
 		//TO-CHANGE FIRST BLOCK AMOUNT DIVIDE 3.4 BILLION BY THE AMOUNT YOU NEED
 		account_put (transaction_a, network_params.ledger.genesis_account, { hash_l, network_params.ledger.genesis_account, genesis_a.open->hash (), std::numeric_limits<futurehead::uint128_t>::max (), futurehead::seconds_since_epoch (), 1, futurehead::epoch::epoch_0 });
+		delegator_put (transaction_a, network_params.ledger.genesis_account, network_params.ledger.genesis_account);
 		++ledger_cache_a.account_count;
 		ledger_cache_a.rep_weights.representation_put (network_params.ledger.genesis_account, std::numeric_limits<futurehead::uint128_t>::max ());
 		frontier_put (transaction_a, hash_l, network_params.ledger.genesis_account);
@@ -53,6 +60,11 @@ public:
 
 	bool account_exists (futurehead::transaction const & transaction_a, futurehead::account const & account_a) override
 	{
+		boost::optional<futurehead::account_info> cached;
+		if (cache.get (cache.accounts, transaction_a.get_handle (), account_a, cached))
+		{
+			return cached.is_initialized ();
+		}
 		auto iterator (latest_begin (transaction_a, account_a));
 		return iterator != latest_end () && futurehead::account (iterator->first) == account_a;
 	}
@@ -119,6 +131,24 @@ public:
 		debug_assert (block_a.previous ().is_zero () || block_successor (transaction_a, block_a.previous ()) == hash_a);
 	}
 
+	void block_import (futurehead::write_transaction const & transaction_a, futurehead::block const & block_a) override
+	{
+		debug_assert (block_a.has_sideband ());
+		std::vector<uint8_t> vector;
+		{
+			futurehead::vectorstream stream (vector);
+			block_a.serialize (stream);
+			block_a.sideband ().serialize (stream, block_a.type ());
+		}
+		block_raw_put (transaction_a, vector, block_a.type (), block_a.hash ());
+	}
+
+	void block_cache_put (futurehead::write_transaction const & transaction_a, std::shared_ptr<futurehead::block> const & block_a) override
+	{
+		debug_assert (block_a->has_sideband ());
+		cache.put (cache.blocks, transaction_a.get_handle (), block_a->hash (), boost::optional<std::shared_ptr<futurehead::block>> (block_a));
+	}
+
 	// Converts a block hash to a block height
 	uint64_t block_account_height (futurehead::transaction const & transaction_a, futurehead::block_hash const & hash_a) const override
 	{
@@ -129,6 +159,11 @@ public:
 
 	std::shared_ptr<futurehead::block> block_get (futurehead::transaction const & transaction_a, futurehead::block_hash const & hash_a) const override
 	{
+		boost::optional<std::shared_ptr<futurehead::block>> cached;
+		if (cache.get (cache.blocks, transaction_a.get_handle (), hash_a, cached))
+		{
+			return cached.value_or (nullptr);
+		}
 		futurehead::block_type type;
 		auto value (block_raw_get (transaction_a, hash_a, type));
 		std::shared_ptr<futurehead::block> result;
@@ -143,6 +178,8 @@ public:
 				auto error (sideband.deserialize (stream, type));
 				(void)error;
 				debug_assert (!error);
+				result->sideband_set (sideband);
+				cache.fill (cache.blocks, transaction_a.get_handle (), hash_a, result);
 			}
 			else
 			{
@@ -152,8 +189,8 @@ public:
 				sideband.successor = block_successor (transaction_a, hash_a);
 				sideband.height = 0;
 				sideband.timestamp = 0;
+				result->sideband_set (sideband);
 			}
-			result->sideband_set (sideband);
 		}
 		return result;
 	}
@@ -359,6 +396,21 @@ public:
 		return futurehead::store_iterator<futurehead::endpoint_key, futurehead::no_value> (nullptr);
 	}
 
+	futurehead::store_iterator<futurehead::block_hash, futurehead::no_value> pruned_end () const override
+	{
+		return futurehead::store_iterator<futurehead::block_hash, futurehead::no_value> (nullptr);
+	}
+
+	futurehead::store_iterator<futurehead::delegator_key, futurehead::no_value> delegators_end () const override
+	{
+		return futurehead::store_iterator<futurehead::delegator_key, futurehead::no_value> (nullptr);
+	}
+
+	futurehead::store_iterator<futurehead::account, futurehead::pending_totals> pending_totals_end () override
+	{
+		return futurehead::store_iterator<futurehead::account, futurehead::pending_totals> (nullptr);
+	}
+
 	futurehead::store_iterator<futurehead::pending_key, futurehead::pending_info> pending_end () override
 	{
 		return futurehead::store_iterator<futurehead::pending_key, futurehead::pending_info> (nullptr);
@@ -384,6 +436,11 @@ public:
 		return cache_mutex;
 	}
 
+	futurehead::store_cache & get_store_cache () override
+	{
+		return cache;
+	}
+
 	void block_del (futurehead::write_transaction const & transaction_a, futurehead::block_hash const & hash_a, futurehead::block_type block_type_a) override
 	{
 		auto table = tables::state_blocks;
@@ -410,6 +467,7 @@ public:
 
 		auto status = del (transaction_a, table, hash_a);
 		release_assert (success (status));
+		cache.invalidate (cache.blocks, transaction_a.get_handle (), hash_a);
 	}
 
 	int version_get (futurehead::transaction const & transaction_a) const override
@@ -445,19 +503,57 @@ public:
 		futurehead::db_val<Val> value{ data.size (), (void *)data.data () };
 		auto status = put (transaction_a, database_a, hash_a, value);
 		release_assert (success (status));
+		// Also covers successor updates of existing blocks
+		cache.invalidate (cache.blocks, transaction_a.get_handle (), hash_a);
 	}
 
 	void pending_put (futurehead::write_transaction const & transaction_a, futurehead::pending_key const & key_a, futurehead::pending_info const & pending_info_a) override
 	{
+		futurehead::pending_totals totals;
+		pending_totals_get (transaction_a, key_a.account, totals);
+		futurehead::pending_info existing;
+		if (!pending_get (transaction_a, key_a, existing))
+		{
+			totals.amount = totals.amount.number () - existing.amount.number ();
+		}
+		else
+		{
+			++totals.count;
+		}
+		totals.amount = totals.amount.number () + pending_info_a.amount.number ();
 		futurehead::db_val<Val> pending (pending_info_a);
 		auto status = put (transaction_a, tables::pending, key_a, pending);
 		release_assert (success (status));
+		pending_totals_put (transaction_a, key_a.account, totals);
 	}
 
 	void pending_del (futurehead::write_transaction const & transaction_a, futurehead::pending_key const & key_a) override
 	{
+		futurehead::pending_info existing;
+		auto error (pending_get (transaction_a, key_a, existing));
+		release_assert (!error);
+		futurehead::pending_totals totals;
+		error = pending_totals_get (transaction_a, key_a.account, totals);
+		release_assert (!error && totals.count > 0);
+		--totals.count;
+		totals.amount = totals.amount.number () - existing.amount.number ();
 		auto status = del (transaction_a, tables::pending, key_a);
 		release_assert (success (status));
+		pending_totals_put (transaction_a, key_a.account, totals);
+	}
+
+	bool pending_totals_get (futurehead::transaction const & transaction_a, futurehead::account const & account_a, futurehead::pending_totals & totals_a) override
+	{
+		futurehead::db_val<Val> value;
+		auto status (get (transaction_a, tables::pending_totals, futurehead::db_val<Val> (account_a), value));
+		release_assert (success (status) || not_found (status));
+		bool result (true);
+		if (success (status))
+		{
+			futurehead::bufferstream stream (reinterpret_cast<uint8_t const *> (value.data ()), value.size ());
+			result = totals_a.deserialize (stream);
+		}
+		return result;
 	}
 
 	bool pending_get (futurehead::transaction const & transaction_a, futurehead::pending_key const & key_a, futurehead::pending_info & pending_a) override
@@ -568,25 +664,43 @@ public:
 		futurehead::db_val<Val> info (info_a);
 		auto status = put (transaction_a, tables::accounts, account_a, info);
 		release_assert (success (status));
+		cache.put (cache.accounts, transaction_a.get_handle (), account_a, boost::optional<futurehead::account_info> (info_a));
 	}
 
 	void account_del (futurehead::write_transaction const & transaction_a, futurehead::account const & account_a) override
 	{
 		auto status = del (transaction_a, tables::accounts, account_a);
 		release_assert (success (status));
+		cache.put (cache.accounts, transaction_a.get_handle (), account_a, boost::optional<futurehead::account_info> ());
 	}
 
 	bool account_get (futurehead::transaction const & transaction_a, futurehead::account const & account_a, futurehead::account_info & info_a) override
 	{
-		futurehead::db_val<Val> value;
-		futurehead::db_val<Val> account (account_a);
-		auto status1 (get (transaction_a, tables::accounts, account, value));
-		release_assert (success (status1) || not_found (status1));
 		bool result (true);
-		if (success (status1))
+		boost::optional<futurehead::account_info> cached;
+		if (cache.get (cache.accounts, transaction_a.get_handle (), account_a, cached))
 		{
-			futurehead::bufferstream stream (reinterpret_cast<uint8_t const *> (value.data ()), value.size ());
-			result = info_a.deserialize (stream);
+			if (cached)
+			{
+				info_a = *cached;
+				result = false;
+			}
+		}
+		else
+		{
+			futurehead::db_val<Val> value;
+			futurehead::db_val<Val> account (account_a);
+			auto status1 (get (transaction_a, tables::accounts, account, value));
+			release_assert (success (status1) || not_found (status1));
+			if (success (status1))
+			{
+				futurehead::bufferstream stream (reinterpret_cast<uint8_t const *> (value.data ()), value.size ());
+				result = info_a.deserialize (stream);
+				if (!result)
+				{
+					cache.fill (cache.accounts, transaction_a.get_handle (), account_a, info_a);
+				}
+			}
 		}
 		return result;
 	}
@@ -637,6 +751,59 @@ public:
 		release_assert (success (status));
 	}
 
+	void pruned_put (futurehead::write_transaction const & transaction_a, futurehead::block_hash const & hash_a) override
+	{
+		futurehead::db_val<Val> value;
+		auto status = put (transaction_a, tables::pruned, hash_a, value);
+		release_assert (success (status));
+	}
+
+	void pruned_del (futurehead::write_transaction const & transaction_a, futurehead::block_hash const & hash_a) override
+	{
+		auto status (del (transaction_a, tables::pruned, hash_a));
+		release_assert (success (status));
+	}
+
+	bool pruned_exists (futurehead::transaction const & transaction_a, futurehead::block_hash const & hash_a) const override
+	{
+		return exists (transaction_a, tables::pruned, futurehead::db_val<Val> (hash_a));
+	}
+
+	size_t pruned_count (futurehead::transaction const & transaction_a) const override
+	{
+		return count (transaction_a, tables::pruned);
+	}
+
+	void pruned_clear (futurehead::write_transaction const & transaction_a) override
+	{
+		auto status = drop (transaction_a, tables::pruned);
+		release_assert (success (status));
+	}
+
+	void delegator_put (futurehead::write_transaction const & transaction_a, futurehead::account const & representative_a, futurehead::account const & account_a) override
+	{
+		futurehead::db_val<Val> value;
+		auto status = put (transaction_a, tables::delegators, futurehead::delegator_key (representative_a, account_a), value);
+		release_assert (success (status));
+	}
+
+	void delegator_del (futurehead::write_transaction const & transaction_a, futurehead::account const & representative_a, futurehead::account const & account_a) override
+	{
+		auto status (del (transaction_a, tables::delegators, futurehead::delegator_key (representative_a, account_a)));
+		release_assert (success (status) || not_found (status));
+	}
+
+	bool delegator_exists (futurehead::transaction const & transaction_a, futurehead::account const & representative_a, futurehead::account const & account_a) const override
+	{
+		return exists (transaction_a, tables::delegators, futurehead::db_val<Val> (futurehead::delegator_key (representative_a, account_a)));
+	}
+
+	void delegators_clear (futurehead::write_transaction const & transaction_a) override
+	{
+		auto status = drop (transaction_a, tables::delegators);
+		release_assert (success (status));
+	}
+
 	bool exists (futurehead::transaction const & transaction_a, tables table_a, futurehead::db_val<Val> const & key_a) const
 	{
 		return static_cast<const Derived_Store &> (*this).exists (transaction_a, table_a, key_a);
@@ -711,18 +878,35 @@ public:
 		futurehead::db_val<Val> confirmation_height_info (confirmation_height_info_a);
 		auto status = put (transaction_a, tables::confirmation_height, account_a, confirmation_height_info);
 		release_assert (success (status));
+		cache.put (cache.confirmation_heights, transaction_a.get_handle (), account_a, boost::optional<futurehead::confirmation_height_info> (confirmation_height_info_a));
 	}
 
 	bool confirmation_height_get (futurehead::transaction const & transaction_a, futurehead::account const & account_a, futurehead::confirmation_height_info & confirmation_height_info_a) override
 	{
-		futurehead::db_val<Val> value;
-		auto status = get (transaction_a, tables::confirmation_height, futurehead::db_val<Val> (account_a), value);
-		release_assert (success (status) || not_found (status));
 		bool result (true);
-		if (success (status))
+		boost::optional<futurehead::confirmation_height_info> cached;
+		if (cache.get (cache.confirmation_heights, transaction_a.get_handle (), account_a, cached))
 		{
-			futurehead::bufferstream stream (reinterpret_cast<uint8_t const *> (value.data ()), value.size ());
-			result = confirmation_height_info_a.deserialize (stream);
+			if (cached)
+			{
+				confirmation_height_info_a = *cached;
+				result = false;
+			}
+		}
+		else
+		{
+			futurehead::db_val<Val> value;
+			auto status = get (transaction_a, tables::confirmation_height, futurehead::db_val<Val> (account_a), value);
+			release_assert (success (status) || not_found (status));
+			if (success (status))
+			{
+				futurehead::bufferstream stream (reinterpret_cast<uint8_t const *> (value.data ()), value.size ());
+				result = confirmation_height_info_a.deserialize (stream);
+				if (!result)
+				{
+					cache.fill (cache.confirmation_heights, transaction_a.get_handle (), account_a, confirmation_height_info_a);
+				}
+			}
 		}
 		return result;
 	}
@@ -731,6 +915,7 @@ public:
 	{
 		auto status (del (transaction_a, tables::confirmation_height, futurehead::db_val<Val> (account_a)));
 		release_assert (success (status));
+		cache.put (cache.confirmation_heights, transaction_a.get_handle (), account_a, boost::optional<futurehead::confirmation_height_info> ());
 	}
 
 	bool confirmation_height_exists (futurehead::transaction const & transaction_a, futurehead::account const & account_a) const override
@@ -758,6 +943,16 @@ public:
 		return make_iterator<futurehead::pending_key, futurehead::pending_info> (transaction_a, tables::pending);
 	}
 
+	futurehead::store_iterator<futurehead::account, futurehead::pending_totals> pending_totals_begin (futurehead::transaction const & transaction_a, futurehead::account const & account_a) override
+	{
+		return make_iterator<futurehead::account, futurehead::pending_totals> (transaction_a, tables::pending_totals, futurehead::db_val<Val> (account_a));
+	}
+
+	futurehead::store_iterator<futurehead::account, futurehead::pending_totals> pending_totals_begin (futurehead::transaction const & transaction_a) override
+	{
+		return make_iterator<futurehead::account, futurehead::pending_totals> (transaction_a, tables::pending_totals);
+	}
+
 	futurehead::store_iterator<futurehead::unchecked_key, futurehead::unchecked_info> unchecked_begin (futurehead::transaction const & transaction_a) const override
 	{
 		return make_iterator<futurehead::unchecked_key, futurehead::unchecked_info> (transaction_a, tables::unchecked);
@@ -783,6 +978,17 @@ public:
 		return make_iterator<futurehead::endpoint_key, futurehead::no_value> (transaction_a, tables::peers);
 	}
 
+	futurehead::store_iterator<futurehead::block_hash, futurehead::no_value> pruned_begin (futurehead::transaction const & transaction_a) const override
+	{
+		return make_iterator<futurehead::block_hash, futurehead::no_value> (transaction_a, tables::pruned);
+	}
+
+	/** Iterates the delegators of all representatives in order, starting with the delegators of \p representative_a from \p start_a onwards */
+	futurehead::store_iterator<futurehead::delegator_key, futurehead::no_value> delegators_begin (futurehead::transaction const & transaction_a, futurehead::account const & representative_a, futurehead::account const & start_a = futurehead::account (0)) const override
+	{
+		return make_iterator<futurehead::delegator_key, futurehead::no_value> (transaction_a, tables::delegators, futurehead::db_val<Val> (futurehead::delegator_key (representative_a, start_a)));
+	}
+
 	futurehead::store_iterator<futurehead::account, futurehead::confirmation_height_info> confirmation_height_begin (futurehead::transaction const & transaction_a, futurehead::account const & account_a) override
 	{
 		return make_iterator<futurehead::account, futurehead::confirmation_height_info> (transaction_a, tables::confirmation_height, futurehead::db_val<Val> (account_a));
@@ -800,9 +1006,25 @@ public:
 
 protected:
 	futurehead::network_params network_params;
+	mutable futurehead::store_cache cache;
 	std::unordered_map<futurehead::account, std::shared_ptr<futurehead::vote>> vote_cache_l1;
 	std::unordered_map<futurehead::account, std::shared_ptr<futurehead::vote>> vote_cache_l2;
-	static int constexpr version{ 18 };
+	static int constexpr version{ 21 };
+
+	/** Accounts without pending entries have no totals entry */
+	void pending_totals_put (futurehead::write_transaction const & transaction_a, futurehead::account const & account_a, futurehead::pending_totals const & totals_a)
+	{
+		if (totals_a.count > 0)
+		{
+			auto status (put (transaction_a, tables::pending_totals, account_a, futurehead::db_val<Val> (totals_a)));
+			release_assert (success (status));
+		}
+		else
+		{
+			auto status (del (transaction_a, tables::pending_totals, account_a));
+			release_assert (success (status) || not_found (status));
+		}
+	}
 
 	template <typename T>
 	std::shared_ptr<futurehead::block> block_random (futurehead::transaction const & transaction_a, tables table_a)
@@ -343,6 +343,49 @@ futurehead::account const & futurehead::pending_key::key () const
 	return account;
 }
 
+futurehead::pending_totals::pending_totals (futurehead::amount const & amount_a, uint64_t count_a) :
+amount (amount_a),
+count (count_a)
+{
+}
+
+void futurehead::pending_totals::serialize (futurehead::stream & stream_a) const
+{
+	futurehead::write (stream_a, amount.bytes);
+	futurehead::write (stream_a, count);
+}
+
+bool futurehead::pending_totals::deserialize (futurehead::stream & stream_a)
+{
+	auto error (false);
+	try
+	{
+		futurehead::read (stream_a, amount.bytes);
+		futurehead::read (stream_a, count);
+	}
+	catch (std::runtime_error const &)
+	{
+		error = true;
+	}
+	return error;
+}
+
+bool futurehead::pending_totals::operator== (futurehead::pending_totals const & other_a) const
+{
+	return amount == other_a.amount && count == other_a.count;
+}
+
+futurehead::delegator_key::delegator_key (futurehead::account const & representative_a, futurehead::account const & account_a) :
+representative (representative_a),
+account (account_a)
+{
+}
+
+bool futurehead::delegator_key::operator== (futurehead::delegator_key const & other_a) const
+{
+	return representative == other_a.representative && account == other_a.account;
+}
+
 futurehead::unchecked_info::unchecked_info (std::shared_ptr<futurehead::block> block_a, futurehead::account const & account_a, uint64_t modified_a, futurehead::signature_verification verified_a, bool confirmed_a) :
 block (block_a),
 account (account_a),
@@ -127,6 +127,34 @@ public:
 	futurehead::block_hash hash{ 0 };
 };
 
+/**
+ * Sum and number of the pending entries of an account
+ */
+class pending_totals final
+{
+public:
+	pending_totals () = default;
+	pending_totals (futurehead::amount const &, uint64_t);
+	void serialize (futurehead::stream &) const;
+	bool deserialize (futurehead::stream &);
+	bool operator== (futurehead::pending_totals const &) const;
+	futurehead::amount amount{ 0 };
+	uint64_t count{ 0 };
+};
+
+/**
+ * Key of the delegators index, accounts are ordered by their representative
+ */
+class delegator_key final
+{
+public:
+	delegator_key () = default;
+	delegator_key (futurehead::account const &, futurehead::account const &);
+	bool operator== (futurehead::delegator_key const &) const;
+	futurehead::account representative{ 0 };
+	futurehead::account account{ 0 };
+};
+
 class endpoint_key final
 {
 public:
@@ -509,6 +537,7 @@ public:
 	std::atomic<uint64_t> block_count{ 0 };
 	std::atomic<uint64_t> unchecked_count{ 0 };
 	std::atomic<uint64_t> account_count{ 0 };
+	std::atomic<uint64_t> pruned_count{ 0 };
 	std::atomic<bool> epoch_2_started{ false };
 };
 
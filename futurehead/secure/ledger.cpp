@@ -5,6 +5,7 @@
 #include <futurehead/secure/blockstore.hpp>
 #include <futurehead/secure/common.hpp>
 #include <futurehead/secure/ledger.hpp>
+#include <futurehead/secure/store_cache.hpp>
 
 namespace
 {
@@ -74,8 +75,12 @@ public:
 		auto destination_account (ledger.account (transaction, hash));
 		auto source_account (ledger.account (transaction, block_a.hashables.source));
 		ledger.cache.rep_weights.representation_add (block_a.representative (), 0 - amount);
+		futurehead::account_info info;
+		auto error (ledger.store.account_get (transaction, destination_account, info));
+		(void)error;
+		debug_assert (!error);
 		futurehead::account_info new_info;
-		ledger.change_latest (transaction, destination_account, new_info, new_info);
+		ledger.change_latest (transaction, destination_account, info, new_info);
 		ledger.store.block_del (transaction, hash, block_a.type ());
 		ledger.store.pending_put (transaction, futurehead::pending_key (destination_account, block_a.hashables.source), { source_account, amount, futurehead::epoch::epoch_0 });
 		ledger.store.frontier_del (transaction, hash);
@@ -257,7 +262,7 @@ void ledger_processor::state_block (futurehead::state_block & block_a)
 void ledger_processor::state_block_impl (futurehead::state_block & block_a)
 {
 	auto hash (block_a.hash ());
-	auto existing (ledger.store.block_exists (transaction, block_a.type (), hash));
+	auto existing (ledger.store.block_exists (transaction, block_a.type (), hash) || (ledger.pruning && ledger.store.pruned_exists (transaction, hash)));
 	result.code = existing ? futurehead::process_result::old : futurehead::process_result::progress; // Have we seen this block before? (Unambiguous)
 	if (result.code == futurehead::process_result::progress)
 	{
@@ -287,7 +292,7 @@ void ledger_processor::state_block_impl (futurehead::state_block & block_a)
 					result.code = block_a.hashables.previous.is_zero () ? futurehead::process_result::fork : futurehead::process_result::progress; // Has this account already been opened? (Ambigious)
 					if (result.code == futurehead::process_result::progress)
 					{
-						result.code = ledger.store.block_exists (transaction, block_a.hashables.previous) ? futurehead::process_result::progress : futurehead::process_result::gap_previous; // Does the previous block exist in the ledger? (Unambigious)
+						result.code = ledger.block_or_pruned_exists (transaction, block_a.hashables.previous) ? futurehead::process_result::progress : futurehead::process_result::gap_previous; // Does the previous block exist in the ledger? (Unambigious)
 						if (result.code == futurehead::process_result::progress)
 						{
 							is_send = block_a.hashables.balance < info.balance;
@@ -314,7 +319,7 @@ void ledger_processor::state_block_impl (futurehead::state_block & block_a)
 					{
 						if (!block_a.hashables.link.is_zero ())
 						{
-							result.code = ledger.store.source_exists (transaction, block_a.hashables.link) ? futurehead::process_result::progress : futurehead::process_result::gap_source; // Have we seen the source block already? (Harmless)
+							result.code = (ledger.store.source_exists (transaction, block_a.hashables.link) || (ledger.pruning && ledger.store.pruned_exists (transaction, block_a.hashables.link))) ? futurehead::process_result::progress : futurehead::process_result::gap_source; // Have we seen the source block already? (Harmless)
 							if (result.code == futurehead::process_result::progress)
 							{
 								futurehead::pending_key key (block_a.hashables.account, block_a.hashables.link);
@@ -381,7 +386,7 @@ void ledger_processor::state_block_impl (futurehead::state_block & block_a)
 void ledger_processor::epoch_block_impl (futurehead::state_block & block_a)
 {
 	auto hash (block_a.hash ());
-	auto existing (ledger.store.block_exists (transaction, block_a.type (), hash));
+	auto existing (ledger.store.block_exists (transaction, block_a.type (), hash) || (ledger.pruning && ledger.store.pruned_exists (transaction, hash)));
 	result.code = existing ? futurehead::process_result::old : futurehead::process_result::progress; // Have we seen this block before? (Unambiguous)
 	if (result.code == futurehead::process_result::progress)
 	{
@@ -473,7 +478,7 @@ void ledger_processor::epoch_block_impl (futurehead::state_block & block_a)
 void ledger_processor::change_block (futurehead::change_block & block_a)
 {
 	auto hash (block_a.hash ());
-	auto existing (ledger.store.block_exists (transaction, block_a.type (), hash));
+	auto existing (ledger.store.block_exists (transaction, block_a.type (), hash) || (ledger.pruning && ledger.store.pruned_exists (transaction, hash)));
 	result.code = existing ? futurehead::process_result::old : futurehead::process_result::progress; // Have we seen this block before? (Harmless)
 	if (result.code == futurehead::process_result::progress)
 	{
@@ -530,7 +535,7 @@ void ledger_processor::change_block (futurehead::change_block & block_a)
 void ledger_processor::send_block (futurehead::send_block & block_a)
 {
 	auto hash (block_a.hash ());
-	auto existing (ledger.store.block_exists (transaction, block_a.type (), hash));
+	auto existing (ledger.store.block_exists (transaction, block_a.type (), hash) || (ledger.pruning && ledger.store.pruned_exists (transaction, hash)));
 	result.code = existing ? futurehead::process_result::old : futurehead::process_result::progress; // Have we seen this block before? (Harmless)
 	if (result.code == futurehead::process_result::progress)
 	{
@@ -592,7 +597,7 @@ void ledger_processor::send_block (futurehead::send_block & block_a)
 void ledger_processor::receive_block (futurehead::receive_block & block_a)
 {
 	auto hash (block_a.hash ());
-	auto existing (ledger.store.block_exists (transaction, block_a.type (), hash));
+	auto existing (ledger.store.block_exists (transaction, block_a.type (), hash) || (ledger.pruning && ledger.store.pruned_exists (transaction, hash)));
 	result.code = existing ? futurehead::process_result::old : futurehead::process_result::progress; // Have we seen this block already?  (Harmless)
 	if (result.code == futurehead::process_result::progress)
 	{
@@ -616,7 +621,7 @@ void ledger_processor::receive_block (futurehead::receive_block & block_a)
 					{
 						debug_assert (!validate_message (account, hash, block_a.signature));
 						result.verified = futurehead::signature_verification::valid;
-						result.code = ledger.store.source_exists (transaction, block_a.hashables.source) ? futurehead::process_result::progress : futurehead::process_result::gap_source; // Have we seen the source block already? (Harmless)
+						result.code = (ledger.store.source_exists (transaction, block_a.hashables.source) || (ledger.pruning && ledger.store.pruned_exists (transaction, block_a.hashables.source))) ? futurehead::process_result::progress : futurehead::process_result::gap_source; // Have we seen the source block already? (Harmless)
 						if (result.code == futurehead::process_result::progress)
 						{
 							futurehead::account_info info;
@@ -662,7 +667,7 @@ void ledger_processor::receive_block (futurehead::receive_block & block_a)
 				}
 				else
 				{
-					result.code = ledger.store.block_exists (transaction, block_a.hashables.previous) ? futurehead::process_result::fork : futurehead::process_result::gap_previous; // If we have the block but it's not the latest we have a signed fork (Malicious)
+					result.code = ledger.block_or_pruned_exists (transaction, block_a.hashables.previous) ? futurehead::process_result::fork : futurehead::process_result::gap_previous; // If we have the block but it's not the latest we have a signed fork (Malicious)
 				}
 			}
 		}
@@ -672,7 +677,7 @@ void ledger_processor::receive_block (futurehead::receive_block & block_a)
 void ledger_processor::open_block (futurehead::open_block & block_a)
 {
 	auto hash (block_a.hash ());
-	auto existing (ledger.store.block_exists (transaction, block_a.type (), hash));
+	auto existing (ledger.store.block_exists (transaction, block_a.type (), hash) || (ledger.pruning && ledger.store.pruned_exists (transaction, hash)));
 	result.code = existing ? futurehead::process_result::old : futurehead::process_result::progress; // Have we seen this block already? (Harmless)
 	if (result.code == futurehead::process_result::progress)
 	{
@@ -685,7 +690,7 @@ void ledger_processor::open_block (futurehead::open_block & block_a)
 		{
 			debug_assert (!validate_message (block_a.hashables.account, hash, block_a.signature));
 			result.verified = futurehead::signature_verification::valid;
-			result.code = ledger.store.source_exists (transaction, block_a.hashables.source) ? futurehead::process_result::progress : futurehead::process_result::gap_source; // Have we seen the source block? (Harmless)
+			result.code = (ledger.store.source_exists (transaction, block_a.hashables.source) || (ledger.pruning && ledger.store.pruned_exists (transaction, block_a.hashables.source))) ? futurehead::process_result::progress : futurehead::process_result::gap_source; // Have we seen the source block? (Harmless)
 			if (result.code == futurehead::process_result::progress)
 			{
 				futurehead::account_info info;
@@ -776,7 +781,9 @@ epoch_2_started_cb (epoch_2_started_cb_a)
 			cache.unchecked_count = store.unchecked_count (transaction);
 		}
 
-		cache.block_count = store.block_count (transaction).sum ();
+		// Pruned blocks are still part of the ledger, only their contents were removed
+		cache.pruned_count = store.pruned_count (transaction);
+		cache.block_count = store.block_count (transaction).sum () + cache.pruned_count;
 	}
 }
 
@@ -786,6 +793,25 @@ futurehead::uint128_t futurehead::ledger::balance (futurehead::transaction const
 	return hash_a.is_zero () ? 0 : store.block_balance (transaction_a, hash_a);
 }
 
+// Balance for account containing hash, sets \p error_a if the block is not available, for instance because it was pruned
+futurehead::uint128_t futurehead::ledger::balance_safe (futurehead::transaction const & transaction_a, futurehead::block_hash const & hash_a, bool & error_a) const
+{
+	futurehead::uint128_t result (0);
+	if (!hash_a.is_zero ())
+	{
+		auto block (store.block_get (transaction_a, hash_a));
+		if (block != nullptr)
+		{
+			result = store.block_balance_calculated (block);
+		}
+		else
+		{
+			error_a = true;
+		}
+	}
+	return result;
+}
+
 // Balance for an account by account number
 futurehead::uint128_t futurehead::ledger::account_balance (futurehead::transaction const & transaction_a, futurehead::account const & account_a)
 {
@@ -801,13 +827,14 @@ futurehead::uint128_t futurehead::ledger::account_balance (futurehead::transacti
 
 futurehead::uint128_t futurehead::ledger::account_pending (futurehead::transaction const & transaction_a, futurehead::account const & account_a)
 {
-	futurehead::uint128_t result (0);
-	futurehead::account end (account_a.number () + 1);
-	for (auto i (store.pending_begin (transaction_a, futurehead::pending_key (account_a, 0))), n (store.pending_begin (transaction_a, futurehead::pending_key (end, 0))); i != n; ++i)
-	{
-		futurehead::pending_info const & info (i->second);
-		result += info.amount.number ();
-	}
+	return account_pending_totals (transaction_a, account_a).amount.number ();
+}
+
+// Sum and number of pending entries of an account, zero if there are none
+futurehead::pending_totals futurehead::ledger::account_pending_totals (futurehead::transaction const & transaction_a, futurehead::account const & account_a)
+{
+	futurehead::pending_totals result;
+	store.pending_totals_get (transaction_a, account_a, result);
 	return result;
 }
 
@@ -847,6 +874,11 @@ bool futurehead::ledger::block_exists (futurehead::block_type type, futurehead::
 	return store.block_exists (store.tx_begin_read (), type, hash_a);
 }
 
+bool futurehead::ledger::block_or_pruned_exists (futurehead::transaction const & transaction_a, futurehead::block_hash const & hash_a) const
+{
+	return store.block_exists (transaction_a, hash_a) || (pruning && store.pruned_exists (transaction_a, hash_a));
+}
+
 std::string futurehead::ledger::block_text (char const * hash_a)
 {
 	return block_text (futurehead::block_hash (hash_a));
@@ -997,6 +1029,21 @@ futurehead::account futurehead::ledger::account (futurehead::transaction const &
 	return store.block_account (transaction_a, hash_a);
 }
 
+futurehead::account futurehead::ledger::account_safe (futurehead::transaction const & transaction_a, futurehead::block_hash const & hash_a, bool & error_a) const
+{
+	futurehead::account result (0);
+	auto block (store.block_get (transaction_a, hash_a));
+	if (block != nullptr)
+	{
+		result = store.block_account_calculated (*block);
+	}
+	else
+	{
+		error_a = true;
+	}
+	return result;
+}
+
 // Return amount decrease or increase for block
 futurehead::uint128_t futurehead::ledger::amount (futurehead::transaction const & transaction_a, futurehead::account const & account_a)
 {
@@ -1012,6 +1059,26 @@ futurehead::uint128_t futurehead::ledger::amount (futurehead::transaction const
 	return block_balance > previous_balance ? block_balance - previous_balance : previous_balance - block_balance;
 }
 
+futurehead::uint128_t futurehead::ledger::amount_safe (futurehead::transaction const & transaction_a, futurehead::block_hash const & hash_a, bool & error_a) const
+{
+	futurehead::uint128_t result (0);
+	auto block (store.block_get (transaction_a, hash_a));
+	if (block != nullptr)
+	{
+		auto block_balance (store.block_balance_calculated (block));
+		auto previous_balance (balance_safe (transaction_a, block->previous (), error_a));
+		if (!error_a)
+		{
+			result = block_balance > previous_balance ? block_balance - previous_balance : previous_balance - block_balance;
+		}
+	}
+	else
+	{
+		error_a = true;
+	}
+	return result;
+}
+
 // Return latest block for account
 futurehead::block_hash futurehead::ledger::latest (futurehead::transaction const & transaction_a, futurehead::account const & account_a)
 {
@@ -1051,7 +1118,7 @@ bool futurehead::ledger::could_fit (futurehead::transaction const & transaction_
 {
 	auto dependencies (dependent_blocks (transaction_a, block_a));
 	return std::all_of (dependencies.begin (), dependencies.end (), [this, &transaction_a](futurehead::block_hash const & hash_a) {
-		return hash_a.is_zero () || store.block_exists (transaction_a, hash_a);
+		return hash_a.is_zero () || block_or_pruned_exists (transaction_a, hash_a);
 	});
 }
 
@@ -1071,6 +1138,11 @@ bool futurehead::ledger::can_vote (futurehead::transaction const & transaction_a
 				debug_assert (!error);
 				result = block->sideband ().height <= height.height;
 			}
+			else
+			{
+				// Only cemented blocks are pruned
+				result = pruning && store.pruned_exists (transaction_a, hash_a);
+			}
 		}
 		return result;
 	});
@@ -1158,9 +1230,18 @@ void futurehead::ledger::change_latest (futurehead::write_transaction const & tr
 			store.account_del (transaction_a, account_a);
 		}
 		store.account_put (transaction_a, account_a, new_a);
+		if (old_a.head.is_zero () || old_a.representative != new_a.representative)
+		{
+			if (!old_a.head.is_zero ())
+			{
+				store.delegator_del (transaction_a, old_a.representative, account_a);
+			}
+			store.delegator_put (transaction_a, new_a.representative, account_a);
+		}
 	}
 	else
 	{
+		store.delegator_del (transaction_a, old_a.representative, account_a);
 		store.confirmation_height_del (transaction_a, account_a);
 		store.account_del (transaction_a, account_a);
 		debug_assert (cache.account_count > 0);
@@ -1236,12 +1317,20 @@ std::shared_ptr<futurehead::block> futurehead::ledger::backtrack (futurehead::tr
 bool futurehead::ledger::block_confirmed (futurehead::transaction const & transaction_a, futurehead::block_hash const & hash_a) const
 {
 	auto confirmed (false);
-	auto block_height (store.block_account_height (transaction_a, hash_a));
-	if (block_height > 0) // 0 indicates that the block doesn't exist
+	if (pruning && store.pruned_exists (transaction_a, hash_a))
 	{
-		futurehead::confirmation_height_info confirmation_height_info;
-		release_assert (!store.confirmation_height_get (transaction_a, account (transaction_a, hash_a), confirmation_height_info));
-		confirmed = (confirmation_height_info.height >= block_height);
+		// Only cemented blocks are pruned
+		confirmed = true;
+	}
+	else
+	{
+		auto block_height (store.block_account_height (transaction_a, hash_a));
+		if (block_height > 0) // 0 indicates that the block doesn't exist
+		{
+			futurehead::confirmation_height_info confirmation_height_info;
+			release_assert (!store.confirmation_height_get (transaction_a, account (transaction_a, hash_a), confirmation_height_info));
+			confirmed = (confirmation_height_info.height >= block_height);
+		}
 	}
 	return confirmed;
 }
@@ -1255,9 +1344,47 @@ bool futurehead::ledger::block_not_confirmed_or_not_exists (futurehead::block co
 	{
 		result = !block_confirmed (transaction, hash);
 	}
+	else if (pruning && store.pruned_exists (transaction, hash))
+	{
+		result = false;
+	}
 	return result;
 }
 
+/**
+ * Removes the contents of \p hash_a and all of its predecessors which were not pruned yet, keeping their hashes in the pruned table.
+ * The caller guarantees these blocks are cemented. The transaction is committed every \p batch_size_a pruned blocks.
+ */
+uint64_t futurehead::ledger::pruning_action (futurehead::write_transaction & transaction_a, futurehead::block_hash const & hash_a, uint64_t const batch_size_a)
+{
+	uint64_t pruned_count (0);
+	futurehead::block_hash hash (hash_a);
+	while (!hash.is_zero () && hash != network_params.ledger.genesis_hash)
+	{
+		auto block (store.block_get (transaction_a, hash));
+		if (block != nullptr)
+		{
+			store.block_del (transaction_a, hash, block->type ());
+			store.pruned_put (transaction_a, hash);
+			hash = block->previous ();
+			++pruned_count;
+			++cache.pruned_count;
+			if (pruned_count % batch_size_a == 0)
+			{
+				transaction_a.commit ();
+				transaction_a.renew ();
+			}
+		}
+		else
+		{
+			// Everything below an already pruned block is pruned as well
+			release_assert (store.pruned_exists (transaction_a, hash));
+			hash.clear ();
+		}
+	}
+	return pruned_count;
+}
+
 std::unique_ptr<futurehead::container_info_component> futurehead::collect_container_info (ledger & ledger, const std::string & name)
 {
 	auto count = ledger.bootstrap_weights_size.load ();
@@ -1265,5 +1392,6 @@ std::unique_ptr<futurehead::container_info_component> futurehead::collect_contai
 	auto composite = std::make_unique<container_info_composite> (name);
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "bootstrap_weights", count, sizeof_element }));
 	composite->add_component (collect_container_info (ledger.cache.rep_weights, "rep_weights"));
+	composite->add_component (collect_container_info (ledger.store.get_store_cache (), "store_cache"));
 	return composite;
 }
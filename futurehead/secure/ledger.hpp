@@ -17,11 +17,15 @@ class ledger final
 public:
 	ledger (futurehead::block_store &, futurehead::stat &, futurehead::generate_cache const & = futurehead::generate_cache (), std::function<void()> = nullptr);
 	futurehead::account account (futurehead::transaction const &, futurehead::block_hash const &) const;
+	futurehead::account account_safe (futurehead::transaction const &, futurehead::block_hash const &, bool &) const;
 	futurehead::uint128_t amount (futurehead::transaction const &, futurehead::account const &);
 	futurehead::uint128_t amount (futurehead::transaction const &, futurehead::block_hash const &);
+	futurehead::uint128_t amount_safe (futurehead::transaction const &, futurehead::block_hash const &, bool &) const;
 	futurehead::uint128_t balance (futurehead::transaction const &, futurehead::block_hash const &) const;
+	futurehead::uint128_t balance_safe (futurehead::transaction const &, futurehead::block_hash const &, bool &) const;
 	futurehead::uint128_t account_balance (futurehead::transaction const &, futurehead::account const &);
 	futurehead::uint128_t account_pending (futurehead::transaction const &, futurehead::account const &);
+	futurehead::pending_totals account_pending_totals (futurehead::transaction const &, futurehead::account const &);
 	futurehead::uint128_t weight (futurehead::account const &);
 	std::shared_ptr<futurehead::block> successor (futurehead::transaction const &, futurehead::qualified_root const &);
 	std::shared_ptr<futurehead::block> forked_block (futurehead::transaction const &, futurehead::block const &);
@@ -34,6 +38,7 @@ public:
 	futurehead::block_hash representative_calculated (futurehead::transaction const &, futurehead::block_hash const &);
 	bool block_exists (futurehead::block_hash const &);
 	bool block_exists (futurehead::block_type, futurehead::block_hash const &);
+	bool block_or_pruned_exists (futurehead::transaction const &, futurehead::block_hash const &) const;
 	std::string block_text (char const *);
 	std::string block_text (futurehead::block_hash const &);
 	bool is_send (futurehead::transaction const &, futurehead::state_block const &) const;
@@ -50,6 +55,7 @@ public:
 	std::array<futurehead::block_hash, 2> dependent_blocks (futurehead::transaction const &, futurehead::block const &);
 	futurehead::account const & epoch_signer (futurehead::link const &) const;
 	futurehead::link const & epoch_link (futurehead::epoch) const;
+	uint64_t pruning_action (futurehead::write_transaction &, futurehead::block_hash const &, uint64_t const);
 	static futurehead::uint128_t const unit;
 	futurehead::network_params network_params;
 	futurehead::block_store & store;
@@ -59,6 +65,7 @@ public:
 	std::atomic<size_t> bootstrap_weights_size{ 0 };
 	uint64_t bootstrap_weight_max_blocks{ 1 };
 	std::atomic<bool> check_bootstrap_weights;
+	bool pruning{ false };
 	std::function<void()> epoch_2_started_cb;
 };
 
@@ -0,0 +1,440 @@
+#include <futurehead/crypto/blake2/blake2.h>
+#include <futurehead/secure/blockstore.hpp>
+#include <futurehead/secure/common.hpp>
+#include <futurehead/secure/ledger_snapshot.hpp>
+
+#include <boost/endian/conversion.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include <map>
+
+constexpr uint8_t futurehead::ledger_snapshot::version;
+
+namespace
+{
+std::array<uint8_t, 4> constexpr magic{ { 'F', 'H', 'L', 'S' } };
+/** Largest payload of a single record, blocks are the largest records */
+uint32_t constexpr record_size_max{ 4 * 1024 };
+
+enum class record_type : uint8_t
+{
+	end,
+	account,
+	block,
+	pending,
+	pruned,
+	weight
+};
+
+class record final
+{
+public:
+	record_type type{ record_type::end };
+	futurehead::account account{ 0 };
+	futurehead::account_info info;
+	futurehead::confirmation_height_info confirmation_height;
+	std::shared_ptr<futurehead::block> block;
+	futurehead::pending_key pending_key;
+	futurehead::pending_info pending_info;
+	futurehead::block_hash hash{ 0 };
+	futurehead::amount weight{ 0 };
+};
+
+template <typename T>
+void write_big (futurehead::stream & stream_a, T value_a)
+{
+	futurehead::write (stream_a, boost::endian::native_to_big (value_a));
+}
+
+template <typename T>
+void read_big (futurehead::stream & stream_a, T & value_a)
+{
+	futurehead::read (stream_a, value_a);
+	boost::endian::big_to_native_inplace (value_a);
+}
+
+class snapshot_writer final
+{
+public:
+	explicit snapshot_writer (boost::filesystem::path const & path_a) :
+	stream (path_a, std::ios::out | std::ios::binary | std::ios::trunc)
+	{
+		blake2b_init (&checksum, sizeof (futurehead::block_hash));
+	}
+	template <typename Serialize>
+	void put (record_type type_a, Serialize const & serialize_a)
+	{
+		payload.clear ();
+		{
+			futurehead::vectorstream payload_stream (payload);
+			serialize_a (payload_stream);
+		}
+		debug_assert (payload.size () <= record_size_max);
+		std::vector<uint8_t> header;
+		{
+			futurehead::vectorstream header_stream (header);
+			futurehead::write (header_stream, type_a);
+			write_big (header_stream, static_cast<uint32_t> (payload.size ()));
+		}
+		append (header);
+		append (payload);
+	}
+	void append (std::vector<uint8_t> const & data_a)
+	{
+		blake2b_update (&checksum, data_a.data (), data_a.size ());
+		stream.write (reinterpret_cast<char const *> (data_a.data ()), data_a.size ());
+	}
+	/** Writes the end record holding the checksum, returns true on error */
+	bool finish ()
+	{
+		futurehead::block_hash checksum_l;
+		blake2b_final (&checksum, checksum_l.bytes.data (), checksum_l.bytes.size ());
+		std::vector<uint8_t> end;
+		{
+			futurehead::vectorstream end_stream (end);
+			futurehead::write (end_stream, record_type::end);
+			write_big (end_stream, static_cast<uint32_t> (checksum_l.bytes.size ()));
+			futurehead::write (end_stream, checksum_l.bytes);
+		}
+		stream.write (reinterpret_cast<char const *> (end.data ()), end.size ());
+		stream.flush ();
+		return stream.fail ();
+	}
+
+private:
+	boost::filesystem::ofstream stream;
+	blake2b_state checksum;
+	std::vector<uint8_t> payload;
+};
+
+class snapshot_reader final
+{
+public:
+	explicit snapshot_reader (boost::filesystem::path const & path_a) :
+	stream (path_a, std::ios::in | std::ios::binary)
+	{
+		blake2b_init (&checksum, sizeof (futurehead::block_hash));
+	}
+	/** Reads the header, returns true on error or if the snapshot was not written for this network and store version */
+	bool header (int store_version_a)
+	{
+		std::vector<uint8_t> header_l (magic.size () + sizeof (uint8_t) + sizeof (int32_t) + sizeof (futurehead::block_hash));
+		auto error (fill (header_l));
+		if (!error)
+		{
+			blake2b_update (&checksum, header_l.data (), header_l.size ());
+			futurehead::bufferstream header_stream (header_l.data (), header_l.size ());
+			std::array<uint8_t, magic.size ()> magic_l;
+			uint8_t version;
+			int32_t store_version;
+			futurehead::block_hash genesis_hash;
+			futurehead::read (header_stream, magic_l);
+			futurehead::read (header_stream, version);
+			read_big (header_stream, store_version);
+			futurehead::read (header_stream, genesis_hash);
+			error = magic_l != magic || version != futurehead::ledger_snapshot::version || store_version != store_version_a || genesis_hash != futurehead::genesis ().hash ();
+		}
+		return error;
+	}
+	/** Reads the next record, returns true on error. The end record is only returned if the checksum matches */
+	bool next (record & record_a)
+	{
+		std::vector<uint8_t> header_l (sizeof (record_type) + sizeof (uint32_t));
+		auto error (fill (header_l));
+		if (!error)
+		{
+			futurehead::bufferstream header_stream (header_l.data (), header_l.size ());
+			uint32_t size;
+			futurehead::read (header_stream, record_a.type);
+			read_big (header_stream, size);
+			payload.resize (size);
+			error = size > record_size_max || fill (payload);
+		}
+		if (!error)
+		{
+			futurehead::bufferstream payload_stream (payload.data (), payload.size ());
+			try
+			{
+				error = parse (payload_stream, record_a);
+			}
+			catch (std::runtime_error const &)
+			{
+				error = true;
+			}
+			// Every byte of the payload is part of the record
+			error = error || payload_stream.in_avail () != 0;
+		}
+		if (!error)
+		{
+			if (record_a.type != record_type::end)
+			{
+				blake2b_update (&checksum, header_l.data (), header_l.size ());
+				blake2b_update (&checksum, payload.data (), payload.size ());
+			}
+			else
+			{
+				futurehead::block_hash checksum_l;
+				blake2b_final (&checksum, checksum_l.bytes.data (), checksum_l.bytes.size ());
+				// Nothing follows the end record
+				error = checksum_l != record_a.hash || stream.peek () != std::char_traits<char>::eof ();
+			}
+		}
+		return error;
+	}
+
+private:
+	bool fill (std::vector<uint8_t> & data_a)
+	{
+		stream.read (reinterpret_cast<char *> (data_a.data ()), data_a.size ());
+		return static_cast<size_t> (stream.gcount ()) != data_a.size ();
+	}
+	bool parse (futurehead::stream & stream_a, record & record_a)
+	{
+		auto error (false);
+		switch (record_a.type)
+		{
+			case record_type::account:
+			{
+				uint8_t epoch;
+				futurehead::read (stream_a, record_a.account);
+				futurehead::read (stream_a, record_a.info.head);
+				futurehead::read (stream_a, record_a.info.representative);
+				futurehead::read (stream_a, record_a.info.open_block);
+				futurehead::read (stream_a, record_a.info.balance);
+				read_big (stream_a, record_a.info.modified);
+				read_big (stream_a, record_a.info.block_count);
+				futurehead::read (stream_a, epoch);
+				read_big (stream_a, record_a.confirmation_height.height);
+				futurehead::read (stream_a, record_a.confirmation_height.frontier);
+				record_a.info.epoch_m = static_cast<futurehead::epoch> (epoch);
+				break;
+			}
+			case record_type::block:
+			{
+				record_a.block = futurehead::deserialize_block (stream_a);
+				error = record_a.block == nullptr;
+				if (!error)
+				{
+					futurehead::block_sideband sideband;
+					error = sideband.deserialize (stream_a, record_a.block->type ());
+					record_a.block->sideband_set (sideband);
+				}
+				break;
+			}
+			case record_type::pending:
+			{
+				uint8_t epoch;
+				futurehead::read (stream_a, record_a.pending_key.account);
+				futurehead::read (stream_a, record_a.pending_key.hash);
+				futurehead::read (stream_a, record_a.pending_info.source);
+				futurehead::read (stream_a, record_a.pending_info.amount);
+				futurehead::read (stream_a, epoch);
+				record_a.pending_info.epoch = static_cast<futurehead::epoch> (epoch);
+				break;
+			}
+			case record_type::pruned:
+			case record_type::end:
+			{
+				futurehead::read (stream_a, record_a.hash);
+				break;
+			}
+			case record_type::weight:
+			{
+				futurehead::read (stream_a, record_a.account);
+				futurehead::read (stream_a, record_a.weight);
+				break;
+			}
+			default:
+			{
+				error = true;
+				break;
+			}
+		}
+		return error;
+	}
+	boost::filesystem::ifstream stream;
+	blake2b_state checksum;
+	std::vector<uint8_t> payload;
+};
+
+std::vector<futurehead::tables> const import_tables{ futurehead::tables::accounts, futurehead::tables::cached_counts, futurehead::tables::change_blocks, futurehead::tables::confirmation_height, futurehead::tables::delegators, futurehead::tables::frontiers, futurehead::tables::open_blocks, futurehead::tables::pending, futurehead::tables::pending_totals, futurehead::tables::pruned, futurehead::tables::receive_blocks, futurehead::tables::send_blocks, futurehead::tables::state_blocks };
+}
+
+bool futurehead::ledger_snapshot::write (futurehead::block_store & store_a, futurehead::transaction const & transaction_a, boost::filesystem::path const & path_a, counts & counts_a)
+{
+	snapshot_writer writer (path_a);
+	{
+		std::vector<uint8_t> header;
+		{
+			futurehead::vectorstream stream (header);
+			futurehead::write (stream, magic);
+			futurehead::write (stream, version);
+			write_big (stream, static_cast<int32_t> (store_a.version_get (transaction_a)));
+			futurehead::write (stream, futurehead::genesis ().hash ());
+		}
+		writer.append (header);
+	}
+	std::map<futurehead::account, futurehead::uint128_t> weights;
+	for (auto i (store_a.latest_begin (transaction_a)), n (store_a.latest_end ()); i != n; ++i)
+	{
+		futurehead::account const & account (i->first);
+		futurehead::account_info const & info (i->second);
+		futurehead::confirmation_height_info confirmation_height{ 0, futurehead::block_hash (0) };
+		store_a.confirmation_height_get (transaction_a, account, confirmation_height);
+		writer.put (record_type::account, [&account, &info, &confirmation_height](futurehead::stream & stream_a) {
+			futurehead::write (stream_a, account);
+			futurehead::write (stream_a, info.head);
+			futurehead::write (stream_a, info.representative);
+			futurehead::write (stream_a, info.open_block);
+			futurehead::write (stream_a, info.balance);
+			write_big (stream_a, info.modified);
+			write_big (stream_a, info.block_count);
+			futurehead::write (stream_a, static_cast<uint8_t> (info.epoch ()));
+			write_big (stream_a, confirmation_height.height);
+			futurehead::write (stream_a, confirmation_height.frontier);
+		});
+		weights[info.representative] += info.balance.number ();
+		++counts_a.accounts;
+		// The chain follows its account from the head down, stopping at pruned blocks
+		for (auto block (store_a.block_get (transaction_a, info.head)); block != nullptr; block = block->previous ().is_zero () ? nullptr : store_a.block_get (transaction_a, block->previous ()))
+		{
+			writer.put (record_type::block, [&block](futurehead::stream & stream_a) {
+				futurehead::serialize_block (stream_a, *block);
+				block->sideband ().serialize (stream_a, block->type ());
+			});
+			++counts_a.blocks;
+		}
+	}
+	for (auto i (store_a.pending_begin (transaction_a)), n (store_a.pending_end ()); i != n; ++i)
+	{
+		futurehead::pending_key const & key (i->first);
+		futurehead::pending_info const & info (i->second);
+		writer.put (record_type::pending, [&key, &info](futurehead::stream & stream_a) {
+			futurehead::write (stream_a, key.account);
+			futurehead::write (stream_a, key.hash);
+			futurehead::write (stream_a, info.source);
+			futurehead::write (stream_a, info.amount);
+			futurehead::write (stream_a, static_cast<uint8_t> (info.epoch));
+		});
+		++counts_a.pending;
+	}
+	for (auto i (store_a.pruned_begin (transaction_a)), n (store_a.pruned_end ()); i != n; ++i)
+	{
+		futurehead::block_hash const & hash (i->first);
+		writer.put (record_type::pruned, [&hash](futurehead::stream & stream_a) {
+			futurehead::write (stream_a, hash);
+		});
+		++counts_a.pruned;
+	}
+	for (auto const & weight : weights)
+	{
+		writer.put (record_type::weight, [&weight](futurehead::stream & stream_a) {
+			futurehead::write (stream_a, weight.first);
+			futurehead::write (stream_a, futurehead::amount (weight.second));
+		});
+	}
+	return writer.finish ();
+}
+
+bool futurehead::ledger_snapshot::read (futurehead::block_store & store_a, boost::filesystem::path const & path_a, counts & counts_a, size_t batch_size_a)
+{
+	int store_version;
+	bool empty;
+	{
+		auto transaction (store_a.tx_begin_read ());
+		store_version = store_a.version_get (transaction);
+		empty = store_a.account_count (transaction) == 1 && store_a.pruned_count (transaction) == 0;
+	}
+	auto error (!empty);
+	// The first pass only validates, nothing is written unless the whole snapshot is consistent
+	if (!error)
+	{
+		snapshot_reader reader (path_a);
+		error = reader.header (store_version);
+		std::map<futurehead::account, futurehead::uint128_t> weights;
+		std::map<futurehead::account, futurehead::uint128_t> expected_weights;
+		record record_l;
+		while (!error && !(error = reader.next (record_l)) && record_l.type != record_type::end)
+		{
+			if (record_l.type == record_type::account)
+			{
+				weights[record_l.info.representative] += record_l.info.balance.number ();
+			}
+			else if (record_l.type == record_type::weight)
+			{
+				expected_weights[record_l.account] = record_l.weight.number ();
+			}
+		}
+		error = error || weights != expected_weights;
+	}
+	if (!error)
+	{
+		snapshot_reader reader (path_a);
+		error = reader.header (store_version);
+		debug_assert (!error);
+		auto transaction (store_a.tx_begin_write (import_tables));
+		futurehead::account account (0);
+		futurehead::block_hash head (0);
+		size_t records (0);
+		record record_l;
+		while (!error && !(error = reader.next (record_l)) && record_l.type != record_type::end)
+		{
+			switch (record_l.type)
+			{
+				case record_type::account:
+				{
+					account = record_l.account;
+					head = record_l.info.head;
+					futurehead::account_info existing;
+					if (!store_a.account_get (transaction, account, existing))
+					{
+						// Only genesis exists, its entries are replaced by the ones of the snapshot
+						if (existing.head != head && store_a.frontier_get (transaction, existing.head) == account)
+						{
+							store_a.frontier_del (transaction, existing.head);
+						}
+						store_a.delegator_del (transaction, existing.representative, account);
+					}
+					store_a.account_put (transaction, account, record_l.info);
+					store_a.confirmation_height_put (transaction, account, record_l.confirmation_height);
+					store_a.delegator_put (transaction, record_l.info.representative, account);
+					++counts_a.accounts;
+					break;
+				}
+				case record_type::block:
+				{
+					store_a.block_import (transaction, *record_l.block);
+					// Legacy blocks heading their account are indexed by the frontiers table
+					if (record_l.block->hash () == head && record_l.block->type () != futurehead::block_type::state)
+					{
+						store_a.frontier_put (transaction, head, account);
+					}
+					++counts_a.blocks;
+					break;
+				}
+				case record_type::pending:
+				{
+					store_a.pending_put (transaction, record_l.pending_key, record_l.pending_info);
+					++counts_a.pending;
+					break;
+				}
+				case record_type::pruned:
+				{
+					store_a.pruned_put (transaction, record_l.hash);
+					++counts_a.pruned;
+					break;
+				}
+				default:
+				{
+					break;
+				}
+			}
+			if (++records % batch_size_a == 0)
+			{
+				transaction.commit ();
+				transaction.renew ();
+			}
+		}
+	}
+	return error;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <futurehead/lib/numbers.hpp>
+
+#include <boost/filesystem/path.hpp>
+
+namespace futurehead
+{
+class block_store;
+class transaction;
+
+/**
+ * Streams a consistent copy of the ledger to a file and imports it into an empty ledger without processing any block.
+ * The file is a header followed by length prefixed records of accounts with their confirmation height, blocks with their sideband,
+ * pending entries, pruned hashes and representative weights, ending with a blake2b checksum of every preceding byte.
+ * Integers are big endian and tables are written in key order so the file compresses well with general purpose tools.
+ */
+class ledger_snapshot final
+{
+public:
+	class counts final
+	{
+	public:
+		uint64_t accounts{ 0 };
+		uint64_t blocks{ 0 };
+		uint64_t pending{ 0 };
+		uint64_t pruned{ 0 };
+	};
+	/** Writes the ledger as read through \p transaction_a, returns true on error */
+	static bool write (futurehead::block_store &, futurehead::transaction const &, boost::filesystem::path const &, counts &);
+	/**
+	 * Imports a snapshot into a store which only holds the genesis account, committing every \p batch_size_a records.
+	 * The whole file is validated before anything is written, returns true on error
+	 */
+	static bool read (futurehead::block_store &, boost::filesystem::path const &, counts &, size_t batch_size_a = 64 * 1024);
+	static uint8_t constexpr version{ 1 };
+};
+}
@@ -0,0 +1,81 @@
+#include <futurehead/secure/store_cache.hpp>
+
+futurehead::store_cache::store_cache (size_t accounts_max_a, size_t blocks_max_a) :
+accounts (accounts_max_a),
+confirmation_heights (accounts_max_a),
+blocks (blocks_max_a)
+{
+}
+
+uint64_t futurehead::store_cache::generation ()
+{
+	futurehead::lock_guard<std::mutex> guard (mutex);
+	return generation_m;
+}
+
+void futurehead::store_cache::txn_start (void * handle_a, uint64_t generation_a)
+{
+	futurehead::lock_guard<std::mutex> guard (mutex);
+	transactions[handle_a] = generation_a;
+}
+
+void futurehead::store_cache::txn_commit (void * handle_a)
+{
+	futurehead::lock_guard<std::mutex> guard (mutex);
+	// Commits complete in the order they are published, this one becomes visible once all earlier ones have completed
+	++pending_commits;
+	auto generation_l (generation_m + pending_commits);
+	accounts.publish (handle_a, generation_l);
+	confirmation_heights.publish (handle_a, generation_l);
+	blocks.publish (handle_a, generation_l);
+	// The handle can be reused by the next write transaction as soon as the database commit releases the write lock
+	transactions.erase (handle_a);
+}
+
+void futurehead::store_cache::txn_end (void * handle_a, bool is_write_a)
+{
+	futurehead::lock_guard<std::mutex> guard (mutex);
+	if (is_write_a)
+	{
+		debug_assert (pending_commits > 0);
+		--pending_commits;
+		++generation_m;
+	}
+	else
+	{
+		transactions.erase (handle_a);
+	}
+}
+
+void futurehead::store_cache::clear ()
+{
+	futurehead::lock_guard<std::mutex> guard (mutex);
+	accounts.clear ();
+	confirmation_heights.clear ();
+	blocks.clear ();
+}
+
+std::unique_ptr<futurehead::container_info_component> futurehead::collect_container_info (store_cache & store_cache, const std::string & name)
+{
+	size_t accounts_count;
+	size_t confirmation_heights_count;
+	size_t blocks_count;
+	{
+		futurehead::lock_guard<std::mutex> guard (store_cache.mutex);
+		accounts_count = store_cache.accounts.size ();
+		confirmation_heights_count = store_cache.confirmation_heights.size ();
+		blocks_count = store_cache.blocks.size ();
+	}
+	auto composite = std::make_unique<container_info_composite> (name);
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "accounts", accounts_count, sizeof (decltype (store_cache.accounts)::entry) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "confirmation_heights", confirmation_heights_count, sizeof (decltype (store_cache.confirmation_heights)::entry) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "blocks", blocks_count, sizeof (decltype (store_cache.blocks)::entry) }));
+	// Lookup counters take no memory, they are reported with an element size of zero
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "accounts_hits", static_cast<size_t> (store_cache.accounts.hits), 0 }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "accounts_misses", static_cast<size_t> (store_cache.accounts.misses), 0 }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "confirmation_heights_hits", static_cast<size_t> (store_cache.confirmation_heights.hits), 0 }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "confirmation_heights_misses", static_cast<size_t> (store_cache.confirmation_heights.misses), 0 }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "blocks_hits", static_cast<size_t> (store_cache.blocks.hits), 0 }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "blocks_misses", static_cast<size_t> (store_cache.blocks.misses), 0 }));
+	return composite;
+}
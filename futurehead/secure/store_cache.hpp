@@ -0,0 +1,298 @@
+#pragma once
+
+#include <futurehead/lib/blocks.hpp>
+#include <futurehead/lib/locks.hpp>
+#include <futurehead/lib/utility.hpp>
+#include <futurehead/secure/common.hpp>
+
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/multi_index_container.hpp>
+#include <boost/optional.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace futurehead
+{
+/**
+ * Least recently used set of committed entries of a single store table, together with the writes staged by open write transactions.
+ * Every committed entry records the commit generation in which it became visible, so transactions holding an older snapshot skip it.
+ * Not thread safe, all access is serialized by futurehead::store_cache
+ */
+template <typename Key, typename Value>
+class store_cache_table final
+{
+public:
+	class entry final
+	{
+	public:
+		Key key;
+		Value value;
+		uint64_t generation;
+	};
+
+	explicit store_cache_table (size_t max_a) :
+	max (max_a)
+	{
+	}
+
+	/**
+	 * Returns true if the cache can answer a lookup of \p key_a by the transaction \p handle_a started at \p generation_a.
+	 * \p value_a is left empty if the transaction itself deleted the entry
+	 */
+	bool get (void * handle_a, uint64_t generation_a, Key const & key_a, boost::optional<Value> & value_a)
+	{
+		auto result (false);
+		auto staged_l (staged.find (handle_a));
+		if (staged_l != staged.end ())
+		{
+			auto existing (staged_l->second.find (key_a));
+			if (existing != staged_l->second.end ())
+			{
+				value_a = existing->second;
+				result = true;
+			}
+		}
+		if (!result && !invalidated_by (handle_a, key_a))
+		{
+			auto & by_key (entries.template get<tag_key> ());
+			auto existing (by_key.find (key_a));
+			if (existing != by_key.end () && existing->generation <= generation_a)
+			{
+				value_a = existing->value;
+				result = true;
+				entries.relocate (entries.end (), entries.template project<tag_sequence> (existing));
+			}
+		}
+		if (result)
+		{
+			++hits;
+		}
+		else
+		{
+			++misses;
+		}
+		return result;
+	}
+
+	/** Inserts a value read from the database, the caller guarantees that no commit happened since it was read */
+	void fill (uint64_t generation_a, Key const & key_a, Value const & value_a)
+	{
+		if (max > 0)
+		{
+			auto inserted (entries.template get<tag_sequence> ().push_back (entry{ key_a, value_a, generation_a }));
+			if (inserted.second)
+			{
+				trim ();
+			}
+		}
+	}
+
+	/** Records a write made by an uncommitted transaction, boost::none marks a deletion */
+	void stage (void * handle_a, Key const & key_a, boost::optional<Value> const & value_a)
+	{
+		staged[handle_a][key_a] = value_a;
+		auto invalidated_l (invalidated.find (handle_a));
+		if (invalidated_l != invalidated.end ())
+		{
+			invalidated_l->second.erase (key_a);
+		}
+	}
+
+	/** Records a write made by an uncommitted transaction whose new value is not known, lookups by that transaction go to the database */
+	void invalidate (void * handle_a, Key const & key_a)
+	{
+		auto staged_l (staged.find (handle_a));
+		if (staged_l != staged.end ())
+		{
+			staged_l->second.erase (key_a);
+		}
+		invalidated[handle_a].insert (key_a);
+	}
+
+	/** Returns true if the transaction \p handle_a has written \p key_a, values it reads for that key are not committed yet */
+	bool modified_by (void * handle_a, Key const & key_a) const
+	{
+		auto result (invalidated_by (handle_a, key_a));
+		auto staged_l (staged.find (handle_a));
+		if (!result && staged_l != staged.end ())
+		{
+			result = staged_l->second.find (key_a) != staged_l->second.end ();
+		}
+		return result;
+	}
+
+	/** Moves the writes of \p handle_a into the committed set, visible from \p generation_a onwards */
+	void publish (void * handle_a, uint64_t generation_a)
+	{
+		auto invalidated_l (invalidated.find (handle_a));
+		if (invalidated_l != invalidated.end ())
+		{
+			auto & by_key (entries.template get<tag_key> ());
+			for (auto const & key : invalidated_l->second)
+			{
+				by_key.erase (key);
+			}
+			invalidated.erase (invalidated_l);
+		}
+		auto staged_l (staged.find (handle_a));
+		if (staged_l != staged.end ())
+		{
+			auto & by_key (entries.template get<tag_key> ());
+			for (auto const & write : staged_l->second)
+			{
+				by_key.erase (write.first);
+				if (write.second && max > 0)
+				{
+					entries.template get<tag_sequence> ().push_back (entry{ write.first, *write.second, generation_a });
+				}
+			}
+			staged.erase (staged_l);
+			trim ();
+		}
+	}
+
+	void erase (Key const & key_a)
+	{
+		entries.template get<tag_key> ().erase (key_a);
+	}
+
+	void clear ()
+	{
+		entries.clear ();
+	}
+
+	size_t size () const
+	{
+		return entries.size ();
+	}
+
+	size_t const max;
+	std::atomic<uint64_t> hits{ 0 };
+	std::atomic<uint64_t> misses{ 0 };
+
+private:
+	bool invalidated_by (void * handle_a, Key const & key_a) const
+	{
+		auto invalidated_l (invalidated.find (handle_a));
+		return invalidated_l != invalidated.end () && invalidated_l->second.find (key_a) != invalidated_l->second.end ();
+	}
+
+	void trim ()
+	{
+		while (entries.size () > max)
+		{
+			entries.template get<tag_sequence> ().pop_front ();
+		}
+	}
+
+	// clang-format off
+	class tag_sequence {};
+	class tag_key {};
+	boost::multi_index_container<entry,
+	boost::multi_index::indexed_by<
+		boost::multi_index::sequenced<boost::multi_index::tag<tag_sequence>>,
+		boost::multi_index::hashed_unique<boost::multi_index::tag<tag_key>,
+			boost::multi_index::member<entry, Key, &entry::key>>>>
+	entries;
+	// clang-format on
+	std::unordered_map<void *, std::unordered_map<Key, boost::optional<Value>>> staged;
+	std::unordered_map<void *, std::unordered_set<Key>> invalidated;
+};
+
+/**
+ * Write-through cache of the account and confirmation height tables, which are read many times for every processed block,
+ * and of recently used blocks including their sideband. Cached blocks are shared between readers and must not be modified.
+ * Transactions are registered by handle together with the commit generation their snapshot is guaranteed to contain.
+ * Writes are staged per write transaction and published just before the database commit, with the generation that
+ * becomes current once the commit completes, so older snapshots keep reading from the database. A write transaction
+ * ending without a commit never publishes its staged writes.
+ */
+class store_cache final
+{
+public:
+	store_cache (size_t accounts_max_a, size_t blocks_max_a);
+	/** Generation contained in the snapshot of any transaction started from now on */
+	uint64_t generation ();
+	/** Registers a transaction whose snapshot contains at least \p generation_a */
+	void txn_start (void *, uint64_t generation_a);
+	/** Publishes the writes of a write transaction which is about to commit */
+	void txn_commit (void *);
+	/** Completes the oldest pending commit for write transactions, forgets read transactions */
+	void txn_end (void *, bool is_write_a);
+	/** Drops all committed entries, used after the database was modified outside of the store interface */
+	void clear ();
+
+	template <typename Key, typename Value>
+	bool get (futurehead::store_cache_table<Key, Value> & table_a, void * handle_a, Key const & key_a, boost::optional<Value> & value_a)
+	{
+		futurehead::lock_guard<std::mutex> guard (mutex);
+		auto result (false);
+		auto existing (transactions.find (handle_a));
+		if (existing != transactions.end ())
+		{
+			result = table_a.get (handle_a, existing->second, key_a, value_a);
+		}
+		return result;
+	}
+
+	template <typename Key, typename Value>
+	void fill (futurehead::store_cache_table<Key, Value> & table_a, void * handle_a, Key const & key_a, Value const & value_a)
+	{
+		futurehead::lock_guard<std::mutex> guard (mutex);
+		auto existing (transactions.find (handle_a));
+		// Only committed values read from the latest snapshot can be shared
+		if (existing != transactions.end () && existing->second == generation_m && pending_commits == 0 && !table_a.modified_by (handle_a, key_a))
+		{
+			table_a.fill (generation_m, key_a, value_a);
+		}
+	}
+
+	template <typename Key, typename Value>
+	void put (futurehead::store_cache_table<Key, Value> & table_a, void * handle_a, Key const & key_a, boost::optional<Value> const & value_a)
+	{
+		futurehead::lock_guard<std::mutex> guard (mutex);
+		if (transactions.find (handle_a) != transactions.end ())
+		{
+			table_a.stage (handle_a, key_a, value_a);
+		}
+		else
+		{
+			table_a.erase (key_a);
+		}
+	}
+
+	template <typename Key, typename Value>
+	void invalidate (futurehead::store_cache_table<Key, Value> & table_a, void * handle_a, Key const & key_a)
+	{
+		futurehead::lock_guard<std::mutex> guard (mutex);
+		if (transactions.find (handle_a) != transactions.end ())
+		{
+			table_a.invalidate (handle_a, key_a);
+		}
+		else
+		{
+			table_a.erase (key_a);
+		}
+	}
+
+	futurehead::store_cache_table<futurehead::account, futurehead::account_info> accounts;
+	futurehead::store_cache_table<futurehead::account, futurehead::confirmation_height_info> confirmation_heights;
+	futurehead::store_cache_table<futurehead::block_hash, std::shared_ptr<futurehead::block>> blocks;
+
+private:
+	std::mutex mutex;
+	uint64_t generation_m{ 0 };
+	/** Number of published commits which have not completed yet */
+	uint64_t pending_commits{ 0 };
+	std::unordered_map<void *, uint64_t> transactions;
+
+	friend std::unique_ptr<container_info_component> collect_container_info (store_cache &, const std::string &);
+};
+
+std::unique_ptr<container_info_component> collect_container_info (store_cache & store_cache, const std::string & name);
+}
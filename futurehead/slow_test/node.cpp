@@ -1,8 +1,12 @@
 #include <futurehead/core_test/common.hpp>
 #include <futurehead/core_test/testutil.hpp>
 #include <futurehead/crypto_lib/random_pool.hpp>
+#include <futurehead/ipc_flatbuffers_lib/flatbuffer_producer.hpp>
 #include <futurehead/lib/threading.hpp>
 #include <futurehead/node/election.hpp>
+#include <futurehead/node/ipc/flatbuffers_handler.hpp>
+#include <futurehead/node/ipc/ipc_server.hpp>
+#include <futurehead/node/json_handler.hpp>
 #include <futurehead/node/testing.hpp>
 #include <futurehead/node/transport/udp.hpp>
 
@@ -1861,3 +1865,89 @@ TEST (node, mass_block_new)
 	process_all (receive_blocks);
 	std::cout << "Receive blocks time: " << timer.stop ().count () << " " << timer.unit () << "\n\n";
 }
+
+TEST (prioritized_roots, benchmark)
+{
+	auto const count (100000);
+	futurehead::prioritized_roots roots;
+	std::vector<futurehead::qualified_root> keys;
+	keys.reserve (count);
+	std::mt19937_64 generator (1);
+	std::uniform_real_distribution<double> multipliers (1., 64.);
+	futurehead::timer<std::chrono::milliseconds> timer (futurehead::timer_state::started);
+	for (auto i (0); i < count; ++i)
+	{
+		futurehead::qualified_root root;
+		futurehead::random_pool::generate_block (root.bytes.data (), root.bytes.size ());
+		auto multiplier (multipliers (generator));
+		ASSERT_TRUE (roots.insert (futurehead::conflict_info{ root, multiplier, multiplier, nullptr, futurehead::epoch::epoch_0, 0 }).second);
+		keys.push_back (root);
+	}
+	std::cout << "Inserted " << count << " elections in " << timer.since_start ().count () << " " << timer.unit () << std::endl;
+
+	// Updates interleaved with priority passes over the top elections, as done by the request loop
+	timer.restart ();
+	for (auto i (0); i < count; ++i)
+	{
+		roots.adjusted_multiplier_set (roots.find (keys[i]), multipliers (generator));
+		if (i % 1000 == 0)
+		{
+			ASSERT_EQ (5000, roots.top (5000).size ());
+		}
+	}
+	std::cout << "Updated " << count << " elections with " << count / 1000 << " priority passes in " << timer.since_start ().count () << " " << timer.unit () << std::endl;
+
+	timer.restart ();
+	auto top (roots.top ());
+	std::cout << "Sorted all elections in " << timer.since_start ().count () << " " << timer.unit () << std::endl;
+	ASSERT_EQ (count, top.size ());
+	ASSERT_TRUE (std::is_sorted (top.begin (), top.end (), [](futurehead::conflict_info const * lhs, futurehead::conflict_info const * rhs) { return lhs->adjusted_multiplier > rhs->adjusted_multiplier; }));
+
+	timer.restart ();
+	for (auto const & root : keys)
+	{
+		roots.erase (roots.find (root));
+	}
+	std::cout << "Erased " << count << " elections in " << timer.since_start ().count () << " " << timer.unit () << std::endl;
+	ASSERT_TRUE (roots.empty ());
+}
+
+TEST (ipc, flatbuffers_account_info_benchmark)
+{
+	auto const count (20000);
+	futurehead::system system (1);
+	auto & node (*system.nodes[0]);
+	futurehead::node_rpc_config node_rpc_config;
+	futurehead::ipc::ipc_server ipc (node, node_rpc_config);
+	auto handler (std::make_shared<futurehead::ipc::flatbuffers_handler> (node, ipc, nullptr, node.config.ipc_config));
+	futureheadapi::AccountInfoT account_info;
+	account_info.account = futurehead::test_genesis_key.pub.to_account ();
+	account_info.include_representative = true;
+	account_info.include_voting_weight = true;
+	account_info.include_pending = true;
+	auto request (futurehead::ipc::flatbuffer_producer::make_buffer (account_info));
+	futurehead::timer<std::chrono::milliseconds> timer (futurehead::timer_state::started);
+	for (auto i (0); i < count; ++i)
+	{
+		std::shared_ptr<flatbuffers::FlatBufferBuilder> response;
+		handler->process (request->GetBufferPointer (), request->GetSize (), [&response](std::shared_ptr<flatbuffers::FlatBufferBuilder> fbb_a) {
+			response = fbb_a;
+		});
+		ASSERT_NE (nullptr, futureheadapi::GetEnvelope (response->GetBufferPointer ())->message_as_AccountInfoResponse ());
+	}
+	std::cout << "Answered " << count << " flatbuffers account_info queries in " << timer.since_start ().count () << " " << timer.unit () << std::endl;
+
+	std::string body ("{\"action\": \"account_info\", \"account\": \"" + futurehead::test_genesis_key.pub.to_account () + "\", \"representative\": \"true\", \"weight\": \"true\", \"pending\": \"true\"}");
+	timer.restart ();
+	for (auto i (0); i < count; ++i)
+	{
+		std::atomic<bool> done (false);
+		auto json_handler (std::make_shared<futurehead::json_handler> (node, node_rpc_config, body, [&done](std::string const & response_a) {
+			done = true;
+		}));
+		json_handler->process_request ();
+		ASSERT_TIMELY (5s, done);
+	}
+	std::cout << "Answered " << count << " json account_info queries in " << timer.since_start ().count () << " " << timer.unit () << std::endl;
+	ipc.stop ();
+}